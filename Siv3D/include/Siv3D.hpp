@@ -174,6 +174,12 @@
 // kd 木 | kd-tree
 # include <Siv3D/KDTree.hpp>
 
+// 要素の追加と削除に対応した kd 木 | Dynamic kd-tree
+# include <Siv3D/DynamicKDTree.hpp>
+
+// 空間ハッシュグリッド | Spatial hash grid
+# include <Siv3D/SpatialHashGrid2D.hpp>
+
 // Disjoint-set (Union-find) | Disjoint-set (Union–find)
 # include <Siv3D/DisjointSet.hpp>
 
@@ -192,6 +198,9 @@
 // 非同期タスク | Asynchronous task
 # include <Siv3D/AsyncTask.hpp>
 
+// タスクグループ | Task group
+# include <Siv3D/TaskGroup.hpp>
+
 // 子プロセス | Child process
 # include <Siv3D/ChildProcess.hpp>
 
@@ -348,6 +357,9 @@
 // プロファイラー | Profiler
 # include <Siv3D/Profiler.hpp>
 
+// スコーププロファイラ | Scope profiler
+# include <Siv3D/ProfilerScope.hpp>
+
 // 処理にかかった時間の測定 | Clock counter in milliseconds
 # include <Siv3D/MillisecClock.hpp>
 
@@ -387,6 +399,9 @@
 // リソースファイルの管理 | Resource files
 # include <Siv3D/Resource.hpp>
 
+// 仮想ファイルシステム | Virtual file system
+# include <Siv3D/VirtualFileSystem.hpp>
+
 // ファイル操作のイベント | File action
 # include <Siv3D/FileAction.hpp>
 
@@ -450,9 +465,27 @@
 // Zstandard 方式による可逆圧縮 | Lossless compression with Zstandard algorithm
 # include <Siv3D/Compression.hpp>
 
+// Zstandard 方式の圧縮に使う辞書 | Dictionary for Zstandard compression
+# include <Siv3D/CompressionDictionary.hpp>
+
+// Zstandard 方式によるストリーミング圧縮 | Streaming Zstandard compressor
+# include <Siv3D/ZstdWriter.hpp>
+
+// Zstandard 方式によるストリーミング展開 | Streaming Zstandard decompressor
+# include <Siv3D/ZstdReader.hpp>
+
+// 任意の位置から展開できる Zstandard 方式の圧縮 | Seekable Zstandard compressor
+# include <Siv3D/ZstdSeekableWriter.hpp>
+
+// 任意の位置から展開できる Zstandard 方式の展開 | Seekable Zstandard decompressor
+# include <Siv3D/ZstdSeekableReader.hpp>
+
 // ZIP 圧縮ファイルの読み込み | ZIP reader
 # include <Siv3D/ZIPReader.hpp>
 
+// ZIP 圧縮ファイル内のファイルの読み込み | ZIP entry reader
+# include <Siv3D/ZIPEntryReader.hpp>
+
 // ZIP 圧縮ファイルの書き出し | ZIP writer
 //# include <Siv3D/ZIPWriter.hpp> // [Siv3D ToDo]
 
@@ -474,12 +507,21 @@
 // CSV データの読み書き | CSV reader/writer
 # include <Siv3D/CSV.hpp>
 
+// 読み込み専用の CSV データ | Read-only, memory-mapped CSV data
+# include <Siv3D/CSVView.hpp>
+
 // INI データの読み書き | INI reader/writer
 # include <Siv3D/INI.hpp>
 
 // JSON データの読み書き | JSON reader/writer
 # include <Siv3D/JSON.hpp>
 
+// JSON データの逐次読み込み | Streaming JSON reader
+# include <Siv3D/JSONReader.hpp>
+
+// JSON Lines ファイルの読み込み | JSON Lines reader
+# include <Siv3D/JSONLinesReader.hpp>
+
 // JSON データの検証 | JSON validation
 # include <Siv3D/JSONValidator.hpp>
 
@@ -729,6 +771,9 @@
 // 2D 描画バッファ | Native 2D drawing buffer
 # include <Siv3D/Buffer2D.hpp>
 
+// 記録済み 2D 図形 | Retained static 2D geometry
+# include <Siv3D/StaticGeometry2D.hpp>
+
 // 2D 幾何 | 2D geometry processing
 # include <Siv3D/Geometry2D.hpp>
 
@@ -1448,6 +1493,11 @@
 // ナビメッシュ | Navigation mesh
 # include <Siv3D/NavMesh.hpp>
 
+# include <Siv3D/NavMeshAgentConfig.hpp>
+
+// ナビメッシュ上の群衆シミュレーション | Crowd simulation on a navigation mesh
+# include <Siv3D/NavMeshCrowd.hpp>
+
 //////////////////////////////////////////////////
 //
 //	シーン | Scene
@@ -1630,6 +1680,9 @@
 # include <Siv3D/SDFGlyph.hpp>
 # include <Siv3D/MSDFGlyph.hpp>
 
+// グリフキャッシュの統計情報 | Glyph cache statistics
+# include <Siv3D/GlyphCacheStat.hpp>
+
 // フォント描画方式 | Font rendering method
 # include <Siv3D/FontMethod.hpp>
 
@@ -1772,6 +1825,8 @@
 # include <Siv3D/Physics2D/P2ContactPair.hpp>
 # include <Siv3D/Physics2D/P2Contact.hpp>
 # include <Siv3D/Physics2D/P2Collision.hpp>
+# include <Siv3D/Physics2D/P2WorldStat.hpp>
+# include <Siv3D/Physics2D/P2BodyTransform.hpp>
 # include <Siv3D/Physics2D/P2World.hpp>
 # include <Siv3D/Physics2D/P2Body.hpp>
 # include <Siv3D/Physics2D/P2Shape.hpp>
@@ -16,6 +16,7 @@
 # endif
 # include <vector>
 # ifndef SIV3D_NO_CONCURRENT_API
+	# include <atomic>
 	# include <future>
 	# if SIV3D_PLATFORM(WINDOWS)
 	#	include <execution>
@@ -1101,32 +1102,40 @@ namespace s3d
 
 	# ifndef SIV3D_NO_CONCURRENT_API
 
-		/// @brief 
-		/// @tparam Fty 
-		/// @param f 
-		/// @return 
+		/// @brief 条件を満たす要素の個数を、エンジンのスレッドプールで並列に数えます。
+		/// @tparam Fty 条件を記述した関数の型
+		/// @param f 条件を記述した関数
+		/// @param grainSize 1 つのタスクが担当する要素数。`Threading::AutoGrainSize` の場合は自動で決定します。
+		/// @remark 要素数が粒度以下の場合は並列化せずに処理します。
+		/// @return 条件を満たす要素の個数
 		template <class Fty, std::enable_if_t<std::is_invocable_r_v<bool, Fty, Type>>* = nullptr>
 		[[nodiscard]]
-		size_t parallel_count_if(Fty f) const;
+		size_t parallel_count_if(Fty f, size_t grainSize = Threading::AutoGrainSize) const;
 
-		/// @brief 
-		/// @tparam Fty 
-		/// @param f 
+		/// @brief 全ての要素に対して、エンジンのスレッドプールで並列に関数を呼び出します。
+		/// @tparam Fty 呼び出す関数の型
+		/// @param f 呼び出す関数
+		/// @param grainSize 1 つのタスクが担当する要素数。`Threading::AutoGrainSize` の場合は自動で決定します。
+		/// @remark 要素数が粒度以下の場合は並列化せずに処理します。
 		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type&>>* = nullptr>
-		void parallel_each(Fty f);
+		void parallel_each(Fty f, size_t grainSize = Threading::AutoGrainSize);
 
-		/// @brief 
-		/// @tparam Fty 
-		/// @param f 
+		/// @brief 全ての要素に対して、エンジンのスレッドプールで並列に関数を呼び出します。
+		/// @tparam Fty 呼び出す関数の型
+		/// @param f 呼び出す関数
+		/// @param grainSize 1 つのタスクが担当する要素数。`Threading::AutoGrainSize` の場合は自動で決定します。
+		/// @remark 要素数が粒度以下の場合は並列化せずに処理します。
 		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>* = nullptr>
-		void parallel_each(Fty f) const;
+		void parallel_each(Fty f, size_t grainSize = Threading::AutoGrainSize) const;
 
-		/// @brief 
-		/// @tparam Fty 
-		/// @param f 
-		/// @return 
+		/// @brief 全ての要素に関数を適用した結果からなる新しい配列を、エンジンのスレッドプールで並列に作成します。
+		/// @tparam Fty 適用する関数の型
+		/// @param f 適用する関数
+		/// @param grainSize 1 つのタスクが担当する要素数。`Threading::AutoGrainSize` の場合は自動で決定します。
+		/// @remark 要素数が粒度以下の場合は並列化せずに処理します。
+		/// @return 新しい配列
 		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>* = nullptr>
-		auto parallel_map(Fty f) const;
+		auto parallel_map(Fty f, size_t grainSize = Threading::AutoGrainSize) const;
 
 	# endif
 
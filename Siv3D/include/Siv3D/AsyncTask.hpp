@@ -14,7 +14,9 @@
 
 # include <future>
 # include <type_traits>
+# include <utility>
 # include "Platform.hpp"
+# include "Threading.hpp"
 
 namespace s3d
 {
@@ -43,13 +45,16 @@ namespace s3d
 		/// @tparam ...Args 非同期処理のタスクで実行する関数の引数の型
 		/// @param f 非同期処理のタスクで実行する関数
 		/// @param ...args 非同期処理のタスクで実行する関数の引数
-		/// @remark 作成と同時にタスクが非同期で実行されます。
+		/// @remark 作成と同時にタスクがエンジンのスレッドプールで非同期に実行されます。
 		/// @remark 参照を渡す場合は `std::ref()` を使ってください。
+		/// @remark スレッドプールのワーカー数には上限があるため、終了しないループや、通信の完了を待つような長時間ブロックする処理には `std::thread` を使ってください。
 		template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<std::decay_t<Fty>, std::decay_t<Args>...>>* = nullptr>
 		SIV3D_NODISCARD_CXX20
 		explicit AsyncTask(Fty&& f, Args&&... args);
 
-		~AsyncTask() = default;
+		/// @brief デストラクタ
+		/// @remark このオブジェクトが作成したタスクが実行中の場合は、完了まで待機します（`std::async` の戻り値と同じ動作です）。
+		~AsyncTask();
 
 		AsyncTask(const base_type&) = delete;
 		
@@ -59,8 +64,12 @@ namespace s3d
 		
 		AsyncTask& operator =(const AsyncTask&) = delete;
 
+		/// @brief 非同期処理を代入します。
+		/// @remark このオブジェクトが作成したタスクが実行中の場合は、完了まで待機してから代入します。
 		AsyncTask& operator =(base_type&& other) noexcept;
 		
+		/// @brief 非同期処理を代入します。
+		/// @remark このオブジェクトが作成したタスクが実行中の場合は、完了まで待機してから代入します。
 		AsyncTask& operator =(AsyncTask&& other) noexcept;
 
 		/// @brief 非同期処理を持っているかを返します。
@@ -92,9 +101,24 @@ namespace s3d
 		[[nodiscard]]
 		std::shared_future<Type> share() noexcept;
 
+		/// @brief このタスクの完了後に、その結果を引数として実行される非同期処理のタスクを作成します。
+		/// @tparam Fty 継続するタスクで実行する関数の型
+		/// @param f 継続するタスクで実行する関数。`Type` が `void` の場合は引数なしで呼ばれます。
+		/// @remark このタスクの結果は継続するタスクに引き渡されるため、呼び出し後、このオブジェクトは非同期処理を持たない状態になります。
+		/// @remark このタスクで例外が発生した場合、継続するタスクの `get()` がその例外を送出します。
+		/// @return 継続するタスク
+		template <class Fty>
+		[[nodiscard]]
+		auto then(Fty&& f);
+
 	private:
 
 		base_type m_data;
+
+		// m_data がスレッドプールで実行中のタスクのものである場合 true. 破棄や上書きの前に完了を待つ
+		bool m_waitOnRelease = false;
+
+		void waitForRelease() const noexcept;
 	};
 
 	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<std::decay_t<Fty>, std::decay_t<Args>...>>* = nullptr>
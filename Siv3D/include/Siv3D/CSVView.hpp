@@ -0,0 +1,184 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <string>
+# include <string_view>
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "Optional.hpp"
+# include "Blob.hpp"
+# include "Parse.hpp"
+# include "Unicode.hpp"
+
+namespace s3d
+{
+	/// @brief 読み込み専用の CSV データ
+	/// @remark ファイルはメモリマップされ、各要素は文字列としてコピーされずに、データ内の範囲として保持されます。
+	/// @remark 行の区切りの検出と要素の分割は、スレッドプールを使って並列に行われます。
+	/// @remark データは UTF-8 である必要があります。クオーテーション記号で囲まれた要素は改行を含むことができ、その中の 2 つ連続したクオーテーション記号は 1 つのクオーテーション記号として扱われます。
+	class CSVView
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		CSVView();
+
+		/// @brief CSV ファイルを読み込みます。
+		/// @param path ファイルパス
+		/// @param separator 要素のセパレータ
+		/// @param quote クオーテーション記号
+		/// @param escape エスケープ記号。U'\0' の場合はエスケープ記号を使いません。
+		/// @remark セパレータ、クオーテーション記号、エスケープ記号は ASCII 文字である必要があります。
+		SIV3D_NODISCARD_CXX20
+		explicit CSVView(FilePathView path, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		/// @brief メモリ上の CSV データを読み込みます。
+		/// @param blob CSV データ
+		/// @param separator 要素のセパレータ
+		/// @param quote クオーテーション記号
+		/// @param escape エスケープ記号。U'\0' の場合はエスケープ記号を使いません。
+		SIV3D_NODISCARD_CXX20
+		explicit CSVView(Blob&& blob, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		/// @brief CSV ファイルを読み込みます。
+		/// @param path ファイルパス
+		/// @param separator 要素のセパレータ
+		/// @param quote クオーテーション記号
+		/// @param escape エスケープ記号。U'\0' の場合はエスケープ記号を使いません。
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		bool load(FilePathView path, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		/// @brief メモリ上の CSV データを読み込みます。
+		/// @param blob CSV データ
+		/// @param separator 要素のセパレータ
+		/// @param quote クオーテーション記号
+		/// @param escape エスケープ記号。U'\0' の場合はエスケープ記号を使いません。
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		bool load(Blob&& blob, char32 separator = U',', char32 quote = U'\"', char32 escape = U'\\');
+
+		/// @brief データを消去し、ファイルをクローズします。
+		void clear();
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 行数を返します。
+		/// @return 行数
+		[[nodiscard]]
+		size_t rows() const noexcept;
+
+		/// @brief 指定した行の列数を返します。
+		/// @param row 行
+		/// @return 指定した行の列数
+		[[nodiscard]]
+		size_t columns(size_t row) const noexcept;
+
+		/// @brief 指定した位置の要素を UTF-8 文字列として返します。
+		/// @param row 行
+		/// @param column 列
+		/// @param buffer クオーテーション記号やエスケープ記号の処理が必要な場合に使う作業用のバッファ
+		/// @return 要素の UTF-8 文字列。範囲外の場合は空の文字列
+		/// @remark 処理が必要ない要素の場合はデータ内を直接指し、それ以外の場合は `buffer` を指します。
+		[[nodiscard]]
+		std::string_view getUTF8(size_t row, size_t column, std::string& buffer) const;
+
+		/// @brief 指定した位置の値を読み取ります。
+		/// @tparam Type 読み取る値の型
+		/// @param row 行
+		/// @param column 列
+		/// @return 読み取った値。失敗した場合は `Type{}`
+		template <class Type = String>
+		[[nodiscard]]
+		Type get(size_t row, size_t column) const;
+
+		/// @brief 指定した位置の値を読み取ります。失敗した場合は defaultValue を返します。
+		/// @tparam Type 読み取る値の型
+		/// @tparam U デフォルトの値の型
+		/// @param row 行
+		/// @param column 列
+		/// @param defaultValue デフォルトの値
+		/// @return 読み取った値。失敗した場合はデフォルトの値
+		template <class Type, class U>
+		[[nodiscard]]
+		Type getOr(size_t row, size_t column, U&& defaultValue) const;
+
+		/// @brief 指定した位置の値を読み取ります。失敗した場合は none を返します。
+		/// @tparam Type 読み取る値の型
+		/// @param row 行
+		/// @param column 列
+		/// @return 読み取った値。失敗した場合は none
+		template <class Type>
+		[[nodiscard]]
+		Optional<Type> getOpt(size_t row, size_t column) const;
+
+		/// @brief 指定した行の全ての要素を返します。
+		/// @param row 行
+		/// @return 指定した行の要素
+		[[nodiscard]]
+		Array<String> getRow(size_t row) const;
+
+		/// @brief 指定した列の全ての行の値を読み取ります。
+		/// @tparam Type 読み取る値の型
+		/// @param column 列
+		/// @param defaultValue 要素が存在しない、または読み取りに失敗した行の値
+		/// @return 各行の値
+		/// @remark bool, 整数型, 浮動小数点数型, String の場合は、String への変換を行わずに並列に読み取ります。
+		template <class Type = String>
+		[[nodiscard]]
+		Array<Type> column(size_t column, const Type& defaultValue = Type{}) const;
+
+	private:
+
+		class CSVViewDetail;
+
+		std::shared_ptr<CSVViewDetail> pImpl;
+	};
+
+	template <>
+	[[nodiscard]]
+	Array<bool> CSVView::column<bool>(size_t column, const bool& defaultValue) const;
+
+	template <>
+	[[nodiscard]]
+	Array<int32> CSVView::column<int32>(size_t column, const int32& defaultValue) const;
+
+	template <>
+	[[nodiscard]]
+	Array<uint32> CSVView::column<uint32>(size_t column, const uint32& defaultValue) const;
+
+	template <>
+	[[nodiscard]]
+	Array<int64> CSVView::column<int64>(size_t column, const int64& defaultValue) const;
+
+	template <>
+	[[nodiscard]]
+	Array<uint64> CSVView::column<uint64>(size_t column, const uint64& defaultValue) const;
+
+	template <>
+	[[nodiscard]]
+	Array<float> CSVView::column<float>(size_t column, const float& defaultValue) const;
+
+	template <>
+	[[nodiscard]]
+	Array<double> CSVView::column<double>(size_t column, const double& defaultValue) const;
+
+	template <>
+	[[nodiscard]]
+	Array<String> CSVView::column<String>(size_t column, const String& defaultValue) const;
+}
+
+# include "detail/CSVView.ipp"
@@ -551,6 +551,18 @@ namespace s3d
 		/// @return *this
 		const Circle& drawShadow(const Vec2& offset, double blur, double spread = 0.0, const ColorF& color = ColorF{ 0.0, 0.5 }) const;
 
+		/// @brief 複数の円をまとめて描きます。
+		/// @param circles 円の一覧
+		/// @param color 円の色
+		/// @remark 各円の `draw(color)` を順に呼ぶのと同じ結果になります。円の数が多い場合は、頂点の生成をワーカースレッドで並列に行います。
+		static void DrawBatch(const Array<Circle>& circles, const ColorF& color = Palette::White);
+
+		/// @brief 複数の円を、それぞれの色でまとめて描きます。
+		/// @param circles 円の一覧
+		/// @param colors 各円の色
+		/// @remark `circles` と `colors` の要素数が異なる場合は、少ないほうの数だけ描きます。
+		static void DrawBatch(const Array<Circle>& circles, const Array<ColorF>& colors);
+
 		[[nodiscard]]
 		TexturedCircle operator ()(const Texture& texture) const;
 
@@ -13,9 +13,12 @@
 # include "Common.hpp"
 # include "StringView.hpp"
 # include "Blob.hpp"
+# include "Array.hpp"
 
 namespace s3d
 {
+	class CompressionDictionary;
+
 	namespace Compression
 	{
 		inline constexpr int32 MinLevel = 1;
@@ -24,6 +27,9 @@ namespace s3d
 
 		inline constexpr int32 MaxLevel = 22;
 
+		/// @brief `TrainDictionary()` で作成する辞書のサイズのデフォルト値（バイト）
+		inline constexpr size_t DefaultDictionarySize = (110 * 1024);
+
 		[[nodiscard]]
 		Blob Compress(const void* data, size_t size, int32 compressionLevel = DefaultLevel);
 
@@ -65,5 +71,75 @@ namespace s3d
 		bool DecompressToFile(const Blob& blob, FilePathView outputPath);
 
 		bool DecompressFileToFile(FilePathView inputPath, FilePathView outputPath);
+
+		/// @brief 辞書を使ってデータを圧縮します。
+		/// @param data 圧縮するデータの先頭ポインタ
+		/// @param size 圧縮するデータのサイズ（バイト）
+		/// @param dictionary 辞書
+		/// @return 圧縮されたデータ。失敗した場合は空の Blob
+		/// @remark 辞書の作成時に指定した圧縮レベルが使われます。圧縮の作業領域はスレッドごとに再利用されるため、小さなデータを繰り返し圧縮する用途に適しています。
+		[[nodiscard]]
+		Blob Compress(const void* data, size_t size, const CompressionDictionary& dictionary);
+
+		/// @brief 辞書を使ってデータを圧縮します。
+		/// @param data 圧縮するデータの先頭ポインタ
+		/// @param size 圧縮するデータのサイズ（バイト）
+		/// @param dst 圧縮されたデータの格納先
+		/// @param dictionary 辞書
+		/// @return 圧縮に成功した場合 true, それ以外の場合は false
+		bool Compress(const void* data, size_t size, Blob& dst, const CompressionDictionary& dictionary);
+
+		/// @brief 辞書を使ってデータを圧縮します。
+		/// @param blob 圧縮するデータ
+		/// @param dictionary 辞書
+		/// @return 圧縮されたデータ。失敗した場合は空の Blob
+		[[nodiscard]]
+		Blob Compress(const Blob& blob, const CompressionDictionary& dictionary);
+
+		/// @brief 辞書を使ってデータを圧縮します。
+		/// @param blob 圧縮するデータ
+		/// @param dst 圧縮されたデータの格納先
+		/// @param dictionary 辞書
+		/// @return 圧縮に成功した場合 true, それ以外の場合は false
+		bool Compress(const Blob& blob, Blob& dst, const CompressionDictionary& dictionary);
+
+		/// @brief 辞書を使って圧縮されたデータを展開します。
+		/// @param data 展開するデータの先頭ポインタ
+		/// @param size 展開するデータのサイズ（バイト）
+		/// @param dictionary 圧縮に使ったものと同じ辞書
+		/// @return 展開されたデータ。失敗した場合は空の Blob
+		[[nodiscard]]
+		Blob Decompress(const void* data, size_t size, const CompressionDictionary& dictionary);
+
+		/// @brief 辞書を使って圧縮されたデータを展開します。
+		/// @param data 展開するデータの先頭ポインタ
+		/// @param size 展開するデータのサイズ（バイト）
+		/// @param dst 展開されたデータの格納先
+		/// @param dictionary 圧縮に使ったものと同じ辞書
+		/// @return 展開に成功した場合 true, それ以外の場合は false
+		bool Decompress(const void* data, size_t size, Blob& dst, const CompressionDictionary& dictionary);
+
+		/// @brief 辞書を使って圧縮されたデータを展開します。
+		/// @param blob 展開するデータ
+		/// @param dictionary 圧縮に使ったものと同じ辞書
+		/// @return 展開されたデータ。失敗した場合は空の Blob
+		[[nodiscard]]
+		Blob Decompress(const Blob& blob, const CompressionDictionary& dictionary);
+
+		/// @brief 辞書を使って圧縮されたデータを展開します。
+		/// @param blob 展開するデータ
+		/// @param dst 展開されたデータの格納先
+		/// @param dictionary 圧縮に使ったものと同じ辞書
+		/// @return 展開に成功した場合 true, それ以外の場合は false
+		bool Decompress(const Blob& blob, Blob& dst, const CompressionDictionary& dictionary);
+
+		/// @brief サンプルデータから圧縮用の辞書を作成します。
+		/// @param samples 圧縮するデータと似た内容のサンプルデータ
+		/// @param dictionarySize 作成する辞書の最大サイズ（バイト）
+		/// @return 作成した辞書のデータ。失敗した場合は空の Blob
+		/// @remark ネットワークのメッセージのような、小さく似た内容のデータを数多く圧縮する場合に、圧縮率が大きく向上します。
+		/// @remark 作成した辞書のデータは保存しておき、`CompressionDictionary` に渡して使います。サンプルは数百個以上あることが望ましいです。
+		[[nodiscard]]
+		Blob TrainDictionary(const Array<Blob>& samples, size_t dictionarySize = DefaultDictionarySize);
 	}
 }
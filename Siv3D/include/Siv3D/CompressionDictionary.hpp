@@ -0,0 +1,85 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "Blob.hpp"
+# include "Compression.hpp"
+
+namespace s3d
+{
+	/// @brief Zstandard 方式の圧縮・展開に使う辞書
+	/// @remark 辞書のデータは作成時に圧縮・展開用の形式に変換されるため、同じ辞書を繰り返し使う場合は、このオブジェクトを使い回してください。
+	/// @remark コピーしたオブジェクトは同じ辞書を共有します。複数のスレッドから同時に使うことができます。
+	class CompressionDictionary
+	{
+	private:
+
+		class CompressionDictionaryDetail;
+
+	public:
+
+		/// @brief 空の辞書を作成します。
+		SIV3D_NODISCARD_CXX20
+		CompressionDictionary();
+
+		/// @brief 辞書のデータから辞書を作成します。
+		/// @param dictionary 辞書のデータ。`Compression::TrainDictionary()` で作成したもの
+		/// @param compressionLevel 圧縮に使う圧縮レベル
+		SIV3D_NODISCARD_CXX20
+		explicit CompressionDictionary(const Blob& dictionary, int32 compressionLevel = Compression::DefaultLevel);
+
+		/// @brief 辞書のデータをファイルから読み込んで辞書を作成します。
+		/// @param path 辞書のデータのファイルパス
+		/// @param compressionLevel 圧縮に使う圧縮レベル
+		SIV3D_NODISCARD_CXX20
+		explicit CompressionDictionary(FilePathView path, int32 compressionLevel = Compression::DefaultLevel);
+
+		/// @brief 辞書が空であるかを返します。
+		/// @return 辞書が空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 辞書が空でないかを返します。
+		/// @return 辞書が空でない場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 辞書の ID を返します。
+		/// @return 辞書の ID。`Compression::TrainDictionary()` で作成したものでない場合は 0
+		[[nodiscard]]
+		uint32 id() const noexcept;
+
+		/// @brief 圧縮に使う圧縮レベルを返します。
+		/// @return 圧縮レベル
+		[[nodiscard]]
+		int32 compressionLevel() const noexcept;
+
+		/// @brief 辞書のデータを返します。
+		/// @return 辞書のデータ
+		[[nodiscard]]
+		const Blob& getBlob() const noexcept;
+
+		//////////////////////////////////////////////////
+		//
+		//	detail
+		//
+		//////////////////////////////////////////////////
+
+		[[nodiscard]]
+		const CompressionDictionaryDetail& _detail() const noexcept;
+
+	private:
+
+		std::shared_ptr<CompressionDictionaryDetail> pImpl;
+	};
+}
@@ -18,6 +18,8 @@
 
 namespace s3d
 {
+	/// @brief フォントと、シェーピング済みの文字列のペア
+	/// @remark 同じ文字列を毎フレーム描画する場合は、DrawableText を保持して使い回すとシェーピングを完全に省略できます。
 	struct DrawableText
 	{
 		Font font;
@@ -0,0 +1,142 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "KDTree.hpp"
+
+namespace s3d
+{
+	/// @brief 要素の追加と削除に対応した kd-tree
+	/// @tparam DatasetAdapter kd-tree 用のアダプタ型
+	/// @remark データセットの末尾に追加した要素は `addPoints()` で、不要になった要素は `removePoint()` でツリーに反映します。ツリー全体の再構築は発生しません。
+	/// @remark 要素を移動する場合は、古い要素を `removePoint()` で削除し、新しい位置の要素をデータセットの末尾に追加して `addPoints()` で反映します。
+	/// @remark ほぼすべての要素が毎回移動する場合は、`KDTree::rebuildIndex()` で再構築するほうが効率的です。
+	template <class DatasetAdapter>
+	class DynamicKDTree
+	{
+	public:
+
+		using adapter_type	= detail::KDAdapter<DatasetAdapter>;
+
+		using point_type	= typename adapter_type::point_type;
+
+		using element_type	= typename adapter_type::element_type;
+
+		using dataset_type	= typename adapter_type::dataset_type;
+
+		static constexpr int32 Dimensions = adapter_type::Dimensions;
+
+		/// @brief デフォルトコンストラクタ
+		DynamicKDTree() = default;
+
+		/// @brief kd-tree を構築します。
+		/// @param dataset データセット
+		explicit DynamicKDTree(const dataset_type& dataset);
+
+		/// @brief データセットの末尾に追加された要素をツリーに追加します。
+		/// @param count 追加する要素の個数
+		void addPoints(size_t count);
+
+		/// @brief 要素をツリーから削除します。
+		/// @param index 削除する要素のインデックス
+		/// @remark データセットから要素を取り除く必要はありません。削除した要素のインデックスは再利用されません。
+		void removePoint(size_t index);
+
+		/// @brief kd-tree を消去し、メモリから解放します。
+		void release();
+
+		/// @brief ツリーに含まれる（削除されていない）要素の個数を返します。
+		/// @return ツリーに含まれる要素の個数
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief ツリーが空であるかを返します。
+		/// @return ツリーが空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 指定した座標から最も近い k 個の要素を検索して返します。
+		/// @param k 検索する個数
+		/// @param point 座標
+		/// @return 見つかった要素一覧
+		[[nodiscard]]
+		Array<size_t> knnSearch(size_t k, const point_type& point) const;
+
+		/// @brief 指定した座標から最も近い k 個の要素を検索して取得します。
+		/// @param results 結果を格納する配列
+		/// @param k 検索する個数
+		/// @param point 中心座標
+		void knnSearch(Array<size_t>& results, size_t k, const point_type& point) const;
+
+		/// @brief 指定した座標から最も近い k 個の要素を検索して取得します。
+		/// @param results 結果を格納する配列
+		/// @param distanceSqResults それぞれの要素について、中心からの距離の二乗を格納する配列
+		/// @param k 検索する個数
+		/// @param point 中心座標
+		void knnSearch(Array<size_t>& results, Array<element_type>& distanceSqResults, size_t k, const point_type& point) const;
+
+		/// @brief 指定した座標から指定した半径以内にある要素一覧を検索して返します。
+		/// @param point 中心座標
+		/// @param radius 半径
+		/// @param sortByDistance 結果を中心座標から近い順にソートする場合 `SortByDistance::Yes`, それ以外の場合は `SortByDistance::No`
+		/// @return 指定した位置から指定した半径以内にある要素一覧
+		[[nodiscard]]
+		Array<size_t> radiusSearch(const point_type& point, element_type radius, SortByDistance sortByDistance = SortByDistance::No) const;
+
+		/// @brief 指定した座標から指定した半径以内にある要素一覧を検索して取得します。
+		/// @param results 結果を格納する配列
+		/// @param point 中心座標
+		/// @param radius 半径
+		/// @param sortByDistance 結果を中心座標から近い順にソートする場合 `SortByDistance::Yes`, それ以外の場合は `SortByDistance::No`
+		void radiusSearch(Array<size_t>& results, const point_type& point, element_type radius, SortByDistance sortByDistance = SortByDistance::No) const;
+
+		/// @brief 複数の座標それぞれについて、最も近い k 個の要素をスレッドプールで並列に検索します。
+		/// @param results 結果を格納する配列。i 番目の座標の結果は [i * n, (i + 1) * n) に、近い順に格納されます（n は戻り値）
+		/// @param k 検索する個数
+		/// @param points 中心座標の一覧
+		/// @return 1 つの座標あたりの結果の個数（k と要素数の小さいほう）
+		size_t knnSearchBatch(Array<size_t>& results, size_t k, const Array<point_type>& points) const;
+
+		/// @brief 複数の座標それぞれについて、最も近い k 個の要素をスレッドプールで並列に検索します。
+		/// @param results 結果を格納する配列。i 番目の座標の結果は [i * n, (i + 1) * n) に、近い順に格納されます（n は戻り値）
+		/// @param distanceSqResults それぞれの要素について、中心からの距離の二乗を results と同じ並びで格納する配列
+		/// @param k 検索する個数
+		/// @param points 中心座標の一覧
+		/// @return 1 つの座標あたりの結果の個数（k と要素数の小さいほう）
+		size_t knnSearchBatch(Array<size_t>& results, Array<element_type>& distanceSqResults, size_t k, const Array<point_type>& points) const;
+
+		/// @brief 複数の座標それぞれについて、指定した半径以内にある要素一覧をスレッドプールで並列に検索します。
+		/// @param results 結果を格納する配列。i 番目の座標の結果は [offsets[i], offsets[i + 1]) に格納されます
+		/// @param offsets 各座標の結果の開始位置を格納する配列。要素数は `points.size() + 1` になります
+		/// @param points 中心座標の一覧
+		/// @param radius 半径
+		/// @param sortByDistance 結果を中心座標から近い順にソートする場合 `SortByDistance::Yes`, それ以外の場合は `SortByDistance::No`
+		void radiusSearchBatch(Array<size_t>& results, Array<size_t>& offsets, const Array<point_type>& points, element_type radius, SortByDistance sortByDistance = SortByDistance::No) const;
+
+	private:
+
+		using index_type = nanoflann::KDTreeSingleIndexDynamicAdaptor<nanoflann::L2_Simple_Adaptor<element_type, adapter_type, double>, adapter_type, Dimensions, size_t>;
+
+		// インデックスはアダプタへの参照を持つため、ムーブしてもアドレスが変わらないようにヒープに置く
+		std::unique_ptr<adapter_type> m_adapter;
+
+		std::unique_ptr<index_type> m_index;
+
+		// 削除済みの要素
+		Array<bool> m_removed;
+
+		size_t m_numRemoved = 0;
+	};
+}
+
+# include "detail/DynamicKDTree.ipp"
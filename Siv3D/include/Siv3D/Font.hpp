@@ -19,6 +19,7 @@
 # include "Typeface.hpp"
 # include "TextStyle.hpp"
 # include "Glyph.hpp"
+# include "GlyphCacheStat.hpp"
 # include "PredefinedYesNo.hpp"
 
 namespace s3d
@@ -406,12 +407,19 @@ namespace s3d
 		bool preload(StringView chars) const;
 
 		/// @brief フォントの内部でキャッシュされているテクスチャを返します。
+		/// @remark キャッシュが複数のテクスチャに分かれている場合は、最初のテクスチャを返します。
 		/// @return フォントの内部でキャッシュされているテクスチャ
 		[[nodiscard]]
 		const Texture& getTexture() const;
 
+		/// @brief フォントの内部のグリフキャッシュの統計情報を返します。
+		/// @return グリフキャッシュの統計情報
+		[[nodiscard]]
+		GlyphCacheStat getGlyphCacheStat() const;
+
 		/// @brief 指定した文字の描画用のグリフを返します。
 		/// @param ch 文字
+		/// @remark グリフのテクスチャ領域は、呼び出したフレームの間は有効です。グリフキャッシュがいっぱいになると、以降のフレームで別のグリフに再利用されることがあるため、グリフは毎フレーム取得してください。
 		/// @return 描画用グリフ
 		[[nodiscard]]
 		Glyph getGlyph(char32 ch) const;
@@ -419,6 +427,7 @@ namespace s3d
 		/// @brief 指定した文字の描画用のグリフを返します。
 		/// @param ch 文字
 		/// @remark char32 型の要素 1 つでは表現できない文字のための関数です。
+		/// @remark グリフのテクスチャ領域は、呼び出したフレームの間は有効です。グリフキャッシュがいっぱいになると、以降のフレームで別のグリフに再利用されることがあるため、グリフは毎フレーム取得してください。
 		/// @return 描画用グリフ
 		[[nodiscard]]
 		Glyph getGlyph(StringView ch) const;
@@ -426,6 +435,7 @@ namespace s3d
 		/// @brief 指定した文字列の描画用のグリフ配列を返します。
 		/// @param s 文字列
 		/// @param ligature リガチャ（合字）を有効にするか
+		/// @remark グリフのテクスチャ領域は、呼び出したフレームの間は有効です。グリフキャッシュがいっぱいになると、以降のフレームで別のグリフに再利用されることがあるため、グリフは毎フレーム取得してください。
 		/// @return 指定した文字列の描画用のグリフ配列
 		[[nodiscard]]
 		Array<Glyph> getGlyphs(StringView s, Ligature ligature = Ligature::No) const;
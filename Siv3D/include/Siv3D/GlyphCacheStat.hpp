@@ -0,0 +1,45 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief フォントのグリフキャッシュの統計情報
+	struct GlyphCacheStat
+	{
+		/// @brief キャッシュされているグリフの数
+		size_t glyphCount = 0;
+
+		/// @brief グリフを格納するテクスチャのページ数
+		size_t pageCount = 0;
+
+		/// @brief キャッシュ済みのグリフが使われた回数
+		uint64 hitCount = 0;
+
+		/// @brief グリフを新しくレンダリングした回数
+		uint64 missCount = 0;
+
+		/// @brief 空き領域を作るためにキャッシュから追い出されたグリフの数
+		uint64 evictedCount = 0;
+
+		/// @brief テクスチャに転送した画像のバイト数
+		uint64 uploadedBytes = 0;
+
+		/// @brief キャッシュのヒット率を返します。
+		/// @return キャッシュのヒット率 [0.0, 1.0]。グリフが一度も使われていない場合は 0.0
+		[[nodiscard]]
+		constexpr double hitRate() const noexcept;
+	};
+}
+
+# include "detail/GlyphCacheStat.ipp"
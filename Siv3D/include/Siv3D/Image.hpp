@@ -759,6 +759,44 @@ namespace s3d
 		[[nodiscard]]
 		Image warpPerspective(const Quad& quad, const Color& background = Color{ 0, 0 }) const;
 
+		/// @brief 画像全体を拡大縮小して、別の画像に書き込みます。
+		/// @param dst 書き込み先の画像。この画像全体が dst と同じサイズに拡大縮小されます
+		/// @param interpolation 補間アルゴリズム
+		/// @remark 一時的な画像を作らず、書き込み先をタイルに分割して複数のスレッドで処理します。
+		void scaleTo(Image& dst, InterpolationAlgorithm interpolation = InterpolationAlgorithm::Auto) const;
+
+		/// @brief 画像全体を拡大縮小して、別の画像の一部の領域に書き込みます。
+		/// @param dst 書き込み先の領域。この画像全体が領域と同じサイズに拡大縮小されます
+		/// @param interpolation 補間アルゴリズム
+		/// @remark 一時的な画像を作らず、書き込み先をタイルに分割して複数のスレッドで処理します。
+		void scaleTo(const ImageROI& dst, InterpolationAlgorithm interpolation = InterpolationAlgorithm::Auto) const;
+
+		/// @brief アフィン変換した画像を、別の画像に書き込みます。
+		/// @param dst 書き込み先の画像
+		/// @param mat この画像の座標から書き込み先の座標への変換
+		/// @param background この画像の範囲外に対応するピクセルの色
+		/// @remark OpenCV を使う `warpAffine()` とは別の実装で、座標と重みの丸め方が異なるため、同じ変換の結果は各チャンネル ±1 の範囲で異なることがあります。
+		void warpAffineTo(Image& dst, const Mat3x2& mat, const Color& background = Color{ 0, 0 }) const;
+
+		/// @brief アフィン変換した画像を、別の画像の一部の領域に書き込みます。
+		/// @param dst 書き込み先の領域
+		/// @param mat この画像の座標から、書き込み先の領域の左上を原点とする座標への変換
+		/// @param background この画像の範囲外に対応するピクセルの色
+		void warpAffineTo(const ImageROI& dst, const Mat3x2& mat, const Color& background = Color{ 0, 0 }) const;
+
+		/// @brief 四隅を quad に合わせて射影変換した画像を、別の画像に書き込みます。
+		/// @param dst 書き込み先の画像
+		/// @param quad 書き込み先の座標で表した、この画像の四隅の移動先
+		/// @param background この画像の範囲外に対応するピクセルの色
+		/// @remark OpenCV を使う `warpPerspective()` とは別の実装で、同じ変換の結果は各チャンネル ±1 の範囲で異なることがあります。
+		void warpPerspectiveTo(Image& dst, const Quad& quad, const Color& background = Color{ 0, 0 }) const;
+
+		/// @brief 四隅を quad に合わせて射影変換した画像を、別の画像の一部の領域に書き込みます。
+		/// @param dst 書き込み先の領域
+		/// @param quad 書き込み先の領域の左上を原点とする座標で表した、この画像の四隅の移動先
+		/// @param background この画像の範囲外に対応するピクセルの色
+		void warpPerspectiveTo(const ImageROI& dst, const Quad& quad, const Color& background = Color{ 0, 0 }) const;
+
 		void paint(Image& dst, int32 x, int32 y, const Color& color = Palette::White) const;
 
 		void paint(Image& dst, const Point& pos, const Color& color = Palette::White) const;
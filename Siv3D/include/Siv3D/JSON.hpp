@@ -668,6 +668,7 @@ namespace s3d
 		/// @param [in] path ファイルパス
 		/// @param [in] allowExceptions 例外を発生させるか
 		/// @return JSON オブジェクト
+		/// @remark ファイルをメモリマップし、UTF-8 のバイト列を文字列に変換せずに直接パースします。
 		[[nodiscard]]
 		static JSON Load(FilePathView path, AllowExceptions allowExceptions = AllowExceptions::No);
 
@@ -678,6 +679,13 @@ namespace s3d
 		[[nodiscard]]
 		static JSON Load(std::unique_ptr<IReader>&& reader, AllowExceptions allowExceptions = AllowExceptions::No);
 
+		/// @brief メモリ上の JSON データをパースして JSON オブジェクトを返します。
+		/// @param [in] blob JSON データ（UTF-8, または BOM 付きの UTF-16）
+		/// @param [in] allowExceptions 例外を発生させるか
+		/// @return JSON オブジェクト
+		[[nodiscard]]
+		static JSON Load(const Blob& blob, AllowExceptions allowExceptions = AllowExceptions::No);
+
 		/// @brief JSON 文字列をパースして JSON オブジェクトを返します。
 		/// @param [in] str 文字列
 		/// @param [in] allowExceptions 例外を発生させるか
@@ -685,6 +693,14 @@ namespace s3d
 		[[nodiscard]]
 		static JSON Parse(StringView str, AllowExceptions allowExceptions = AllowExceptions::No);
 
+		/// @brief UTF-8 の JSON 文字列をパースして JSON オブジェクトを返します。
+		/// @param [in] str UTF-8 文字列
+		/// @param [in] allowExceptions 例外を発生させるか
+		/// @return JSON オブジェクト
+		/// @remark 先頭の BOM は無視されます。
+		[[nodiscard]]
+		static JSON ParseUTF8(std::string_view str, AllowExceptions allowExceptions = AllowExceptions::No);
+
 		/// @brief BSON 形式のデータから JSON オブジェクトをデシリアライズします。
 		/// @param [in] bson BSON データ
 		/// @param [in] allowExceptions 例外を発生させるか
@@ -0,0 +1,119 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "Array.hpp"
+# include "JSON.hpp"
+# include "IReader.hpp"
+# include "PredefinedYesNo.hpp"
+
+namespace s3d
+{
+	/// @brief JSON Lines 形式（1 行に 1 つの JSON）のデータを 1 行ずつ読み込むクラス
+	/// @remark データは一定サイズのブロックごとに読み込まれるため、使用するメモリはファイル全体の大きさではなく、読み込む行数と最も長い行の長さで決まります。
+	/// @remark データは UTF-8 である必要があります。空白のみの行は読み飛ばします。
+	class JSONLinesReader
+	{
+	public:
+
+		/// @brief `readBatch()` で一度に読み込む行数のデフォルト値
+		static constexpr size_t DefaultBatchSize = 4096;
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		JSONLinesReader();
+
+		/// @brief JSON Lines ファイルをオープンします。
+		/// @param path ファイルパス
+		SIV3D_NODISCARD_CXX20
+		explicit JSONLinesReader(FilePathView path);
+
+		/// @brief JSON Lines データを IReader 経由でオープンします。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader IReader オブジェクト
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		SIV3D_NODISCARD_CXX20
+		explicit JSONLinesReader(Reader&& reader);
+
+		/// @brief JSON Lines データを IReader 経由でオープンします。
+		/// @param reader IReader オブジェクト
+		SIV3D_NODISCARD_CXX20
+		explicit JSONLinesReader(std::unique_ptr<IReader>&& reader);
+
+		/// @brief JSON Lines ファイルをオープンします。
+		/// @param path ファイルパス
+		/// @return ファイルのオープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path);
+
+		/// @brief JSON Lines データを IReader 経由でオープンします。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader IReader オブジェクト
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		bool open(Reader&& reader);
+
+		/// @brief JSON Lines データを IReader 経由でオープンします。
+		/// @param reader IReader オブジェクト
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IReader>&& reader);
+
+		/// @brief JSON Lines ファイルをクローズします。
+		void close();
+
+		/// @brief JSON Lines ファイルがオープンしているかを返します。
+		/// @return オープンしている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		/// @brief JSON Lines ファイルがオープンしているかを返します。
+		/// @return オープンしている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 次の行を読み込んで JSON としてパースします。
+		/// @return パースした JSON。パースに失敗した行では無効な JSON, 最後まで読み込んだ場合は none
+		[[nodiscard]]
+		Optional<JSON> readLine();
+
+		/// @brief 次の行を読み込んで JSON としてパースします。
+		/// @param value パースした JSON の格納先。パースに失敗した行では無効な JSON になります。
+		/// @return 行を読み込んだ場合 true, 最後まで読み込んだ場合は false
+		bool readLine(JSON& value);
+
+		/// @brief 最大 `maxLines` 行を読み込み、それぞれを JSON としてパースします。
+		/// @param values パースした JSON の格納先。パースに失敗した行では無効な JSON になります。
+		/// @param maxLines 読み込む最大の行数
+		/// @param parallel スレッドプールを使って並列にパースするか
+		/// @return 読み込んだ行数。最後まで読み込んだ場合は 0
+		/// @remark 結果の順序はファイル内の行の順序と同じです。
+		size_t readBatch(Array<JSON>& values, size_t maxLines = DefaultBatchSize, Parallel parallel = Parallel::Yes);
+
+		/// @brief 最後に読み込んだ行の行番号（1 から始まる）を返します。
+		/// @return 最後に読み込んだ行の行番号。まだ読み込んでいない場合は 0
+		[[nodiscard]]
+		size_t lineNumber() const noexcept;
+
+		/// @brief オープンしているファイルのパスを返します。
+		/// @return オープンしているファイルのパス。IReader からオープンしている場合は空の文字列
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		class JSONLinesReaderDetail;
+
+		std::shared_ptr<JSONLinesReaderDetail> pImpl;
+	};
+}
+
+# include "detail/JSONLinesReader.ipp"
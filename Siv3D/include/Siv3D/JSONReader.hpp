@@ -0,0 +1,164 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "String.hpp"
+# include "Number.hpp"
+# include "IReader.hpp"
+
+namespace s3d
+{
+	/// @brief JSONReader が読み込んだ JSON のイベントを受け取るハンドラのインタフェース
+	/// @remark 各関数が false を返すと、読み込みを中断します。
+	/// @remark オーバーライドしなかった関数は何もせずに true を返します。
+	class IJSONHandler
+	{
+	public:
+
+		virtual ~IJSONHandler() = default;
+
+		/// @brief null を読み込んだときに呼ばれます。
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onNull();
+
+		/// @brief 真偽値を読み込んだときに呼ばれます。
+		/// @param value 値
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onBool(bool value);
+
+		/// @brief 符号付き整数を読み込んだときに呼ばれます。
+		/// @param value 値
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onInt(int64 value);
+
+		/// @brief 0 以上の整数を読み込んだときに呼ばれます。
+		/// @param value 値
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		/// @remark デフォルトでは、値が int64 で表せる場合は `onInt()` を、それ以外の場合は `onFloat()` を呼びます。
+		virtual bool onUInt(uint64 value);
+
+		/// @brief 浮動小数点数を読み込んだときに呼ばれます。
+		/// @param value 値
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onFloat(double value);
+
+		/// @brief 文字列を読み込んだときに呼ばれます。
+		/// @param value 値。関数から戻った後は無効になります。
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onString(StringView value);
+
+		/// @brief オブジェクトの開始を読み込んだときに呼ばれます。
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onBeginObject();
+
+		/// @brief オブジェクトのキーを読み込んだときに呼ばれます。
+		/// @param key キー。関数から戻った後は無効になります。
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onKey(StringView key);
+
+		/// @brief オブジェクトの終了を読み込んだときに呼ばれます。
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onEndObject();
+
+		/// @brief 配列の開始を読み込んだときに呼ばれます。
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onBeginArray();
+
+		/// @brief 配列の終了を読み込んだときに呼ばれます。
+		/// @return 読み込みを続ける場合 true, 中断する場合 false
+		virtual bool onEndArray();
+	};
+
+	/// @brief JSON を DOM を構築せずに先頭から読み込み、イベントとしてハンドラに通知するクラス（SAX 形式）
+	/// @remark データは一定サイズのブロックごとに読み込まれるため、ファイルの大きさにかかわらず使用するメモリは一定です。
+	/// @remark データは UTF-8 である必要があります。
+	class JSONReader
+	{
+	public:
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		JSONReader();
+
+		/// @brief JSON ファイルをオープンします。
+		/// @param path ファイルパス
+		SIV3D_NODISCARD_CXX20
+		explicit JSONReader(FilePathView path);
+
+		/// @brief JSON データを IReader 経由でオープンします。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader IReader オブジェクト
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		SIV3D_NODISCARD_CXX20
+		explicit JSONReader(Reader&& reader);
+
+		/// @brief JSON データを IReader 経由でオープンします。
+		/// @param reader IReader オブジェクト
+		SIV3D_NODISCARD_CXX20
+		explicit JSONReader(std::unique_ptr<IReader>&& reader);
+
+		/// @brief JSON ファイルをオープンします。
+		/// @param path ファイルパス
+		/// @return ファイルのオープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path);
+
+		/// @brief JSON データを IReader 経由でオープンします。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader IReader オブジェクト
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		bool open(Reader&& reader);
+
+		/// @brief JSON データを IReader 経由でオープンします。
+		/// @param reader IReader オブジェクト
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IReader>&& reader);
+
+		/// @brief JSON ファイルをクローズします。
+		void close();
+
+		/// @brief JSON ファイルがオープンしているかを返します。
+		/// @return オープンしている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		/// @brief JSON ファイルがオープンしているかを返します。
+		/// @return オープンしている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief JSON データを最後まで読み込み、イベントをハンドラに通知します。
+		/// @param handler ハンドラ
+		/// @return 最後まで読み込んだ場合 true, パースエラーが発生したか、ハンドラが読み込みを中断した場合は false
+		/// @remark データは先頭から一度だけ読み込まれます。読み込み後はファイルがクローズされます。
+		bool read(IJSONHandler& handler);
+
+		/// @brief 直前の `read()` で発生したパースエラーの内容を返します。
+		/// @return パースエラーの内容。エラーが発生していない場合は空の文字列
+		[[nodiscard]]
+		const String& lastError() const noexcept;
+
+		/// @brief オープンしているファイルのパスを返します。
+		/// @return オープンしているファイルのパス。IReader からオープンしている場合は空の文字列
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		class JSONReaderDetail;
+
+		std::shared_ptr<JSONReaderDetail> pImpl;
+	};
+}
+
+# include "detail/JSONReader.ipp"
@@ -14,6 +14,7 @@
 # include "Array.hpp"
 # include "YesNo.hpp"
 # include "PredefinedYesNo.hpp"
+# include "Threading.hpp"
 # include <ThirdParty/nanoflann/nanoflann.hpp>
 
 namespace s3d
@@ -125,6 +126,30 @@ namespace s3d
 		/// @param sortByDistance 結果を中心座標から近い順にソートする場合 `SortByDistance::Yes`, それ以外の場合は `SortByDistance::No`
 		void radiusSearch(Array<size_t>& results, const point_type& point, element_type radius, const SortByDistance sortByDistance = SortByDistance::No) const;
 
+		/// @brief 複数の座標それぞれについて、最も近い k 個の要素をスレッドプールで並列に検索します。
+		/// @param results 結果を格納する配列。i 番目の座標の結果は [i * n, (i + 1) * n) に、近い順に格納されます（n は戻り値）
+		/// @param k 検索する個数
+		/// @param points 中心座標の一覧
+		/// @return 1 つの座標あたりの結果の個数（k と要素数の小さいほう）
+		size_t knnSearchBatch(Array<size_t>& results, size_t k, const Array<point_type>& points) const;
+
+		/// @brief 複数の座標それぞれについて、最も近い k 個の要素をスレッドプールで並列に検索します。
+		/// @param results 結果を格納する配列。i 番目の座標の結果は [i * n, (i + 1) * n) に、近い順に格納されます（n は戻り値）
+		/// @param distanceSqResults それぞれの要素について、中心からの距離の二乗を results と同じ並びで格納する配列
+		/// @param k 検索する個数
+		/// @param points 中心座標の一覧
+		/// @return 1 つの座標あたりの結果の個数（k と要素数の小さいほう）
+		size_t knnSearchBatch(Array<size_t>& results, Array<element_type>& distanceSqResults, size_t k, const Array<point_type>& points) const;
+
+		/// @brief 複数の座標それぞれについて、指定した半径以内にある要素一覧をスレッドプールで並列に検索します。
+		/// @param results 結果を格納する配列。i 番目の座標の結果は [offsets[i], offsets[i + 1]) に格納されます
+		/// @param offsets 各座標の結果の開始位置を格納する配列。要素数は `points.size() + 1` になります
+		/// @param points 中心座標の一覧
+		/// @param radius 半径
+		/// @param sortByDistance 結果を中心座標から近い順にソートする場合 `SortByDistance::Yes`, それ以外の場合は `SortByDistance::No`
+		/// @remark 検索ごとの配列の確保は行わないため、多数の検索を 1 つずつ行うよりも高速です。
+		void radiusSearchBatch(Array<size_t>& results, Array<size_t>& offsets, const Array<point_type>& points, element_type radius, SortByDistance sortByDistance = SortByDistance::No) const;
+
 	private:
 
 		adapter_type m_adapter;
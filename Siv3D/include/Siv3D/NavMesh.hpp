@@ -14,10 +14,12 @@
 # include "NavMeshConfig.hpp"
 # include "TriangleIndex.hpp"
 # include "Polygon.hpp"
+# include "Blob.hpp"
 
 namespace s3d
 {
 	/// @brief ナビメッシュ
+	/// @remark 経路の計算は、複数のスレッドから同時に行うことができます。ただし、構築や読み込みと同時に行うことはできません。
 	class NavMesh
 	{
 	public:
@@ -156,10 +158,61 @@ namespace s3d
 		/// @param areaCosts エリアのコスト
 		void query(const Vec3& start, const Vec3& end, Array<Vec3>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
 
+		/// @brief 複数の経路を、複数のスレッドで並列に計算します。
+		/// @param startEnds 各経路の出発地点と目的地の座標
+		/// @param areaCosts エリアのコスト
+		/// @return ナビメッシュ上の経路の配列。`startEnds` と同じ順に並びます。
+		[[nodiscard]]
+		Array<Array<Vec2>> query(const Array<std::pair<Vec2, Vec2>>& startEnds, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の経路を、複数のスレッドで並列に計算します。
+		/// @remark 毎フレーム同じ `dst` を渡すと、各経路のメモリが再利用されます。
+		/// @param startEnds 各経路の出発地点と目的地の座標
+		/// @param dst 経路の格納先。`startEnds` と同じ順に並びます。
+		/// @param areaCosts エリアのコスト
+		void query(const Array<std::pair<Vec2, Vec2>>& startEnds, Array<Array<Vec2>>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の経路を、複数のスレッドで並列に計算します。
+		/// @param startEnds 各経路の出発地点と目的地の座標
+		/// @param areaCosts エリアのコスト
+		/// @return ナビメッシュ上の経路の配列。`startEnds` と同じ順に並びます。
+		[[nodiscard]]
+		Array<Array<Vec3>> query(const Array<std::pair<Vec3, Vec3>>& startEnds, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 複数の経路を、複数のスレッドで並列に計算します。
+		/// @remark 毎フレーム同じ `dst` を渡すと、各経路のメモリが再利用されます。
+		/// @param startEnds 各経路の出発地点と目的地の座標
+		/// @param dst 経路の格納先。`startEnds` と同じ順に並びます。
+		/// @param areaCosts エリアのコスト
+		void query(const Array<std::pair<Vec3, Vec3>>& startEnds, Array<Array<Vec3>>& dst, const Array<std::pair<int32, double>>& areaCosts = {}) const;
+
+		/// @brief 構築済みのナビメッシュのデータをバイナリとして返します。
+		/// @remark `load()` で読み込むと、地形データから構築し直さずにナビメッシュを復元できます。
+		/// @return ナビメッシュのデータ。ナビメッシュが構築されていない場合は空のバイナリ
+		[[nodiscard]]
+		Blob toBlob() const;
+
+		/// @brief 構築済みのナビメッシュのデータをファイルに保存します。
+		/// @param path ファイルパス
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool save(FilePathView path) const;
+
+		/// @brief `toBlob()` で作成したデータからナビメッシュを復元します。
+		/// @param blob ナビメッシュのデータ
+		/// @return 復元に成功した場合 true, それ以外の場合は false
+		bool load(const Blob& blob);
+
+		/// @brief `save()` で保存したファイルからナビメッシュを復元します。
+		/// @param path ファイルパス
+		/// @return 復元に成功した場合 true, それ以外の場合は false
+		bool load(FilePathView path);
+
 	private:
 
 		class NavMeshDetail;
 
 		std::shared_ptr<NavMeshDetail> pImpl;
+
+		friend class NavMeshCrowd;
 	};
 }
@@ -0,0 +1,34 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+
+namespace s3d
+{
+	/// @brief `NavMeshCrowd` のエージェントの設定
+	struct NavMeshAgentConfig
+	{
+		/// @brief エージェントの半径
+		/// @remark エージェントどうしは、互いの半径の和より近づかないように押し戻されます。
+		double radius = 0.5;
+
+		/// @brief 最大の移動速度（1 秒あたりの距離）
+		double maxSpeed = 3.5;
+
+		/// @brief 最大の加速度（1 秒あたりの速度の変化）
+		double maxAcceleration = 8.0;
+
+		/// @brief 周囲のエージェントから離れようとする強さ
+		/// @remark 半径の 4 倍以内にいるエージェントから、近いほど強く離れようとします。0 の場合は離れようとしません。
+		double separationWeight = 2.0;
+	};
+}
@@ -31,5 +31,10 @@ namespace s3d
 		/// @brief エージェントの半径
 		/// @remark これより狭い経路を通過できません
 		double agentRadius = 0.25;
+
+		/// @brief タイル 1 枚の一辺のセル数
+		/// @remark 0 の場合はタイルに分割せず、全体を 1 枚のメッシュとして構築します。
+		/// @remark 0 より大きい場合は地形をタイルに分割し、タイルごとに複数のスレッドで並列に構築します。広い地形ではこちらのほうが高速です。
+		int32 tileSize = 0;
 	};
 }
@@ -0,0 +1,125 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "Array.hpp"
+# include "PointVector.hpp"
+# include "Optional.hpp"
+# include "Scene.hpp"
+# include "NavMesh.hpp"
+# include "NavMeshAgentConfig.hpp"
+
+namespace s3d
+{
+	/// @brief `NavMeshCrowd` のエージェントに与えられる一意の ID の型
+	using NavMeshAgentID = uint32;
+
+	/// @brief 2D のナビメッシュ上を移動する、多数のエージェントの群衆シミュレーション
+	/// @remark 各エージェントは目的地までの経路に沿って進み、周囲のエージェントを避けながら移動します。
+	/// @remark `update()` では、すべてのエージェントを複数のスレッドで並列に更新します。
+	class NavMeshCrowd
+	{
+	public:
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		NavMeshCrowd();
+
+		/// @brief 群衆シミュレーションを作成します。
+		/// @param navMesh エージェントが移動するナビメッシュ
+		/// @remark ナビメッシュを構築し直した場合は、エージェントを追加し直す必要があります。
+		SIV3D_NODISCARD_CXX20
+		explicit NavMeshCrowd(const NavMesh& navMesh);
+
+		/// @brief デストラクタ
+		~NavMeshCrowd();
+
+		/// @brief エージェントの数を返します。
+		/// @return エージェントの数
+		[[nodiscard]]
+		size_t num_agents() const noexcept;
+
+		/// @brief エージェントを追加します。
+		/// @param pos エージェントの初期位置。ナビメッシュ上の最も近い位置に配置されます。
+		/// @param config エージェントの設定
+		/// @return 追加したエージェントの ID。近くにナビメッシュがない場合は none
+		[[nodiscard]]
+		Optional<NavMeshAgentID> addAgent(const Vec2& pos, const NavMeshAgentConfig& config = {});
+
+		/// @brief エージェントを削除します。
+		/// @param id エージェントの ID
+		/// @return 削除した場合 true, 指定した ID のエージェントが存在しない場合は false
+		bool removeAgent(NavMeshAgentID id);
+
+		/// @brief すべてのエージェントを削除します。
+		void clear();
+
+		/// @brief 指定した ID のエージェントが存在するかを返します。
+		/// @param id エージェントの ID
+		/// @return エージェントが存在する場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool hasAgent(NavMeshAgentID id) const;
+
+		/// @brief エージェントの目的地を設定します。
+		/// @remark 経路は次の `update()` で計算されます。目的地まで到達できない場合は、できるだけ近い位置を目指します。
+		/// @param id エージェントの ID
+		/// @param target 目的地の座標
+		/// @return 設定に成功した場合 true, エージェントが存在しないか、目的地の近くにナビメッシュがない場合は false
+		bool setTarget(NavMeshAgentID id, const Vec2& target);
+
+		/// @brief エージェントの目的地を解除し、その場で止まらせます。
+		/// @param id エージェントの ID
+		/// @return 解除した場合 true, エージェントが存在しない場合は false
+		bool resetTarget(NavMeshAgentID id);
+
+		/// @brief エージェントの現在位置を返します。
+		/// @param id エージェントの ID
+		/// @return エージェントの現在位置。エージェントが存在しない場合は (0, 0)
+		[[nodiscard]]
+		Vec2 getPos(NavMeshAgentID id) const;
+
+		/// @brief エージェントの現在の速度を返します。
+		/// @param id エージェントの ID
+		/// @return エージェントの現在の速度。エージェントが存在しない場合は (0, 0)
+		[[nodiscard]]
+		Vec2 getVelocity(NavMeshAgentID id) const;
+
+		/// @brief エージェントが目的地に到着したかを返します。
+		/// @param id エージェントの ID
+		/// @return 目的地との距離がエージェントの半径以内である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool hasArrived(NavMeshAgentID id) const;
+
+		/// @brief すべてのエージェントを移動させます。
+		/// @param deltaTime 経過時間（秒）
+		void update(double deltaTime = Scene::DeltaTime());
+
+		/// @brief すべてのエージェントの現在位置を返します。
+		/// @remark `getAgentIDs()` と同じ順に並びます。エージェントを削除すると順序が変わります。
+		/// @return すべてのエージェントの現在位置
+		[[nodiscard]]
+		const Array<Vec2>& getPositions() const noexcept;
+
+		/// @brief すべてのエージェントの ID を返します。
+		/// @remark `getPositions()` と同じ順に並びます。
+		/// @return すべてのエージェントの ID
+		[[nodiscard]]
+		const Array<NavMeshAgentID>& getAgentIDs() const noexcept;
+
+	private:
+
+		class NavMeshCrowdDetail;
+
+		std::shared_ptr<NavMeshCrowdDetail> pImpl;
+	};
+}
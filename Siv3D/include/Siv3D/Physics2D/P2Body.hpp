@@ -256,6 +256,18 @@ namespace s3d
 		[[nodiscard]]
 		std::pair<Vec2, double> getTransform() const noexcept;
 
+		/// @brief 最後のステップの開始時と終了時の間を補間した、物体のワールド座標 (cm) を返します。
+		/// @param alpha 補間係数。通常は `P2World::getInterpolationAlpha()` の値を渡します。
+		/// @return 補間した物体のワールド座標 (cm) 
+		[[nodiscard]]
+		Vec2 getInterpolatedPos(double alpha) const noexcept;
+
+		/// @brief 最後のステップの開始時と終了時の間を補間した、物体の回転角度（ラジアン）を返します。
+		/// @param alpha 補間係数。通常は `P2World::getInterpolationAlpha()` の値を渡します。
+		/// @return 補間した物体の回転角度（ラジアン）
+		[[nodiscard]]
+		double getInterpolatedAngle(double alpha) const noexcept;
+
 		/// @brief 
 		/// @param v 
 		/// @return 
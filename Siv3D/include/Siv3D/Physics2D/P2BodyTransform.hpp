@@ -0,0 +1,32 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../Common.hpp"
+# include "../PointVector.hpp"
+# include "P2Fwd.hpp"
+
+namespace s3d
+{
+	/// @brief 物体の ID と位置・角度の組
+	/// @remark `P2World::getTransforms()` で、ワールド内の物体の状態をまとめて取得するために使います。
+	struct P2BodyTransform
+	{
+		/// @brief 物体の ID
+		P2BodyID id = 0;
+
+		/// @brief 物体のワールド座標 (cm)
+		Vec2 pos{ 0, 0 };
+
+		/// @brief 物体の回転角度（ラジアン）
+		double angle = 0.0;
+	};
+}
@@ -32,6 +32,8 @@ namespace s3d
 	struct P2ContactPair;
 	struct P2Contact;
 	class P2Collision;
+	struct P2WorldStat;
+	struct P2BodyTransform;
 	class P2World;
 	class P2Body;
 	class P2Shape;
@@ -16,6 +16,8 @@
 # include "../HashTable.hpp"
 # include "../Scene.hpp"
 # include "P2Fwd.hpp"
+# include "P2WorldStat.hpp"
+# include "P2BodyTransform.hpp"
 # include "P2BodyType.hpp"
 # include "P2Material.hpp"
 # include "P2Filter.hpp"
@@ -49,6 +51,34 @@ namespace s3d
 		/// @param positionIterations 物体の衝突時の位置の補正の回数
 		void update(double timeStep = Scene::DeltaTime(), int32 velocityIterations = 6, int32 positionIterations = 2) const;
 
+		/// @brief 一定のタイムステップでワールドの状態を更新します。
+		/// @remark 前回の呼び出しから持ち越した時間に `deltaTime` を加え、`stepTime` ずつステップを進めます。余った時間は次の呼び出しに持ち越されます。
+		/// @remark フレームレートによらず同じ結果が得られます。描画時は `getInterpolationAlpha()` を使って物体の位置を補間すると、動きが滑らかになります。
+		/// @param stepTime 1 ステップのタイムステップ（秒）
+		/// @param deltaTime 前回の呼び出しからの経過時間（秒）
+		/// @param maxSteps 1 回の呼び出しで進める最大のステップ数。これを超える分の時間は切り捨てられます。
+		/// @param velocityIterations 物体の衝突時の速度の補正の回数
+		/// @param positionIterations 物体の衝突時の位置の補正の回数
+		/// @return 進めたステップ数
+		int32 updateFixed(double stepTime = (1.0 / 60.0), double deltaTime = Scene::DeltaTime(), int32 maxSteps = 4, int32 velocityIterations = 6, int32 positionIterations = 2) const;
+
+		/// @brief 直前の `updateFixed()` で持ち越された時間の、1 ステップに対する割合を返します。
+		/// @remark `P2Body::getInterpolatedPos()` などに渡すと、最後のステップの開始時と終了時の間を補間した状態が得られます。
+		/// @remark `update()` の後は 1.0 を返します。
+		/// @return 持ち越された時間の割合 [0.0, 1.0]
+		[[nodiscard]]
+		double getInterpolationAlpha() const noexcept;
+
+		/// @brief 直前の更新の処理時間と、物体や接触の数を返します。
+		/// @return 直前の更新に関する統計情報
+		[[nodiscard]]
+		P2WorldStat getStat() const;
+
+		/// @brief ワールド内のすべての物体の ID と位置・角度を取得します。
+		/// @remark 物体は作成した順に並びます。`P2Body` ごとに `getPos()` や `getAngle()` を呼ぶより高速です。
+		/// @param transforms 結果を格納する配列。元の内容は上書きされます。
+		void getTransforms(Array<P2BodyTransform>& transforms) const;
+
 		/// @brief ワールド内の物体がスリープ状態になることを許可・不許可を設定します（デフォルトでは許可）。
 		/// @param enabled 許可する場合 true, 許可しない場合 false
 		void setSleepEnabled(bool enabled);
@@ -58,6 +88,16 @@ namespace s3d
 		[[nodiscard]]
 		bool getSleepEnabled() const;
 
+		/// @brief 接触の多いワールドで、接触の判定をエンジンのスレッドプールで並列に処理することを許可・不許可を設定します（デフォルトでは許可）。
+		/// @param enabled 許可する場合 true, 許可しない場合 false
+		/// @remark どちらの設定でも、シミュレーションの結果は同じです。
+		void setParallelEnabled(bool enabled);
+
+		/// @brief 接触の判定を並列に処理することを許可しているかの現在の設定を返します。
+		/// @return 並列処理を許可している場合 true, 許可していない場合 false
+		[[nodiscard]]
+		bool getParallelEnabled() const noexcept;
+
 		/// @brief 重力加速度 (cm/s^2) を設定します。
 		/// @remark `setGravity(Vec2{ 0, gravity })` と同じです。
 		/// @param gravity 重力加速度 (cm/s^2)
@@ -154,6 +194,18 @@ namespace s3d
 		[[nodiscard]]
 		P2Body createCircleSensor(P2BodyType bodyType, const Vec2& worldPos, double r, const P2Filter& filter = {});
 
+		/// @brief 円を部品として持つ物体を、指定した座標にまとめて作成します。
+		/// @remark 各物体は `P2Circle` の部品を持ちます。
+		/// @remark 内部のデータ構造をあらかじめ確保するため、`createCircle()` を繰り返し呼ぶより高速です。
+		/// @param bodyType 物体の種類
+		/// @param worldPositions 各物体のワールド座標 (cm) 
+		/// @param r 円形の部品の半径 (cm) 
+		/// @param material 部品の材質
+		/// @param filter 部品の干渉フィルタ
+		/// @return 作成した物体の配列。`worldPositions` と同じ順に並びます。
+		[[nodiscard]]
+		Array<P2Body> createCircles(P2BodyType bodyType, const Array<Vec2>& worldPositions, double r, const P2Material& material = {}, const P2Filter& filter = {});
+
 		/// @brief 正方形を部品として持つ物体を作成します。
 		/// @remark 物体は `P2Rect` の部品を持ちます。
 		/// @remark 正方形の中心座標は `worldPos` です。
@@ -189,6 +241,18 @@ namespace s3d
 		[[nodiscard]]
 		P2Body createRect(P2BodyType bodyType, const Vec2& worldPos, const RectF& localPos, const P2Material& material = {}, const P2Filter& filter = {});
 
+		/// @brief 長方形を部品として持つ物体を、指定した座標にまとめて作成します。
+		/// @remark 各物体は `P2Rect` の部品を持ちます。
+		/// @remark 内部のデータ構造をあらかじめ確保するため、`createRect()` を繰り返し呼ぶより高速です。
+		/// @param bodyType 物体の種類
+		/// @param worldPositions 各物体のワールド座標 (cm) 
+		/// @param size 長方形の幅と高さ (cm) 
+		/// @param material 部品の材質
+		/// @param filter 部品の干渉フィルタ
+		/// @return 作成した物体の配列。`worldPositions` と同じ順に並びます。
+		[[nodiscard]]
+		Array<P2Body> createRects(P2BodyType bodyType, const Array<Vec2>& worldPositions, const SizeF& size, const P2Material& material = {}, const P2Filter& filter = {});
+
 		/// @brief 三角形を部品として持つ物体を作成します。
 		/// @remark 物体は `P2Triangle` の部品を持ちます。
 		/// @param bodyType 物体の種類
@@ -0,0 +1,52 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "../Common.hpp"
+# include "P2Fwd.hpp"
+
+namespace s3d
+{
+	/// @brief 2D 物理演算のワールドの直前の更新に関する統計情報
+	/// @remark 処理時間は、直前の `P2World::update()` または `P2World::updateFixed()` で進めたすべてのステップの合計です。
+	struct P2WorldStat
+	{
+		/// @brief 進めたステップ数
+		int32 stepCount = 0;
+
+		/// @brief ステップ全体の処理時間（ミリ秒）
+		double stepTime = 0.0;
+
+		/// @brief ブロードフェーズ（新しい接触候補の検出）の処理時間（ミリ秒）
+		double broadPhaseTime = 0.0;
+
+		/// @brief ナローフェーズ（接触点の計算）の処理時間（ミリ秒）
+		double narrowPhaseTime = 0.0;
+
+		/// @brief 衝突応答と位置の更新の処理時間（ミリ秒）
+		double solveTime = 0.0;
+
+		/// @brief 高速な物体のすり抜けを防ぐ連続衝突判定の処理時間（ミリ秒）
+		double solveTOITime = 0.0;
+
+		/// @brief ワールド内の物体の数
+		size_t bodyCount = 0;
+
+		/// @brief 起きている（スリープしていない）物体の数
+		size_t awakeBodyCount = 0;
+
+		/// @brief ブロードフェーズで検出された接触候補の数
+		size_t contactCount = 0;
+
+		/// @brief 実際に接触している接触候補の数
+		size_t touchingContactCount = 0;
+	};
+}
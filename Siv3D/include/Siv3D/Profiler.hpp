@@ -12,6 +12,7 @@
 # pragma once
 # include "Common.hpp"
 # include "ProfilerStat.hpp"
+# include "ProfilerScope.hpp"
 
 namespace s3d
 {
@@ -29,5 +30,24 @@ namespace s3d
 
 		[[nodiscard]]
 		const ProfilerStat& GetStat();
+
+		/// @brief スコーププロファイラによる記録の ON / OFF を設定します。
+		/// @param enabled 記録を有効にするか
+		/// @remark 有効な間は、`SIV3D_PROFILE_SCOPE` を置いたスコープと、エンジン内部の主な処理（フレームの更新、2D 描画のフラッシュ、画像や音声の読み込み）の実行時間がスレッドごとに記録されます。
+		void EnableScopeProfiler(bool enabled);
+
+		/// @brief スコーププロファイラによる記録が有効であるかを返します。
+		/// @return 記録が有効である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool IsScopeProfilerEnabled() noexcept;
+
+		/// @brief スコーププロファイラが記録したデータを消去します。
+		void ClearScopeProfile();
+
+		/// @brief スコーププロファイラが記録したデータを、Chrome のトレースイベント形式の JSON で保存します。
+		/// @param path 保存するファイルのパス
+		/// @remark 保存したファイルは chrome://tracing や Perfetto で読み込むことができます。
+		/// @return 保存に成功した場合 true, それ以外の場合は false
+		bool ExportChromeTrace(FilePathView path);
 	}
 }
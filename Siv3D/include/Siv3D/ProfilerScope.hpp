@@ -0,0 +1,83 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "StringView.hpp"
+
+namespace s3d
+{
+	/// @brief スコーププロファイラのラベル | Label of the scope profiler
+	/// @remark 同じ名前のラベルは同じ ID を共有します。通常は `SIV3D_PROFILE_SCOPE` マクロによって、関数内の静的変数として一度だけ作成されます。
+	class ProfilerLabel
+	{
+	public:
+
+		/// @brief ラベルを作成します。 | Creates a label.
+		/// @param name ラベルの名前 | Name of the label
+		SIV3D_NODISCARD_CXX20
+		explicit ProfilerLabel(StringView name);
+
+		/// @brief ラベルの ID を返します。 | Returns the ID of the label.
+		/// @return ラベルの ID | ID of the label
+		[[nodiscard]]
+		constexpr uint32 id() const noexcept;
+
+	private:
+
+		uint32 m_id = 0;
+	};
+
+	/// @brief スコープの開始から終了までの時間を、スコーププロファイラに記録します。 | Records the time from the beginning to the end of the scope to the scope profiler.
+	/// @remark スコーププロファイラが無効の場合は何も記録しません。 | Nothing is recorded when the scope profiler is disabled.
+	class ProfilerScope
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		explicit ProfilerScope(const ProfilerLabel& label) noexcept;
+
+		~ProfilerScope();
+
+		ProfilerScope(const ProfilerScope&) = delete;
+
+		ProfilerScope& operator =(const ProfilerScope&) = delete;
+
+	private:
+
+		uint64 m_beginNanosec = 0;
+
+		uint32 m_labelID = 0;
+
+		uint32 m_depth = 0;
+
+		bool m_active = false;
+	};
+}
+
+# include "detail/ProfilerScope.ipp"
+
+# define SIV3D_PROFILER_PRIVATE_COMBINE_(X,Y) X##Y
+# define SIV3D_PROFILER_PRIVATE_COMBINE(X,Y) SIV3D_PROFILER_PRIVATE_COMBINE_(X,Y)
+
+# if defined(SIV3D_DISABLE_PROFILE_SCOPE)
+
+	# define SIV3D_PROFILE_SCOPE(NAME) ((void)0)
+
+# else
+
+	/// @brief 現在のスコープの実行時間を、NAME というラベルでスコーププロファイラに記録します。 | Records the execution time of the current scope to the scope profiler with the label NAME.
+	/// @remark ラベルは最初の実行時に一度だけ登録され、以降は文字列の比較やハッシュ計算を行いません。
+	# define SIV3D_PROFILE_SCOPE(NAME) \
+		static const ::s3d::ProfilerLabel SIV3D_PROFILER_PRIVATE_COMBINE(siv3d_profiler_label_,__LINE__){ NAME }; \
+		const ::s3d::ProfilerScope SIV3D_PROFILER_PRIVATE_COMBINE(siv3d_profiler_scope_,__LINE__){ SIV3D_PROFILER_PRIVATE_COMBINE(siv3d_profiler_label_,__LINE__) }
+
+# endif
@@ -20,6 +20,12 @@ namespace s3d
 
 		uint32 triangleCount = 0;
 
+		/// @brief 2D 描画で GPU に送った頂点・インデックスのバッチ数
+		uint32 batchCount = 0;
+
+		/// @brief 2D 描画で GPU に送った頂点・インデックスのバイト数
+		uint64 uploadedBytes = 0;
+
 		uint32 textureCount = 0;
 
 		uint32 fontCount = 0;
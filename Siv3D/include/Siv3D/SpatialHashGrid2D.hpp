@@ -0,0 +1,178 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "Array.hpp"
+# include "2DShapes.hpp"
+# include "Geometry2D.hpp"
+# include "Threading.hpp"
+
+namespace s3d
+{
+	/// @brief 一様なセルによる空間ハッシュグリッド（2D のブロードフェーズ用コンテナ）
+	/// @tparam Type 要素と一緒に格納する値の型。ID やインデックスなど、コピーが軽量な型を推奨します。
+	/// @remark 要素はバウンディングボックスで登録され、重なるすべてのセルに格納されます。
+	/// @remark 要素を追加・変更したあとは `build()` を呼ぶ必要があります。`build()` はセルのデータを計数ソートで連続した配列に詰め直します。
+	/// @remark 多数の要素が毎フレーム移動する場合は、`clear()` と `add()` で登録し直してから `build()` します。
+	template <class Type>
+	class SpatialHashGrid2D
+	{
+	public:
+
+		using value_type = Type;
+
+		using pair_type = std::pair<Type, Type>;
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		SpatialHashGrid2D() = default;
+
+		/// @brief 空間ハッシュグリッドを作成します。
+		/// @param cellSize セルの大きさ。典型的な要素の大きさ、または検索範囲の大きさ程度にします。
+		/// @param tableSize ハッシュテーブルのサイズ（2 の累乗に切り上げられます）。0 の場合は要素数に応じて自動で決定します。
+		SIV3D_NODISCARD_CXX20
+		explicit SpatialHashGrid2D(double cellSize, size_t tableSize = 0);
+
+		/// @brief 要素を追加します。
+		/// @tparam Shape 要素の形状の型（Vec2, RectF, Circle など）
+		/// @param value 値
+		/// @param shape 要素の形状
+		/// @return 追加した要素のインデックス
+		template <class Shape>
+		size_t add(const Type& value, const Shape& shape);
+
+		/// @brief 要素の形状を変更します。
+		/// @tparam Shape 要素の形状の型（Vec2, RectF, Circle など）
+		/// @param index 要素のインデックス
+		/// @param shape 新しい形状
+		template <class Shape>
+		void update(size_t index, const Shape& shape);
+
+		/// @brief すべての要素を削除します。
+		void clear();
+
+		/// @brief 追加・変更した要素を反映して、セルのデータを構築し直します。
+		void build();
+
+		/// @brief 要素数を返します。
+		/// @return 要素数
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		/// @brief 要素が空であるかを返します。
+		/// @return 要素が空である場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief セルの大きさを返します。
+		/// @return セルの大きさ
+		[[nodiscard]]
+		double cellSize() const noexcept;
+
+		/// @brief 要素の値を返します。
+		/// @param index 要素のインデックス
+		/// @return 要素の値
+		[[nodiscard]]
+		const Type& operator [](size_t index) const;
+
+		/// @brief 要素のバウンディングボックスを返します。
+		/// @param index 要素のインデックス
+		/// @return 要素のバウンディングボックス
+		[[nodiscard]]
+		const RectF& getBoundingRect(size_t index) const;
+
+		/// @brief 指定した形状と交差する要素の値の一覧を返します。
+		/// @tparam Shape 検索範囲の形状の型（RectF, Circle, Polygon など）
+		/// @param shape 検索範囲の形状
+		/// @return 交差する要素の値の一覧
+		/// @remark 要素は登録したときのバウンディングボックス（Vec2 の場合は点）で判定します。
+		template <class Shape>
+		[[nodiscard]]
+		Array<Type> query(const Shape& shape) const;
+
+		/// @brief 指定した形状と交差する要素の値の一覧を取得します。
+		/// @tparam Shape 検索範囲の形状の型（RectF, Circle, Polygon など）
+		/// @param results 結果を格納する配列
+		/// @param shape 検索範囲の形状
+		/// @remark 要素は登録したときのバウンディングボックス（Vec2 の場合は点）で判定します。
+		template <class Shape>
+		void query(Array<Type>& results, const Shape& shape) const;
+
+		/// @brief バウンディングボックスが重なっている要素のペアの一覧を返します。
+		/// @return 重なっている要素の値のペアの一覧。ペアの first は second より先に追加された要素です。
+		/// @remark 境界が接している場合も重なっているとみなします。
+		/// @remark ハッシュテーブルを分割して、スレッドプールで並列に検索します。結果の順序は常に同じです。
+		[[nodiscard]]
+		Array<pair_type> findPairs() const;
+
+		/// @brief バウンディングボックスが重なっている要素のペアの一覧を取得します。
+		/// @param results 結果を格納する配列。ペアの first は second より先に追加された要素です。
+		/// @remark 境界が接している場合も重なっているとみなします。
+		/// @remark ハッシュテーブルを分割して、スレッドプールで並列に検索します。結果の順序は常に同じです。
+		void findPairs(Array<pair_type>& results) const;
+
+	private:
+
+		struct CellRange
+		{
+			int32 minX;
+
+			int32 minY;
+
+			int32 maxX;
+
+			int32 maxY;
+		};
+
+		double m_cellSize = 64.0;
+
+		double m_invCellSize = (1.0 / 64.0);
+
+		size_t m_requestedTableSize = 0;
+
+		Array<Type> m_values;
+
+		Array<RectF> m_rects;
+
+		// バケット i の要素は m_entries[m_bucketStarts[i]] から m_entries[m_bucketStarts[i + 1]] の手前まで
+		Array<uint32> m_bucketStarts;
+
+		Array<uint32> m_entries;
+
+		// build() の作業用
+		Array<uint32> m_workspace;
+
+		uint32 m_bucketMask = 0;
+
+		// 直前の build() でセルに格納した要素数
+		size_t m_numIndexed = 0;
+
+		[[nodiscard]]
+		int32 toCell(double v) const noexcept;
+
+		[[nodiscard]]
+		CellRange toCellRange(const RectF& rect) const noexcept;
+
+		[[nodiscard]]
+		uint32 toBucket(int32 cellX, int32 cellY) const noexcept;
+
+		// rect が重なるセルのバケットそれぞれについて f(bucket) を呼ぶ（同じバケットが複数回渡されることがある）
+		template <class Fty>
+		void forEachBucket(const RectF& rect, Fty f) const;
+
+		template <class Shape>
+		[[nodiscard]]
+		bool intersects(size_t index, const RectF& queryRect, const Shape& shape) const;
+	};
+}
+
+# include "detail/SpatialHashGrid2D.ipp"
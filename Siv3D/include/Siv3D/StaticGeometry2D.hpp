@@ -0,0 +1,142 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "Array.hpp"
+# include "Buffer2D.hpp"
+# include "ColorHSV.hpp"
+# include "Palette.hpp"
+
+namespace s3d
+{
+	struct RectF;
+	struct Circle;
+	struct RoundRect;
+	struct Line;
+	struct LineStyle;
+	class LineString;
+	class Polygon;
+	struct Mat3x2;
+
+	/// @brief 記録済み 2D 図形
+	/// @remark 変化しない図形の頂点とインデックスを一度だけ生成して保持し、毎フレームの描画ではそれをコピーするだけにします。
+	/// @remark 描画時には座標変換行列と乗算カラーを適用できます。
+	class StaticGeometry2D
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		StaticGeometry2D() = default;
+
+		/// @brief 記録済み 2D 図形を作成します。
+		/// @param qualityScale 円や角丸の分割数を決めるときの拡大率。拡大して描画する場合は、その倍率を指定します。
+		SIV3D_NODISCARD_CXX20
+		explicit StaticGeometry2D(double qualityScale) noexcept;
+
+		/// @brief 長方形を記録します。
+		/// @param rect 長方形
+		/// @param color 色
+		/// @return *this
+		StaticGeometry2D& addRect(const RectF& rect, const ColorF& color);
+
+		/// @brief 長方形の枠を記録します。
+		/// @param rect 長方形
+		/// @param thickness 枠の太さ
+		/// @param color 色
+		/// @return *this
+		StaticGeometry2D& addRectFrame(const RectF& rect, double thickness, const ColorF& color);
+
+		/// @brief 円を記録します。
+		/// @param circle 円
+		/// @param color 色
+		/// @return *this
+		StaticGeometry2D& addCircle(const Circle& circle, const ColorF& color);
+
+		/// @brief 円の枠を記録します。
+		/// @param circle 円
+		/// @param thickness 枠の太さ
+		/// @param color 色
+		/// @return *this
+		StaticGeometry2D& addCircleFrame(const Circle& circle, double thickness, const ColorF& color);
+
+		/// @brief 角丸長方形を記録します。
+		/// @param roundRect 角丸長方形
+		/// @param color 色
+		/// @return *this
+		StaticGeometry2D& addRoundRect(const RoundRect& roundRect, const ColorF& color);
+
+		/// @brief 線分を記録します。
+		/// @param line 線分
+		/// @param thickness 線の太さ
+		/// @param color 色
+		/// @return *this
+		StaticGeometry2D& addLine(const Line& line, double thickness, const ColorF& color);
+
+		/// @brief 線分を記録します。
+		/// @param style 線のスタイル
+		/// @param line 線分
+		/// @param thickness 線の太さ
+		/// @param color 色
+		/// @return *this
+		StaticGeometry2D& addLine(const LineStyle& style, const Line& line, double thickness, const ColorF& color);
+
+		/// @brief 連続した線分を記録します。
+		/// @param lineString 連続した線分
+		/// @param thickness 線の太さ
+		/// @param color 色
+		/// @return *this
+		StaticGeometry2D& addLineString(const LineString& lineString, double thickness, const ColorF& color);
+
+		/// @brief 多角形を記録します。
+		/// @param polygon 多角形
+		/// @param color 色
+		/// @return *this
+		StaticGeometry2D& addPolygon(const Polygon& polygon, const ColorF& color);
+
+		/// @brief 記録した図形をすべて消去します。
+		void clear();
+
+		/// @brief 記録した図形が無いかを返します。
+		/// @return 記録した図形が無い場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		/// @brief 記録した頂点の数を返します。
+		/// @return 記録した頂点の数
+		[[nodiscard]]
+		size_t num_vertices() const noexcept;
+
+		/// @brief 記録した三角形の数を返します。
+		/// @return 記録した三角形の数
+		[[nodiscard]]
+		size_t num_triangles() const noexcept;
+
+		/// @brief 記録した図形を描画します。
+		/// @param colorMul 乗算カラー
+		void draw(const ColorF& colorMul = Palette::White) const;
+
+		/// @brief 記録した図形を、座標変換を適用して描画します。
+		/// @param transform 座標変換行列
+		/// @param colorMul 乗算カラー
+		/// @remark 座標変換は GPU で行われるため、CPU での頂点の再計算は発生しません。
+		void draw(const Mat3x2& transform, const ColorF& colorMul = Palette::White) const;
+
+	private:
+
+		// 1 回の描画で扱える頂点数に収まるよう分割して保持する
+		Array<Buffer2D> m_buffers;
+
+		Array<Float2> m_buffer;
+
+		float m_qualityScale = 1.0f;
+	};
+}
@@ -0,0 +1,89 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# ifndef SIV3D_NO_CONCURRENT_API
+
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <exception>
+# include <functional>
+# include <memory>
+# include <mutex>
+# include "Common.hpp"
+# include "Threading.hpp"
+
+namespace s3d
+{
+	/// @brief エンジンのスレッドプールで実行するタスクのグループ
+	/// @remark `run()` で追加したタスクの完了を `wait()` でまとめて待つことができます。
+	class TaskGroup
+	{
+	public:
+
+		SIV3D_NODISCARD_CXX20
+		TaskGroup();
+
+		/// @brief デストラクタ
+		/// @remark 実行中のタスクがある場合は、完了まで待機します。
+		~TaskGroup();
+
+		TaskGroup(const TaskGroup&) = delete;
+
+		TaskGroup& operator =(const TaskGroup&) = delete;
+
+		/// @brief タスクをグループに追加し、エンジンのスレッドプールで実行します。
+		/// @tparam Fty タスクで実行する関数の型
+		/// @param f タスクで実行する関数
+		template <class Fty, std::enable_if_t<std::is_invocable_v<std::decay_t<Fty>>>* = nullptr>
+		void run(Fty&& f);
+
+		/// @brief グループの全てのタスクの完了を待ちます。
+		/// @remark このグループのタスクのうち、まだ開始されていないものは呼び出し元のスレッドで実行します。他のタスクは実行しません。
+		/// @remark タスクで例外が発生していた場合、最初の例外を送出します。
+		void wait();
+
+		/// @brief グループの全てのタスクが完了しているかを返します。
+		/// @return 全てのタスクが完了している場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isDone() const noexcept;
+
+	private:
+
+		struct State
+		{
+			std::atomic<size_t> pendingTasks = 0;
+
+			std::mutex mutex;
+
+			std::condition_variable finished;
+
+			std::exception_ptr exception;
+
+			// まだ開始されていないタスク（mutex で保護）
+			std::deque<std::function<void()>> tasks;
+
+			void push(std::function<void()> task);
+
+			// まだ開始されていないタスクを 1 つ取り出して実行する
+			bool runOne();
+
+			void onTaskFinished(std::exception_ptr e);
+		};
+
+		std::shared_ptr<State> m_state;
+	};
+}
+
+# include "detail/TaskGroup.ipp"
+
+# endif // SIV3D_NO_CONCURRENT_API
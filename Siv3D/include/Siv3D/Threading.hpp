@@ -10,14 +10,112 @@
 //-----------------------------------------------
 
 # pragma once
+# include <chrono>
+# include <functional>
+# include <future>
+# include <memory>
+# include <type_traits>
+# include <vector>
+# include "Common.hpp"
 
 namespace s3d
 {
 	namespace Threading
 	{
+		/// @brief 並列処理の粒度を自動で決定することを示す値です。 | A value indicating that the grain size of parallel processing is determined automatically.
+		inline constexpr size_t AutoGrainSize = 0;
+
+		/// @brief 粒度を自動で決定する場合の最小の粒度です。要素数がこの値以下の範囲は並列化されず、呼び出し元のスレッドで処理されます。 | Minimum grain size used when the grain size is determined automatically. Ranges with this number of elements or fewer are processed serially on the calling thread.
+		inline constexpr size_t MinAutoGrainSize = 512;
+
 		/// @brief サポートされるスレッド数を返します。 | Returns the number of concurrent threads supported by the implementation.
 		/// @return サポートされるスレッド数 | Number of concurrent threads supported
 		[[nodiscard]]
 		size_t GetConcurrency() noexcept;
+
+		/// @brief エンジンのスレッドプールが持つワーカースレッドの数を返します。 | Returns the number of worker threads owned by the engine's thread pool.
+		/// @remark 並列処理を呼び出したスレッドも処理に参加するため、`Max(GetConcurrency() - 1, 2)` です。1 つの `AsyncTask` がブロックしても他のタスクが止まらないよう、少なくとも 2 つあります。 | Since the calling thread also takes part in parallel processing, this is `Max(GetConcurrency() - 1, 2)`. There are at least two so that one blocking `AsyncTask` does not stall the other tasks.
+		/// @remark スレッドを使えない環境（pthreads なしでビルドした Web 版）では 0 で、並列処理はすべて呼び出し元のスレッドで行われます。 | In environments without threads (Web builds without pthreads), this is 0 and all parallel processing runs on the calling thread.
+		/// @return ワーカースレッドの数 | Number of worker threads
+		[[nodiscard]]
+		size_t GetWorkerCount() noexcept;
+
+		/// @brief 並列処理で 1 つのタスクが担当する要素数を返します。 | Returns the number of elements processed by a single task in parallel processing.
+		/// @param count 処理する要素数 | Number of elements to process
+		/// @param grainSize 粒度。`Threading::AutoGrainSize` の場合は自動で決定します。 | Grain size. If `Threading::AutoGrainSize`, it is determined automatically.
+		/// @return 1 つのタスクが担当する要素数 | Number of elements processed by a single task
+		[[nodiscard]]
+		size_t ResolveGrainSize(size_t count, size_t grainSize) noexcept;
+
+		/// @brief [first, last) の各インデックス i について、エンジンのスレッドプールで並列に `f(i)` を呼び出します。 | Calls `f(i)` in parallel on the engine's thread pool for each index i in [first, last).
+		/// @tparam Fty 呼び出す関数の型 | Type of the function
+		/// @param first 範囲の開始 | Beginning of the range
+		/// @param last 範囲の終端 | End of the range
+		/// @param f 呼び出す関数 | Function to call
+		/// @param grainSize 1 つのタスクが担当する要素数。`Threading::AutoGrainSize` の場合は自動で決定します。 | Number of elements processed by a single task. If `Threading::AutoGrainSize`, it is determined automatically.
+		/// @remark 範囲の要素数が粒度以下の場合は、呼び出し元のスレッドで処理します。 | If the number of elements is not greater than the grain size, the range is processed on the calling thread.
+		/// @remark `f` が例外を投げた場合、残りの処理を打ち切り、全てのタスクの終了後に最初の例外を再送出します。 | If `f` throws, the remaining work is cancelled and the first exception is rethrown after all tasks have finished.
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t>>* = nullptr>
+		void ParallelFor(size_t first, size_t last, Fty f, size_t grainSize = AutoGrainSize);
+
+		/// @brief [0, count) の各インデックス i について、エンジンのスレッドプールで並列に `f(i)` を呼び出します。 | Calls `f(i)` in parallel on the engine's thread pool for each index i in [0, count).
+		/// @tparam Fty 呼び出す関数の型 | Type of the function
+		/// @param count 要素数 | Number of elements
+		/// @param f 呼び出す関数 | Function to call
+		/// @param grainSize 1 つのタスクが担当する要素数。`Threading::AutoGrainSize` の場合は自動で決定します。 | Number of elements processed by a single task. If `Threading::AutoGrainSize`, it is determined automatically.
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t>>* = nullptr>
+		void ParallelFor(size_t count, Fty f, size_t grainSize = AutoGrainSize);
+
+		/// @brief [first, last) の各インデックス i について `map(i)` を求め、`reduce` で集約した結果をエンジンのスレッドプールで並列に計算します。 | Computes `map(i)` for each index i in [first, last) and combines the results with `reduce` in parallel on the engine's thread pool.
+		/// @tparam Type 結果の型 | Type of the result
+		/// @tparam MapFunction 各要素に適用する関数の型 | Type of the function applied to each element
+		/// @tparam ReduceFunction 結果を集約する関数の型 | Type of the function that combines results
+		/// @param first 範囲の開始 | Beginning of the range
+		/// @param last 範囲の終端 | End of the range
+		/// @param identity `reduce` の単位元 | Identity element of `reduce`
+		/// @param map 各要素に適用する関数 | Function applied to each element
+		/// @param reduce 結果を集約する関数。結合則を満たす必要があります。 | Function that combines results. Must be associative.
+		/// @param grainSize 1 つのタスクが担当する要素数。`Threading::AutoGrainSize` の場合は自動で決定します。 | Number of elements processed by a single task. If `Threading::AutoGrainSize`, it is determined automatically.
+		/// @remark 部分結果は常に同じ順序で集約されるため、浮動小数点数の総和もスレッド数によらず同じ結果になります。 | Partial results are always combined in the same order, so floating-point sums give the same result regardless of the number of threads.
+		/// @return 集約した結果 | Combined result
+		template <class Type, class MapFunction, class ReduceFunction,
+			std::enable_if_t<std::is_invocable_v<MapFunction, size_t>>* = nullptr,
+			std::enable_if_t<std::is_invocable_r_v<Type, ReduceFunction, Type, Type>>* = nullptr>
+		[[nodiscard]]
+		Type ParallelReduce(size_t first, size_t last, Type identity, MapFunction map, ReduceFunction reduce, size_t grainSize = AutoGrainSize);
+
+		namespace detail
+		{
+			using ParallelRangeFunction = void(*)(void* context, size_t first, size_t last);
+
+			void ParallelForRangeImpl(size_t first, size_t last, size_t grainSize, ParallelRangeFunction function, void* context);
+
+			/// @brief [first, last) の範囲を分割して、エンジンのスレッドプールで並列に `f(begin, end)` を呼びます。
+			/// @remark 範囲の要素数が粒度以下の場合は、呼び出し元のスレッドで `f(first, last)` を 1 回だけ呼びます。
+			template <class Fty>
+			void ParallelForRange(size_t first, size_t last, size_t grainSize, Fty&& f);
+
+			/// @brief エンジンのスレッドプールにタスクを追加します。
+			void SubmitTask(std::function<void()> task);
+
+			/// @brief ワーカースレッドがブロックして待機する間、代わりのスレッドにスレッドプールのタスクを処理させます。
+			/// @remark 代わりのスレッドを作れなかった場合も例外は送出しません。
+			void BeginBlockingWait() noexcept;
+
+			/// @brief `BeginBlockingWait()` で始めた待機が終わったことを通知します。
+			void EndBlockingWait() noexcept;
+
+			/// @brief 現在のスレッドがエンジンのスレッドプールのワーカースレッドであるかを返します。
+			[[nodiscard]]
+			bool IsWorkerThread() noexcept;
+
+			/// @brief future の完了を待ちます。
+			/// @remark ワーカースレッドから呼ばれた場合は、待機中は代わりのスレッドがキューのタスクを処理します。これにより、タスクの中で別のタスクを待ってもデッドロックしません。
+			/// @remark 待機中のスレッドが、キューにある無関係なタスクを実行することはありません。
+			template <class Future>
+			void WaitForFuture(const Future& future);
+		}
 	}
 }
+
+# include "detail/Threading.ipp"
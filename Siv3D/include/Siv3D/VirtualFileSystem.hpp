@@ -0,0 +1,78 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include "Common.hpp"
+# include "String.hpp"
+# include "Array.hpp"
+# include "MemoryViewReader.hpp"
+
+namespace s3d
+{
+	/// @brief 仮想ファイルシステム
+	/// @remark マウントしたディレクトリ、ZIP 圧縮ファイル、パックファイル内のファイルは、`BinaryReader` や `Texture`, `Audio`, `Font`, `JSON::Load()` などのファイルパスを受け取る関数から、通常のファイルと同じように読み込めます。
+	/// @remark `FileSystem::Exists()`, `FileSystem::IsFile()`, `FileSystem::IsDirectory()`, `FileSystem::FileSize()` も、マウントしたファイルを考慮します。
+	namespace VirtualFileSystem
+	{
+		/// @brief ディレクトリ、ZIP 圧縮ファイル、またはパックファイルをマウントします。
+		/// @param source マウントするディレクトリ、ZIP 圧縮ファイル、または `VirtualFileSystem::CreatePack()` で作成したパックファイルのパス
+		/// @param mountPoint マウント先のパス。空の場合、中のファイルには `source` からの相対パスでアクセスできます。
+		/// @return マウントに成功した場合 true, それ以外の場合は false
+		/// @remark マウント時にファイルの一覧を作成するため、以降のファイルの検索ではファイルシステムにアクセスしません。
+		/// @remark 同じパスのファイルがある場合、後からマウントしたものが優先されます。マウントされていないファイルは、通常どおりファイルシステムから読み込みます。
+		bool Mount(FilePathView source, FilePathView mountPoint = U"");
+
+		/// @brief マウントを解除します。
+		/// @param source `Mount()` に渡したパス
+		/// @return マウントを解除した場合 true, マウントされていなかった場合は false
+		bool Unmount(FilePathView source);
+
+		/// @brief すべてのマウントを解除します。
+		void UnmountAll();
+
+		/// @brief マウントされているかを返します。
+		/// @param source `Mount()` に渡したパス
+		/// @return マウントされている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool IsMounted(FilePathView source);
+
+		/// @brief マウントしたものの中にファイルが存在するかを返します。
+		/// @param path ファイルパス
+		/// @return ファイルが存在する場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool Exists(FilePathView path);
+
+		/// @brief マウントしたものの中にあるファイルのサイズを返します。
+		/// @param path ファイルパス
+		/// @return ファイルのサイズ（バイト）。ファイルが存在しない場合は 0
+		[[nodiscard]]
+		int64 FileSize(FilePathView path);
+
+		/// @brief マウントしたものの中にあるファイルの一覧を返します。
+		/// @return ファイルパスの一覧
+		[[nodiscard]]
+		Array<FilePath> EnumFiles();
+
+		/// @brief パックファイル内のファイルを、コピーせずに読み込む Reader を作成します。
+		/// @param path ファイルパス
+		/// @return ファイルを読み込む Reader。ファイルがパックファイル内に無い場合は空の Reader
+		/// @remark Reader はメモリマップされたパックファイルを直接参照します。マウントを解除した後は使用できません。
+		[[nodiscard]]
+		MemoryViewReader OpenView(FilePathView path);
+
+		/// @brief ディレクトリ内のすべてのファイルを 1 つのパックファイルにまとめます。
+		/// @param directory ディレクトリのパス
+		/// @param packPath 作成するパックファイルのパス
+		/// @return パックファイルの作成に成功した場合 true, それ以外の場合は false
+		/// @remark パックファイルは圧縮されず、マウント時にメモリマップされます。多数の小さなファイルを開く際のオーバーヘッドを削減できます。
+		bool CreatePack(FilePathView directory, FilePathView packPath);
+	}
+}
@@ -0,0 +1,133 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "IReader.hpp"
+# include "String.hpp"
+
+namespace s3d
+{
+	class ZIPReader;
+
+	/// @brief ZIP アーカイブ内のファイルを、展開しながら読み込む Reader
+	/// @remark `ZIPReader::openEntry()` で作成します。ファイル全体をメモリ上に展開しないため、巨大なファイルを少ないメモリで読み込めます。
+	/// @remark 圧縮されていないファイルは、アーカイブファイルのメモリマップからコピーせずに読み込みます。
+	/// @remark 作成元の `ZIPReader` を閉じた後も読み込めます。
+	class ZIPEntryReader : public IReader
+	{
+	public:
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		ZIPEntryReader();
+
+		/// @brief lookahead をサポートしているかを返します。
+		/// @return 圧縮されていないファイルの場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool supportsLookahead() const noexcept override;
+
+		/// @brief 読み込み元を閉じます。
+		void close();
+
+		/// @brief 読み込み元が開いているかを返します。
+		/// @return 読み込み元が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept override;
+
+		/// @brief 読み込み元が開いているかを返します。
+		/// @return 読み込み元が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief ファイルが圧縮されているかを返します。
+		/// @return ファイルが圧縮されている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isCompressed() const noexcept;
+
+		/// @brief 展開後のファイルのサイズを返します。
+		/// @return 展開後のファイルのサイズ（バイト）
+		[[nodiscard]]
+		int64 size() const override;
+
+		/// @brief 現在の読み込み位置を返します。
+		/// @return 現在の読み込み位置（バイト）
+		[[nodiscard]]
+		int64 getPos() const override;
+
+		/// @brief 読み込み位置を変更します。
+		/// @param pos 新しい読み込み位置（バイト）
+		/// @return 読み込み位置の変更に成功した場合 true, それ以外の場合は false
+		/// @remark 圧縮されたファイルで現在の位置より前に戻る場合は、先頭から展開し直します。
+		bool setPos(int64 pos) override;
+
+		/// @brief ファイルを読み飛ばします。
+		/// @param offset 読み飛ばすサイズ（バイト）
+		/// @return 新しい読み込み位置（バイト）
+		int64 skip(int64 offset) override;
+
+		/// @brief ファイルからデータを読み込みます。
+		/// @param dst 読み込み先
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 size) override;
+
+		/// @brief ファイルからデータを読み込みます。
+		/// @param dst 読み込み先
+		/// @param pos 先頭から数えた読み込み開始位置（バイト）
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 pos, int64 size) override;
+
+		/// @brief ファイルからデータを読み込みます。
+		/// @tparam TriviallyCopyable 読み込む値の型
+		/// @param dst 読み込み先
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
+		bool read(TriviallyCopyable& dst);
+
+		/// @brief 読み込み位置を変更しないでファイルからデータを読み込みます。
+		/// @param dst 読み込み先
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）。lookahead がサポートされていない場合は 0
+		int64 lookahead(void* dst, int64 size) const override;
+
+		/// @brief 読み込み位置を変更しないでファイルからデータを読み込みます。
+		/// @param dst 読み込み先
+		/// @param pos 先頭から数えた読み込み開始位置（バイト）
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）。lookahead がサポートされていない場合は 0
+		int64 lookahead(void* dst, int64 pos, int64 size) const override;
+
+		/// @brief 読み込み位置を変更しないでファイルからデータを読み込みます。
+		/// @tparam TriviallyCopyable 読み込む値の型
+		/// @param dst 読み込み先
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
+		bool lookahead(TriviallyCopyable& dst) const;
+
+		/// @brief アーカイブ内でのファイルパスを返します。
+		/// @return アーカイブ内でのファイルパス
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		friend ZIPReader;
+
+		class ZIPEntryReaderDetail;
+
+		std::shared_ptr<ZIPEntryReaderDetail> pImpl;
+	};
+}
+
+# include "detail/ZIPEntryReader.ipp"
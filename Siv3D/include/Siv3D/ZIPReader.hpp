@@ -15,6 +15,7 @@
 # include "Array.hpp"
 # include "Blob.hpp"
 # include "MemoryReader.hpp"
+# include "ZIPEntryReader.hpp"
 
 namespace s3d
 {
@@ -54,6 +55,13 @@ namespace s3d
 		[[nodiscard]]
 		Blob extractToBlob(FilePathView filePath) const;
 
+		/// @brief アーカイブ内のファイルを、展開しながら読み込む Reader を作成します。
+		/// @param filePath アーカイブ内でのファイルパス。`enumPaths()` が返すパスと完全に一致する必要があります。
+		/// @return ファイルを読み込む Reader。ファイルが見つからない場合は空の Reader
+		/// @remark 暗号化されたファイルや、deflate 以外の方式で圧縮されたファイルは、全体を展開してから読み込みます。
+		[[nodiscard]]
+		ZIPEntryReader openEntry(FilePathView filePath) const;
+
 	private:
 
 		class ZIPReaderDetail;
@@ -0,0 +1,156 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "IReader.hpp"
+# include "StringView.hpp"
+
+namespace s3d
+{
+	class String;
+	using FilePath = String;
+	class CompressionDictionary;
+
+	/// @brief Zstandard 方式で圧縮されたデータを展開しながら読み込む Reader
+	/// @remark `Compression::Compress()` や `ZstdWriter` で圧縮したデータを読み込めます。複数のフレームが連結されたデータにも対応しています。
+	/// @remark データ全体をメモリ上に展開しないため、巨大なデータを少ないメモリで読み込めます。`Deserializer<ZstdReader>` として使うこともできます。
+	class ZstdReader : public IReader
+	{
+	public:
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		ZstdReader();
+
+		/// @brief 圧縮されたファイルを開きます。
+		/// @param path ファイルパス
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdReader(FilePathView path);
+
+		/// @brief 圧縮されたデータを IReader から読み込みます。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader IReader オブジェクト
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdReader(Reader&& reader);
+
+		/// @brief 圧縮されたデータを IReader から読み込みます。
+		/// @param reader IReader オブジェクト
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdReader(std::unique_ptr<IReader>&& reader);
+
+		/// @brief lookahead をサポートしているかを返します。
+		/// @return false
+		[[nodiscard]]
+		bool supportsLookahead() const noexcept override;
+
+		/// @brief 圧縮されたファイルを開きます。
+		/// @param path ファイルパス
+		/// @return ファイルのオープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path);
+
+		/// @brief 圧縮されたデータを IReader から読み込みます。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader IReader オブジェクト
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		bool open(Reader&& reader);
+
+		/// @brief 圧縮されたデータを IReader から読み込みます。
+		/// @param reader IReader オブジェクト
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IReader>&& reader);
+
+		/// @brief 展開に辞書を使います。
+		/// @param dictionary 圧縮に使ったものと同じ辞書
+		/// @return 辞書の設定に成功した場合 true, それ以外の場合は false
+		/// @remark オープンした後、最初の `read()` の前に呼ぶ必要があります。
+		bool setDictionary(const CompressionDictionary& dictionary);
+
+		/// @brief 読み込み元を閉じます。
+		void close();
+
+		/// @brief 読み込み元が開いているかを返します。
+		/// @return 読み込み元が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept override;
+
+		/// @brief 読み込み元が開いているかを返します。
+		/// @return 読み込み元が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 展開後のデータのサイズを返します。
+		/// @return 各フレームのヘッダに記録されている展開後のサイズの合計（バイト）。記録されていないフレームがある場合は 0
+		/// @remark `ZstdWriter` で圧縮したデータには展開後のサイズが記録されません。
+		[[nodiscard]]
+		int64 size() const override;
+
+		/// @brief 展開後のデータにおける現在の読み込み位置を返します。
+		/// @return 現在の読み込み位置（バイト）
+		[[nodiscard]]
+		int64 getPos() const override;
+
+		/// @brief 展開後のデータにおける読み込み位置を変更します。
+		/// @param pos 新しい読み込み位置（バイト）
+		/// @return 読み込み位置の変更に成功した場合 true, それ以外の場合は false
+		/// @remark 現在の位置より前に戻る場合は、先頭から展開し直します。
+		bool setPos(int64 pos) override;
+
+		/// @brief 展開後のデータを読み飛ばします。
+		/// @param offset 読み飛ばすサイズ（バイト）
+		/// @return 新しい読み込み位置（バイト）
+		int64 skip(int64 offset) override;
+
+		/// @brief データを展開して読み込みます。
+		/// @param dst 読み込み先
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 size) override;
+
+		/// @brief データを展開して読み込みます。
+		/// @param dst 読み込み先
+		/// @param pos 展開後のデータの先頭から数えた読み込み開始位置（バイト）
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 pos, int64 size) override;
+
+		/// @brief データを展開して読み込みます。
+		/// @tparam TriviallyCopyable 読み込む値の型
+		/// @param dst 読み込み先
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
+		bool read(TriviallyCopyable& dst);
+
+		/// @brief lookahead はサポートされていません。
+		/// @return 0
+		int64 lookahead(void* dst, int64 size) const override;
+
+		/// @brief lookahead はサポートされていません。
+		/// @return 0
+		int64 lookahead(void* dst, int64 pos, int64 size) const override;
+
+		/// @brief 読み込み元のファイルパスを返します。
+		/// @return 読み込み元のファイルパス。IReader から読み込んでいる場合は空の文字列
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		class ZstdReaderDetail;
+
+		std::shared_ptr<ZstdReaderDetail> pImpl;
+	};
+}
+
+# include "detail/ZstdReader.ipp"
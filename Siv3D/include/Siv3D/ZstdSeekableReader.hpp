@@ -0,0 +1,193 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "IReader.hpp"
+# include "StringView.hpp"
+# include "Blob.hpp"
+
+namespace s3d
+{
+	class String;
+	using FilePath = String;
+
+	/// @brief 任意の位置から展開できる形式で Zstandard 方式で圧縮されたデータを読み込む Reader
+	/// @remark `ZstdSeekableWriter` で圧縮したデータなど、Zstandard の seekable format のデータを読み込みます。`setPos()` で移動した位置を含むフレームだけを展開するため、巨大なデータの任意の位置を高速に読み込めます。
+	/// @remark シークテーブルが無い場合でも、展開後のサイズが記録されたフレームが連結されたデータであれば、フレームを走査して読み込めます。
+	/// @remark 展開したフレームは、最近使われたものから指定した数までキャッシュされます。ファイルを開いた場合は、圧縮されたデータをメモリマップドファイルとしてコピーせずに参照します。
+	class ZstdSeekableReader : public IReader
+	{
+	public:
+
+		/// @brief キャッシュするフレームの数のデフォルト値
+		static constexpr size_t DefaultCacheFrameCount = 4;
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		ZstdSeekableReader();
+
+		/// @brief 圧縮されたファイルを開きます。
+		/// @param path ファイルパス
+		/// @param cacheFrameCount キャッシュするフレームの数
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdSeekableReader(FilePathView path, size_t cacheFrameCount = DefaultCacheFrameCount);
+
+		/// @brief 圧縮されたデータをメモリ上から読み込みます。
+		/// @param blob 圧縮されたデータ
+		/// @param cacheFrameCount キャッシュするフレームの数
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdSeekableReader(Blob&& blob, size_t cacheFrameCount = DefaultCacheFrameCount);
+
+		/// @brief 圧縮されたデータを IReader から読み込みます。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader IReader オブジェクト
+		/// @param cacheFrameCount キャッシュするフレームの数
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdSeekableReader(Reader&& reader, size_t cacheFrameCount = DefaultCacheFrameCount);
+
+		/// @brief 圧縮されたデータを IReader から読み込みます。
+		/// @param reader IReader オブジェクト
+		/// @param cacheFrameCount キャッシュするフレームの数
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdSeekableReader(std::unique_ptr<IReader>&& reader, size_t cacheFrameCount = DefaultCacheFrameCount);
+
+		/// @brief lookahead をサポートしているかを返します。
+		/// @return true
+		[[nodiscard]]
+		bool supportsLookahead() const noexcept override;
+
+		/// @brief 圧縮されたファイルを開きます。
+		/// @param path ファイルパス
+		/// @param cacheFrameCount キャッシュするフレームの数
+		/// @return ファイルのオープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path, size_t cacheFrameCount = DefaultCacheFrameCount);
+
+		/// @brief 圧縮されたデータをメモリ上から読み込みます。
+		/// @param blob 圧縮されたデータ
+		/// @param cacheFrameCount キャッシュするフレームの数
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(Blob&& blob, size_t cacheFrameCount = DefaultCacheFrameCount);
+
+		/// @brief 圧縮されたデータを IReader から読み込みます。
+		/// @tparam Reader IReader オブジェクトの型
+		/// @param reader IReader オブジェクト
+		/// @param cacheFrameCount キャッシュするフレームの数
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>* = nullptr>
+		bool open(Reader&& reader, size_t cacheFrameCount = DefaultCacheFrameCount);
+
+		/// @brief 圧縮されたデータを IReader から読み込みます。
+		/// @param reader IReader オブジェクト
+		/// @param cacheFrameCount キャッシュするフレームの数
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		/// @remark IReader から読み込む場合は、シークテーブルが必要です。
+		bool open(std::unique_ptr<IReader>&& reader, size_t cacheFrameCount = DefaultCacheFrameCount);
+
+		/// @brief 読み込み元を閉じます。
+		void close();
+
+		/// @brief 読み込み元が開いているかを返します。
+		/// @return 読み込み元が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept override;
+
+		/// @brief 読み込み元が開いているかを返します。
+		/// @return 読み込み元が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 展開後のデータのサイズを返します。
+		/// @return 展開後のデータのサイズ（バイト）
+		[[nodiscard]]
+		int64 size() const override;
+
+		/// @brief 展開後のデータにおける現在の読み込み位置を返します。
+		/// @return 現在の読み込み位置（バイト）
+		[[nodiscard]]
+		int64 getPos() const override;
+
+		/// @brief 展開後のデータにおける読み込み位置を変更します。
+		/// @param pos 新しい読み込み位置（バイト）
+		/// @return 読み込み位置の変更に成功した場合 true, それ以外の場合は false
+		/// @remark データは次に読み込むときに、その位置を含むフレームだけが展開されます。
+		bool setPos(int64 pos) override;
+
+		/// @brief 展開後のデータを読み飛ばします。
+		/// @param offset 読み飛ばすサイズ（バイト）
+		/// @return 新しい読み込み位置（バイト）
+		int64 skip(int64 offset) override;
+
+		/// @brief データを展開して読み込みます。
+		/// @param dst 読み込み先
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 size) override;
+
+		/// @brief データを展開して読み込みます。
+		/// @param dst 読み込み先
+		/// @param pos 展開後のデータの先頭から数えた読み込み開始位置（バイト）
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 read(void* dst, int64 pos, int64 size) override;
+
+		/// @brief データを展開して読み込みます。
+		/// @tparam TriviallyCopyable 読み込む値の型
+		/// @param dst 読み込み先
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
+		bool read(TriviallyCopyable& dst);
+
+		/// @brief 読み込み位置を変更しないでデータを展開して読み込みます。
+		/// @param dst 読み込み先
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 lookahead(void* dst, int64 size) const override;
+
+		/// @brief 読み込み位置を変更しないでデータを展開して読み込みます。
+		/// @param dst 読み込み先
+		/// @param pos 展開後のデータの先頭から数えた読み込み開始位置（バイト）
+		/// @param size 読み込むサイズ（バイト）
+		/// @return 実際に読み込んだサイズ（バイト）
+		int64 lookahead(void* dst, int64 pos, int64 size) const override;
+
+		/// @brief 読み込み位置を変更しないでデータを展開して読み込みます。
+		/// @tparam TriviallyCopyable 読み込む値の型
+		/// @param dst 読み込み先
+		/// @return 読み込みに成功した場合 true, それ以外の場合は false
+		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
+		bool lookahead(TriviallyCopyable& dst) const;
+
+		/// @brief フレームの数を返します。
+		/// @return フレームの数
+		[[nodiscard]]
+		size_t frameCount() const noexcept;
+
+		/// @brief キャッシュするフレームの数を変更します。
+		/// @param cacheFrameCount キャッシュするフレームの数。0 の場合は 1 として扱います。
+		void setCacheFrameCount(size_t cacheFrameCount);
+
+		/// @brief 読み込み元のファイルパスを返します。
+		/// @return 読み込み元のファイルパス。ファイル以外から読み込んでいる場合は空の文字列
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		class ZstdSeekableReaderDetail;
+
+		std::shared_ptr<ZstdSeekableReaderDetail> pImpl;
+	};
+}
+
+# include "detail/ZstdSeekableReader.ipp"
@@ -0,0 +1,159 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "IWriter.hpp"
+# include "StringView.hpp"
+# include "Compression.hpp"
+
+namespace s3d
+{
+	class String;
+	using FilePath = String;
+
+	/// @brief 任意の位置から展開できる形式で、データを Zstandard 方式で圧縮して出力する Writer
+	/// @remark データを一定のサイズごとに独立したフレームとして圧縮し、最後に各フレームの位置を記録したシークテーブルを書き込みます。形式は Zstandard の seekable format に準拠します。
+	/// @remark 出力は `ZstdSeekableReader` で任意の位置から読み込めるほか、`ZstdReader` や `Compression::Decompress()` で先頭から展開することもできます。
+	/// @remark シークテーブルは `close()` で書き込まれます。`close()` を呼ばずにオブジェクトが破棄された場合も、シークテーブルを書き込みます。
+	class ZstdSeekableWriter : public IWriter
+	{
+	public:
+
+		/// @brief デフォルトのフレームのサイズ（圧縮前、バイト）
+		static constexpr size_t DefaultFrameSize = (1024 * 1024);
+
+		/// @brief フレームのサイズの最大値（圧縮前、バイト）
+		static constexpr size_t MaxFrameSize = (1024 * 1024 * 1024);
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		ZstdSeekableWriter();
+
+		/// @brief 圧縮したデータを書き込むファイルを開きます。
+		/// @param path ファイルパス
+		/// @param compressionLevel 圧縮レベル
+		/// @param frameSize 1 つのフレームに含める、圧縮前のデータのサイズ（バイト）。小さいほど任意の位置からの読み込みが速くなり、圧縮率は低下します。
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdSeekableWriter(FilePathView path, int32 compressionLevel = Compression::DefaultLevel, size_t frameSize = DefaultFrameSize);
+
+		/// @brief 圧縮したデータを IWriter に書き込みます。
+		/// @tparam Writer IWriter オブジェクトの型
+		/// @param writer IWriter オブジェクト
+		/// @param compressionLevel 圧縮レベル
+		/// @param frameSize 1 つのフレームに含める、圧縮前のデータのサイズ（バイト）。小さいほど任意の位置からの読み込みが速くなり、圧縮率は低下します。
+		template <class Writer, std::enable_if_t<std::is_base_of_v<IWriter, Writer> && !std::is_lvalue_reference_v<Writer>>* = nullptr>
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdSeekableWriter(Writer&& writer, int32 compressionLevel = Compression::DefaultLevel, size_t frameSize = DefaultFrameSize);
+
+		/// @brief 圧縮したデータを IWriter に書き込みます。
+		/// @param writer IWriter オブジェクト
+		/// @param compressionLevel 圧縮レベル
+		/// @param frameSize 1 つのフレームに含める、圧縮前のデータのサイズ（バイト）。小さいほど任意の位置からの読み込みが速くなり、圧縮率は低下します。
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdSeekableWriter(std::unique_ptr<IWriter>&& writer, int32 compressionLevel = Compression::DefaultLevel, size_t frameSize = DefaultFrameSize);
+
+		/// @brief 圧縮したデータを書き込むファイルを開きます。
+		/// @param path ファイルパス
+		/// @param compressionLevel 圧縮レベル
+		/// @param frameSize 1 つのフレームに含める、圧縮前のデータのサイズ（バイト）
+		/// @return ファイルのオープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path, int32 compressionLevel = Compression::DefaultLevel, size_t frameSize = DefaultFrameSize);
+
+		/// @brief 圧縮したデータを IWriter に書き込みます。
+		/// @tparam Writer IWriter オブジェクトの型
+		/// @param writer IWriter オブジェクト
+		/// @param compressionLevel 圧縮レベル
+		/// @param frameSize 1 つのフレームに含める、圧縮前のデータのサイズ（バイト）
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Writer, std::enable_if_t<std::is_base_of_v<IWriter, Writer> && !std::is_lvalue_reference_v<Writer>>* = nullptr>
+		bool open(Writer&& writer, int32 compressionLevel = Compression::DefaultLevel, size_t frameSize = DefaultFrameSize);
+
+		/// @brief 圧縮したデータを IWriter に書き込みます。
+		/// @param writer IWriter オブジェクト
+		/// @param compressionLevel 圧縮レベル
+		/// @param frameSize 1 つのフレームに含める、圧縮前のデータのサイズ（バイト）
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IWriter>&& writer, int32 compressionLevel = Compression::DefaultLevel, size_t frameSize = DefaultFrameSize);
+
+		/// @brief 残りのデータを圧縮し、シークテーブルを書き込んで出力先を閉じます。
+		/// @return すべてのデータの書き込みに成功した場合 true, それ以外の場合は false
+		bool close();
+
+		/// @brief 出力先が開いているかを返します。
+		/// @return 出力先が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept override;
+
+		/// @brief 出力先が開いているかを返します。
+		/// @return 出力先が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief 現在のフレームを終了し、これまでに書き込んだデータを圧縮して出力します。
+		/// @return 出力に成功した場合 true, それ以外の場合は false
+		/// @remark リプレイのキーフレームなど、読み込みを開始したい位置の直前で呼ぶと、その位置からの読み込みが速くなります。
+		bool endFrame();
+
+		/// @brief これまでに書き込んだ、圧縮前のデータのサイズを返します。
+		/// @return 圧縮前のデータのサイズ（バイト）
+		[[nodiscard]]
+		int64 size() const override;
+
+		/// @brief これまでに書き込んだ、圧縮前のデータのサイズを返します。
+		/// @return 圧縮前のデータのサイズ（バイト）
+		[[nodiscard]]
+		int64 getPos() const override;
+
+		/// @brief 書き込み位置の変更はサポートされていません。
+		/// @param pos 新しい書き込み位置（バイト）
+		/// @return `pos` が現在の書き込み位置と等しい場合 true, それ以外の場合は false
+		bool setPos(int64 pos) override;
+
+		/// @brief データを圧縮して書き込みます。
+		/// @param src 書き込むデータ
+		/// @param sizeBytes 書き込むサイズ（バイト）
+		/// @return 実際に書き込んだサイズ（バイト）
+		int64 write(const void* src, int64 sizeBytes) override;
+
+		/// @brief データを圧縮して書き込みます。
+		/// @tparam TriviallyCopyable 書き込む値の型
+		/// @param src 書き込むデータ
+		/// @return 書き込みに成功した場合 true, それ以外の場合は false
+		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
+		bool write(const TriviallyCopyable& src);
+
+		/// @brief これまでに出力したフレームの数を返します。
+		/// @return フレームの数
+		[[nodiscard]]
+		size_t frameCount() const noexcept;
+
+		/// @brief これまでに出力した、圧縮後のデータのサイズを返します。
+		/// @return 圧縮後のデータのサイズ（バイト）
+		/// @remark `close()` の後も、次にオープンするまで値を保持します。
+		[[nodiscard]]
+		int64 compressedSize() const noexcept;
+
+		/// @brief 出力先のファイルパスを返します。
+		/// @return 出力先のファイルパス。IWriter に書き込んでいる場合は空の文字列
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		class ZstdSeekableWriterDetail;
+
+		std::shared_ptr<ZstdSeekableWriterDetail> pImpl;
+	};
+}
+
+# include "detail/ZstdSeekableWriter.ipp"
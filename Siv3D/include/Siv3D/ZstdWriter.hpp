@@ -0,0 +1,155 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include "Common.hpp"
+# include "IWriter.hpp"
+# include "StringView.hpp"
+# include "Compression.hpp"
+
+namespace s3d
+{
+	class String;
+	using FilePath = String;
+	class CompressionDictionary;
+
+	/// @brief 書き込んだデータを Zstandard 方式で圧縮しながら出力する Writer
+	/// @remark 出力は `Compression::Decompress()` や `ZstdReader` で展開できます。
+	/// @remark データ全体をメモリ上に保持しないため、巨大なデータを少ないメモリで圧縮できます。`Serializer<ZstdWriter>` として使うこともできます。
+	/// @remark `close()` を呼ばずにオブジェクトが破棄された場合も、残りのデータを圧縮して書き込みます。
+	class ZstdWriter : public IWriter
+	{
+	public:
+
+		/// @brief デフォルトコンストラクタ
+		SIV3D_NODISCARD_CXX20
+		ZstdWriter();
+
+		/// @brief 圧縮したデータを書き込むファイルを開きます。
+		/// @param path ファイルパス
+		/// @param compressionLevel 圧縮レベル
+		/// @param workerCount 圧縮に使うワーカースレッドの数。0 の場合は `write()` を呼んだスレッドで圧縮します。
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdWriter(FilePathView path, int32 compressionLevel = Compression::DefaultLevel, size_t workerCount = 0);
+
+		/// @brief 圧縮したデータを IWriter に書き込みます。
+		/// @tparam Writer IWriter オブジェクトの型
+		/// @param writer IWriter オブジェクト
+		/// @param compressionLevel 圧縮レベル
+		/// @param workerCount 圧縮に使うワーカースレッドの数。0 の場合は `write()` を呼んだスレッドで圧縮します。
+		template <class Writer, std::enable_if_t<std::is_base_of_v<IWriter, Writer> && !std::is_lvalue_reference_v<Writer>>* = nullptr>
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdWriter(Writer&& writer, int32 compressionLevel = Compression::DefaultLevel, size_t workerCount = 0);
+
+		/// @brief 圧縮したデータを IWriter に書き込みます。
+		/// @param writer IWriter オブジェクト
+		/// @param compressionLevel 圧縮レベル
+		/// @param workerCount 圧縮に使うワーカースレッドの数。0 の場合は `write()` を呼んだスレッドで圧縮します。
+		SIV3D_NODISCARD_CXX20
+		explicit ZstdWriter(std::unique_ptr<IWriter>&& writer, int32 compressionLevel = Compression::DefaultLevel, size_t workerCount = 0);
+
+		/// @brief 圧縮したデータを書き込むファイルを開きます。
+		/// @param path ファイルパス
+		/// @param compressionLevel 圧縮レベル
+		/// @param workerCount 圧縮に使うワーカースレッドの数。0 の場合は `write()` を呼んだスレッドで圧縮します。
+		/// @return ファイルのオープンに成功した場合 true, それ以外の場合は false
+		bool open(FilePathView path, int32 compressionLevel = Compression::DefaultLevel, size_t workerCount = 0);
+
+		/// @brief 圧縮したデータを IWriter に書き込みます。
+		/// @tparam Writer IWriter オブジェクトの型
+		/// @param writer IWriter オブジェクト
+		/// @param compressionLevel 圧縮レベル
+		/// @param workerCount 圧縮に使うワーカースレッドの数。0 の場合は `write()` を呼んだスレッドで圧縮します。
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		template <class Writer, std::enable_if_t<std::is_base_of_v<IWriter, Writer> && !std::is_lvalue_reference_v<Writer>>* = nullptr>
+		bool open(Writer&& writer, int32 compressionLevel = Compression::DefaultLevel, size_t workerCount = 0);
+
+		/// @brief 圧縮したデータを IWriter に書き込みます。
+		/// @param writer IWriter オブジェクト
+		/// @param compressionLevel 圧縮レベル
+		/// @param workerCount 圧縮に使うワーカースレッドの数。0 の場合は `write()` を呼んだスレッドで圧縮します。
+		/// @return オープンに成功した場合 true, それ以外の場合は false
+		bool open(std::unique_ptr<IWriter>&& writer, int32 compressionLevel = Compression::DefaultLevel, size_t workerCount = 0);
+
+		/// @brief 圧縮に辞書を使います。
+		/// @param dictionary 辞書
+		/// @return 辞書の設定に成功した場合 true, それ以外の場合は false
+		/// @remark オープンした後、最初の `write()` の前に呼ぶ必要があります。辞書の作成時に指定した圧縮レベルが使われます。
+		bool setDictionary(const CompressionDictionary& dictionary);
+
+		/// @brief 残りのデータを圧縮して書き込み、出力先を閉じます。
+		/// @return すべてのデータの書き込みに成功した場合 true, それ以外の場合は false
+		bool close();
+
+		/// @brief 出力先が開いているかを返します。
+		/// @return 出力先が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		bool isOpen() const noexcept override;
+
+		/// @brief 出力先が開いているかを返します。
+		/// @return 出力先が開いている場合 true, それ以外の場合は false
+		[[nodiscard]]
+		explicit operator bool() const noexcept;
+
+		/// @brief これまでに書き込んだデータを、展開側が読み込めるように圧縮して出力します。
+		/// @return 出力に成功した場合 true, それ以外の場合は false
+		/// @remark 頻繁に呼ぶと圧縮率が低下します。
+		bool flush();
+
+		/// @brief これまでに書き込んだ、圧縮前のデータのサイズを返します。
+		/// @return 圧縮前のデータのサイズ（バイト）
+		[[nodiscard]]
+		int64 size() const override;
+
+		/// @brief これまでに書き込んだ、圧縮前のデータのサイズを返します。
+		/// @return 圧縮前のデータのサイズ（バイト）
+		[[nodiscard]]
+		int64 getPos() const override;
+
+		/// @brief 書き込み位置の変更はサポートされていません。
+		/// @param pos 新しい書き込み位置（バイト）
+		/// @return `pos` が現在の書き込み位置と等しい場合 true, それ以外の場合は false
+		bool setPos(int64 pos) override;
+
+		/// @brief データを圧縮して書き込みます。
+		/// @param src 書き込むデータ
+		/// @param sizeBytes 書き込むサイズ（バイト）
+		/// @return 実際に書き込んだサイズ（バイト）
+		int64 write(const void* src, int64 sizeBytes) override;
+
+		/// @brief データを圧縮して書き込みます。
+		/// @tparam TriviallyCopyable 書き込む値の型
+		/// @param src 書き込むデータ
+		/// @return 書き込みに成功した場合 true, それ以外の場合は false
+		SIV3D_CONCEPT_TRIVIALLY_COPYABLE
+		bool write(const TriviallyCopyable& src);
+
+		/// @brief これまでに出力した、圧縮後のデータのサイズを返します。
+		/// @return 圧縮後のデータのサイズ（バイト）
+		/// @remark `close()` の後も、次にオープンするまで値を保持します。
+		[[nodiscard]]
+		int64 compressedSize() const noexcept;
+
+		/// @brief 出力先のファイルパスを返します。
+		/// @return 出力先のファイルパス。IWriter に書き込んでいる場合は空の文字列
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		class ZstdWriterDetail;
+
+		std::shared_ptr<ZstdWriterDetail> pImpl;
+	};
+}
+
+# include "detail/ZstdWriter.ipp"
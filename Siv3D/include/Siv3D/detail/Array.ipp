@@ -1541,191 +1541,58 @@ namespace s3d
 
 	template <class Type, class Allocator>
 	template <class Fty, std::enable_if_t<std::is_invocable_r_v<bool, Fty, Type>>*>
-	inline size_t Array<Type, Allocator>::parallel_count_if(Fty f) const
+	inline size_t Array<Type, Allocator>::parallel_count_if(Fty f, const size_t grainSize) const
 	{
-	# if SIV3D_PLATFORM(WINDOWS)
-
-		return std::count_if(std::execution::par, begin(), end(), f);
-
-	# else
-
 		if (isEmpty())
 		{
 			return 0;
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return count_if(f);
-		}
-
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<std::ptrdiff_t>> futures;
-
-		auto it = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				return std::count_if(it, it + n, f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		size_t result = 0;
-		
-		if (countLeft)
-		{
-			result = std::count_if(it, it + countLeft, f);
-		}
+		std::atomic<size_t> result = 0;
 
-		for (auto& future : futures)
+		Threading::detail::ParallelForRange(0, size(), grainSize, [this, &f, &result](const size_t first, const size_t last)
 		{
-			result += future.get();
-		}
+			const size_t n = std::count_if((begin() + first), (begin() + last), f);
 
-		return result;
+			result.fetch_add(n, std::memory_order_relaxed);
+		});
 
-	# endif
+		return result.load();
 	}
 
 	template <class Type, class Allocator>
 	template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type&>>*>
-	inline void Array<Type, Allocator>::parallel_each(Fty f)
+	inline void Array<Type, Allocator>::parallel_each(Fty f, const size_t grainSize)
 	{
-	# if SIV3D_PLATFORM(WINDOWS)
-
-		std::for_each(std::execution::par, begin(), end(), f);
-
-	# else
-
 		if (isEmpty())
 		{
 			return;
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return each(f);
-		}
-
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<std::ptrdiff_t>> futures;
-
-		auto it = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				std::for_each(it, it + n, f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
-		{
-			std::for_each(it, it + countLeft, f);
-		}
-
-		for (auto& future : futures)
+		Threading::detail::ParallelForRange(0, size(), grainSize, [this, &f](const size_t first, const size_t last)
 		{
-			future.get();
-		}
-
-	# endif
+			std::for_each((begin() + first), (begin() + last), f);
+		});
 	}
 
 	template <class Type, class Allocator>
 	template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>*>
-	inline void Array<Type, Allocator>::parallel_each(Fty f) const
+	inline void Array<Type, Allocator>::parallel_each(Fty f, const size_t grainSize) const
 	{
-	# if SIV3D_PLATFORM(WINDOWS)
-
-		std::for_each(std::execution::par, begin(), end(), f);
-
-	# else
-
 		if (isEmpty())
 		{
 			return;
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return each(f);
-		}
-
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<std::ptrdiff_t>> futures;
-
-		auto it = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]()
-			{
-				std::for_each(it, it + n, f);
-			}));
-
-			it += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
-		{
-			std::for_each(it, it + countLeft, f);
-		}
-
-		for (auto& future : futures)
+		Threading::detail::ParallelForRange(0, size(), grainSize, [this, &f](const size_t first, const size_t last)
 		{
-			future.get();
-		}
-
-	# endif
+			std::for_each((begin() + first), (begin() + last), f);
+		});
 	}
 
 	template <class Type, class Allocator>
 	template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, Type>>*>
-	inline auto Array<Type, Allocator>::parallel_map(Fty f) const
+	inline auto Array<Type, Allocator>::parallel_map(Fty f, const size_t grainSize) const
 	{
 		using Ret = std::remove_cvref_t<decltype(f((*this)[0]))>;
 
@@ -1734,61 +1601,19 @@ namespace s3d
 			return Array<Ret>{};
 		}
 
-		const size_t numThreads = Threading::GetConcurrency();
-
-		if (numThreads <= 1)
-		{
-			return map(f);
-		}
-
 		Array<Ret> new_array(size());
 
-		const size_t countPerthread = Max<size_t>(1, (size() + (numThreads - 1)) / numThreads);
-
-		Array<std::future<void>> futures;
-
-		auto itDst = new_array.begin();
-		auto itSrc = begin();
-		size_t countLeft = size();
-
-		for (size_t i = 0; i < (numThreads - 1); ++i)
-		{
-			const size_t n = Min(countPerthread, countLeft);
-
-			if (n == 0)
-			{
-				break;
-			}
-
-			futures.emplace_back(std::async(std::launch::async, [=, &f]() mutable
-			{
-				const auto itSrcEnd = itSrc + n;
-
-				while (itSrc != itSrcEnd)
-				{
-					*itDst++ = f(*itSrc++);
-				}
-			}));
-
-			itDst += n;
-			itSrc += n;
-			countLeft -= n;
-		}
-
-		if (countLeft)
+		Threading::detail::ParallelForRange(0, size(), grainSize, [this, &f, &new_array](const size_t first, const size_t last)
 		{
-			const auto itSrcEnd = end();
+			auto itDst = (new_array.begin() + first);
+			auto itSrc = (begin() + first);
+			const auto itSrcEnd = (begin() + last);
 
 			while (itSrc != itSrcEnd)
 			{
 				*itDst++ = f(*itSrc++);
 			}
-		}
-
-		for (auto& future : futures)
-		{
-			future.get();
-		}
+		});
 
 		return new_array;
 	}
@@ -13,27 +13,59 @@
 
 namespace s3d
 {
+	namespace detail
+	{
+		template <class Type, class Fty, class... Args>
+		[[nodiscard]]
+		inline std::future<Type> LaunchOnThreadPool(Fty&& f, Args&&... args)
+		{
+			// std::function はコピー可能である必要があるため、std::packaged_task は shared_ptr で保持する
+			auto task = std::make_shared<std::packaged_task<Type()>>(
+				[f = std::forward<Fty>(f), ...args = std::forward<Args>(args)]() mutable -> Type
+				{
+					return std::invoke(std::move(f), std::move(args)...);
+				});
+
+			std::future<Type> future = task->get_future();
+
+			Threading::detail::SubmitTask([task = std::move(task)]() { (*task)(); });
+
+			return future;
+		}
+	}
+
 	template <class Type>
 	inline AsyncTask<Type>::AsyncTask(base_type&& other) noexcept
 		: m_data{ std::move(other) } {}
 
 	template <class Type>
 	inline AsyncTask<Type>::AsyncTask(AsyncTask&& other) noexcept
-		: m_data{ std::move(other.m_data) } {}
+		: m_data{ std::move(other.m_data) }
+		, m_waitOnRelease{ std::exchange(other.m_waitOnRelease, false) } {}
 
 	template <class Type>
 	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<std::decay_t<Fty>, std::decay_t<Args>...>>*>
 	inline AsyncTask<Type>::AsyncTask(Fty&& f, Args&&... args)
 	# if !SIV3D_PLATFORM(WEB) || defined(__EMSCRIPTEN_PTHREADS__)
-		: m_data{ std::async(std::launch::async, std::forward<Fty>(f), std::forward<Args>(args)...) } {}
+		: m_data{ detail::LaunchOnThreadPool<Type>(std::forward<Fty>(f), std::forward<Args>(args)...) }
+		, m_waitOnRelease{ true } {}
 	# else
 		: m_data{} {}
 	# endif
 
+	template <class Type>
+	inline AsyncTask<Type>::~AsyncTask()
+	{
+		waitForRelease();
+	}
+
 	template <class Type>
 	inline AsyncTask<Type>& AsyncTask<Type>::operator =(base_type&& other) noexcept
 	{
+		waitForRelease();
+
 		m_data = std::move(other);
+		m_waitOnRelease = false;
 
 		return *this;
 	}
@@ -41,7 +73,13 @@ namespace s3d
 	template <class Type>
 	inline AsyncTask<Type>& AsyncTask<Type>::operator =(AsyncTask&& other) noexcept
 	{
-		m_data = std::move(other.m_data);
+		if (this != &other)
+		{
+			waitForRelease();
+
+			m_data = std::move(other.m_data);
+			m_waitOnRelease = std::exchange(other.m_waitOnRelease, false);
+		}
 
 		return *this;
 	}
@@ -62,13 +100,15 @@ namespace s3d
 	template <class Type>
 	inline Type AsyncTask<Type>::get()
 	{
+		Threading::detail::WaitForFuture(m_data);
+
 		return m_data.get();
 	}
 
 	template <class Type>
 	inline void AsyncTask<Type>::wait() const
 	{
-		m_data.wait();
+		Threading::detail::WaitForFuture(m_data);
 	}
 
 	template <class Type>
@@ -91,6 +131,42 @@ namespace s3d
 		return m_data.share();
 	}
 
+	template <class Type>
+	inline void AsyncTask<Type>::waitForRelease() const noexcept
+	{
+		// std::async の戻り値と同様に、実行中のタスクを置き去りにしない（タスクが参照しているローカル変数や this が先に破棄されるのを防ぐ）
+		if (m_waitOnRelease && m_data.valid())
+		{
+			Threading::detail::WaitForFuture(m_data);
+		}
+	}
+
+	template <class Type>
+	template <class Fty>
+	inline auto AsyncTask<Type>::then(Fty&& f)
+	{
+		if constexpr (std::is_void_v<Type>)
+		{
+			using Result = std::invoke_result_t<std::decay_t<Fty>>;
+
+			return AsyncTask<Result>{ [antecedent = AsyncTask{ std::move(m_data) }, f = std::forward<Fty>(f)]() mutable -> Result
+			{
+				antecedent.get();
+
+				return std::invoke(std::move(f));
+			} };
+		}
+		else
+		{
+			using Result = std::invoke_result_t<std::decay_t<Fty>, Type>;
+
+			return AsyncTask<Result>{ [antecedent = AsyncTask{ std::move(m_data) }, f = std::forward<Fty>(f)]() mutable -> Result
+			{
+				return std::invoke(std::move(f), antecedent.get());
+			} };
+		}
+	}
+
 	template <class Fty, class... Args, std::enable_if_t<std::is_invocable_v<std::decay_t<Fty>, std::decay_t<Args>...>>*>
 	inline auto Async(Fty&& f, Args&&... args)
 	{
@@ -0,0 +1,74 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	inline CSVView::operator bool() const noexcept
+	{
+		return (not isEmpty());
+	}
+
+	template <class Type>
+	inline Type CSVView::get(const size_t row, const size_t column) const
+	{
+		if (const auto opt = getOpt<Type>(row, column))
+		{
+			return opt.value();
+		}
+
+		return Type();
+	}
+
+	template <class Type, class U>
+	inline Type CSVView::getOr(const size_t row, const size_t column, U&& defaultValue) const
+	{
+		return getOpt<Type>(row, column).value_or(std::forward<U>(defaultValue));
+	}
+
+	template <class Type>
+	inline Optional<Type> CSVView::getOpt(const size_t row, const size_t column) const
+	{
+		if (columns(row) <= column)
+		{
+			return none;
+		}
+
+		std::string buffer;
+
+		const String item = Unicode::FromUTF8(getUTF8(row, column, buffer));
+
+		if constexpr (std::is_same_v<Type, String>)
+		{
+			return item;
+		}
+		else
+		{
+			return ParseOpt<Type>(item);
+		}
+	}
+
+	template <class Type>
+	inline Array<Type> CSVView::column(const size_t column, const Type& defaultValue) const
+	{
+		const size_t rowCount = rows();
+
+		Array<Type> values(Arg::reserve = rowCount);
+
+		for (size_t row = 0; row < rowCount; ++row)
+		{
+			values.push_back(getOr<Type>(row, column, defaultValue));
+		}
+
+		return values;
+	}
+}
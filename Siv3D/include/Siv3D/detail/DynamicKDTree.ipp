@@ -0,0 +1,202 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	template <class DatasetAdapter>
+	inline DynamicKDTree<DatasetAdapter>::DynamicKDTree(const dataset_type& dataset)
+		: m_adapter{ std::make_unique<adapter_type>(dataset) }
+		, m_index{ std::make_unique<index_type>(Dimensions, *m_adapter, nanoflann::KDTreeSingleIndexAdaptorParams(10)) }
+		, m_removed(m_adapter->kdtree_get_point_count(), false) {}
+
+	template <class DatasetAdapter>
+	inline void DynamicKDTree<DatasetAdapter>::addPoints(const size_t count)
+	{
+		if ((not m_index) || (count == 0))
+		{
+			return;
+		}
+
+		const size_t first = m_removed.size();
+
+		m_index->addPoints(first, (first + count - 1));
+
+		m_removed.resize((first + count), false);
+	}
+
+	template <class DatasetAdapter>
+	inline void DynamicKDTree<DatasetAdapter>::removePoint(const size_t index)
+	{
+		if ((m_removed.size() <= index) || m_removed[index])
+		{
+			return;
+		}
+
+		m_index->removePoint(index);
+
+		m_removed[index] = true;
+
+		++m_numRemoved;
+	}
+
+	template <class DatasetAdapter>
+	inline void DynamicKDTree<DatasetAdapter>::release()
+	{
+		m_index.reset();
+		m_adapter.reset();
+		m_removed.clear();
+		m_numRemoved = 0;
+	}
+
+	template <class DatasetAdapter>
+	inline size_t DynamicKDTree<DatasetAdapter>::size() const noexcept
+	{
+		return (m_removed.size() - m_numRemoved);
+	}
+
+	template <class DatasetAdapter>
+	inline bool DynamicKDTree<DatasetAdapter>::isEmpty() const noexcept
+	{
+		return (size() == 0);
+	}
+
+	template <class DatasetAdapter>
+	inline Array<size_t> DynamicKDTree<DatasetAdapter>::knnSearch(const size_t k, const point_type& point) const
+	{
+		Array<size_t> results;
+
+		knnSearch(results, k, point);
+
+		return results;
+	}
+
+	template <class DatasetAdapter>
+	inline void DynamicKDTree<DatasetAdapter>::knnSearch(Array<size_t>& results, const size_t k, const point_type& point) const
+	{
+		Array<element_type> distanceSqs;
+
+		knnSearch(results, distanceSqs, k, point);
+	}
+
+	template <class DatasetAdapter>
+	inline void DynamicKDTree<DatasetAdapter>::knnSearch(Array<size_t>& results, Array<element_type>& distanceSqResults, size_t k, const point_type& point) const
+	{
+		k = Min(k, size());
+
+		results.resize(k);
+		distanceSqResults.resize(k);
+
+		if (k == 0)
+		{
+			return;
+		}
+
+		Array<double> distanceSqs(k);
+
+		nanoflann::KNNResultSet<double, size_t> resultSet{ k };
+		resultSet.init(results.data(), distanceSqs.data());
+
+		m_index->findNeighbors(resultSet, adapter_type::GetPointer(point), nanoflann::SearchParams{});
+
+		for (size_t i = 0; i < k; ++i)
+		{
+			distanceSqResults[i] = static_cast<element_type>(distanceSqs[i]);
+		}
+	}
+
+	template <class DatasetAdapter>
+	inline Array<size_t> DynamicKDTree<DatasetAdapter>::radiusSearch(const point_type& point, const element_type radius, const SortByDistance sortByDistance) const
+	{
+		Array<size_t> results;
+
+		radiusSearch(results, point, radius, sortByDistance);
+
+		return results;
+	}
+
+	template <class DatasetAdapter>
+	inline void DynamicKDTree<DatasetAdapter>::radiusSearch(Array<size_t>& results, const point_type& point, const element_type radius, const SortByDistance sortByDistance) const
+	{
+		results.clear();
+
+		if (isEmpty())
+		{
+			return;
+		}
+
+		const double radiusSq = (static_cast<double>(radius) * radius);
+		const nanoflann::SearchParams searchParams{ 32, 0.0f, sortByDistance.getBool() };
+
+		if (sortByDistance)
+		{
+			std::vector<std::pair<size_t, double>> matches;
+
+			nanoflann::RadiusResultSet<double, size_t> resultSet{ radiusSq, matches };
+
+			m_index->findNeighbors(resultSet, adapter_type::GetPointer(point), searchParams);
+
+			std::sort(matches.begin(), matches.end(), nanoflann::IndexDist_Sorter());
+
+			results.reserve(matches.size());
+
+			for (const auto& match : matches)
+			{
+				results.push_back(match.first);
+			}
+		}
+		else
+		{
+			detail::RadiusResultsAdapter<double> resultSet{ radiusSq, results };
+
+			m_index->findNeighbors(resultSet, adapter_type::GetPointer(point), searchParams);
+		}
+	}
+
+	template <class DatasetAdapter>
+	inline size_t DynamicKDTree<DatasetAdapter>::knnSearchBatch(Array<size_t>& results, const size_t k, const Array<point_type>& points) const
+	{
+		if (not m_index)
+		{
+			results.clear();
+			return 0;
+		}
+
+		return detail::KNNSearchBatch<double, adapter_type>(*m_index, size(), k, points, results, nullptr);
+	}
+
+	template <class DatasetAdapter>
+	inline size_t DynamicKDTree<DatasetAdapter>::knnSearchBatch(Array<size_t>& results, Array<element_type>& distanceSqResults, const size_t k, const Array<point_type>& points) const
+	{
+		if (not m_index)
+		{
+			results.clear();
+			distanceSqResults.clear();
+			return 0;
+		}
+
+		return detail::KNNSearchBatch<double, adapter_type>(*m_index, size(), k, points, results, &distanceSqResults);
+	}
+
+	template <class DatasetAdapter>
+	inline void DynamicKDTree<DatasetAdapter>::radiusSearchBatch(Array<size_t>& results, Array<size_t>& offsets, const Array<point_type>& points, const element_type radius, const SortByDistance sortByDistance) const
+	{
+		if (not m_index)
+		{
+			results.clear();
+			offsets.assign((points.size() + 1), 0);
+			return;
+		}
+
+		detail::RadiusSearchBatch<double, adapter_type>(*m_index, points, radius, sortByDistance, results, offsets);
+	}
+}
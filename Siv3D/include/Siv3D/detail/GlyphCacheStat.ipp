@@ -0,0 +1,27 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	inline constexpr double GlyphCacheStat::hitRate() const noexcept
+	{
+		const uint64 total = (hitCount + missCount);
+
+		if (total == 0)
+		{
+			return 0.0;
+		}
+
+		return (static_cast<double>(hitCount) / total);
+	}
+}
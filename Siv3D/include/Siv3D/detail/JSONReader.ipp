@@ -0,0 +1,90 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	inline bool IJSONHandler::onNull()
+	{
+		return true;
+	}
+
+	inline bool IJSONHandler::onBool(bool)
+	{
+		return true;
+	}
+
+	inline bool IJSONHandler::onInt(int64)
+	{
+		return true;
+	}
+
+	inline bool IJSONHandler::onUInt(const uint64 value)
+	{
+		if (value <= static_cast<uint64>(Largest<int64>))
+		{
+			return onInt(static_cast<int64>(value));
+		}
+		else
+		{
+			return onFloat(static_cast<double>(value));
+		}
+	}
+
+	inline bool IJSONHandler::onFloat(double)
+	{
+		return true;
+	}
+
+	inline bool IJSONHandler::onString(StringView)
+	{
+		return true;
+	}
+
+	inline bool IJSONHandler::onBeginObject()
+	{
+		return true;
+	}
+
+	inline bool IJSONHandler::onKey(StringView)
+	{
+		return true;
+	}
+
+	inline bool IJSONHandler::onEndObject()
+	{
+		return true;
+	}
+
+	inline bool IJSONHandler::onBeginArray()
+	{
+		return true;
+	}
+
+	inline bool IJSONHandler::onEndArray()
+	{
+		return true;
+	}
+
+	template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>*>
+	inline JSONReader::JSONReader(Reader&& reader)
+		: JSONReader{}
+	{
+		open(std::forward<Reader>(reader));
+	}
+
+	template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>*>
+	inline bool JSONReader::open(Reader&& reader)
+	{
+		return open(std::make_unique<Reader>(std::forward<Reader>(reader)));
+	}
+}
@@ -96,6 +96,170 @@ namespace s3d
 				return m_radius;
 			}
 		};
+
+		// 結果を消去せずに末尾に追加していく RadiusResultsAdapter
+		template <class _DistanceType>
+		class RadiusAppendResultsAdapter
+		{
+		public:
+
+			using DistanceType	= _DistanceType;
+
+			using IndexType		= size_t;
+
+			const DistanceType m_radius;
+
+			Array<IndexType>& m_results;
+
+			RadiusAppendResultsAdapter(DistanceType radius, Array<IndexType>& results)
+				: m_radius{ radius }
+				, m_results{ results } {}
+
+			void init() {}
+
+			void clear() {}
+
+			size_t size() const
+			{
+				return m_results.size();
+			}
+
+			constexpr bool full() const
+			{
+				return true;
+			}
+
+			bool addPoint(const DistanceType, const IndexType index)
+			{
+				m_results.push_back(index);
+
+				return true;
+			}
+
+			DistanceType worstDist() const
+			{
+				return m_radius;
+			}
+		};
+
+		// 一括検索で、1 つのタスクがまとめて処理する検索の数
+		inline constexpr size_t KDTreeBatchGrainSize = 256;
+
+		template <class DistanceType, class Adapter, class Index>
+		inline size_t KNNSearchBatch(const Index& index, const size_t num_elements, size_t k,
+			const Array<typename Adapter::point_type>& points, Array<size_t>& results, Array<typename Adapter::element_type>* distanceSqResults)
+		{
+			// 要素数より多くは見つからないので、すべての検索で結果の個数が k になるようにする
+			k = Min(k, num_elements);
+
+			results.resize(points.size() * k);
+
+			if (distanceSqResults)
+			{
+				distanceSqResults->resize(points.size() * k);
+			}
+
+			if (k == 0)
+			{
+				return 0;
+			}
+
+			Threading::detail::ParallelForRange(0, points.size(), KDTreeBatchGrainSize, [&](const size_t begin, const size_t end)
+			{
+				Array<DistanceType> distanceSqs(k);
+
+				nanoflann::KNNResultSet<DistanceType, size_t> resultSet{ k };
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					resultSet.init((results.data() + (i * k)), distanceSqs.data());
+
+					index.findNeighbors(resultSet, Adapter::GetPointer(points[i]), nanoflann::SearchParams{});
+
+					if (distanceSqResults)
+					{
+						auto* pDst = (distanceSqResults->data() + (i * k));
+
+						for (const auto& distanceSq : distanceSqs)
+						{
+							*pDst++ = static_cast<typename Adapter::element_type>(distanceSq);
+						}
+					}
+				}
+			});
+
+			return k;
+		}
+
+		template <class DistanceType, class Adapter, class Index>
+		inline void RadiusSearchBatch(const Index& index, const Array<typename Adapter::point_type>& points, const typename Adapter::element_type radius,
+			const SortByDistance sortByDistance, Array<size_t>& results, Array<size_t>& offsets)
+		{
+			const size_t num_points = points.size();
+			const size_t num_chunks = ((num_points + KDTreeBatchGrainSize - 1) / KDTreeBatchGrainSize);
+
+			offsets.resize(num_points + 1);
+			offsets[0] = 0;
+
+			// 結果の個数は事前にわからないので、チャンクごとの配列に集めてから連結する
+			Array<Array<size_t>> chunkResults(num_chunks);
+
+			const DistanceType radiusSq = (static_cast<DistanceType>(radius) * radius);
+			const nanoflann::SearchParams searchParams{ 32, 0.0f, sortByDistance.getBool() };
+
+			Threading::detail::ParallelForRange(0, num_points, KDTreeBatchGrainSize, [&](const size_t begin, const size_t end)
+			{
+				std::vector<std::pair<size_t, DistanceType>> matches;
+
+				// 呼び出し元のスレッドだけで処理する場合は、複数のチャンクをまとめて渡される
+				for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += KDTreeBatchGrainSize)
+				{
+					const size_t chunkEnd = Min((chunkBegin + KDTreeBatchGrainSize), end);
+					Array<size_t>& chunk = chunkResults[chunkBegin / KDTreeBatchGrainSize];
+
+					for (size_t i = chunkBegin; i < chunkEnd; ++i)
+					{
+						const size_t previousSize = chunk.size();
+
+						if (sortByDistance)
+						{
+							nanoflann::RadiusResultSet<DistanceType, size_t> resultSet{ radiusSq, matches };
+
+							index.findNeighbors(resultSet, Adapter::GetPointer(points[i]), searchParams);
+
+							std::sort(matches.begin(), matches.end(), nanoflann::IndexDist_Sorter());
+
+							for (const auto& match : matches)
+							{
+								chunk.push_back(match.first);
+							}
+						}
+						else
+						{
+							RadiusAppendResultsAdapter<DistanceType> resultSet{ radiusSq, chunk };
+
+							index.findNeighbors(resultSet, Adapter::GetPointer(points[i]), searchParams);
+						}
+
+						offsets[i + 1] = (chunk.size() - previousSize);
+					}
+				}
+			});
+
+			for (size_t i = 0; i < num_points; ++i)
+			{
+				offsets[i + 1] += offsets[i];
+			}
+
+			results.resize(offsets.back());
+
+			Threading::ParallelFor(num_chunks, [&](const size_t chunkIndex)
+			{
+				const Array<size_t>& chunk = chunkResults[chunkIndex];
+
+				std::copy(chunk.begin(), chunk.end(), (results.begin() + offsets[chunkIndex * KDTreeBatchGrainSize]));
+			}, 1);
+		}
 	}
 
 	template <class DatasetAdapter>
@@ -204,4 +368,22 @@ namespace s3d
 			m_index.radiusSearchCustomCallback(adapter_type::GetPointer(point), resultSet, searchParams);
 		}
 	}
+
+	template <class DatasetAdapter>
+	inline size_t KDTree<DatasetAdapter>::knnSearchBatch(Array<size_t>& results, const size_t k, const Array<point_type>& points) const
+	{
+		return detail::KNNSearchBatch<double, adapter_type>(m_index, m_index.size(m_index), k, points, results, nullptr);
+	}
+
+	template <class DatasetAdapter>
+	inline size_t KDTree<DatasetAdapter>::knnSearchBatch(Array<size_t>& results, Array<element_type>& distanceSqResults, const size_t k, const Array<point_type>& points) const
+	{
+		return detail::KNNSearchBatch<double, adapter_type>(m_index, m_index.size(m_index), k, points, results, &distanceSqResults);
+	}
+
+	template <class DatasetAdapter>
+	inline void KDTree<DatasetAdapter>::radiusSearchBatch(Array<size_t>& results, Array<size_t>& offsets, const Array<point_type>& points, const element_type radius, const SortByDistance sortByDistance) const
+	{
+		detail::RadiusSearchBatch<double, adapter_type>(m_index, points, radius, sortByDistance, results, offsets);
+	}
 }
@@ -0,0 +1,426 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	namespace detail
+	{
+		// findPairs() で、1 つのタスクがまとめて処理するバケットの数
+		inline constexpr size_t SpatialHashGridPairGrainSize = 1024;
+
+		inline constexpr uint32 SpatialHashGridInvalidIndex = 0xFFFFFFFFu;
+
+		[[nodiscard]]
+		inline constexpr RectF SpatialHashGridBoundingRect(const Vec2& point) noexcept
+		{
+			return{ point, 0.0, 0.0 };
+		}
+
+		[[nodiscard]]
+		inline constexpr RectF SpatialHashGridBoundingRect(const Point& point) noexcept
+		{
+			return{ point, 0.0, 0.0 };
+		}
+
+		[[nodiscard]]
+		inline constexpr RectF SpatialHashGridBoundingRect(const RectF& rect) noexcept
+		{
+			return rect;
+		}
+
+		[[nodiscard]]
+		inline constexpr RectF SpatialHashGridBoundingRect(const Rect& rect) noexcept
+		{
+			return rect;
+		}
+
+		[[nodiscard]]
+		inline constexpr RectF SpatialHashGridBoundingRect(const RoundRect& roundRect) noexcept
+		{
+			return roundRect.rect;
+		}
+
+		template <class Shape>
+		[[nodiscard]]
+		inline RectF SpatialHashGridBoundingRect(const Shape& shape)
+		{
+			return shape.boundingRect();
+		}
+
+		// 境界を含めて重なっているか（大きさ 0 の要素も扱えるようにする）
+		[[nodiscard]]
+		inline constexpr bool SpatialHashGridOverlaps(const RectF& a, const RectF& b) noexcept
+		{
+			return (a.x <= (b.x + b.w))
+				&& (b.x <= (a.x + a.w))
+				&& (a.y <= (b.y + b.h))
+				&& (b.y <= (a.y + a.h));
+		}
+
+		[[nodiscard]]
+		inline size_t SpatialHashGridTableSize(const size_t requestedTableSize, const size_t num_elements) noexcept
+		{
+			const size_t minTableSize = (requestedTableSize ? requestedTableSize : Max<size_t>((num_elements * 2), 64));
+
+			size_t tableSize = 1;
+
+			while ((tableSize < minTableSize) && (tableSize < (size_t{ 1 } << 31)))
+			{
+				tableSize <<= 1;
+			}
+
+			return tableSize;
+		}
+	}
+
+	template <class Type>
+	inline SpatialHashGrid2D<Type>::SpatialHashGrid2D(const double cellSize, const size_t tableSize)
+		: m_cellSize{ cellSize }
+		, m_invCellSize{ (1.0 / cellSize) }
+		, m_requestedTableSize{ tableSize } {}
+
+	template <class Type>
+	template <class Shape>
+	inline size_t SpatialHashGrid2D<Type>::add(const Type& value, const Shape& shape)
+	{
+		m_values.push_back(value);
+		m_rects.push_back(detail::SpatialHashGridBoundingRect(shape));
+		return (m_values.size() - 1);
+	}
+
+	template <class Type>
+	template <class Shape>
+	inline void SpatialHashGrid2D<Type>::update(const size_t index, const Shape& shape)
+	{
+		m_rects[index] = detail::SpatialHashGridBoundingRect(shape);
+	}
+
+	template <class Type>
+	inline void SpatialHashGrid2D<Type>::clear()
+	{
+		m_values.clear();
+		m_rects.clear();
+		m_bucketStarts.clear();
+		m_entries.clear();
+		m_bucketMask = 0;
+		m_numIndexed = 0;
+	}
+
+	template <class Type>
+	inline void SpatialHashGrid2D<Type>::build()
+	{
+		m_numIndexed = m_rects.size();
+
+		const size_t tableSize = detail::SpatialHashGridTableSize(m_requestedTableSize, m_numIndexed);
+		m_bucketMask = static_cast<uint32>(tableSize - 1);
+
+		// 各バケットに入る要素数を数える（1 つの要素が同じバケットに重複して入らないようにする）
+		m_bucketStarts.assign((tableSize + 1), 0);
+		m_workspace.assign(tableSize, detail::SpatialHashGridInvalidIndex);
+
+		for (size_t i = 0; i < m_numIndexed; ++i)
+		{
+			const uint32 index = static_cast<uint32>(i);
+
+			forEachBucket(m_rects[i], [&](const uint32 bucket)
+			{
+				if (m_workspace[bucket] != index)
+				{
+					m_workspace[bucket] = index;
+					++m_bucketStarts[bucket + 1];
+				}
+			});
+		}
+
+		for (size_t i = 0; i < tableSize; ++i)
+		{
+			m_bucketStarts[i + 1] += m_bucketStarts[i];
+		}
+
+		// 要素のインデックスをバケットの順に並べる
+		m_entries.resize(m_bucketStarts.back());
+		std::copy(m_bucketStarts.begin(), (m_bucketStarts.end() - 1), m_workspace.begin());
+
+		for (size_t i = 0; i < m_numIndexed; ++i)
+		{
+			const uint32 index = static_cast<uint32>(i);
+
+			forEachBucket(m_rects[i], [&](const uint32 bucket)
+			{
+				uint32& cursor = m_workspace[bucket];
+
+				if ((cursor != m_bucketStarts[bucket]) && (m_entries[cursor - 1] == index))
+				{
+					return;
+				}
+
+				m_entries[cursor++] = index;
+			});
+		}
+	}
+
+	template <class Type>
+	inline size_t SpatialHashGrid2D<Type>::size() const noexcept
+	{
+		return m_values.size();
+	}
+
+	template <class Type>
+	inline bool SpatialHashGrid2D<Type>::isEmpty() const noexcept
+	{
+		return m_values.isEmpty();
+	}
+
+	template <class Type>
+	inline double SpatialHashGrid2D<Type>::cellSize() const noexcept
+	{
+		return m_cellSize;
+	}
+
+	template <class Type>
+	inline const Type& SpatialHashGrid2D<Type>::operator [](const size_t index) const
+	{
+		return m_values[index];
+	}
+
+	template <class Type>
+	inline const RectF& SpatialHashGrid2D<Type>::getBoundingRect(const size_t index) const
+	{
+		return m_rects[index];
+	}
+
+	template <class Type>
+	template <class Shape>
+	inline Array<Type> SpatialHashGrid2D<Type>::query(const Shape& shape) const
+	{
+		Array<Type> results;
+
+		query(results, shape);
+
+		return results;
+	}
+
+	template <class Type>
+	template <class Shape>
+	inline void SpatialHashGrid2D<Type>::query(Array<Type>& results, const Shape& shape) const
+	{
+		results.clear();
+
+		if (m_numIndexed == 0)
+		{
+			return;
+		}
+
+		const RectF queryRect = detail::SpatialHashGridBoundingRect(shape);
+		const CellRange range = toCellRange(queryRect);
+		const uint64 num_cells = (static_cast<uint64>(range.maxX - range.minX + 1) * static_cast<uint64>(range.maxY - range.minY + 1));
+
+		// 検索範囲のセル数が要素数より多い場合は、すべての要素を調べるほうが速い
+		if (m_numIndexed < num_cells)
+		{
+			for (size_t i = 0; i < m_numIndexed; ++i)
+			{
+				if (intersects(i, queryRect, shape))
+				{
+					results.push_back(m_values[i]);
+				}
+			}
+
+			return;
+		}
+
+		for (int32 cellY = range.minY; cellY <= range.maxY; ++cellY)
+		{
+			for (int32 cellX = range.minX; cellX <= range.maxX; ++cellX)
+			{
+				const uint32 bucket = toBucket(cellX, cellY);
+				const uint32* pEntry = (m_entries.data() + m_bucketStarts[bucket]);
+				const uint32* const pEntryEnd = (m_entries.data() + m_bucketStarts[bucket + 1]);
+
+				for (; pEntry != pEntryEnd; ++pEntry)
+				{
+					const uint32 index = *pEntry;
+					const RectF& rect = m_rects[index];
+
+					if (not detail::SpatialHashGridOverlaps(rect, queryRect))
+					{
+						continue;
+					}
+
+					// 複数のセルにまたがる要素は、重なりの左上の点を含むセルでだけ報告する
+					if ((toCell(Max(rect.x, queryRect.x)) != cellX)
+						|| (toCell(Max(rect.y, queryRect.y)) != cellY))
+					{
+						continue;
+					}
+
+					if (intersects(index, queryRect, shape))
+					{
+						results.push_back(m_values[index]);
+					}
+				}
+			}
+		}
+	}
+
+	template <class Type>
+	inline Array<typename SpatialHashGrid2D<Type>::pair_type> SpatialHashGrid2D<Type>::findPairs() const
+	{
+		Array<pair_type> results;
+
+		findPairs(results);
+
+		return results;
+	}
+
+	template <class Type>
+	inline void SpatialHashGrid2D<Type>::findPairs(Array<pair_type>& results) const
+	{
+		results.clear();
+
+		if (m_numIndexed == 0)
+		{
+			return;
+		}
+
+		const size_t tableSize = (m_bucketStarts.size() - 1);
+		const size_t num_chunks = ((tableSize + detail::SpatialHashGridPairGrainSize - 1) / detail::SpatialHashGridPairGrainSize);
+
+		// 結果の個数は事前にわからないので、チャンクごとの配列に集めてから連結する
+		Array<Array<pair_type>> chunkResults(num_chunks);
+
+		Threading::detail::ParallelForRange(0, tableSize, detail::SpatialHashGridPairGrainSize, [&](const size_t begin, const size_t end)
+		{
+			// 呼び出し元のスレッドだけで処理する場合は、複数のチャンクをまとめて渡される
+			for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += detail::SpatialHashGridPairGrainSize)
+			{
+				const size_t chunkEnd = Min((chunkBegin + detail::SpatialHashGridPairGrainSize), end);
+				Array<pair_type>& chunk = chunkResults[chunkBegin / detail::SpatialHashGridPairGrainSize];
+
+				for (size_t bucket = chunkBegin; bucket < chunkEnd; ++bucket)
+				{
+					const uint32* const pBegin = (m_entries.data() + m_bucketStarts[bucket]);
+					const uint32* const pEnd = (m_entries.data() + m_bucketStarts[bucket + 1]);
+
+					for (const uint32* pA = pBegin; pA != pEnd; ++pA)
+					{
+						const RectF& a = m_rects[*pA];
+
+						for (const uint32* pB = (pA + 1); pB != pEnd; ++pB)
+						{
+							const RectF& b = m_rects[*pB];
+
+							if (not detail::SpatialHashGridOverlaps(a, b))
+							{
+								continue;
+							}
+
+							// 複数のバケットで見つかるペアは、重なりの左上の点を含むセルのバケットでだけ報告する
+							if (toBucket(toCell(Max(a.x, b.x)), toCell(Max(a.y, b.y))) != bucket)
+							{
+								continue;
+							}
+
+							chunk.emplace_back(m_values[*pA], m_values[*pB]);
+						}
+					}
+				}
+			}
+		});
+
+		size_t num_pairs = 0;
+
+		for (const auto& chunk : chunkResults)
+		{
+			num_pairs += chunk.size();
+		}
+
+		results.reserve(num_pairs);
+
+		for (const auto& chunk : chunkResults)
+		{
+			results.insert(results.end(), chunk.begin(), chunk.end());
+		}
+	}
+
+	template <class Type>
+	inline int32 SpatialHashGrid2D<Type>::toCell(const double v) const noexcept
+	{
+		// 極端に大きな座標でも、セルの範囲の計算があふれないようにする
+		return static_cast<int32>(Clamp(std::floor(v * m_invCellSize), -1073741824.0, 1073741823.0));
+	}
+
+	template <class Type>
+	inline typename SpatialHashGrid2D<Type>::CellRange SpatialHashGrid2D<Type>::toCellRange(const RectF& rect) const noexcept
+	{
+		return{ toCell(rect.x), toCell(rect.y), toCell(rect.x + rect.w), toCell(rect.y + rect.h) };
+	}
+
+	template <class Type>
+	inline uint32 SpatialHashGrid2D<Type>::toBucket(const int32 cellX, const int32 cellY) const noexcept
+	{
+		return (((static_cast<uint32>(cellX) * 73856093u) ^ (static_cast<uint32>(cellY) * 19349663u)) & m_bucketMask);
+	}
+
+	template <class Type>
+	template <class Fty>
+	inline void SpatialHashGrid2D<Type>::forEachBucket(const RectF& rect, Fty f) const
+	{
+		const CellRange range = toCellRange(rect);
+		const uint64 num_cells = (static_cast<uint64>(range.maxX - range.minX + 1) * static_cast<uint64>(range.maxY - range.minY + 1));
+
+		// ハッシュテーブルより多くのセルにまたがる要素は、すべてのバケットに入れる
+		if (m_bucketMask < num_cells)
+		{
+			for (uint64 bucket = 0; bucket <= m_bucketMask; ++bucket)
+			{
+				f(static_cast<uint32>(bucket));
+			}
+
+			return;
+		}
+
+		for (int32 cellY = range.minY; cellY <= range.maxY; ++cellY)
+		{
+			for (int32 cellX = range.minX; cellX <= range.maxX; ++cellX)
+			{
+				f(toBucket(cellX, cellY));
+			}
+		}
+	}
+
+	template <class Type>
+	template <class Shape>
+	inline bool SpatialHashGrid2D<Type>::intersects(const size_t index, const RectF& queryRect, const Shape& shape) const
+	{
+		const RectF& rect = m_rects[index];
+
+		if (not detail::SpatialHashGridOverlaps(rect, queryRect))
+		{
+			return false;
+		}
+
+		if constexpr (std::is_same_v<Shape, RectF> || std::is_same_v<Shape, Rect>)
+		{
+			return true;
+		}
+		else if ((rect.w == 0.0) && (rect.h == 0.0))
+		{
+			return Geometry2D::Intersect(rect.pos, shape);
+		}
+		else
+		{
+			return Geometry2D::Intersect(rect, shape);
+		}
+	}
+}
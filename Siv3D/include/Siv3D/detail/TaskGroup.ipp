@@ -0,0 +1,27 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	template <class Fty, std::enable_if_t<std::is_invocable_v<std::decay_t<Fty>>>*>
+	inline void TaskGroup::run(Fty&& f)
+	{
+		m_state->pendingTasks.fetch_add(1, std::memory_order_relaxed);
+
+		m_state->push([f = std::forward<Fty>(f)]() mutable { std::invoke(f); });
+
+		// スレッドプールには、グループのタスクを 1 つ取り出して実行するタスクを追加する。
+		// wait() で先に実行されていた場合は何もしない
+		Threading::detail::SubmitTask([state = m_state]() { state->runOne(); });
+	}
+}
@@ -0,0 +1,116 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	namespace Threading
+	{
+		namespace detail
+		{
+			template <class Fty>
+			inline void ParallelForRange(const size_t first, const size_t last, const size_t grainSize, Fty&& f)
+			{
+				using Function = std::remove_reference_t<Fty>;
+
+				ParallelForRangeImpl(first, last, grainSize,
+					[](void* context, const size_t begin, const size_t end)
+					{
+						(*static_cast<Function*>(context))(begin, end);
+					},
+					const_cast<void*>(static_cast<const void*>(std::addressof(f))));
+			}
+
+			template <class Future>
+			inline void WaitForFuture(const Future& future)
+			{
+				if ((not IsWorkerThread())
+					|| (future.wait_for(std::chrono::seconds{ 0 }) == std::future_status::ready))
+				{
+					future.wait();
+					return;
+				}
+
+				// ワーカーが 1 つ減る間、代わりのスレッドがキューのタスクを処理する
+				BeginBlockingWait();
+				future.wait();
+				EndBlockingWait();
+			}
+		}
+
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t>>*>
+		inline void ParallelFor(const size_t first, const size_t last, Fty f, const size_t grainSize)
+		{
+			detail::ParallelForRange(first, last, grainSize, [&f](const size_t begin, const size_t end)
+			{
+				for (size_t i = begin; i < end; ++i)
+				{
+					f(i);
+				}
+			});
+		}
+
+		template <class Fty, std::enable_if_t<std::is_invocable_v<Fty, size_t>>*>
+		inline void ParallelFor(const size_t count, Fty f, const size_t grainSize)
+		{
+			ParallelFor(0, count, std::move(f), grainSize);
+		}
+
+		template <class Type, class MapFunction, class ReduceFunction,
+			std::enable_if_t<std::is_invocable_v<MapFunction, size_t>>*,
+			std::enable_if_t<std::is_invocable_r_v<Type, ReduceFunction, Type, Type>>*>
+		inline Type ParallelReduce(const size_t first, const size_t last, Type identity, MapFunction map, ReduceFunction reduce, size_t grainSize)
+		{
+			if (last <= first)
+			{
+				return identity;
+			}
+
+			const size_t count = (last - first);
+			grainSize = ResolveGrainSize(count, grainSize);
+
+			// 部分結果をチャンクの位置に格納し、最後に先頭から順に集約することで、結果をスケジューリングに依存させない
+			const size_t numChunks = ((count + grainSize - 1) / grainSize);
+			struct Partial
+			{
+				Type value;
+			};
+
+			std::vector<Partial> partials(numChunks, Partial{ identity });
+
+			detail::ParallelForRange(first, last, grainSize, [&](const size_t begin, const size_t end)
+			{
+				for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize)
+				{
+					const size_t chunkEnd = (((end - chunkBegin) < grainSize) ? end : (chunkBegin + grainSize));
+					Type result = identity;
+
+					for (size_t i = chunkBegin; i < chunkEnd; ++i)
+					{
+						result = reduce(std::move(result), map(i));
+					}
+
+					partials[(chunkBegin - first) / grainSize].value = std::move(result);
+				}
+			});
+
+			Type result = std::move(identity);
+
+			for (auto& partial : partials)
+			{
+				result = reduce(std::move(result), std::move(partial.value));
+			}
+
+			return result;
+		}
+	}
+}
@@ -0,0 +1,39 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>*>
+	inline ZstdReader::ZstdReader(Reader&& reader)
+		: ZstdReader{}
+	{
+		open(std::forward<Reader>(reader));
+	}
+
+	template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>*>
+	inline bool ZstdReader::open(Reader&& reader)
+	{
+		return open(std::make_unique<Reader>(std::forward<Reader>(reader)));
+	}
+
+	inline bool ZstdReader::supportsLookahead() const noexcept
+	{
+		return false;
+	}
+
+	SIV3D_CONCEPT_TRIVIALLY_COPYABLE_
+	inline bool ZstdReader::read(TriviallyCopyable& dst)
+	{
+		return (read(std::addressof(dst), sizeof(TriviallyCopyable)) == sizeof(TriviallyCopyable));
+	}
+}
@@ -0,0 +1,45 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>*>
+	inline ZstdSeekableReader::ZstdSeekableReader(Reader&& reader, const size_t cacheFrameCount)
+		: ZstdSeekableReader{}
+	{
+		open(std::forward<Reader>(reader), cacheFrameCount);
+	}
+
+	template <class Reader, std::enable_if_t<std::is_base_of_v<IReader, Reader> && !std::is_lvalue_reference_v<Reader>>*>
+	inline bool ZstdSeekableReader::open(Reader&& reader, const size_t cacheFrameCount)
+	{
+		return open(std::make_unique<Reader>(std::forward<Reader>(reader)), cacheFrameCount);
+	}
+
+	inline bool ZstdSeekableReader::supportsLookahead() const noexcept
+	{
+		return true;
+	}
+
+	SIV3D_CONCEPT_TRIVIALLY_COPYABLE_
+	inline bool ZstdSeekableReader::read(TriviallyCopyable& dst)
+	{
+		return (read(std::addressof(dst), sizeof(TriviallyCopyable)) == sizeof(TriviallyCopyable));
+	}
+
+	SIV3D_CONCEPT_TRIVIALLY_COPYABLE_
+	inline bool ZstdSeekableReader::lookahead(TriviallyCopyable& dst) const
+	{
+		return (lookahead(std::addressof(dst), sizeof(TriviallyCopyable)) == sizeof(TriviallyCopyable));
+	}
+}
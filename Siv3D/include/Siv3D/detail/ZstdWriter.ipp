@@ -0,0 +1,34 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+
+namespace s3d
+{
+	template <class Writer, std::enable_if_t<std::is_base_of_v<IWriter, Writer> && !std::is_lvalue_reference_v<Writer>>*>
+	inline ZstdWriter::ZstdWriter(Writer&& writer, const int32 compressionLevel, const size_t workerCount)
+		: ZstdWriter{}
+	{
+		open(std::forward<Writer>(writer), compressionLevel, workerCount);
+	}
+
+	template <class Writer, std::enable_if_t<std::is_base_of_v<IWriter, Writer> && !std::is_lvalue_reference_v<Writer>>*>
+	inline bool ZstdWriter::open(Writer&& writer, const int32 compressionLevel, const size_t workerCount)
+	{
+		return open(std::make_unique<Writer>(std::forward<Writer>(writer)), compressionLevel, workerCount);
+	}
+
+	SIV3D_CONCEPT_TRIVIALLY_COPYABLE_
+	inline bool ZstdWriter::write(const TriviallyCopyable& src)
+	{
+		return (write(std::addressof(src), sizeof(TriviallyCopyable)) == sizeof(TriviallyCopyable));
+	}
+}
@@ -18,6 +18,7 @@
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/EnvironmentVariable.hpp>
 # include <Siv3D/INI.hpp>
+# include <Siv3D/VirtualFileSystem/IVirtualFileSystem.hpp>
 
 namespace s3d
 {
@@ -247,6 +248,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isFile(path) || pVirtualFileSystem->isDirectory(path))
+				{
+					return true;
+				}
+			}
+
 			return detail::Exists(path);
 		}
 
@@ -257,6 +266,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isDirectory(path))
+				{
+					return true;
+				}
+			}
+
 			return detail::IsDirectory(path);
 		}
 
@@ -267,6 +284,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isFile(path))
+				{
+					return true;
+				}
+			}
+
 			return detail::IsRegular(path);
 		}
 
@@ -384,6 +409,14 @@ namespace s3d
 				return 0;
 			}
 			
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (const int64 size = pVirtualFileSystem->fileSize(path); 0 <= size)
+				{
+					return size;
+				}
+			}
+
 			struct stat s;
 			if (!detail::GetStat(path, s))
 			{
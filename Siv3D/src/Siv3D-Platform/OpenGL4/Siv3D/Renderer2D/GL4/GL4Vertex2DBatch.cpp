@@ -17,29 +17,35 @@ namespace s3d
 {
 	namespace detail
 	{
-		static size_t CalculateNewArraySize(const size_t current, const size_t target) noexcept
+		static void SetVertex2DAttributes(const GLuint vao, const GLuint vertexBuffer, const GLuint indexBuffer)
 		{
-			size_t newArraySize = current * 2;
-
-			while (newArraySize < target)
+			::glBindVertexArray(vao);
 			{
-				newArraySize *= 2;
-			}
+				::glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer);
 
-			return newArraySize;
+				::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)0);	// Vertex2D::pos
+				::glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)8);	// Vertex2D::tex
+				::glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)16);	// Vertex2D::color
+
+				::glEnableVertexAttribArray(0);
+				::glEnableVertexAttribArray(1);
+				::glEnableVertexAttribArray(2);
+
+				::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, indexBuffer);
+			}
+			::glBindVertexArray(0);
 		}
 	}
 
 	GL4Vertex2DBatch::GL4Vertex2DBatch()
-		: m_vertexArray(InitialVertexArraySize)
-		, m_indexArray(InitialIndexArraySize)
-		, m_batches(1)
 	{
 
 	}
 
 	GL4Vertex2DBatch::~GL4Vertex2DBatch()
 	{
+		releaseRingBuffer();
+
 		if (m_indexBuffer)
 		{
 			::glDeleteBuffers(1, &m_indexBuffer);
@@ -67,122 +73,106 @@ namespace s3d
 
 		::glBindVertexArray(m_vao);
 		{
-			{
-				::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
-				::glBufferData(GL_ARRAY_BUFFER, (sizeof(Vertex2D) * VertexBufferSize), nullptr, GL_DYNAMIC_DRAW);
-			}
+			::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+			::glBufferData(GL_ARRAY_BUFFER, (sizeof(Vertex2D) * VertexBufferSize), nullptr, GL_DYNAMIC_DRAW);
 
-			{
-				::glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)0);	// Vertex2D::pos
-				::glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)8);	// Vertex2D::tex
-				::glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, 32, (const GLubyte*)16);	// Vertex2D::color
+			::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
+			::glBufferData(GL_ELEMENT_ARRAY_BUFFER, (sizeof(Vertex2D::IndexType) * IndexBufferSize), nullptr, GL_DYNAMIC_DRAW);
+		}
+		::glBindVertexArray(0);
 
-				::glEnableVertexAttribArray(0);
-				::glEnableVertexAttribArray(1);
-				::glEnableVertexAttribArray(2);
-			}
+		detail::SetVertex2DAttributes(m_vao, m_vertexBuffer, m_indexBuffer);
 
-			{
-				::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer);
-				::glBufferData(GL_ELEMENT_ARRAY_BUFFER, (sizeof(Vertex2D::IndexType) * IndexBufferSize), nullptr, GL_DYNAMIC_DRAW);
-			}
+		m_currentVAO = m_vao;
+
+		// 永続マップ（OpenGL 4.4 または GL_ARB_buffer_storage）が使える場合は、リングバッファに直接書き込む
+		if ((GLEW_VERSION_4_4 || GLEW_ARB_buffer_storage)
+			&& initRingBuffer())
+		{
+			m_streamingMode = StreamingMode::PersistentMapped;
+			beginRingSegment();
+			LOG_INFO(U"ℹ️ GL4Vertex2DBatch: persistent-mapped streaming ({} segments x {} vertices)"_fmt(RingSegmentCount, RingSegmentVertexCount));
+		}
+		else
+		{
+			LOG_INFO(U"ℹ️ GL4Vertex2DBatch: buffer orphaning streaming");
 		}
-		::glBindVertexArray(0);
 
 		return true;
 	}
 
 	Vertex2DBufferPointer GL4Vertex2DBatch::requestBuffer(const uint16 vertexSize, const uint32 indexSize, GL4Renderer2DCommandManager& commandManager)
 	{
-		// VB
-		if (const uint32 vertexArrayWritePosTarget = m_vertexArrayWritePos + vertexSize;
-			m_vertexArray.size() < vertexArrayWritePosTarget) SIV3D_UNLIKELY
-		{
-			if (MaxVertexArraySize < vertexArrayWritePosTarget) SIV3D_UNLIKELY
-			{
-				return{ nullptr, 0, 0 };
-			}
+		const size_t batchIndex = m_queue.num_batches();
 
-			const size_t newVertexArraySize = detail::CalculateNewArraySize(m_vertexArray.size(), vertexArrayWritePosTarget);
-			LOG_TRACE(U"ℹ️ Resized GL4Vertex2DBatch::m_vertexArray (size: {} -> {})"_fmt(m_vertexArray.size(), newVertexArraySize));
-			m_vertexArray.resize(newVertexArraySize);
-		}
+		const Vertex2DBufferPointer pointer = m_queue.requestBuffer(vertexSize, indexSize);
 
-		// IB
-		if (const uint32 indexArrayWritePosTarget = m_indexArrayWritePos + indexSize;
-			m_indexArray.size() < indexArrayWritePosTarget) SIV3D_UNLIKELY
+		if (batchIndex != m_queue.num_batches())
 		{
-			if (MaxIndexArraySize < indexArrayWritePosTarget) SIV3D_UNLIKELY
-			{
-				return{ nullptr, 0, 0 };
-			}
-
-			const size_t newIndexArraySize = detail::CalculateNewArraySize(m_indexArray.size(), indexArrayWritePosTarget);
-			LOG_TRACE(U"ℹ️ Resized GL4Vertex2DBatch::m_indexArray (size: {} -> {})"_fmt(m_indexArray.size(), newIndexArraySize));
-			m_indexArray.resize(newIndexArraySize);
-		}
-
-		if (const auto& lastbatch = m_batches.back();
-			(VertexBufferSize < (lastbatch.vertexPos + vertexSize) || IndexBufferSize < (lastbatch.indexPos + indexSize)))
-		{
-			commandManager.pushUpdateBuffers(static_cast<uint32>(m_batches.size()));
-			m_batches.emplace_back();
+			commandManager.pushUpdateBuffers(static_cast<uint32>(batchIndex));
 		}
 
-		auto& lastbatch = m_batches.back();
-		Vertex2D* const pVertex = (m_vertexArray.data() + m_vertexArrayWritePos);
-		Vertex2D::IndexType* const pIndex = (m_indexArray.data() + m_indexArrayWritePos);
-		const auto indexOffset = lastbatch.vertexPos;
-
-		advanceArrayWritePos(vertexSize, indexSize);
-		lastbatch.advance(vertexSize, indexSize);
-
-		return{ pVertex, pIndex, indexOffset };
+		return pointer;
 	}
 
 	size_t GL4Vertex2DBatch::num_batches() const noexcept
 	{
-		return m_batches.size();
+		return m_queue.num_batches();
 	}
 
 	void GL4Vertex2DBatch::reset()
 	{
-		m_batches.clear();
-		m_batches.emplace_back();
+		const bool ringSegmentUsed = (m_queue.getMappedVertexCount() || m_queue.getMappedIndexCount());
+
+		m_queue.reset();
+
+		if (m_streamingMode == StreamingMode::PersistentMapped)
+		{
+			if (ringSegmentUsed)
+			{
+				// この区画を読む描画コマンドがすべて完了したことを、次にこの区画を使う前に確認する
+				m_ringFences[m_ringSegmentIndex] = ::glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+				m_ringSegmentIndex = ((m_ringSegmentIndex + 1) % RingSegmentCount);
+			}
 
-		m_vertexArrayWritePos = 0;
-		m_indexArrayWritePos = 0;
+			beginRingSegment();
+		}
 	}
 
 	void GL4Vertex2DBatch::setBuffers()
 	{
-		::glBindVertexArray(m_vao);
-		::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
+		::glBindVertexArray(m_currentVAO);
+		::glBindBuffer(GL_ARRAY_BUFFER, ((m_currentVAO == m_ringVAO) ? m_ringVertexBuffer : m_vertexBuffer));
 	}
 
 	BatchInfo2D GL4Vertex2DBatch::updateBuffers(const size_t batchIndex)
 	{
-		assert(batchIndex < m_batches.size());
+		const auto& currentBatch = m_queue.getBatch(batchIndex);
 
-		size_t vertexArrayReadPos = 0;
-		size_t indexArrayReadPos = 0;
+		BatchInfo2D batchInfo;
+		batchInfo.vertexCount = currentBatch.vertexCount;
 
-		for (size_t i = 0; i < batchIndex; ++i)
+		// リングバッファに直接書き込まれたバッチは、アップロードせずに参照するだけでよい
+		if (currentBatch.mapped)
 		{
-			vertexArrayReadPos += m_batches[i].vertexPos;
-			indexArrayReadPos += m_batches[i].indexPos;
+			m_currentVAO = m_ringVAO;
+			::glBindVertexArray(m_ringVAO);
+			::glBindBuffer(GL_ARRAY_BUFFER, m_ringVertexBuffer);
+
+			batchInfo.indexCount			= currentBatch.indexCount;
+			batchInfo.startIndexLocation	= ((m_ringSegmentIndex * RingSegmentIndexCount) + currentBatch.indexOffset);
+			batchInfo.baseVertexLocation	= ((m_ringSegmentIndex * RingSegmentVertexCount) + currentBatch.vertexOffset);
+			return batchInfo;
 		}
 
+		m_currentVAO = m_vao;
 		::glBindVertexArray(m_vao);
 		::glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer);
 
-		BatchInfo2D batchInfo;
-		const auto& currentBatch = m_batches[batchIndex];
-
 		// VB
-		if (const uint16 vertexSize = currentBatch.vertexPos)
+		if (const uint32 vertexSize = currentBatch.vertexCount)
 		{
-			const Vertex2D* pSrc = &m_vertexArray[vertexArrayReadPos];
+			const Vertex2D* pSrc = m_queue.getStagedVertices(currentBatch);
 
 			if (VertexBufferSize < (m_vertexBufferWritePos + vertexSize))
 			{
@@ -202,9 +192,9 @@ namespace s3d
 		}
 
 		// IB
-		if (const uint32 indexSize = currentBatch.indexPos)
+		if (const uint32 indexSize = currentBatch.indexCount)
 		{
-			const Vertex2D::IndexType* pSrc = &m_indexArray[indexArrayReadPos];
+			const Vertex2D::IndexType* pSrc = m_queue.getStagedIndices(currentBatch);
 
 			if (IndexBufferSize < (m_indexBufferWritePos + indexSize))
 			{
@@ -227,9 +217,102 @@ namespace s3d
 		return batchInfo;
 	}
 
-	void GL4Vertex2DBatch::advanceArrayWritePos(const uint16 vertexSize, const uint32 indexSize) noexcept
+	bool GL4Vertex2DBatch::initRingBuffer()
+	{
+		constexpr GLbitfield StorageFlags = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+		constexpr GLsizeiptr VertexRingBytes = (sizeof(Vertex2D) * RingSegmentVertexCount * RingSegmentCount);
+		constexpr GLsizeiptr IndexRingBytes = (sizeof(Vertex2D::IndexType) * RingSegmentIndexCount * RingSegmentCount);
+
+		::glGenVertexArrays(1, &m_ringVAO);
+		::glGenBuffers(1, &m_ringVertexBuffer);
+		::glGenBuffers(1, &m_ringIndexBuffer);
+
+		::glBindVertexArray(m_ringVAO);
+		{
+			::glBindBuffer(GL_ARRAY_BUFFER, m_ringVertexBuffer);
+			::glBufferStorage(GL_ARRAY_BUFFER, VertexRingBytes, nullptr, StorageFlags);
+			m_pRingVertex = static_cast<Vertex2D*>(::glMapBufferRange(GL_ARRAY_BUFFER, 0, VertexRingBytes, StorageFlags));
+
+			::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ringIndexBuffer);
+			::glBufferStorage(GL_ELEMENT_ARRAY_BUFFER, IndexRingBytes, nullptr, StorageFlags);
+			m_pRingIndex = static_cast<Vertex2D::IndexType*>(::glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, 0, IndexRingBytes, StorageFlags));
+		}
+		::glBindVertexArray(0);
+
+		if ((not m_pRingVertex) || (not m_pRingIndex))
+		{
+			LOG_FAIL(U"❌ GL4Vertex2DBatch: failed to map the ring buffer persistently");
+			releaseRingBuffer();
+			return false;
+		}
+
+		detail::SetVertex2DAttributes(m_ringVAO, m_ringVertexBuffer, m_ringIndexBuffer);
+
+		return true;
+	}
+
+	void GL4Vertex2DBatch::releaseRingBuffer()
 	{
-		m_vertexArrayWritePos	+= vertexSize;
-		m_indexArrayWritePos	+= indexSize;
+		for (auto& fence : m_ringFences)
+		{
+			if (fence)
+			{
+				::glDeleteSync(fence);
+				fence = nullptr;
+			}
+		}
+
+		if (m_ringIndexBuffer)
+		{
+			if (m_pRingIndex)
+			{
+				::glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_ringIndexBuffer);
+				::glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+				m_pRingIndex = nullptr;
+			}
+
+			::glDeleteBuffers(1, &m_ringIndexBuffer);
+			m_ringIndexBuffer = 0;
+		}
+
+		if (m_ringVertexBuffer)
+		{
+			if (m_pRingVertex)
+			{
+				::glBindBuffer(GL_ARRAY_BUFFER, m_ringVertexBuffer);
+				::glUnmapBuffer(GL_ARRAY_BUFFER);
+				m_pRingVertex = nullptr;
+			}
+
+			::glDeleteBuffers(1, &m_ringVertexBuffer);
+			m_ringVertexBuffer = 0;
+		}
+
+		if (m_ringVAO)
+		{
+			::glDeleteVertexArrays(1, &m_ringVAO);
+			m_ringVAO = 0;
+		}
+	}
+
+	void GL4Vertex2DBatch::beginRingSegment()
+	{
+		// GPU がまだこの区画を読んでいる場合は、読み終わるまで待つ
+		if (GLsync& fence = m_ringFences[m_ringSegmentIndex])
+		{
+			// 最初の待機でコマンドをフラッシュしておけば、フェンスは必ずいつか通知されるので、それ以降はフラッシュせずに待つ
+			GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+
+			while (::glClientWaitSync(fence, flags, RingFenceTimeoutNanosec) == GL_TIMEOUT_EXPIRED)
+			{
+				flags = 0;
+			}
+
+			::glDeleteSync(fence);
+			fence = nullptr;
+		}
+
+		m_queue.setMappedRegion((m_pRingVertex + (m_ringSegmentIndex * RingSegmentVertexCount)), RingSegmentVertexCount,
+			(m_pRingIndex + (m_ringSegmentIndex * RingSegmentIndexCount)), RingSegmentIndexCount);
 	}
 }
@@ -10,11 +10,13 @@
 //-----------------------------------------------
 
 # pragma once
+# include <array>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/Common/OpenGL.hpp>
 # include <Siv3D/Vertex2D.hpp>
 # include <Siv3D/Array.hpp>
 # include <Siv3D/Renderer2D/Vertex2DBufferPointer.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBatchQueue.hpp>
 # include <Siv3D/Renderer2D/Renderer2DCommon.hpp>
 # include "GL4Renderer2DCommand.hpp"
 
@@ -24,19 +26,32 @@ namespace s3d
 	{
 	private:
 
-		struct BatchBufferPos
+		enum class StreamingMode : uint8
 		{
-			uint16 vertexPos = 0;
+			// ステージング配列からバッチごとにコピーし、バッファが一杯になったら orphaning する
+			Orphaning,
 
-			uint32 indexPos = 0;
-
-			void advance(uint16 vertexSize, uint32 indexSize) noexcept
-			{
-				vertexPos += vertexSize;
-				indexPos += indexSize;
-			}
+			// 永続マップしたリングバッファに直接書き込み、フェンスで GPU の読み出し完了を待つ
+			PersistentMapped,
 		};
 
+		static constexpr uint32 VertexBufferSize		= 65535;// 65,535;
+		static constexpr uint32 IndexBufferSize			= ((VertexBufferSize + 1) * 4); // 524,288
+
+		// 永続マップするリングバッファの 1 区画あたりのサイズ（1 回の flush で使う領域）
+		static constexpr uint32 RingSegmentVertexCount	= (65536 * 2); // 131,072 (4 MiB)
+		static constexpr uint32 RingSegmentIndexCount	= (RingSegmentVertexCount * 4); // 524,288 (1 MiB)
+
+		// GPU が読み出し中の区画を避けるため、3 区画を順番に使う
+		static constexpr uint32 RingSegmentCount		= 3;
+
+		// 区画のフェンスを 1 回待つ時間（ナノ秒）。GPU が止まっていても、期限ごとに待ち直す
+		static constexpr GLuint64 RingFenceTimeoutNanosec	= 100'000'000; // 100 ms
+
+		Vertex2DBatchQueue m_queue{ VertexBufferSize, IndexBufferSize };
+
+		StreamingMode m_streamingMode = StreamingMode::Orphaning;
+
 		GLuint m_vao = 0;
 
 		GLuint m_vertexBuffer = 0;
@@ -45,24 +60,29 @@ namespace s3d
 		GLuint m_indexBuffer = 0;
 		uint32 m_indexBufferWritePos = 0;
 
-		Array<Vertex2D> m_vertexArray;
-		uint32 m_vertexArrayWritePos = 0;
+		GLuint m_ringVAO = 0;
 
-		Array<Vertex2D::IndexType> m_indexArray;
-		uint32 m_indexArrayWritePos = 0;
+		GLuint m_ringVertexBuffer = 0;
 
-		Array<BatchBufferPos> m_batches;
+		GLuint m_ringIndexBuffer = 0;
 
-		static constexpr uint32 InitialVertexArraySize	= 4096;
-		static constexpr uint32 InitialIndexArraySize	= (4096 * 8); // 32,768
+		Vertex2D* m_pRingVertex = nullptr;
 
-		static constexpr uint32 MaxVertexArraySize		= (65536 * 64); // 4,194,304
-		static constexpr uint32 MaxIndexArraySize		= (65536 * 64); // 4,194,304
+		Vertex2D::IndexType* m_pRingIndex = nullptr;
 
-		static constexpr uint32 VertexBufferSize		= 65535;// 65,535;
-		static constexpr uint32 IndexBufferSize			= ((VertexBufferSize + 1) * 4); // 524,288
+		std::array<GLsync, RingSegmentCount> m_ringFences{};
+
+		uint32 m_ringSegmentIndex = 0;
+
+		// 直前の UpdateBuffers でバインドした VAO
+		GLuint m_currentVAO = 0;
+
+		[[nodiscard]]
+		bool initRingBuffer();
+
+		void releaseRingBuffer();
 
-		void advanceArrayWritePos(uint16 vertexSize, uint32 indexSize) noexcept;
+		void beginRingSegment();
 
 	public:
 
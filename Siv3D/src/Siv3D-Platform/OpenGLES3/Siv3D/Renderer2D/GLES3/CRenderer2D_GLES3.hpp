@@ -144,6 +144,8 @@ namespace s3d
 
 		void addCircle(const Float2& center, float r, const Float4& innerColor, const Float4& outerColor) override;
 
+		void addCircles(const Circle* circles, const ColorF* colors, size_t num_circles, bool uniformColor) override;
+
 		void addCircleFrame(const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor) override;
 
 		void addCirclePie(const Float2& center, float r, float startAngle, float angle, const Float4& innerColor, const Float4& outerColor) override;
@@ -200,9 +202,13 @@ namespace s3d
 
 		void addRoundRectShadow(const RoundRect& roundRect, float blur, const Float4& color, bool fill) override;
 
-		void addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
-			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
-			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) override;
+		void addParticles(const ParticleStorage2D& particles,
+			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc,
+			const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc) override;
+
+		void addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
+			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc,
+			const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc) override;
 
 
 		Float4 getColorMul() const override;
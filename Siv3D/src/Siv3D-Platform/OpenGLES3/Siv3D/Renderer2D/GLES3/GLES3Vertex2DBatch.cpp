@@ -200,6 +200,7 @@ namespace s3d
 			::glUnmapBuffer(GL_ARRAY_BUFFER);
 
 			batchInfo.baseVertexLocation = m_vertexBufferWritePos;
+			batchInfo.vertexCount = vertexSize;
 			m_vertexBufferWritePos += vertexSize;
 		}
 
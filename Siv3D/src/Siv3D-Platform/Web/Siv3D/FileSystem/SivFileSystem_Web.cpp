@@ -17,6 +17,7 @@
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/EnvironmentVariable.hpp>
 # include <Siv3D/INI.hpp>
+# include <Siv3D/VirtualFileSystem/IVirtualFileSystem.hpp>
 # include <Siv3D/SimpleHTTP.hpp>
 
 namespace s3d
@@ -221,6 +222,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isFile(path) || pVirtualFileSystem->isDirectory(path))
+				{
+					return true;
+				}
+			}
+
 			return detail::Exists(path);
 		}
 
@@ -231,6 +240,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isDirectory(path))
+				{
+					return true;
+				}
+			}
+
 			return detail::IsDirectory(path);
 		}
 
@@ -241,6 +258,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isFile(path))
+				{
+					return true;
+				}
+			}
+
 			return detail::IsRegular(path);
 		}
 
@@ -351,6 +376,14 @@ namespace s3d
 				return 0;
 			}
 			
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (const int64 size = pVirtualFileSystem->fileSize(path); 0 <= size)
+				{
+					return size;
+				}
+			}
+
 			struct stat s;
 			if (!detail::GetStat(path, s))
 			{
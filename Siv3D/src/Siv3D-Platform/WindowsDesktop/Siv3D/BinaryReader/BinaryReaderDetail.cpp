@@ -12,6 +12,7 @@
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/FormatUtility.hpp>
+# include <Siv3D/VirtualFileSystem/IVirtualFileSystem.hpp>
 # include "BinaryReaderDetail.hpp"
 
 namespace s3d
@@ -29,6 +30,39 @@ namespace s3d
 
 		close();
 
+		if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+		{
+			VirtualFileSource source;
+
+			if (pVirtualFileSystem->open(path, source))
+			{
+				// マウントされたディレクトリ内のファイル
+				if (not source.reader)
+				{
+					return openFile(source.filePath);
+				}
+
+				m_virtual = { std::move(source.holder), std::move(source.reader) };
+
+				m_info =
+				{
+					.isOpen		= true,
+					.size		= m_virtual.reader->size(),
+					.fullPath	= FilePath(path)
+				};
+
+				LOG_INFO(U"📤 BinaryReader: Virtual file `{0}` opened (size: {1})"_fmt(
+					m_info.fullPath, FormatDataSize(m_info.size)));
+
+				return true;
+			}
+		}
+
+		return openFile(path);
+	}
+
+	bool BinaryReader::BinaryReaderDetail::openFile(const FilePathView path)
+	{
 		if (FileSystem::IsResourcePath(path))
 		{
 			HMODULE hModule = ::GetModuleHandleW(nullptr);
@@ -95,7 +129,13 @@ namespace s3d
 			return;
 		}
 
-		if (isResource())
+		if (isVirtual())
+		{
+			m_virtual = {};
+			LOG_INFO(U"📥 BinaryReader: Virtual file `{0}` closed"_fmt(
+				m_info.fullPath));
+		}
+		else if (isResource())
 		{
 			m_resource = {};
 			LOG_INFO(U"📥 BinaryReader: Resource `{0}` closed"_fmt(
@@ -131,6 +171,12 @@ namespace s3d
 
 		assert(InRange<int64>(clampedPos, 0, size()));
 
+		if (isVirtual())
+		{
+			m_virtual.reader->setPos(clampedPos);
+			return m_virtual.reader->getPos();
+		}
+
 		if (isResource())
 		{
 			return (m_resource.pos = clampedPos);
@@ -145,6 +191,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::getPos()
 	{
+		if (isVirtual())
+		{
+			return m_virtual.reader->getPos();
+		}
+
 		if (isResource())
 		{
 			return m_resource.pos;
@@ -157,6 +208,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::read(const NonNull<void*> dst, const int64 size)
 	{
+		if (isVirtual())
+		{
+			return m_virtual.reader->read(dst.pointer, size);
+		}
+
 		if (isResource())
 		{
 			const int64 readBytes = Clamp(size, 0LL, (m_info.size - m_resource.pos));
@@ -191,6 +247,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::read(const NonNull<void*> dst, const int64 pos, const int64 size)
 	{
+		if (isVirtual())
+		{
+			return m_virtual.reader->read(dst.pointer, pos, size);
+		}
+
 		if (isResource())
 		{
 			const int64 readBytes = Clamp(size, 0LL, (m_info.size - pos));
@@ -230,6 +291,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 size)
 	{
+		if (isVirtual())
+		{
+			return lookaheadVirtual(dst, m_virtual.reader->getPos(), size);
+		}
+
 		if (isResource())
 		{
 			const int64 readBytes = Clamp(size, 0LL, (m_info.size - m_resource.pos));
@@ -265,6 +331,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 pos, const int64 size)
 	{
+		if (isVirtual())
+		{
+			return lookaheadVirtual(dst, pos, size);
+		}
+
 		if (isResource())
 		{
 			const int64 readBytes = Clamp(size, 0LL, (m_info.size - pos));
@@ -312,4 +383,23 @@ namespace s3d
 	{
 		return (m_resource.pointer != nullptr);
 	}
+
+	bool BinaryReader::BinaryReaderDetail::isVirtual() const noexcept
+	{
+		return static_cast<bool>(m_virtual.reader);
+	}
+
+	int64 BinaryReader::BinaryReaderDetail::lookaheadVirtual(const NonNull<void*> dst, const int64 pos, const int64 size)
+	{
+		if (m_virtual.reader->supportsLookahead())
+		{
+			return m_virtual.reader->lookahead(dst.pointer, pos, size);
+		}
+
+		// lookahead をサポートしていない Reader では、読み込んだ後に位置を戻す
+		const int64 previousPos = m_virtual.reader->getPos();
+		const int64 readBytes = m_virtual.reader->read(dst.pointer, pos, size);
+		m_virtual.reader->setPos(previousPos);
+		return readBytes;
+	}
 }
@@ -16,6 +16,7 @@
 # include <Siv3D/String.hpp>
 # include <Siv3D/Byte.hpp>
 # include <Siv3D/NonNull.hpp>
+# include <Siv3D/IReader.hpp>
 
 namespace s3d
 {
@@ -35,6 +36,15 @@ namespace s3d
 			int64 pos = 0;
 		} m_resource;
 
+		struct Virtual
+		{
+			// reader が参照するデータを保持する
+			std::shared_ptr<const void> holder;
+
+			// 仮想ファイルシステムにマウントされたファイルを読み込む Reader
+			std::unique_ptr<IReader> reader;
+		} m_virtual;
+
 		struct Info
 		{
 			bool isOpen = false;
@@ -44,6 +54,12 @@ namespace s3d
 
 		bool isResource() const noexcept;
 
+		bool isVirtual() const noexcept;
+
+		bool openFile(FilePathView path);
+
+		int64 lookaheadVirtual(NonNull<void*> dst, int64 pos, int64 size);
+
 	public:
 
 		BinaryReaderDetail();
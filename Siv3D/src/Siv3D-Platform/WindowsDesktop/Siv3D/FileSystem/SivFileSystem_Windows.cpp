@@ -17,6 +17,7 @@
 # include <Siv3D/FormatUtility.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/FileSystem.hpp>
+# include <Siv3D/VirtualFileSystem/IVirtualFileSystem.hpp>
 # include <Siv3D/Windows/Windows.hpp>
 # include <Shlobj.h>
 
@@ -283,6 +284,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isFile(path) || pVirtualFileSystem->isDirectory(path))
+				{
+					return true;
+				}
+			}
+
 			if (IsResourcePath(path))
 			{
 				return detail::ResourceExists(path);
@@ -298,6 +307,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isDirectory(path))
+				{
+					return true;
+				}
+			}
+
 			if (IsResourcePath(path))
 			{
 				return false;
@@ -313,6 +330,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isFile(path))
+				{
+					return true;
+				}
+			}
+
 			if (IsResourcePath(path))
 			{
 				return detail::ResourceExists(path);
@@ -508,6 +533,14 @@ namespace s3d
 				return 0;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (const int64 size = pVirtualFileSystem->fileSize(path); 0 <= size)
+				{
+					return size;
+				}
+			}
+
 			if (IsResourcePath(path))
 			{
 				return detail::ResourceSize(path);
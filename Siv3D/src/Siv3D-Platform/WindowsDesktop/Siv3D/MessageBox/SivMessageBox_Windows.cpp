@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <future>
 # include <Siv3D/MessageBox.hpp>
 # include <Siv3D/AsyncTask.hpp>
 # include <Siv3D/Window.hpp>
@@ -53,7 +54,8 @@ namespace s3d
 
 			const int32 flag = (MessageBoxStyleFlags[static_cast<int32>(style)] | buttons);
 
-			const int32 result = Async([=]()
+			// モーダルなダイアログはスレッドプールのワーカーを占有しないよう、専用のスレッドで表示する
+			const int32 result = std::async(std::launch::async, [=]()
 				{
 					const HWND hWnd = static_cast<HWND>(SIV3D_ENGINE(Window)->getHandle());
 					return ::MessageBoxW(hWnd, text.toWstr().c_str(), title.toWstr().c_str(), flag);
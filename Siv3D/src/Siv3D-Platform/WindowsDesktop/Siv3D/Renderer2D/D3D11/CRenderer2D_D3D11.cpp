@@ -13,6 +13,7 @@
 # include <Siv3D/Error.hpp>
 # include <Siv3D/Resource.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerScope.hpp>
 # include <Siv3D/ScopeGuard.hpp>
 # include <Siv3D/Mat3x2.hpp>
 # include <Siv3D/ShaderCommon.hpp>
@@ -21,6 +22,7 @@
 # include <Siv3D/Shader/D3D11/CShader_D3D11.hpp>
 # include <Siv3D/Texture/D3D11/CTexture_D3D11.hpp>
 # include <Siv3D/ConstantBuffer/D3D11/ConstantBufferDetail_D3D11.hpp>
+# include <Siv3D/ParticleSystem2D/ParticleStorage2D.hpp>
 
 /*
 #	define LOG_COMMAND(...) LOG_TRACE(__VA_ARGS__)
@@ -296,6 +298,33 @@ namespace s3d
 		}
 	}
 
+	void CRenderer2D_D3D11::addCircles(const Circle* circles, const ColorF* colors, const size_t num_circles, const bool uniformColor)
+	{
+		const float scale = getMaxScaling();
+
+		for (size_t i = 0; i < num_circles;)
+		{
+			size_t num_consumed = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildCircles(m_bufferCreator, (circles + i), (uniformColor ? colors : (colors + i)), (num_circles - i), uniformColor, scale, num_consumed))
+			{
+				if (not m_currentCustomVS)
+				{
+					m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				}
+
+				if (not m_currentCustomPS)
+				{
+					m_commandManager.pushStandardPS(m_standardPS->shapeID);
+				}
+
+				m_commandManager.pushDraw(indexCount);
+			}
+
+			i += num_consumed;
+		}
+	}
+
 	void CRenderer2D_D3D11::addCircleFrame(const Float2& center, const float rInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
 		if (const auto indexCount = Vertex2DBuilder::BuildCircleFrame(m_bufferCreator, center, rInner, thickness, innerColor, outerColor, getMaxScaling()))
@@ -801,24 +830,58 @@ namespace s3d
 		}
 	}
 
-	void CRenderer2D_D3D11::addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
-		ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
-		ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc)
+	void CRenderer2D_D3D11::addParticles(const ParticleStorage2D& particles,
+		const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc,
+		const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
 	{
-		if (const auto indexCount = Vertex2DBuilder::BuildTexturedParticles(m_bufferCreator, particles, sizeOverLifeTimeFunc, colorOverLifeTimeFunc))
+		for (size_t i = 0; i < particles.size();)
 		{
-			if (not m_currentCustomVS)
+			size_t num_consumed = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildParticles(m_bufferCreator, particles, i, sizeOverLifeTimeFunc, colorOverLifeTimeFunc, num_consumed))
 			{
-				m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				if (not m_currentCustomVS)
+				{
+					m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				}
+
+				if (not m_currentCustomPS)
+				{
+					m_commandManager.pushStandardPS(m_standardPS->shapeID);
+				}
+
+				m_commandManager.pushDraw(indexCount);
 			}
 
-			if (not m_currentCustomPS)
+			i += num_consumed;
+		}
+	}
+
+	void CRenderer2D_D3D11::addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
+		const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc,
+		const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
+	{
+		for (size_t i = 0; i < particles.size();)
+		{
+			size_t num_consumed = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildParticles(m_bufferCreator, particles, i, sizeOverLifeTimeFunc, colorOverLifeTimeFunc, num_consumed))
 			{
-				m_commandManager.pushStandardPS(m_standardPS->textureID);
+				if (not m_currentCustomVS)
+				{
+					m_commandManager.pushStandardVS(m_standardVS->spriteID);
+				}
+
+				if (not m_currentCustomPS)
+				{
+					m_commandManager.pushStandardPS(m_standardPS->textureID);
+				}
+
+				m_commandManager.pushPSTexture(0, texture);
+				m_commandManager.pushDraw(indexCount);
 			}
 
-			m_commandManager.pushPSTexture(0, texture);
-			m_commandManager.pushDraw(indexCount);
+			i += num_consumed;
 		}
 	}
 
@@ -1064,6 +1127,8 @@ namespace s3d
 
 	void CRenderer2D_D3D11::flush()
 	{
+		SIV3D_PROFILE_SCOPE(U"Renderer2D::flush");
+
 		ScopeGuard cleanUp = [this]()
 		{
 			m_batches.reset();
@@ -1116,6 +1181,12 @@ namespace s3d
 			case D3D11Renderer2DCommandType::UpdateBuffers:
 				{
 					batchInfo = m_batches.updateBuffers(command.index);
+
+					if (batchInfo.vertexCount || batchInfo.indexCount)
+					{
+						++m_stat.batchCount;
+						m_stat.uploadedBytes += ((sizeof(Vertex2D) * batchInfo.vertexCount) + (sizeof(Vertex2D::IndexType) * batchInfo.indexCount));
+					}
 					
 					LOG_COMMAND(U"UpdateBuffers[{}] BatchInfo(indexCount = {}, startIndexLocation = {}, baseVertexLocation = {})"_fmt(
 						command.index, batchInfo.indexCount, batchInfo.startIndexLocation, batchInfo.baseVertexLocation));
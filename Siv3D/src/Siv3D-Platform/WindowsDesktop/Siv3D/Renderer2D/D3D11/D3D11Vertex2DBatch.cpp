@@ -204,6 +204,7 @@ namespace s3d
 			}
 
 			batchInfo.baseVertexLocation = m_vertexBufferWritePos;
+			batchInfo.vertexCount = vertexSize;
 			m_vertexBufferWritePos += vertexSize;
 		}
 
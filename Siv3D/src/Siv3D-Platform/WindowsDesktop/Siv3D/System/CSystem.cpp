@@ -10,6 +10,7 @@
 //-----------------------------------------------
 
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerScope.hpp>
 # include <Siv3D/AsyncTask.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include <Siv3D/Resource/IResource.hpp>
@@ -172,9 +173,15 @@ namespace s3d
 
 		SIV3D_ENGINE(Addon)->draw();
 		SIV3D_ENGINE(Print)->draw();
-		SIV3D_ENGINE(Renderer)->flush();
+		{
+			SIV3D_PROFILE_SCOPE(U"System::Update/Renderer::flush");
+			SIV3D_ENGINE(Renderer)->flush();
+		}
 		SIV3D_ENGINE(Profiler)->endFrame();
-		SIV3D_ENGINE(Renderer)->present();
+		{
+			SIV3D_PROFILE_SCOPE(U"System::Update/Renderer::present");
+			SIV3D_ENGINE(Renderer)->present();
+		}
 		SIV3D_ENGINE(ScreenCapture)->update();
 		SIV3D_ENGINE(Addon)->postPresent();
 
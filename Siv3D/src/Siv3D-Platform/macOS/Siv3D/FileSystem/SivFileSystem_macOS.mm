@@ -14,6 +14,7 @@
 # include <Siv3D/String.hpp>
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/FileSystem.hpp>
+# include <Siv3D/VirtualFileSystem/IVirtualFileSystem.hpp>
 # define BOOST_FILESYSTEM_NO_DEPRECATED
 # include <boost/filesystem.hpp>
 # import  <Foundation/Foundation.h>
@@ -390,6 +391,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isFile(path) || pVirtualFileSystem->isDirectory(path))
+				{
+					return true;
+				}
+			}
+
 			return detail::Exists(path);
 		}
 
@@ -400,6 +409,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isDirectory(path))
+				{
+					return true;
+				}
+			}
+
 			return detail::IsDirectory(path);
 		}
 
@@ -410,6 +427,14 @@ namespace s3d
 				return false;
 			}
 
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (pVirtualFileSystem->isFile(path))
+				{
+					return true;
+				}
+			}
+
 			return detail::IsRegular(path);
 		}
 
@@ -555,6 +580,14 @@ namespace s3d
 				return 0;
 			}
 			
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				if (const int64 size = pVirtualFileSystem->fileSize(path); 0 <= size)
+				{
+					return size;
+				}
+			}
+
 			struct stat s;
 			if (!detail::GetStat(path, s))
 			{
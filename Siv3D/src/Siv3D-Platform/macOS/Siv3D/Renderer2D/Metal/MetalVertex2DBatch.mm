@@ -133,6 +133,6 @@ namespace s3d
 		
 		const auto& currentVIBuffer = m_viBuffers[m_currentVIBufferIndex][batchIndex];
 		
-		return{ currentVIBuffer.indexBufferWritePos, 0, 0 };
+		return{ currentVIBuffer.indexBufferWritePos, 0, 0, currentVIBuffer.vertexBufferWritePos };
 	}
 }
@@ -12,6 +12,7 @@
 # include <Siv3D/EngineLog.hpp>
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/FormatUtility.hpp>
+# include <Siv3D/VirtualFileSystem/IVirtualFileSystem.hpp>
 # include "BinaryReaderDetail.hpp"
 
 namespace s3d
@@ -29,6 +30,39 @@ namespace s3d
 
 		close();
 
+		if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+		{
+			VirtualFileSource source;
+
+			if (pVirtualFileSystem->open(path, source))
+			{
+				// マウントされたディレクトリ内のファイル
+				if (not source.reader)
+				{
+					return openFile(source.filePath);
+				}
+
+				m_virtual = { std::move(source.holder), std::move(source.reader) };
+
+				m_info =
+				{
+					.isOpen		= true,
+					.size		= m_virtual.reader->size(),
+					.fullPath	= FilePath(path)
+				};
+
+				LOG_INFO(U"📤 BinaryReader: Virtual file `{0}` opened (size: {1})"_fmt(
+					m_info.fullPath, FormatDataSize(m_info.size)));
+
+				return true;
+			}
+		}
+
+		return openFile(path);
+	}
+
+	bool BinaryReader::BinaryReaderDetail::openFile(const FilePathView path)
+	{
 		// ファイルのオープン
 		{
 			m_file.file.open(path.narrow(), std::ios_base::binary);
@@ -61,10 +95,19 @@ namespace s3d
 			return;
 		}
 
-		m_file.file.close();
-		m_file.pos = 0;
-		LOG_INFO(U"📥 BinaryReader: File `{0}` closed"_fmt(
-			m_info.fullPath));
+		if (isVirtual())
+		{
+			m_virtual = {};
+			LOG_INFO(U"📥 BinaryReader: Virtual file `{0}` closed"_fmt(
+				m_info.fullPath));
+		}
+		else
+		{
+			m_file.file.close();
+			m_file.pos = 0;
+			LOG_INFO(U"📥 BinaryReader: File `{0}` closed"_fmt(
+				m_info.fullPath));
+		}
 
 		m_info = {};
 	}
@@ -88,6 +131,12 @@ namespace s3d
 
 		assert(InRange<int64>(clampedPos, 0, size()));
 
+		if (isVirtual())
+		{
+			m_virtual.reader->setPos(clampedPos);
+			return m_virtual.reader->getPos();
+		}
+
 		m_file.file.seekg(clampedPos);
 		m_file.pos = clampedPos;
 		return m_file.pos;
@@ -95,11 +144,21 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::getPos()
 	{
+		if (isVirtual())
+		{
+			return m_virtual.reader->getPos();
+		}
+
 		return m_file.pos;
 	}
 
 	int64 BinaryReader::BinaryReaderDetail::read(const NonNull<void*> dst, const int64 size)
 	{
+		if (isVirtual())
+		{
+			return m_virtual.reader->read(dst.pointer, size);
+		}
+
 		const int64 readBytes = Clamp<int64>(size, 0LL, (m_info.size - m_file.pos));
 
 		if (readBytes)
@@ -124,6 +183,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::read(const NonNull<void*> dst, const int64 pos, const int64 size)
 	{
+		if (isVirtual())
+		{
+			return m_virtual.reader->read(dst.pointer, pos, size);
+		}
+
 		if (pos != setPos(pos))
 		{
 			return 0;
@@ -153,6 +217,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 size)
 	{
+		if (isVirtual())
+		{
+			return lookaheadVirtual(dst, m_virtual.reader->getPos(), size);
+		}
+
 		const auto previousPos = getPos();
 
 		const int64 readBytes = Clamp<int64>(size, 0LL, (m_info.size - m_file.pos));
@@ -179,6 +248,11 @@ namespace s3d
 
 	int64 BinaryReader::BinaryReaderDetail::lookahead(const NonNull<void*> dst, const int64 pos, const int64 size)
 	{
+		if (isVirtual())
+		{
+			return lookaheadVirtual(dst, pos, size);
+		}
+
 		const auto previousPos = getPos();
 
 		if (pos != setPos(pos))
@@ -212,4 +286,23 @@ namespace s3d
 	{
 		return m_info.fullPath;
 	}
+
+	bool BinaryReader::BinaryReaderDetail::isVirtual() const noexcept
+	{
+		return static_cast<bool>(m_virtual.reader);
+	}
+
+	int64 BinaryReader::BinaryReaderDetail::lookaheadVirtual(const NonNull<void*> dst, const int64 pos, const int64 size)
+	{
+		if (m_virtual.reader->supportsLookahead())
+		{
+			return m_virtual.reader->lookahead(dst.pointer, pos, size);
+		}
+
+		// lookahead をサポートしていない Reader では、読み込んだ後に位置を戻す
+		const int64 previousPos = m_virtual.reader->getPos();
+		const int64 readBytes = m_virtual.reader->read(dst.pointer, pos, size);
+		m_virtual.reader->setPos(previousPos);
+		return readBytes;
+	}
 }
@@ -14,6 +14,7 @@
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/String.hpp>
 # include <Siv3D/NonNull.hpp>
+# include <Siv3D/IReader.hpp>
 
 namespace s3d
 {
@@ -27,12 +28,27 @@ namespace s3d
 			int64 pos = 0;
 		} m_file;
 		
+		struct Virtual
+		{
+			// reader が参照するデータを保持する
+			std::shared_ptr<const void> holder;
+
+			// 仮想ファイルシステムにマウントされたファイルを読み込む Reader
+			std::unique_ptr<IReader> reader;
+		} m_virtual;
+
 		struct Info
 		{
 			bool isOpen = false;
 			int64 size = 0;
 			FilePath fullPath;
 		} m_info;
+
+		bool isVirtual() const noexcept;
+
+		bool openFile(FilePathView path);
+
+		int64 lookaheadVirtual(NonNull<void*> dst, int64 pos, int64 size);
 		
 	public:
 
@@ -58,6 +58,8 @@ namespace s3d
 
 	AsyncHTTPTaskDetail::AsyncHTTPTaskDetail() {}
 
+	// 転送の完了まで戻らない curl の処理がスレッドプールのワーカーを占有しないよう、転送ごとに専用のスレッドで実行する
+
 	AsyncHTTPTaskDetail::AsyncHTTPTaskDetail(const URLView url, const HashTable<String, String>& headers, const FilePathView path)
 		: m_url{ url }
 		, m_writer{ BinaryWriter{ path }, {}, {}, true }
@@ -65,7 +67,7 @@ namespace s3d
 	{
 		m_writer.path = m_writer.file.path();
 
-		m_task = Async(&AsyncHTTPTaskDetail::runGet, this);
+		m_task = std::async(std::launch::async, &AsyncHTTPTaskDetail::runGet, this);
 	}
 
 	AsyncHTTPTaskDetail::AsyncHTTPTaskDetail(const URLView url, const HashTable<String, String>& headers)
@@ -73,7 +75,7 @@ namespace s3d
 		, m_writer{ {}, {}, {}, false }
 		, m_headers{ headers }
 	{
-		m_task = Async(&AsyncHTTPTaskDetail::runGet, this);
+		m_task = std::async(std::launch::async, &AsyncHTTPTaskDetail::runGet, this);
 	}
 
 	AsyncHTTPTaskDetail::AsyncHTTPTaskDetail(const URLView url, const HashTable<String, String>& headers, const void* src, const size_t size, const FilePathView path)
@@ -84,7 +86,7 @@ namespace s3d
 	{
 		m_writer.path = m_writer.file.path();
 
-		m_task = Async(&AsyncHTTPTaskDetail::runPost, this);
+		m_task = std::async(std::launch::async, &AsyncHTTPTaskDetail::runPost, this);
 	}
 
 	AsyncHTTPTaskDetail::AsyncHTTPTaskDetail(const URLView url, const HashTable<String, String>& headers, const void* src, const size_t size)
@@ -93,7 +95,7 @@ namespace s3d
 		, m_headers{ headers }
 		, m_blob{ src, size }
 	{
-		m_task = Async(&AsyncHTTPTaskDetail::runPost, this);
+		m_task = std::async(std::launch::async, &AsyncHTTPTaskDetail::runPost, this);
 	}
 
 	AsyncHTTPTaskDetail::~AsyncHTTPTaskDetail()
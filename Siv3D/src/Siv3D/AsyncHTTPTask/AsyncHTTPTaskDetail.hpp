@@ -11,6 +11,7 @@
 
 # pragma once
 # include <atomic>
+# include <future>
 # include <mutex>
 # include <Siv3D/Common.hpp>
 # include <Siv3D/AsyncTask.hpp>
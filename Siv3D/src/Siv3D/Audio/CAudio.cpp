@@ -11,6 +11,7 @@
 
 # include <Siv3D/Error.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerScope.hpp>
 # include <Siv3D/Unicode.hpp>
 # include <Siv3D/Resource.hpp>
 # include <Siv3D/FFTResult.hpp>
@@ -205,6 +206,8 @@ namespace s3d
 
 	Audio::IDType CAudio::create(Wave&& wave, const Optional<AudioLoopTiming>& loop)
 	{
+		SIV3D_PROFILE_SCOPE(U"Audio::Create");
+
 		if (not wave)
 		{
 			return Audio::IDType::NullAsset();
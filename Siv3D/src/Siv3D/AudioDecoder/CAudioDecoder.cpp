@@ -12,6 +12,7 @@
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/IReader.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerScope.hpp>
 # include "CAudioDecoder.hpp"
 # include <Siv3D/AudioFormat/WAVEDecoder.hpp>
 # include <Siv3D/AudioFormat/OggVorbisDecoder.hpp>
@@ -92,6 +93,7 @@ namespace s3d
 	Wave CAudioDecoder::decode(IReader& reader, const FilePathView pathHint, const AudioFormat imageFormat)
 	{
 		LOG_SCOPED_TRACE(U"CAudioDecoder::decode()");
+		SIV3D_PROFILE_SCOPE(U"AudioDecoder::Decode");
 
 		auto it = findDecoder(imageFormat);
 
@@ -113,6 +115,7 @@ namespace s3d
 	Wave CAudioDecoder::decode(IReader& reader, const StringView decoderName)
 	{
 		LOG_SCOPED_TRACE(U"CAudioDecoder::decode({})"_fmt(decoderName));
+		SIV3D_PROFILE_SCOPE(U"AudioDecoder::Decode");
 
 		const auto it = findDecoder(decoderName);
 
@@ -0,0 +1,575 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <bit>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/VirtualFileSystem.hpp>
+# include "CSVViewDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// このサイズ未満のデータは分割せずに処理する
+		inline constexpr size_t CSVParallelThreshold = (256 * 1024);
+
+		// 分割する場合の 1 つのチャンクの最小サイズ
+		inline constexpr size_t CSVMinChunkSize = (64 * 1024);
+
+		// 探索する 4 種類の文字
+		struct CSVSpecialChars
+		{
+			__m128i c0, c1, c2, c3;
+
+			CSVSpecialChars(const char ch0, const char ch1, const char ch2, const char ch3) noexcept
+				: c0{ ::_mm_set1_epi8(ch0) }
+				, c1{ ::_mm_set1_epi8(ch1) }
+				, c2{ ::_mm_set1_epi8(ch2) }
+				, c3{ ::_mm_set1_epi8(ch3) } {}
+		};
+
+		// [p, last) で chars のいずれかが最初に現れる位置を返す。見つからない場合は last
+		[[nodiscard]]
+		static const char* FindAny(const char* p, const char* const last, const CSVSpecialChars& chars, const char ch0, const char ch1, const char ch2, const char ch3) noexcept
+		{
+			while (16 <= (last - p))
+			{
+				const __m128i v = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+				const __m128i m01 = ::_mm_or_si128(::_mm_cmpeq_epi8(v, chars.c0), ::_mm_cmpeq_epi8(v, chars.c1));
+				const __m128i m23 = ::_mm_or_si128(::_mm_cmpeq_epi8(v, chars.c2), ::_mm_cmpeq_epi8(v, chars.c3));
+
+				if (const uint32 mask = static_cast<uint32>(::_mm_movemask_epi8(::_mm_or_si128(m01, m23))))
+				{
+					return (p + std::countr_zero(mask));
+				}
+
+				p += 16;
+			}
+
+			while (p < last)
+			{
+				const char ch = *p;
+
+				if ((ch == ch0) || (ch == ch1) || (ch == ch2) || (ch == ch3))
+				{
+					return p;
+				}
+
+				++p;
+			}
+
+			return last;
+		}
+
+		// 解析中の記号の設定
+		struct CSVSyntax
+		{
+			char separator;
+
+			char quote;
+
+			// エスケープ記号を使わない場合は 0
+			char escape;
+
+			// クオーテーションの外で探索する文字
+			CSVSpecialChars outside;
+
+			// クオーテーションの中で探索する文字
+			CSVSpecialChars inside;
+
+			CSVSyntax(const char _separator, const char _quote, const char _escape) noexcept
+				: separator{ _separator }
+				, quote{ _quote }
+				, escape{ _escape }
+				, outside{ _separator, '\n', _quote, (_escape ? _escape : _quote) }
+				, inside{ _quote, (_escape ? _escape : _quote), _quote, _quote } {}
+
+			[[nodiscard]]
+			const char* findOutside(const char* p, const char* last) const noexcept
+			{
+				return FindAny(p, last, outside, separator, '\n', quote, (escape ? escape : quote));
+			}
+
+			[[nodiscard]]
+			const char* findInside(const char* p, const char* last) const noexcept
+			{
+				return FindAny(p, last, inside, quote, (escape ? escape : quote), quote, quote);
+			}
+
+			[[nodiscard]]
+			bool isEscape(const char ch) const noexcept
+			{
+				return (escape && (ch == escape));
+			}
+		};
+
+		// 位置 pos の文字が直前のエスケープ記号によってエスケープされているかを返す
+		[[nodiscard]]
+		static bool IsEscaped(const char* const first, const char* pos, const CSVSyntax& syntax) noexcept
+		{
+			if (not syntax.escape)
+			{
+				return false;
+			}
+
+			size_t count = 0;
+
+			while ((first < pos) && (pos[-1] == syntax.escape))
+			{
+				--pos;
+				++count;
+			}
+
+			return (count % 2);
+		}
+
+		// [first, last) に含まれる、エスケープされていないクオーテーション記号の数を返す
+		[[nodiscard]]
+		static size_t CountQuotes(const char* const begin, const char* p, const char* const last, const CSVSyntax& syntax) noexcept
+		{
+			if (IsEscaped(begin, p, syntax))
+			{
+				++p;
+			}
+
+			size_t count = 0;
+
+			while (p < last)
+			{
+				p = syntax.findInside(p, last);
+
+				if (p == last)
+				{
+					break;
+				}
+
+				if (syntax.isEscape(*p))
+				{
+					p += 2;
+				}
+				else
+				{
+					++count;
+					++p;
+				}
+			}
+
+			return count;
+		}
+
+		// p 以降で最初に始まる行の先頭を返す。チャンクの範囲 [p, last) に無い場合は nullptr
+		[[nodiscard]]
+		static const char* FindRowStart(const char* const begin, const char* p, const char* const last, bool inQuote, const CSVSyntax& syntax) noexcept
+		{
+			if (IsEscaped(begin, p, syntax))
+			{
+				++p;
+			}
+
+			while (p < last)
+			{
+				p = (inQuote ? syntax.findInside(p, last) : syntax.findOutside(p, last));
+
+				if (p == last)
+				{
+					break;
+				}
+
+				const char ch = *p;
+
+				if (syntax.isEscape(ch))
+				{
+					p += 2;
+				}
+				else if (ch == syntax.quote)
+				{
+					inQuote = (not inQuote);
+					++p;
+				}
+				else if (ch == '\n')
+				{
+					return (p + 1);
+				}
+				else
+				{
+					++p;
+				}
+			}
+
+			return nullptr;
+		}
+
+		struct CSVChunk
+		{
+			const char* rowStart = nullptr;
+
+			Array<CSVCell> cells;
+
+			// 各行の末尾の、cells 内でのインデックス
+			Array<size_t> rowEnds;
+		};
+
+		// 行の先頭から始まる範囲 [p, last) を要素に分割する
+		static void Tokenize(const char* const data, const char* p, const char* const last, const char* const dataEnd, const CSVSyntax& syntax, CSVChunk& chunk)
+		{
+			while (p < last)
+			{
+				for (;;)
+				{
+					const char* const fieldStart = p;
+					bool inQuote = false;
+					size_t quoteCount = 0;
+					bool hasEscape = false;
+
+					for (;;)
+					{
+						p = (inQuote ? syntax.findInside(p, dataEnd) : syntax.findOutside(p, dataEnd));
+
+						if (p == dataEnd)
+						{
+							break;
+						}
+
+						const char ch = *p;
+
+						if (syntax.isEscape(ch))
+						{
+							hasEscape = true;
+							p = Min((p + 2), dataEnd);
+						}
+						else if (ch == syntax.quote)
+						{
+							inQuote = (not inQuote);
+							++quoteCount;
+							++p;
+						}
+						else
+						{
+							// セパレータか改行
+							break;
+						}
+					}
+
+					const char* fieldEnd = p;
+
+					// CRLF の CR を取り除く
+					if ((not inQuote)
+						&& ((p == dataEnd) || (*p == '\n'))
+						&& (fieldStart < fieldEnd) && (fieldEnd[-1] == '\r')
+						&& (not IsEscaped(fieldStart, (fieldEnd - 1), syntax)))
+					{
+						--fieldEnd;
+					}
+
+					CSVCell cell{ static_cast<uint64>(fieldStart - data), static_cast<uint32>(fieldEnd - fieldStart), (hasEscape || (quoteCount != 0)) };
+
+					// "..." の形で、内側に処理が必要な記号が無い場合は内側を直接参照する
+					if ((not hasEscape) && (quoteCount == 2)
+						&& (2 <= cell.size) && (*fieldStart == syntax.quote) && (fieldEnd[-1] == syntax.quote))
+					{
+						++cell.offset;
+						cell.size -= 2;
+						cell.needsUnescape = false;
+					}
+
+					chunk.cells.push_back(cell);
+
+					if ((p != dataEnd) && (*p == syntax.separator))
+					{
+						++p;
+						continue;
+					}
+
+					if (p != dataEnd)
+					{
+						++p;
+					}
+
+					chunk.rowEnds.push_back(chunk.cells.size());
+					break;
+				}
+			}
+		}
+	}
+
+	CSVView::CSVViewDetail::CSVViewDetail()
+	{
+		// do nothing
+	}
+
+	CSVView::CSVViewDetail::~CSVViewDetail()
+	{
+		clear();
+	}
+
+	bool CSVView::CSVViewDetail::load(const FilePathView path, const char32 separator, const char32 quote, const char32 escape)
+	{
+		clear();
+
+		// リソースや、仮想ファイルシステムにマウントされたファイルはメモリマップできないので、BinaryReader で読み込む
+		if (FileSystem::IsResourcePath(path) || VirtualFileSystem::Exists(path))
+		{
+			BinaryReader reader{ path };
+
+			if (not reader)
+			{
+				return false;
+			}
+
+			return load(Blob{ reader }, separator, quote, escape);
+		}
+
+		if (not m_file.open(path, MapAll::Yes))
+		{
+			return false;
+		}
+
+		if (m_file.fileSize() != 0)
+		{
+			if (not m_file.data())
+			{
+				clear();
+				return false;
+			}
+
+			m_data = reinterpret_cast<const char*>(m_file.data());
+			m_size = m_file.mappedSize();
+		}
+
+		if (not build(separator, quote, escape))
+		{
+			clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool CSVView::CSVViewDetail::load(Blob&& blob, const char32 separator, const char32 quote, const char32 escape)
+	{
+		clear();
+
+		m_blob = std::move(blob);
+		m_data = reinterpret_cast<const char*>(m_blob.data());
+		m_size = m_blob.size();
+
+		if (not build(separator, quote, escape))
+		{
+			clear();
+			return false;
+		}
+
+		return true;
+	}
+
+	void CSVView::CSVViewDetail::clear()
+	{
+		m_cells.clear();
+		m_cells.shrink_to_fit();
+		m_rowOffsets.clear();
+		m_rowOffsets.shrink_to_fit();
+		m_data = nullptr;
+		m_size = 0;
+		m_blob.clear();
+		m_blob.shrink_to_fit();
+		m_file.close();
+	}
+
+	size_t CSVView::CSVViewDetail::rows() const noexcept
+	{
+		return (m_rowOffsets.isEmpty() ? 0 : (m_rowOffsets.size() - 1));
+	}
+
+	size_t CSVView::CSVViewDetail::columns(const size_t row) const noexcept
+	{
+		if (rows() <= row)
+		{
+			return 0;
+		}
+
+		return (m_rowOffsets[row + 1] - m_rowOffsets[row]);
+	}
+
+	const CSVView::CSVViewDetail::Cell* CSVView::CSVViewDetail::getCell(const size_t row, const size_t column) const noexcept
+	{
+		if (columns(row) <= column)
+		{
+			return nullptr;
+		}
+
+		return &m_cells[m_rowOffsets[row] + column];
+	}
+
+	std::string_view CSVView::CSVViewDetail::getUTF8(const Cell& cell, std::string& buffer) const
+	{
+		const std::string_view raw{ (m_data + cell.offset), cell.size };
+
+		if (not cell.needsUnescape)
+		{
+			return raw;
+		}
+
+		buffer.clear();
+
+		bool inQuote = false;
+
+		for (size_t i = 0; i < raw.size(); ++i)
+		{
+			const char ch = raw[i];
+
+			if (m_escape && (ch == m_escape))
+			{
+				if ((i + 1) < raw.size())
+				{
+					buffer.push_back(raw[++i]);
+				}
+			}
+			else if (ch == m_quote)
+			{
+				// クオーテーションの中の "" は " として扱う
+				if (inQuote && ((i + 1) < raw.size()) && (raw[i + 1] == m_quote))
+				{
+					buffer.push_back(m_quote);
+					++i;
+				}
+				else
+				{
+					inQuote = (not inQuote);
+				}
+			}
+			else
+			{
+				buffer.push_back(ch);
+			}
+		}
+
+		return buffer;
+	}
+
+	bool CSVView::CSVViewDetail::build(const char32 separator, const char32 quote, char32 escape)
+	{
+		if ((0x80 <= separator) || (0x80 <= quote) || (0x80 <= escape)
+			|| (separator == quote) || (separator == escape)
+			|| (separator == U'\n') || (quote == U'\n') || (escape == U'\n'))
+		{
+			return false;
+		}
+
+		if (escape == quote)
+		{
+			escape = U'\0';
+		}
+
+		m_quote = static_cast<char>(quote);
+		m_escape = static_cast<char>(escape);
+
+		const detail::CSVSyntax syntax{ static_cast<char>(separator), m_quote, m_escape };
+
+		const char* begin = m_data;
+		const char* const end = (m_data + m_size);
+
+		if ((3 <= m_size)
+			&& (begin[0] == '\xEF') && (begin[1] == '\xBB') && (begin[2] == '\xBF'))
+		{
+			begin += 3;
+		}
+
+		const size_t size = static_cast<size_t>(end - begin);
+
+		if (size == 0)
+		{
+			return true;
+		}
+
+		const size_t chunkCount = ((size < detail::CSVParallelThreshold) ? 1
+			: Clamp<size_t>((size / detail::CSVMinChunkSize), 1, (Threading::GetConcurrency() * 4)));
+		const size_t chunkSize = ((size + chunkCount - 1) / chunkCount);
+
+		const auto chunkBegin = [&](const size_t i) { return (begin + Min((i * chunkSize), size)); };
+
+		Array<detail::CSVChunk> chunks(chunkCount);
+
+		if (1 < chunkCount)
+		{
+			// 各チャンクのクオーテーション記号の数から、チャンクの先頭がクオーテーションの中にあるかを求める
+			Array<size_t> quoteCounts(chunkCount);
+
+			Threading::ParallelFor(chunkCount, [&](const size_t i)
+			{
+				quoteCounts[i] = detail::CountQuotes(begin, chunkBegin(i), chunkBegin(i + 1), syntax);
+			}, 1);
+
+			Array<bool> inQuote(chunkCount);
+
+			for (size_t i = 1; i < chunkCount; ++i)
+			{
+				inQuote[i] = (inQuote[i - 1] != static_cast<bool>(quoteCounts[i - 1] % 2));
+			}
+
+			Threading::ParallelFor(1, chunkCount, [&](const size_t i)
+			{
+				chunks[i].rowStart = detail::FindRowStart(begin, chunkBegin(i), chunkBegin(i + 1), inQuote[i], syntax);
+			}, 1);
+		}
+
+		// 行が始まらないチャンクは、次に行が始まる位置を先頭とする（空の範囲になる）
+		chunks[0].rowStart = begin;
+
+		for (size_t i = (chunkCount - 1); 0 < i; --i)
+		{
+			if (not chunks[i].rowStart)
+			{
+				chunks[i].rowStart = (((i + 1) < chunkCount) ? chunks[i + 1].rowStart : end);
+			}
+		}
+
+		Threading::ParallelFor(chunkCount, [&](const size_t i)
+		{
+			const char* const last = (((i + 1) < chunkCount) ? chunks[i + 1].rowStart : end);
+			detail::Tokenize(m_data, chunks[i].rowStart, last, end, syntax, chunks[i]);
+		}, 1);
+
+		size_t cellCount = 0;
+		size_t rowCount = 0;
+		Array<size_t> cellBases(chunkCount);
+		Array<size_t> rowBases(chunkCount);
+
+		for (size_t i = 0; i < chunkCount; ++i)
+		{
+			cellBases[i] = cellCount;
+			rowBases[i] = rowCount;
+			cellCount += chunks[i].cells.size();
+			rowCount += chunks[i].rowEnds.size();
+		}
+
+		m_cells.resize(cellCount);
+		m_rowOffsets.resize(rowCount + 1);
+		m_rowOffsets[0] = 0;
+
+		Threading::ParallelFor(chunkCount, [&](const size_t i)
+		{
+			const detail::CSVChunk& chunk = chunks[i];
+
+			std::copy(chunk.cells.begin(), chunk.cells.end(), (m_cells.begin() + cellBases[i]));
+
+			for (size_t k = 0; k < chunk.rowEnds.size(); ++k)
+			{
+				m_rowOffsets[rowBases[i] + k + 1] = (cellBases[i] + chunk.rowEnds[k]);
+			}
+		}, 1);
+
+		return true;
+	}
+}
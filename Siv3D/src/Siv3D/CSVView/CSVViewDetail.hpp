@@ -0,0 +1,86 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/CSVView.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// データ内の要素の範囲
+		struct CSVCell
+		{
+			uint64 offset;
+
+			uint32 size;
+
+			// true の場合、クオーテーション記号やエスケープ記号の処理が必要
+			bool needsUnescape;
+		};
+	}
+
+	class CSVView::CSVViewDetail
+	{
+	public:
+
+		using Cell = detail::CSVCell;
+
+		CSVViewDetail();
+
+		~CSVViewDetail();
+
+		[[nodiscard]]
+		bool load(FilePathView path, char32 separator, char32 quote, char32 escape);
+
+		[[nodiscard]]
+		bool load(Blob&& blob, char32 separator, char32 quote, char32 escape);
+
+		void clear();
+
+		[[nodiscard]]
+		size_t rows() const noexcept;
+
+		[[nodiscard]]
+		size_t columns(size_t row) const noexcept;
+
+		[[nodiscard]]
+		const Cell* getCell(size_t row, size_t column) const noexcept;
+
+		[[nodiscard]]
+		std::string_view getUTF8(const Cell& cell, std::string& buffer) const;
+
+	private:
+
+		MemoryMappedFileView m_file;
+
+		Blob m_blob;
+
+		// m_file または m_blob のデータ
+		const char* m_data = nullptr;
+
+		size_t m_size = 0;
+
+		char m_quote = '\"';
+
+		// エスケープ記号を使わない場合は 0
+		char m_escape = '\\';
+
+		Array<Cell> m_cells;
+
+		// 行 i の要素は m_cells[m_rowOffsets[i]] から m_cells[m_rowOffsets[i + 1]] の手前まで
+		Array<size_t> m_rowOffsets;
+
+		[[nodiscard]]
+		bool build(char32 separator, char32 quote, char32 escape);
+	};
+}
@@ -0,0 +1,280 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <charconv>
+# include <ThirdParty/fast_float/fast_float.h>
+# include <Siv3D/CSVView.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/CSVView/CSVViewDetail.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 1 つのタスクで読み取る行数
+		inline constexpr size_t CSVColumnGrainSize = 4096;
+
+		[[nodiscard]]
+		static constexpr bool IsCSVSpace(const char ch) noexcept
+		{
+			return ((ch == ' ') || (ch == '\t') || (ch == '\r') || (ch == '\n'));
+		}
+
+		[[nodiscard]]
+		static std::string_view TrimCSVValue(std::string_view s) noexcept
+		{
+			while ((not s.empty()) && IsCSVSpace(s.front()))
+			{
+				s.remove_prefix(1);
+			}
+
+			while ((not s.empty()) && IsCSVSpace(s.back()))
+			{
+				s.remove_suffix(1);
+			}
+
+			return s;
+		}
+
+		template <class Type>
+		[[nodiscard]]
+		static bool ParseCSVValue(std::string_view s, Type& value) noexcept
+		{
+			s = TrimCSVValue(s);
+
+			if constexpr (std::is_same_v<Type, bool>)
+			{
+				const auto equals = [s](const std::string_view word)
+				{
+					if (s.size() != word.size())
+					{
+						return false;
+					}
+
+					for (size_t i = 0; i < s.size(); ++i)
+					{
+						if ((s[i] | 0x20) != word[i])
+						{
+							return false;
+						}
+					}
+
+					return true;
+				};
+
+				if (equals("true"))
+				{
+					value = true;
+					return true;
+				}
+				else if (equals("false"))
+				{
+					value = false;
+					return true;
+				}
+
+				return false;
+			}
+			else if constexpr (std::is_integral_v<Type>)
+			{
+				if (s.starts_with('+'))
+				{
+					s.remove_prefix(1);
+				}
+
+				const auto [p, ec] = std::from_chars(s.data(), (s.data() + s.size()), value);
+
+				return ((ec == std::errc{}) && (p == (s.data() + s.size())) && (not s.empty()));
+			}
+			else
+			{
+				double result;
+
+				const auto [p, ec] = fast_float::from_chars(s.data(), (s.data() + s.size()), result);
+
+				if ((ec != std::errc{}) || (p != (s.data() + s.size())))
+				{
+					return false;
+				}
+
+				value = static_cast<Type>(result);
+				return true;
+			}
+		}
+
+		template <class Detail, class Type, class Fty>
+		[[nodiscard]]
+		static Array<Type> ReadCSVColumn(const Detail& csv, const size_t column, const Type& defaultValue, Fty convert)
+		{
+			const size_t rowCount = csv.rows();
+
+			Array<Type> values(rowCount, defaultValue);
+
+			Threading::ParallelFor(rowCount, [&](const size_t row)
+			{
+				if (const auto cell = csv.getCell(row, column))
+				{
+					thread_local std::string buffer;
+
+					convert(csv.getUTF8(*cell, buffer), values[row]);
+				}
+			}, CSVColumnGrainSize);
+
+			return values;
+		}
+
+		template <class Detail, class Type>
+		[[nodiscard]]
+		static Array<Type> ReadCSVColumn(const Detail& csv, const size_t column, const Type& defaultValue)
+		{
+			return ReadCSVColumn(csv, column, defaultValue, [&](const std::string_view s, Type& value)
+			{
+				if (not ParseCSVValue(s, value))
+				{
+					value = defaultValue;
+				}
+			});
+		}
+	}
+
+	CSVView::CSVView()
+		: pImpl{ std::make_shared<CSVViewDetail>() } {}
+
+	CSVView::CSVView(const FilePathView path, const char32 separator, const char32 quote, const char32 escape)
+		: CSVView{}
+	{
+		load(path, separator, quote, escape);
+	}
+
+	CSVView::CSVView(Blob&& blob, const char32 separator, const char32 quote, const char32 escape)
+		: CSVView{}
+	{
+		load(std::move(blob), separator, quote, escape);
+	}
+
+	bool CSVView::load(const FilePathView path, const char32 separator, const char32 quote, const char32 escape)
+	{
+		return pImpl->load(path, separator, quote, escape);
+	}
+
+	bool CSVView::load(Blob&& blob, const char32 separator, const char32 quote, const char32 escape)
+	{
+		return pImpl->load(std::move(blob), separator, quote, escape);
+	}
+
+	void CSVView::clear()
+	{
+		pImpl->clear();
+	}
+
+	bool CSVView::isEmpty() const noexcept
+	{
+		return (pImpl->rows() == 0);
+	}
+
+	size_t CSVView::rows() const noexcept
+	{
+		return pImpl->rows();
+	}
+
+	size_t CSVView::columns(const size_t row) const noexcept
+	{
+		return pImpl->columns(row);
+	}
+
+	std::string_view CSVView::getUTF8(const size_t row, const size_t column, std::string& buffer) const
+	{
+		if (const auto cell = pImpl->getCell(row, column))
+		{
+			return pImpl->getUTF8(*cell, buffer);
+		}
+
+		return{};
+	}
+
+	Array<String> CSVView::getRow(const size_t row) const
+	{
+		const size_t columnCount = pImpl->columns(row);
+
+		Array<String> values(Arg::reserve = columnCount);
+
+		std::string buffer;
+
+		for (size_t column = 0; column < columnCount; ++column)
+		{
+			values.push_back(Unicode::FromUTF8(pImpl->getUTF8(*pImpl->getCell(row, column), buffer)));
+		}
+
+		return values;
+	}
+
+	template <>
+	Array<bool> CSVView::column<bool>(const size_t column, const bool& defaultValue) const
+	{
+		// Array<bool> の要素は複数のスレッドから同時に書き込めないため、uint8 で読み取ってから変換する
+		const Array<uint8> values = detail::ReadCSVColumn(*pImpl, column, static_cast<uint8>(defaultValue), [&](const std::string_view s, uint8& value)
+		{
+			bool b;
+
+			if (detail::ParseCSVValue(s, b))
+			{
+				value = b;
+			}
+		});
+
+		return Array<bool>(values.begin(), values.end());
+	}
+
+	template <>
+	Array<int32> CSVView::column<int32>(const size_t column, const int32& defaultValue) const
+	{
+		return detail::ReadCSVColumn(*pImpl, column, defaultValue);
+	}
+
+	template <>
+	Array<uint32> CSVView::column<uint32>(const size_t column, const uint32& defaultValue) const
+	{
+		return detail::ReadCSVColumn(*pImpl, column, defaultValue);
+	}
+
+	template <>
+	Array<int64> CSVView::column<int64>(const size_t column, const int64& defaultValue) const
+	{
+		return detail::ReadCSVColumn(*pImpl, column, defaultValue);
+	}
+
+	template <>
+	Array<uint64> CSVView::column<uint64>(const size_t column, const uint64& defaultValue) const
+	{
+		return detail::ReadCSVColumn(*pImpl, column, defaultValue);
+	}
+
+	template <>
+	Array<float> CSVView::column<float>(const size_t column, const float& defaultValue) const
+	{
+		return detail::ReadCSVColumn(*pImpl, column, defaultValue);
+	}
+
+	template <>
+	Array<double> CSVView::column<double>(const size_t column, const double& defaultValue) const
+	{
+		return detail::ReadCSVColumn(*pImpl, column, defaultValue);
+	}
+
+	template <>
+	Array<String> CSVView::column<String>(const size_t column, const String& defaultValue) const
+	{
+		return detail::ReadCSVColumn(*pImpl, column, defaultValue, [](const std::string_view s, String& value)
+		{
+			value = Unicode::FromUTF8(s);
+		});
+	}
+}
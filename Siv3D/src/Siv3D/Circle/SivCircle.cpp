@@ -490,6 +490,16 @@ namespace s3d
 		return *this;
 	}
 
+	void Circle::DrawBatch(const Array<Circle>& circles, const ColorF& color)
+	{
+		SIV3D_ENGINE(Renderer2D)->addCircles(circles.data(), &color, circles.size(), true);
+	}
+
+	void Circle::DrawBatch(const Array<Circle>& circles, const Array<ColorF>& colors)
+	{
+		SIV3D_ENGINE(Renderer2D)->addCircles(circles.data(), colors.data(), Min(circles.size(), colors.size()), false);
+	}
+
 	TexturedCircle Circle::operator ()(const Texture& texture) const
 	{
 		return{ texture,
@@ -16,6 +16,7 @@
 namespace s3d
 {
 	class ISiv3DEmpty;
+	class ISiv3DVirtualFileSystem;
 	class ISiv3DLicenseManager;
 	class ISiv3DLogger;
 	class ISiv3DSystem;
@@ -72,6 +73,7 @@ namespace s3d
 
 		std::tuple<
 			Siv3DComponent<ISiv3DEmpty>,
+			Siv3DComponent<ISiv3DVirtualFileSystem>,
 			Siv3DComponent<ISiv3DLicenseManager>,
 			Siv3DComponent<ISiv3DLogger>,
 			Siv3DComponent<ISiv3DSystem>,
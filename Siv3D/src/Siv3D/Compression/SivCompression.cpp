@@ -12,12 +12,48 @@
 # include <Siv3D/Compression.hpp>
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/CompressionDictionary.hpp>
+# include <Siv3D/CompressionDictionary/CompressionDictionaryDetail.hpp>
 # include <ThirdParty/zstd/zstd.h>
+# include <ThirdParty/zstd/zdict.h>
 
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+# include <Siv3D/Unicode.hpp>
 
 namespace s3d
 {
+	namespace detail
+	{
+		struct ZstdContextDeleter
+		{
+			void operator ()(ZSTD_CCtx* cctx) const noexcept
+			{
+				ZSTD_freeCCtx(cctx);
+			}
+
+			void operator ()(ZSTD_DCtx* dctx) const noexcept
+			{
+				ZSTD_freeDCtx(dctx);
+			}
+		};
+
+		// 辞書を使う圧縮・展開の作業領域。小さなデータを繰り返し処理する場合のためにスレッドごとに再利用する
+		[[nodiscard]]
+		static ZSTD_CCtx* GetThreadCCtx()
+		{
+			thread_local std::unique_ptr<ZSTD_CCtx, ZstdContextDeleter> cctx{ ZSTD_createCCtx() };
+			return cctx.get();
+		}
+
+		[[nodiscard]]
+		static ZSTD_DCtx* GetThreadDCtx()
+		{
+			thread_local std::unique_ptr<ZSTD_DCtx, ZstdContextDeleter> dctx{ ZSTD_createDCtx() };
+			return dctx.get();
+		}
+	}
+
 	namespace Compression
 	{
 		Blob Compress(const void* data, const size_t size, const int32 compressionLevel)
@@ -607,5 +643,169 @@ namespace s3d
 
 			return true;
 		}
+	
+
+		Blob Compress(const void* data, const size_t size, const CompressionDictionary& dictionary)
+		{
+			Blob blob;
+
+			if (not Compress(data, size, blob, dictionary))
+			{
+				return{};
+			}
+
+			return blob;
+		}
+
+		bool Compress(const void* data, const size_t size, Blob& dst, const CompressionDictionary& dictionary)
+		{
+			ZSTD_CCtx* const cctx = detail::GetThreadCCtx();
+			const ZSTD_CDict* const cDict = dictionary._detail().getCDict();
+
+			if ((not cctx) || (not cDict))
+			{
+				dst.clear();
+				return false;
+			}
+
+			dst.resize(ZSTD_compressBound(size));
+
+			const size_t result = ZSTD_compress_usingCDict(cctx, dst.data(), dst.size(), data, size, cDict);
+
+			if (ZSTD_isError(result))
+			{
+				dst.clear();
+				return false;
+			}
+
+			dst.resize(result);
+
+			return true;
+		}
+
+		Blob Compress(const Blob& blob, const CompressionDictionary& dictionary)
+		{
+			return Compress(blob.data(), blob.size(), dictionary);
+		}
+
+		bool Compress(const Blob& blob, Blob& dst, const CompressionDictionary& dictionary)
+		{
+			return Compress(blob.data(), blob.size(), dst, dictionary);
+		}
+
+		Blob Decompress(const void* data, const size_t size, const CompressionDictionary& dictionary)
+		{
+			Blob blob;
+
+			if (not Decompress(data, size, blob, dictionary))
+			{
+				return{};
+			}
+
+			return blob;
+		}
+
+		bool Decompress(const void* data, const size_t size, Blob& dst, const CompressionDictionary& dictionary)
+		{
+			dst.clear();
+
+			ZSTD_DCtx* const dctx = detail::GetThreadDCtx();
+			const ZSTD_DDict* const dDict = dictionary._detail().getDDict();
+
+			if ((not dctx) || (not dDict))
+			{
+				return false;
+			}
+
+			// 展開後のサイズが分かる場合は一度に展開する
+			if (const unsigned long long contentSize = ZSTD_getFrameContentSize(data, size);
+				(contentSize != ZSTD_CONTENTSIZE_UNKNOWN) && (contentSize != ZSTD_CONTENTSIZE_ERROR))
+			{
+				dst.resize(static_cast<size_t>(contentSize));
+
+				const size_t result = ZSTD_decompress_usingDDict(dctx, dst.data(), dst.size(), data, size, dDict);
+
+				if (ZSTD_isError(result))
+				{
+					dst.clear();
+					return false;
+				}
+
+				dst.resize(result);
+
+				return true;
+			}
+
+			ZSTD_DCtx_reset(dctx, ZSTD_reset_session_only);
+
+			if (ZSTD_isError(ZSTD_DCtx_refDDict(dctx, dDict)))
+			{
+				return false;
+			}
+
+			const size_t outputBufferSize = ZSTD_DStreamOutSize();
+			ZSTD_inBuffer input = { data, size, 0 };
+			size_t result = 0;
+
+			while (input.pos < input.size)
+			{
+				const size_t writePos = dst.size();
+				dst.resize(writePos + outputBufferSize);
+
+				ZSTD_outBuffer output = { (dst.data() + writePos), outputBufferSize, 0 };
+
+				result = ZSTD_decompressStream(dctx, &output, &input);
+
+				dst.resize(writePos + output.pos);
+
+				if (ZSTD_isError(result))
+				{
+					dst.clear();
+					ZSTD_DCtx_reset(dctx, ZSTD_reset_session_and_parameters);
+					return false;
+				}
+			}
+
+			ZSTD_DCtx_reset(dctx, ZSTD_reset_session_and_parameters);
+
+			return (result == 0);
+		}
+
+		Blob Decompress(const Blob& blob, const CompressionDictionary& dictionary)
+		{
+			return Decompress(blob.data(), blob.size(), dictionary);
+		}
+
+		bool Decompress(const Blob& blob, Blob& dst, const CompressionDictionary& dictionary)
+		{
+			return Decompress(blob.data(), blob.size(), dst, dictionary);
+		}
+
+		Blob TrainDictionary(const Array<Blob>& samples, const size_t dictionarySize)
+		{
+			Array<Byte> buffer;
+			Array<size_t> sampleSizes(Arg::reserve = samples.size());
+
+			for (const auto& sample : samples)
+			{
+				buffer.insert(buffer.end(), sample.begin(), sample.end());
+				sampleSizes.push_back(sample.size());
+			}
+
+			Blob dictionary{ dictionarySize };
+
+			const size_t result = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+				buffer.data(), sampleSizes.data(), static_cast<unsigned>(sampleSizes.size()));
+
+			if (ZDICT_isError(result))
+			{
+				LOG_FAIL(U"Compression::TrainDictionary(): {}"_fmt(Unicode::Widen(ZDICT_getErrorName(result))));
+				return{};
+			}
+
+			dictionary.resize(result);
+
+			return dictionary;
+		}
 	}
 }
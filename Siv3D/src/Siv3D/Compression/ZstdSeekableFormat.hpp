@@ -0,0 +1,49 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		//
+		//	Zstandard seekable format
+		//	https://github.com/facebook/zstd/blob/dev/contrib/seekable_format/zstd_seekable_compression_format.md
+		//
+		//	[フレーム 0] ... [フレーム N-1] [シークテーブル（skippable frame）]
+		//
+		//	シークテーブル:
+		//		uint32 Magic_Number (ZstdSkippableMagic)
+		//		uint32 Frame_Size (エントリーとフッタのサイズ)
+		//		{ uint32 Compressed_Size, uint32 Decompressed_Size, [uint32 Checksum] } x N
+		//		uint32 Number_Of_Frames
+		//		uint8  Seek_Table_Descriptor (bit 7: Checksum_Flag, bit 2-6: 予約済み)
+		//		uint32 Seekable_Magic_Number (ZstdSeekableMagic)
+		//
+
+		inline constexpr uint32 ZstdSkippableMagic = 0x184D2A5E;
+
+		inline constexpr uint32 ZstdSeekableMagic = 0x8F92EAB1;
+
+		inline constexpr size_t ZstdSkippableHeaderSize = 8;
+
+		inline constexpr size_t ZstdSeekTableFooterSize = 9;
+
+		inline constexpr uint8 ZstdSeekTableChecksumFlag = 0x80;
+
+		inline constexpr uint8 ZstdSeekTableReservedBits = 0x7C;
+
+		// 1 つのシークテーブルに記録できるフレームの最大数
+		inline constexpr uint32 ZstdSeekTableMaxFrames = 0x8000000;
+	}
+}
@@ -0,0 +1,58 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/CompressionDictionary.hpp>
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class CompressionDictionary::CompressionDictionaryDetail
+	{
+	public:
+
+		CompressionDictionaryDetail();
+
+		CompressionDictionaryDetail(const Blob& dictionary, int32 compressionLevel);
+
+		~CompressionDictionaryDetail();
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		[[nodiscard]]
+		uint32 id() const noexcept;
+
+		[[nodiscard]]
+		int32 compressionLevel() const noexcept;
+
+		[[nodiscard]]
+		const Blob& getBlob() const noexcept;
+
+		// 辞書が空の場合は nullptr
+		[[nodiscard]]
+		const ZSTD_CDict* getCDict() const noexcept;
+
+		// 辞書が空の場合は nullptr
+		[[nodiscard]]
+		const ZSTD_DDict* getDDict() const noexcept;
+
+	private:
+
+		Blob m_blob;
+
+		int32 m_compressionLevel = Compression::DefaultLevel;
+
+		ZSTD_CDict* m_cDict = nullptr;
+
+		ZSTD_DDict* m_dDict = nullptr;
+	};
+}
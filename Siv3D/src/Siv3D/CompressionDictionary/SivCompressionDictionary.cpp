@@ -0,0 +1,55 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/CompressionDictionary.hpp>
+# include <Siv3D/CompressionDictionary/CompressionDictionaryDetail.hpp>
+
+namespace s3d
+{
+	CompressionDictionary::CompressionDictionary()
+		: pImpl{ std::make_shared<CompressionDictionaryDetail>() } {}
+
+	CompressionDictionary::CompressionDictionary(const Blob& dictionary, const int32 compressionLevel)
+		: pImpl{ std::make_shared<CompressionDictionaryDetail>(dictionary, compressionLevel) } {}
+
+	CompressionDictionary::CompressionDictionary(const FilePathView path, const int32 compressionLevel)
+		: CompressionDictionary{ Blob{ path }, compressionLevel } {}
+
+	bool CompressionDictionary::isEmpty() const noexcept
+	{
+		return pImpl->isEmpty();
+	}
+
+	CompressionDictionary::operator bool() const noexcept
+	{
+		return (not pImpl->isEmpty());
+	}
+
+	uint32 CompressionDictionary::id() const noexcept
+	{
+		return pImpl->id();
+	}
+
+	int32 CompressionDictionary::compressionLevel() const noexcept
+	{
+		return pImpl->compressionLevel();
+	}
+
+	const Blob& CompressionDictionary::getBlob() const noexcept
+	{
+		return pImpl->getBlob();
+	}
+
+	const CompressionDictionary::CompressionDictionaryDetail& CompressionDictionary::_detail() const noexcept
+	{
+		return *pImpl;
+	}
+}
@@ -357,6 +357,11 @@ namespace s3d
 		return m_fonts[handleID]->getGlyphCache().getTexture();
 	}
 
+	GlyphCacheStat CFont::getGlyphCacheStat(const Font::IDType handleID)
+	{
+		return m_fonts[handleID]->getGlyphCache().getStat();
+	}
+
 	Glyph CFont::getGlyph(const Font::IDType handleID, const StringView ch)
 	{
 		if (not ch)
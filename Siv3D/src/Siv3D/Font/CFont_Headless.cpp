@@ -273,6 +273,11 @@ namespace s3d
 		return m_fonts[handleID]->getGlyphCache().getTexture();
 	}
 
+	GlyphCacheStat CFont_Headless::getGlyphCacheStat(const Font::IDType handleID)
+	{
+		return m_fonts[handleID]->getGlyphCache().getStat();
+	}
+
 	Glyph CFont_Headless::getGlyph(const Font::IDType handleID, const StringView ch)
 	{
 		if (not ch)
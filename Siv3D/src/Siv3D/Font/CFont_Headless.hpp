@@ -89,6 +89,8 @@ namespace s3d
 
 		const Texture& getTexture(Font::IDType handleID) override;
 
+		GlyphCacheStat getGlyphCacheStat(Font::IDType handleID) override;
+
 		Glyph getGlyph(Font::IDType handleID, StringView ch) override;
 
 		Array<Glyph> getGlyphs(Font::IDType handleID, StringView s, Ligature ligature) override;
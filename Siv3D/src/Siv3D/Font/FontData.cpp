@@ -12,6 +12,7 @@
 # include <Siv3D/FileSystem.hpp>
 # include <Siv3D/PolygonGlyph.hpp>
 # include <Siv3D/Font/IFont.hpp>
+# include <Siv3D/VirtualFileSystem/IVirtualFileSystem.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include "FontData.hpp"
@@ -35,9 +36,26 @@ namespace s3d
 
 	FontData::FontData(const FT_Library library, const FilePathView path, const size_t faceIndex, FontMethod fontMethod, const int32 fontSize, const FontStyle style)
 	{
+		VirtualFileSource source;
+
+		if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+		{
+			pVirtualFileSystem->open(path, source);
+		}
+
+		// マウントされたディレクトリ内のファイルの場合は、実際のファイルパス
+		const FilePathView filePath = (source.filePath ? FilePathView{ source.filePath } : path);
+
 	# if SIV3D_PLATFORM(WINDOWS)
 
-		if (FileSystem::IsResource(path))
+		if (source.reader)
+		{
+			if (not loadVirtualFile(library, source, faceIndex, fontMethod, fontSize, style))
+			{
+				return;
+			}
+		}
+		else if (FileSystem::IsResource(path))
 		{
 			m_resource = FontResourceHolder{ path };
 
@@ -48,7 +66,7 @@ namespace s3d
 		}
 		else
 		{
-			if (not m_fontFace.load(library, path, faceIndex, fontSize, style, fontMethod))
+			if (not m_fontFace.load(library, filePath, faceIndex, fontSize, style, fontMethod))
 			{
 				return;
 			}
@@ -56,9 +74,19 @@ namespace s3d
 
 	# else
 
-		if (not m_fontFace.load(library, path, faceIndex, fontSize, style, fontMethod))
+		if (source.reader)
 		{
-			return;
+			if (not loadVirtualFile(library, source, faceIndex, fontMethod, fontSize, style))
+			{
+				return;
+			}
+		}
+		else
+		{
+			if (not m_fontFace.load(library, filePath, faceIndex, fontSize, style, fontMethod))
+			{
+				return;
+			}
 		}
 
 	# endif
@@ -142,6 +170,32 @@ namespace s3d
 	}
 
 	Array<GlyphCluster> FontData::getGlyphClusters(const StringView s, const bool recursive, const Ligature ligature) const
+	{
+		if (m_fallbackFonts)
+		{
+			// フォールバックフォントが解放されると、キャッシュしたシェーピング結果は使えなくなる
+			const size_t fallbackCount = m_fallbackFonts.count_if([](const auto& font) { return (not font.expired()); });
+
+			if (fallbackCount != m_shapingCacheFallbackCount)
+			{
+				m_shapingCache.clear();
+				m_shapingCacheFallbackCount = fallbackCount;
+			}
+		}
+
+		if (const Array<GlyphCluster>* clusters = m_shapingCache.find(s, recursive, ligature))
+		{
+			return *clusters;
+		}
+
+		Array<GlyphCluster> clusters = shapeGlyphClusters(s, recursive, ligature);
+
+		m_shapingCache.add(s, recursive, ligature, clusters);
+
+		return clusters;
+	}
+
+	Array<GlyphCluster> FontData::shapeGlyphClusters(const StringView s, const bool recursive, const Ligature ligature) const
 	{
 		const HBGlyphInfo glyphInfo = m_fontFace.getHBGlyphInfo(s, ligature);
 
@@ -332,6 +386,10 @@ namespace s3d
 	{
 		m_fallbackFonts.push_back(font);
 
+		// フォールバックフォントを使うシェーピング結果が変わるため
+		m_shapingCache.clear();
+		m_shapingCacheFallbackCount = m_fallbackFonts.count_if([](const auto& fallbackFont) { return (not fallbackFont.expired()); });
+
 		return true;
 	}
 
@@ -339,4 +397,25 @@ namespace s3d
 	{
 		return m_fallbackFonts[index];
 	}
+
+	bool FontData::loadVirtualFile(const FT_Library library, VirtualFileSource& source, const size_t faceIndex, const FontMethod fontMethod, const int32 fontSize, const FontStyle style)
+	{
+		// FreeType はフォントのデータを参照し続けるため、フォントを解放するまで保持する
+		if (source.data)
+		{
+			// パックファイル内のデータはコピーせずに参照する
+			m_virtualFileHolder = std::move(source.holder);
+
+			return m_fontFace.load(library, source.data, static_cast<size_t>(source.size), faceIndex, fontSize, style, fontMethod);
+		}
+
+		m_virtualFileData.resize(static_cast<size_t>(source.size));
+
+		if (source.reader->read(m_virtualFileData.data(), source.size) != source.size)
+		{
+			return false;
+		}
+
+		return m_fontFace.load(library, m_virtualFileData.data(), m_virtualFileData.size(), faceIndex, fontSize, style, fontMethod);
+	}
 }
@@ -13,12 +13,15 @@
 # include <Siv3D/Common.hpp>
 # include <Siv3D/StringView.hpp>
 # include <Siv3D/Font.hpp>
+# include <Siv3D/Blob.hpp>
 # include "FontResourceHolder.hpp"
 # include "FontFace.hpp"
+# include "ShapingCache.hpp"
 
 namespace s3d
 {
 	class IGlyphCache;
+	struct VirtualFileSource;
 
 	class FontData
 	{
@@ -95,6 +98,11 @@ namespace s3d
 
 	# endif
 
+		// 仮想ファイルシステムから読み込んだフォントのデータ。FreeType が参照し続けるため、m_fontFace より先に宣言する
+		std::shared_ptr<const void> m_virtualFileHolder;
+
+		Blob m_virtualFileData;
+
 		FontFace m_fontFace;
 
 		Array<std::weak_ptr<AssetHandle<Font>::AssetIDWrapperType>> m_fallbackFonts;
@@ -103,6 +111,17 @@ namespace s3d
 
 		std::unique_ptr<IGlyphCache> m_glyphCache;
 
+		mutable ShapingCache m_shapingCache;
+
+		// m_shapingCache を作成したときに有効だったフォールバックフォントの数
+		mutable size_t m_shapingCacheFallbackCount = 0;
+
 		bool m_initialized = false;
+
+		[[nodiscard]]
+		Array<GlyphCluster> shapeGlyphClusters(StringView s, bool recursive, Ligature ligature) const;
+
+		[[nodiscard]]
+		bool loadVirtualFile(FT_Library library, VirtualFileSource& source, size_t faceIndex, FontMethod fontMethod, int32 fontSize, FontStyle style);
 	};
 }
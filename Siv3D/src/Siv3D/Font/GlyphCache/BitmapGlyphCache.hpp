@@ -15,6 +15,7 @@
 # include <Siv3D/DynamicTexture.hpp>
 # include "IGlyphCache.hpp"
 # include "GlyphCacheCommon.hpp"
+# include "GlyphAtlas.hpp"
 
 namespace s3d
 {
@@ -61,15 +62,12 @@ namespace s3d
 		[[nodiscard]]
 		int32 getBufferThickness(GlyphIndex glyphIndex) override;
 
-	private:
-
-		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
-
-		DynamicTexture m_texture;
+		[[nodiscard]]
+		GlyphCacheStat getStat() const noexcept override;
 
-		bool m_hasDirty = false;
+	private:
 
-		BufferImage m_buffer = {};
+		GlyphAtlas m_atlas;
 
 		[[nodiscard]]
 		bool prerender(const FontData& font, const Array<GlyphCluster>& clusters, bool isMainFont);
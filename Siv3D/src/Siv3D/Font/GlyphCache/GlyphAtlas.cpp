@@ -0,0 +1,375 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Scene.hpp>
+# include "GlyphAtlas.hpp"
+
+namespace s3d
+{
+	GlyphAtlas::GlyphAtlas(const Color backgroundColor) noexcept
+		: m_backgroundColor{ backgroundColor } {}
+
+	bool GlyphAtlas::isEmpty() const noexcept
+	{
+		return m_glyphTable.empty();
+	}
+
+	const GlyphCache* GlyphAtlas::find(const GlyphIndex glyphIndex) const
+	{
+		if (auto it = m_glyphTable.find(glyphIndex);
+			it != m_glyphTable.end())
+		{
+			return &it->second;
+		}
+
+		return nullptr;
+	}
+
+	const GlyphCache& GlyphAtlas::get(const GlyphIndex glyphIndex) const
+	{
+		return m_glyphTable.find(glyphIndex)->second;
+	}
+
+	bool GlyphAtlas::touch(const GlyphIndex glyphIndex)
+	{
+		const auto it = m_glyphTable.find(glyphIndex);
+
+		if (it == m_glyphTable.end())
+		{
+			return false;
+		}
+
+		const GlyphCache& cache = it->second;
+		m_pages[cache.page].shelves[cache.shelf].lastUsedFrame = Scene::FrameCount();
+		++m_hitCount;
+
+		return true;
+	}
+
+	bool GlyphAtlas::add(const FontData& font, const Image& image, const GlyphInfo& glyphInfo)
+	{
+		++m_missCount;
+
+		if (m_pages.empty())
+		{
+			const int32 fontSize = font.getProperty().fontPixelSize;
+			const int32 baseWidth =
+				fontSize <= 16 ? 512 :
+				fontSize <= 32 ? 768 :
+				fontSize <= 48 ? 1024 :
+				fontSize <= 64 ? 1536 :
+				fontSize <= 256 ? 2048 : 4096;
+			const int32 baseHeight = (fontSize <= 256 ? 256 : 512);
+			m_pageBaseSize.set(baseWidth, baseHeight);
+			addPage();
+		}
+
+		const int32 bitmapWidth		= image.width();
+		const int32 bitmapHeight	= image.height();
+		size_t pageIndex = 0, shelfIndex = 0;
+
+		if (not allocate(bitmapWidth, bitmapHeight, pageIndex, shelfIndex))
+		{
+			return false;
+		}
+
+		Page& page = m_pages[pageIndex];
+		Shelf& shelf = page.shelves[shelfIndex];
+		const Point pos{ (shelf.penX + Padding), shelf.top };
+
+		image.overwrite(page.image, pos);
+		MarkDirty(page, Rect{ pos, bitmapWidth, bitmapHeight });
+
+		shelf.penX = (pos.x + bitmapWidth + Padding);
+		shelf.lastUsedFrame = Scene::FrameCount();
+		shelf.glyphs << glyphInfo.glyphIndex;
+
+		GlyphCache cache;
+		cache.info					= glyphInfo;
+		cache.textureRegionLeft		= static_cast<int16>(pos.x);
+		cache.textureRegionTop		= static_cast<int16>(pos.y);
+		cache.textureRegionWidth	= static_cast<int16>(bitmapWidth);
+		cache.textureRegionHeight	= static_cast<int16>(bitmapHeight);
+		cache.page					= static_cast<uint16>(pageIndex);
+		cache.shelf					= static_cast<uint16>(shelfIndex);
+		m_glyphTable.emplace(glyphInfo.glyphIndex, cache);
+
+		return true;
+	}
+
+	void GlyphAtlas::pin(const GlyphIndex glyphIndex)
+	{
+		if (const GlyphCache* cache = find(glyphIndex))
+		{
+			m_pages[cache->page].shelves[cache->shelf].pinnedFrame = Scene::FrameCount();
+		}
+	}
+
+	void GlyphAtlas::update()
+	{
+		for (auto& page : m_pages)
+		{
+			if (page.texture.size() != page.image.size())
+			{
+				// ページの高さが変わった場合は作り直す
+				page.texture = DynamicTexture{ page.image };
+				m_uploadedBytes += page.image.size_bytes();
+			}
+			else if (not page.dirtyRect.isEmpty())
+			{
+				// 変更された領域だけを転送する
+				if (page.texture.fillRegion(page.image, page.dirtyRect))
+				{
+					m_uploadedBytes += (static_cast<uint64>(page.dirtyRect.area()) * sizeof(Color));
+				}
+				else if (page.texture.fill(page.image))
+				{
+					m_uploadedBytes += page.image.size_bytes();
+				}
+				else
+				{
+					page.texture = DynamicTexture{ page.image };
+					m_uploadedBytes += page.image.size_bytes();
+				}
+			}
+
+			page.dirtyRect.set(0, 0, 0, 0);
+		}
+	}
+
+	const Texture& GlyphAtlas::getTexture()
+	{
+		update();
+
+		if (m_pages.empty())
+		{
+			return m_emptyTexture;
+		}
+
+		return m_pages.front().texture;
+	}
+
+	TextureRegion GlyphAtlas::getTextureRegion(const GlyphCache& cache) const
+	{
+		return m_pages[cache.page].texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+	}
+
+	GlyphCacheStat GlyphAtlas::getStat() const noexcept
+	{
+		return{
+			.glyphCount		= m_glyphTable.size(),
+			.pageCount		= m_pages.size(),
+			.hitCount		= m_hitCount,
+			.missCount		= m_missCount,
+			.evictedCount	= m_evictedCount,
+			.uploadedBytes	= m_uploadedBytes,
+		};
+	}
+
+	bool GlyphAtlas::allocate(const int32 width, const int32 height, size_t& pageIndex, size_t& shelfIndex)
+	{
+		for (size_t i = 0; i < m_pages.size(); ++i)
+		{
+			if (allocateInPage(i, width, height, shelfIndex))
+			{
+				pageIndex = i;
+				return true;
+			}
+		}
+
+		// 空きが無ければ、しばらく使われていないシェルフを再利用する
+		if (evict(width, height, pageIndex, shelfIndex))
+		{
+			return true;
+		}
+
+		// 現在のフレームで使うグリフだけで埋まっている場合はページを増やす
+		if (m_pages.size() < MaxPageCount)
+		{
+			addPage();
+
+			if (allocateInPage((m_pages.size() - 1), width, height, shelfIndex))
+			{
+				pageIndex = (m_pages.size() - 1);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool GlyphAtlas::allocateInPage(const size_t pageIndex, const int32 width, const int32 height, size_t& shelfIndex)
+	{
+		Page& page = m_pages[pageIndex];
+		const int32 pageWidth = page.image.width();
+
+		if (pageWidth < (Padding + width + Padding))
+		{
+			return false;
+		}
+
+		// 高さの無駄が最も少ないシェルフを探す
+		Optional<size_t> bestShelf;
+		int32 bestWaste = MaxPageHeight;
+
+		for (size_t i = 0; i < page.shelves.size(); ++i)
+		{
+			const Shelf& shelf = page.shelves[i];
+
+			if (pageWidth < (shelf.penX + Padding + width + Padding))
+			{
+				continue;
+			}
+
+			int32 waste = 0;
+
+			if (height <= shelf.height)
+			{
+				waste = (shelf.height - height);
+			}
+			else if ((i == (page.shelves.size() - 1))
+				&& ((shelf.top + height + Padding) <= MaxPageHeight))
+			{
+				// 最後のシェルフは下に伸ばせる
+				waste = 0;
+			}
+			else
+			{
+				continue;
+			}
+
+			if (waste < bestWaste)
+			{
+				bestShelf = i;
+				bestWaste = waste;
+			}
+		}
+
+		if (not bestShelf)
+		{
+			const int32 top = (page.shelves ? (page.shelves.back().top + page.shelves.back().height + (Padding * 2)) : Padding);
+
+			if (MaxPageHeight < (top + height + Padding))
+			{
+				return false;
+			}
+
+			page.shelves.emplace_back().top = top;
+			bestShelf = (page.shelves.size() - 1);
+		}
+
+		Shelf& shelf = page.shelves[*bestShelf];
+		shelf.height = Max(shelf.height, height);
+
+		if (const int32 requiredHeight = (shelf.top + shelf.height + Padding);
+			page.image.height() < requiredHeight)
+		{
+			const int32 newHeight = Min(((requiredHeight + 255) / 256 * 256), MaxPageHeight);
+			page.image.resizeRows(newHeight, m_backgroundColor);
+		}
+
+		shelfIndex = *bestShelf;
+		return true;
+	}
+
+	bool GlyphAtlas::evict(const int32 width, const int32 height, size_t& pageIndex, size_t& shelfIndex)
+	{
+		const int32 currentFrame = Scene::FrameCount();
+		Optional<std::pair<size_t, size_t>> lruShelf;
+		int32 lruFrame = currentFrame;
+
+		for (size_t p = 0; p < m_pages.size(); ++p)
+		{
+			const Page& page = m_pages[p];
+
+			if (page.image.width() < (Padding + width + Padding))
+			{
+				continue;
+			}
+
+			for (size_t s = 0; s < page.shelves.size(); ++s)
+			{
+				const Shelf& shelf = page.shelves[s];
+
+				if ((shelf.pinnedFrame == currentFrame)
+					|| (shelf.height < height)
+					|| (shelf.lastUsedFrame == currentFrame))
+				{
+					continue;
+				}
+
+				if ((not lruShelf) || (shelf.lastUsedFrame < lruFrame))
+				{
+					lruShelf.emplace(p, s);
+					lruFrame = shelf.lastUsedFrame;
+				}
+			}
+		}
+
+		if (not lruShelf)
+		{
+			return false;
+		}
+
+		std::tie(pageIndex, shelfIndex) = *lruShelf;
+		Page& page = m_pages[pageIndex];
+		Shelf& shelf = page.shelves[shelfIndex];
+
+		for (const auto& glyphIndex : shelf.glyphs)
+		{
+			m_glyphTable.erase(glyphIndex);
+		}
+
+		m_evictedCount += shelf.glyphs.size();
+		shelf.glyphs.clear();
+		shelf.penX = 0;
+
+		// 古いグリフがバイリニア補間で滲まないよう、シェルフ全体を消去する
+		const int32 pageWidth = page.image.width();
+
+		for (int32 y = shelf.top; y < (shelf.top + shelf.height); ++y)
+		{
+			Color* const line = page.image[y];
+			std::fill(line, (line + pageWidth), m_backgroundColor);
+		}
+
+		MarkDirty(page, Rect{ 0, shelf.top, pageWidth, shelf.height });
+
+		return true;
+	}
+
+	void GlyphAtlas::addPage()
+	{
+		Page page;
+		page.image.resize(m_pageBaseSize, m_backgroundColor);
+		m_pages << std::move(page);
+	}
+
+	void GlyphAtlas::MarkDirty(Page& page, const Rect& rect)
+	{
+		if (rect.isEmpty())
+		{
+			return;
+		}
+
+		if (page.dirtyRect.isEmpty())
+		{
+			page.dirtyRect = rect;
+			return;
+		}
+
+		const int32 left	= Min(page.dirtyRect.x, rect.x);
+		const int32 top		= Min(page.dirtyRect.y, rect.y);
+		const int32 right	= Max(page.dirtyRect.rightX(), rect.rightX());
+		const int32 bottom	= Max(page.dirtyRect.bottomY(), rect.bottomY());
+		page.dirtyRect.set(left, top, (right - left), (bottom - top));
+	}
+}
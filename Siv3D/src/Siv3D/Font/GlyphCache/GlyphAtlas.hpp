@@ -0,0 +1,143 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Optional.hpp>
+# include <Siv3D/Image.hpp>
+# include <Siv3D/DynamicTexture.hpp>
+# include <Siv3D/TextureRegion.hpp>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/GlyphCacheStat.hpp>
+# include "GlyphCacheCommon.hpp"
+
+namespace s3d
+{
+	/// @brief グリフを複数ページのテクスチャに詰め込むアトラス
+	/// @remark 各ページは高さの揃った行（シェルフ）に分割され、いっぱいになると最も長く使われていないシェルフを再利用します。
+	/// @remark 現在のフレームで使われたグリフは描画が終わっていないため、追い出しの対象になりません。
+	class GlyphAtlas
+	{
+	public:
+
+		static constexpr int32 MaxPageHeight = 4096;
+
+		static constexpr size_t MaxPageCount = 4;
+
+		GlyphAtlas() = default;
+
+		/// @param backgroundColor グリフの無い領域の色
+		explicit GlyphAtlas(Color backgroundColor) noexcept;
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		[[nodiscard]]
+		const GlyphCache* find(GlyphIndex glyphIndex) const;
+
+		/// @brief キャッシュ済みのグリフを返します。
+		/// @remark グリフがキャッシュされていない場合の動作は未定義です。
+		[[nodiscard]]
+		const GlyphCache& get(GlyphIndex glyphIndex) const;
+
+		/// @brief グリフがキャッシュされていれば、そのグリフを現在のフレームで使用したことを記録します。
+		/// @return グリフがキャッシュされていた場合 true, それ以外の場合は false
+		bool touch(GlyphIndex glyphIndex);
+
+		/// @brief グリフをアトラスに追加します。
+		/// @return 追加に成功した場合 true, 空き領域が無い場合は false
+		[[nodiscard]]
+		bool add(const FontData& font, const Image& image, const GlyphInfo& glyphInfo);
+
+		/// @brief 現在のフレームが終わるまで、グリフを追い出しの対象から外します。
+		/// @remark `Font::getGlyph()` などで外部に渡した TextureRegion を、そのフレームの描画が終わるまで有効に保つために使います。
+		/// @remark 固定はフレームの終わりに自動で解除されるため、毎フレーム `getGlyphs()` を呼んでも固定されたシェルフが溜まり続けることはありません。
+		void pin(GlyphIndex glyphIndex);
+
+		/// @brief 変更された領域をテクスチャに転送します。
+		void update();
+
+		[[nodiscard]]
+		const Texture& getTexture();
+
+		[[nodiscard]]
+		TextureRegion getTextureRegion(const GlyphCache& cache) const;
+
+		[[nodiscard]]
+		GlyphCacheStat getStat() const noexcept;
+
+	private:
+
+		struct Shelf
+		{
+			int32 top = 0;
+
+			int32 height = 0;
+
+			int32 penX = 0;
+
+			// 最後に使われたフレーム
+			int32 lastUsedFrame = 0;
+
+			// 追い出しの対象から外されているフレーム（pin() したフレーム）
+			int32 pinnedFrame = -1;
+
+			Array<GlyphIndex> glyphs;
+		};
+
+		struct Page
+		{
+			Image image;
+
+			DynamicTexture texture;
+
+			Array<Shelf> shelves;
+
+			// 変更された領域
+			Rect dirtyRect{ 0, 0, 0, 0 };
+		};
+
+		static constexpr int32 Padding = 1;
+
+		Color m_backgroundColor{ 255, 0 };
+
+		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
+
+		Array<Page> m_pages;
+
+		// ページが無い場合に getTexture() が返す空のテクスチャ
+		DynamicTexture m_emptyTexture;
+
+		Size m_pageBaseSize{ 0, 0 };
+
+		uint64 m_hitCount = 0;
+
+		uint64 m_missCount = 0;
+
+		uint64 m_evictedCount = 0;
+
+		uint64 m_uploadedBytes = 0;
+
+		[[nodiscard]]
+		bool allocate(int32 width, int32 height, size_t& pageIndex, size_t& shelfIndex);
+
+		[[nodiscard]]
+		bool allocateInPage(size_t pageIndex, int32 width, int32 height, size_t& shelfIndex);
+
+		[[nodiscard]]
+		bool evict(int32 width, int32 height, size_t& pageIndex, size_t& shelfIndex);
+
+		void addPage();
+
+		static void MarkDirty(Page& page, const Rect& rect);
+	};
+}
@@ -58,5 +58,8 @@ namespace s3d
 
 		[[nodiscard]]
 		virtual int32 getBufferThickness(GlyphIndex glyphIndex) = 0;
+
+		[[nodiscard]]
+		virtual GlyphCacheStat getStat() const noexcept = 0;
 	};
 }
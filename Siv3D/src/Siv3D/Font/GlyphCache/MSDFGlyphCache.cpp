@@ -63,9 +63,9 @@ namespace s3d
 				continue;
 			}
 
-			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
+			const auto& cache = m_atlas.get(cluster.glyphIndex);
 			{
-				const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+				const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 				const Vec2 posOffset = usebasePos ? cache.info.getBase(scale) : cache.info.getOffset(scale);
 				const Vec2 drawPos = (penPos + posOffset);
 
@@ -105,7 +105,7 @@ namespace s3d
 		}
 		updateTexture();
 
-		const double dotXAdvance = m_glyphTable.find(dotGlyphCluster[0].glyphIndex)->second.info.xAdvance;
+		const double dotXAdvance = m_atlas.get(dotGlyphCluster[0].glyphIndex).info.xAdvance;
 		const Vec2 areaBottomRight = area.br();
 
 		const auto& prop = font.getProperty();
@@ -156,7 +156,7 @@ namespace s3d
 				}
 				else
 				{
-					const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
+					const auto& cache = m_atlas.get(cluster.glyphIndex);
 					xAdvance = (cache.info.xAdvance * scale);
 				}
 
@@ -219,7 +219,7 @@ namespace s3d
 		}
 		updateTexture();
 
-		const double dotXAdvance = m_glyphTable.find(dotGlyphCluster[0].glyphIndex)->second.info.xAdvance;
+		const double dotXAdvance = m_atlas.get(dotGlyphCluster[0].glyphIndex).info.xAdvance;
 		const Vec2 areaBottomRight = area.br();
 
 		const auto& prop = font.getProperty();
@@ -270,7 +270,7 @@ namespace s3d
 				}
 				else
 				{
-					const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
+					const auto& cache = m_atlas.get(cluster.glyphIndex);
 					xAdvance = (cache.info.xAdvance * scale);
 				}
 
@@ -367,9 +367,9 @@ namespace s3d
 			}
 			else
 			{
-				const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
+				const auto& cache = m_atlas.get(cluster.glyphIndex);
 				{
-					const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+					const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 					const Vec2 posOffset = cache.info.getOffset(scale);
 					const Vec2 drawPos = (newPenPositions[i] + posOffset);
 
@@ -408,9 +408,9 @@ namespace s3d
 		double xMax = basePos.x;
 
 		{
-			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
+			const auto& cache = m_atlas.get(cluster.glyphIndex);
 			{
-				const TextureRegion textureRegion = m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+				const TextureRegion textureRegion = m_atlas.getTextureRegion(cache);
 				const Vec2 posOffset = usebasePos ? cache.info.getBase(scale) : cache.info.getOffset(scale);
 				const Vec2 drawPos = (penPos + posOffset);
 				RectF rect;
@@ -485,7 +485,7 @@ namespace s3d
 				continue;
 			}
 
-			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
+			const auto& cache = m_atlas.get(cluster.glyphIndex);
 			const double xAdvance = (cache.info.xAdvance * scale);
 			xAdvances << xAdvance;
 			penPosX += xAdvance;
@@ -503,7 +503,7 @@ namespace s3d
 
 		const auto& prop = font.getProperty();
 		const double scale = (fontSize / prop.fontPixelSize);
-		const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
+		const auto& cache = m_atlas.get(cluster.glyphIndex);
 		return (cache.info.xAdvance * scale);
 	}
 
@@ -550,7 +550,7 @@ namespace s3d
 				continue;
 			}
 
-			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
+			const auto& cache = m_atlas.get(cluster.glyphIndex);
 			penPos.x += (cache.info.xAdvance * scale);
 			xMax = Max(xMax, penPos.x);
 		}
@@ -574,7 +574,7 @@ namespace s3d
 		double xMax = basePos.x;
 
 		{
-			const auto& cache = m_glyphTable.find(cluster.glyphIndex)->second;
+			const auto& cache = m_atlas.get(cluster.glyphIndex);
 			penPos.x += (cache.info.xAdvance * scale);
 			xMax = Max(xMax, penPos.x);
 		}
@@ -585,12 +585,12 @@ namespace s3d
 
 	void MSDFGlyphCache::setBufferWidth(const int32 width)
 	{
-		m_buffer.bufferWidth = Max(width, 0);
+		m_bufferWidth = Max(width, 0);
 	}
 
 	int32 MSDFGlyphCache::getBufferWidth() const noexcept
 	{
-		return m_buffer.bufferWidth;
+		return m_bufferWidth;
 	}
 
 	bool MSDFGlyphCache::preload(const FontData& font, const StringView s)
@@ -600,9 +600,7 @@ namespace s3d
 
 	const Texture& MSDFGlyphCache::getTexture() noexcept
 	{
-		updateTexture();
-
-		return m_texture;
+		return m_atlas.getTexture();
 	}
 
 	TextureRegion MSDFGlyphCache::getTextureRegion(const FontData& font, const GlyphIndex glyphIndex)
@@ -611,35 +609,40 @@ namespace s3d
 		{
 			return{};
 		}
+
+		// 返した TextureRegion が、このフレームの描画が終わるまで無効にならないよう、追い出しの対象から外す
+		m_atlas.pin(glyphIndex);
 		updateTexture();
 
-		const auto& cache = m_glyphTable.find(glyphIndex)->second;
-		return m_texture(cache.textureRegionLeft, cache.textureRegionTop, cache.textureRegionWidth, cache.textureRegionHeight);
+		const auto& cache = m_atlas.get(glyphIndex);
+		return m_atlas.getTextureRegion(cache);
 	}
 
 	int32 MSDFGlyphCache::getBufferThickness(const GlyphIndex glyphIndex)
 	{
-		if (auto it = m_glyphTable.find(glyphIndex);
-			it != m_glyphTable.end())
+		if (const GlyphCache* cache = m_atlas.find(glyphIndex))
 		{
-			return it->second.info.buffer;
+			return cache->info.buffer;
 		}
 
 		return 0;
 	}
 
+	GlyphCacheStat MSDFGlyphCache::getStat() const noexcept
+	{
+		return m_atlas.getStat();
+	}
+
 	bool MSDFGlyphCache::prerender(const FontData& font, const Array<GlyphCluster>& clusters, const bool isMainFont)
 	{
-		if (m_glyphTable.empty())
+		if (m_atlas.isEmpty())
 		{
-			const MSDFGlyph glyph = font.renderMSDFByGlyphIndex(0, m_buffer.bufferWidth);
+			const MSDFGlyph glyph = font.renderMSDFByGlyphIndex(0, m_bufferWidth);
 
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
+			if (not m_atlas.add(font, glyph.image, glyph))
 			{
 				return false;
 			}
-
-			m_hasDirty = true;
 		}
 
 		for (const auto& cluster : clusters)
@@ -649,24 +652,22 @@ namespace s3d
 				continue;
 			}
 
-			if (m_glyphTable.contains(cluster.glyphIndex))
+			if (m_atlas.touch(cluster.glyphIndex))
 			{
 				continue;
 			}
 
-			const MSDFGlyph glyph = font.renderMSDFByGlyphIndex(cluster.glyphIndex, m_buffer.bufferWidth);
+			const MSDFGlyph glyph = font.renderMSDFByGlyphIndex(cluster.glyphIndex, m_bufferWidth);
 
-			if (m_glyphTable.contains(glyph.glyphIndex))
+			if (m_atlas.touch(glyph.glyphIndex))
 			{
 				continue;
 			}
 
-			if (not CacheGlyph(font, glyph.image, glyph, m_buffer, m_glyphTable))
+			if (not m_atlas.add(font, glyph.image, glyph))
 			{
 				return false;
 			}
-
-			m_hasDirty = true;
 		}
 
 		// texture content can be updated in a different thread
@@ -680,20 +681,6 @@ namespace s3d
 
 	void MSDFGlyphCache::updateTexture()
 	{
-		if (not m_hasDirty)
-		{
-			return;
-		}
-
-		if (m_texture.size() == m_buffer.image.size())
-		{
-			m_texture.fill(m_buffer.image);
-		}
-		else
-		{
-			m_texture = DynamicTexture{ m_buffer.image };
-		}
-
-		m_hasDirty = false;
+		m_atlas.update();
 	}
 }
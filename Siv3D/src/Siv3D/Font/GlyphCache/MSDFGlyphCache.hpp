@@ -15,6 +15,7 @@
 # include <Siv3D/HashTable.hpp>
 # include "IGlyphCache.hpp"
 # include "GlyphCacheCommon.hpp"
+# include "GlyphAtlas.hpp"
 
 namespace s3d
 {
@@ -61,17 +62,16 @@ namespace s3d
 		[[nodiscard]]
 		int32 getBufferThickness(GlyphIndex glyphIndex) override;
 
+		[[nodiscard]]
+		GlyphCacheStat getStat() const noexcept override;
+
 	private:
 
 		static constexpr int32 DefaultBuffer = 2;
 
-		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
-
-		DynamicTexture m_texture;
-
-		bool m_hasDirty = false;
+		GlyphAtlas m_atlas{ Color{ 0, 0 } };
 
-		BufferImage m_buffer = { .image = {}, .backgroundColor = Color{ 0, 0 } };
+		int32 m_bufferWidth = 2;
 
 		[[nodiscard]]
 		bool prerender(const FontData& font, const Array<GlyphCluster>& clusters, bool isMainFont);
@@ -15,6 +15,7 @@
 # include <Siv3D/HashTable.hpp>
 # include "IGlyphCache.hpp"
 # include "GlyphCacheCommon.hpp"
+# include "GlyphAtlas.hpp"
 
 namespace s3d
 {
@@ -61,15 +62,14 @@ namespace s3d
 		[[nodiscard]]
 		int32 getBufferThickness(GlyphIndex glyphIndex) override;
 
-	private:
-
-		HashTable<GlyphIndex, GlyphCache> m_glyphTable;
+		[[nodiscard]]
+		GlyphCacheStat getStat() const noexcept override;
 
-		DynamicTexture m_texture;
+	private:
 
-		bool m_hasDirty = false;
+		GlyphAtlas m_atlas;
 
-		BufferImage m_buffer = {};
+		int32 m_bufferWidth = 2;
 	
 		[[nodiscard]]
 		bool prerender(const FontData& font, const Array<GlyphCluster>& clusters, bool isMainFont);
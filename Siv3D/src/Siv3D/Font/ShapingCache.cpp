@@ -0,0 +1,82 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Hash.hpp>
+# include "ShapingCache.hpp"
+
+namespace s3d
+{
+	const Array<GlyphCluster>* ShapingCache::find(const StringView s, const bool recursive, const Ligature ligature)
+	{
+		if (MaxTextLength < s.size())
+		{
+			return nullptr;
+		}
+
+		const auto it = m_table.find(MakeKey(s, recursive, ligature));
+
+		if (it == m_table.end())
+		{
+			return nullptr;
+		}
+
+		const auto entry = it->second;
+
+		// ハッシュ値の衝突に備えて文字列も比較する
+		if ((entry->text != s)
+			|| (entry->recursive != recursive)
+			|| (entry->ligature != ligature.getBool()))
+		{
+			return nullptr;
+		}
+
+		m_entries.splice(m_entries.begin(), m_entries, entry);
+
+		return &entry->clusters;
+	}
+
+	void ShapingCache::add(const StringView s, const bool recursive, const Ligature ligature, const Array<GlyphCluster>& clusters)
+	{
+		if (MaxTextLength < s.size())
+		{
+			return;
+		}
+
+		const uint64 key = MakeKey(s, recursive, ligature);
+
+		if (auto it = m_table.find(key);
+			it != m_table.end())
+		{
+			m_entries.erase(it->second);
+			m_table.erase(it);
+		}
+		else if (MaxEntries <= m_entries.size())
+		{
+			m_table.erase(m_entries.back().key);
+			m_entries.pop_back();
+		}
+
+		m_entries.push_front(Entry{ key, String{ s }, recursive, ligature.getBool(), clusters });
+		m_table.emplace(key, m_entries.begin());
+	}
+
+	void ShapingCache::clear()
+	{
+		m_entries.clear();
+		m_table.clear();
+	}
+
+	uint64 ShapingCache::MakeKey(const StringView s, const bool recursive, const Ligature ligature) noexcept
+	{
+		const uint64 hash = Hash::XXHash3(s.data(), s.size_bytes());
+		return (hash ^ ((static_cast<uint64>(recursive) << 1) | static_cast<uint64>(ligature.getBool())));
+	}
+}
@@ -0,0 +1,68 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <list>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/GlyphCluster.hpp>
+# include <Siv3D/PredefinedYesNo.hpp>
+
+namespace s3d
+{
+	/// @brief 文字列のシェーピング結果を保持する LRU キャッシュ
+	/// @remark 毎フレーム同じ文字列を描画する場合に、HarfBuzz によるシェーピングを省略します。
+	class ShapingCache
+	{
+	public:
+
+		/// @brief キャッシュする文字列の最大数
+		static constexpr size_t MaxEntries = 4096;
+
+		/// @brief キャッシュする文字列の最大の長さ。これより長い文字列はキャッシュしません。
+		static constexpr size_t MaxTextLength = 1024;
+
+		/// @brief キャッシュされたシェーピング結果を返します。
+		/// @return シェーピング結果へのポインタ。キャッシュされていない場合は nullptr
+		[[nodiscard]]
+		const Array<GlyphCluster>* find(StringView s, bool recursive, Ligature ligature);
+
+		/// @brief シェーピング結果をキャッシュに追加します。
+		void add(StringView s, bool recursive, Ligature ligature, const Array<GlyphCluster>& clusters);
+
+		void clear();
+
+	private:
+
+		struct Entry
+		{
+			uint64 key = 0;
+
+			String text;
+
+			bool recursive = false;
+
+			bool ligature = false;
+
+			Array<GlyphCluster> clusters;
+		};
+
+		// 先頭ほど最近使われた
+		std::list<Entry> m_entries;
+
+		HashTable<uint64, std::list<Entry>::iterator> m_table;
+
+		[[nodiscard]]
+		static uint64 MakeKey(StringView s, bool recursive, Ligature ligature) noexcept;
+	};
+}
@@ -403,6 +403,11 @@ namespace s3d
 		return SIV3D_ENGINE(Font)->getTexture(m_handle->id());
 	}
 
+	GlyphCacheStat Font::getGlyphCacheStat() const
+	{
+		return SIV3D_ENGINE(Font)->getGlyphCacheStat(m_handle->id());
+	}
+
 	Glyph Font::getGlyph(const char32 ch) const
 	{
 		return SIV3D_ENGINE(Font)->getGlyph(m_handle->id(), StringView(&ch, 1));
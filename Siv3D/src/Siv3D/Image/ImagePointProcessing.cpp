@@ -0,0 +1,684 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+// AVX2 版は x86-64 の GCC / Clang / MSVC でのみビルドし、実行時に CPU の対応を確認して使う。
+// SIMDe の関数名エイリアスと衝突しないよう、<immintrin.h> は SIMD.hpp より先に読み込む。
+# if (defined(__x86_64__) || defined(_M_X64))
+#	include <immintrin.h>
+#	define SIV3D_PRIVATE_IMAGE_POINT_AVX2() 1
+#	if defined(_MSC_VER) && !defined(__clang__)
+#		define SIV3D_PRIVATE_TARGET_AVX2
+#	else
+#		define SIV3D_PRIVATE_TARGET_AVX2 __attribute__((target("avx2")))
+#	endif
+# else
+#	define SIV3D_PRIVATE_IMAGE_POINT_AVX2() 0
+# endif
+
+# include <cmath>
+# include <Siv3D/CPUInfo.hpp>
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/Threading.hpp>
+# include "ImagePointProcessing.hpp"
+
+namespace s3d
+{
+	namespace ImagePointProcessing
+	{
+		namespace
+		{
+			// 1 タスクあたりの最小ピクセル数。これより小さい画像は呼び出し元のスレッドだけで処理する
+			constexpr size_t MinPixelsPerTask = (1 << 16);
+
+			constexpr uint32 RGBMask = 0x00FFFFFF;
+
+			constexpr uint32 AlphaMask = 0xFF000000;
+
+			enum class KernelLevel : uint8
+			{
+				Reference,
+
+				SSE4_1,
+
+				AVX2,
+			};
+
+			[[nodiscard]]
+			KernelLevel DetectKernelLevel() noexcept
+			{
+			# if SIV3D_PRIVATE_IMAGE_POINT_AVX2()
+
+				const CPUInfo& cpu = GetCPUInfo();
+
+				if (cpu.features.avx2)
+				{
+					return KernelLevel::AVX2;
+				}
+				else if (cpu.features.sse4_1)
+				{
+					return KernelLevel::SSE4_1;
+				}
+
+				return KernelLevel::Reference;
+
+			# else
+
+				// x86 以外では SIMDe が NEON などの命令に置き換える
+				return KernelLevel::SSE4_1;
+
+			# endif
+			}
+
+			[[nodiscard]]
+			KernelLevel GetKernelLevel() noexcept
+			{
+				static const KernelLevel level = DetectKernelLevel();
+				return level;
+			}
+
+			template <class Kernel>
+			[[nodiscard]]
+			Kernel SelectKernel(const Kernel reference, const Kernel sse4_1, [[maybe_unused]] const Kernel avx2) noexcept
+			{
+				switch (GetKernelLevel())
+				{
+			# if SIV3D_PRIVATE_IMAGE_POINT_AVX2()
+				case KernelLevel::AVX2:
+					return avx2;
+			# endif
+				case KernelLevel::SSE4_1:
+					return sse4_1;
+				default:
+					return reference;
+				}
+			}
+
+			/// @brief 画像を行単位で分割し、各ブロックの先頭ピクセルとピクセル数を f に渡します。
+			template <class Fty>
+			void ForEachRows(Image& image, Fty f)
+			{
+				const size_t width = image.width();
+				const size_t height = image.height();
+
+				if ((width == 0) || (height == 0))
+				{
+					return;
+				}
+
+				Color* const pixels = image.data();
+				const size_t rowsPerTask = Max<size_t>((MinPixelsPerTask / width), 1);
+
+				Threading::detail::ParallelForRange(0, height, rowsPerTask, [=](const size_t beginRow, const size_t endRow)
+				{
+					f((pixels + beginRow * width), ((endRow - beginRow) * width));
+				});
+			}
+
+			[[nodiscard]]
+			inline Color MakeSepia(Color color) noexcept
+			{
+				const double tr = Min(((0.393 * color.r) + (0.769 * color.g) + (0.189 * color.b)), 255.0);
+				const double tg = Min(((0.349 * color.r) + (0.686 * color.g) + (0.168 * color.b)), 255.0);
+				const double tb = Min(((0.272 * color.r) + (0.534 * color.g) + (0.131 * color.b)), 255.0);
+
+				color.r = static_cast<uint8>(tr);
+				color.g = static_cast<uint8>(tg);
+				color.b = static_cast<uint8>(tb);
+				return color;
+			}
+
+			void InitPosterizeTable(const int32 level, uint8 table[256]) noexcept
+			{
+				const int32 levN = Clamp(level, 2, 256) - 1;
+
+				for (size_t i = 0; i < 256; ++i)
+				{
+					table[i] = static_cast<uint8>(std::floor(i / 255.0 * levN + 0.5) / levN * 255);
+				}
+			}
+
+			void InitGammmaTable(const double gamma, uint8 table[256])
+			{
+				const double gammaInv = (1.0 / gamma);
+
+				for (size_t i = 0; i < 256; ++i)
+				{
+					table[i] = static_cast<uint8>(std::pow(i / 255.0, gammaInv) * 255.0);
+				}
+			}
+
+			[[nodiscard]]
+			inline uint32 BrightenOffset(const int32 level) noexcept
+			{
+				const uint32 offset = static_cast<uint32>(Min<int64>(std::abs(static_cast<int64>(level)), 255));
+				return (offset * 0x010101);
+			}
+
+			//////////////////////////////////////////////////
+			//
+			//	Reference
+			//
+			//////////////////////////////////////////////////
+
+			void Negate_Reference(Color* pixels, const size_t count)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					pixels[i] = ~pixels[i];
+				}
+			}
+
+			void Grayscale_Reference(Color* pixels, const size_t count)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					Color& pixel = pixels[i];
+					const uint8 gray = pixel.grayscale0_255();
+					pixel.r = gray;
+					pixel.g = gray;
+					pixel.b = gray;
+				}
+			}
+
+			void Sepia_Reference(Color* pixels, const size_t count)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					pixels[i] = MakeSepia(pixels[i]);
+				}
+			}
+
+			void Table_Reference(Color* pixels, const size_t count, const uint8* table)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					Color& pixel = pixels[i];
+					pixel.r = table[pixel.r];
+					pixel.g = table[pixel.g];
+					pixel.b = table[pixel.b];
+				}
+			}
+
+			void Brighten_Reference(Color* pixels, const size_t count, const int32 level)
+			{
+				if (level < 0)
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						Color& pixel = pixels[i];
+						pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
+						pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
+						pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
+					}
+				}
+				else if (level > 0)
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						Color& pixel = pixels[i];
+						pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
+						pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
+						pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
+					}
+				}
+			}
+
+			void Threshold_Reference(Color* pixels, const size_t count, const double thresholdF, const bool invertColor)
+			{
+				const uint8 high = (invertColor ? 0 : 255);
+				const uint8 low = (invertColor ? 255 : 0);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					Color& pixel = pixels[i];
+					pixel.setRGB((thresholdF < pixel.grayscale()) ? high : low);
+				}
+			}
+
+			void RGBAtoBGRA_Reference(Color* pixels, const size_t count)
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					Color& pixel = pixels[i];
+					const uint8 t = pixel.r;
+					pixel.r = pixel.b;
+					pixel.b = t;
+				}
+			}
+
+			//////////////////////////////////////////////////
+			//
+			//	SSE4.1
+			//
+			//////////////////////////////////////////////////
+
+			// 4 ピクセルの R, G, B 成分を、下位 2 ピクセルと上位 2 ピクセルに分けて double に変換する
+			inline void UnpackRGB_SSE4_1(const __m128i pixels, __m128d (&r)[2], __m128d (&g)[2], __m128d (&b)[2])
+			{
+				const __m128i mask = ::_mm_set1_epi32(0xFF);
+				const __m128i ri = ::_mm_and_si128(pixels, mask);
+				const __m128i gi = ::_mm_and_si128(::_mm_srli_epi32(pixels, 8), mask);
+				const __m128i bi = ::_mm_and_si128(::_mm_srli_epi32(pixels, 16), mask);
+
+				r[0] = ::_mm_cvtepi32_pd(ri);
+				r[1] = ::_mm_cvtepi32_pd(_mm_shuffle_epi32(ri, _MM_SHUFFLE(1, 0, 3, 2)));
+				g[0] = ::_mm_cvtepi32_pd(gi);
+				g[1] = ::_mm_cvtepi32_pd(_mm_shuffle_epi32(gi, _MM_SHUFFLE(1, 0, 3, 2)));
+				b[0] = ::_mm_cvtepi32_pd(bi);
+				b[1] = ::_mm_cvtepi32_pd(_mm_shuffle_epi32(bi, _MM_SHUFFLE(1, 0, 3, 2)));
+			}
+
+			// スカラー版と同じ順序 ((kr * r + kg * g) + kb * b) で計算する（FMA は使わない）
+			[[nodiscard]]
+			inline __m128d Dot_SSE4_1(const __m128d r, const __m128d g, const __m128d b, const double kr, const double kg, const double kb)
+			{
+				return ::_mm_add_pd(::_mm_add_pd(::_mm_mul_pd(::_mm_set1_pd(kr), r), ::_mm_mul_pd(::_mm_set1_pd(kg), g)), ::_mm_mul_pd(::_mm_set1_pd(kb), b));
+			}
+
+			// 2 + 2 個の double を、static_cast と同じく 0 方向に丸めて 4 個の int32 にする
+			[[nodiscard]]
+			inline __m128i Truncate_SSE4_1(const __m128d lo, const __m128d hi)
+			{
+				return ::_mm_unpacklo_epi64(::_mm_cvttpd_epi32(lo), ::_mm_cvttpd_epi32(hi));
+			}
+
+			void Negate_SSE4_1(Color* pixels, const size_t count)
+			{
+				const __m128i rgbMask = ::_mm_set1_epi32(RGBMask);
+				size_t i = 0;
+
+				for (; (i + 4) <= count; i += 4)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + i);
+					::_mm_storeu_si128(p, ::_mm_xor_si128(::_mm_loadu_si128(p), rgbMask));
+				}
+
+				Negate_Reference((pixels + i), (count - i));
+			}
+
+			void Grayscale_SSE4_1(Color* pixels, const size_t count)
+			{
+				const __m128i alphaMask = ::_mm_set1_epi32(AlphaMask);
+				const __m128i broadcast = ::_mm_set1_epi32(0x010101);
+				size_t i = 0;
+
+				for (; (i + 4) <= count; i += 4)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + i);
+					const __m128i src = ::_mm_loadu_si128(p);
+
+					__m128d r[2], g[2], b[2];
+					UnpackRGB_SSE4_1(src, r, g, b);
+
+					const __m128i gray = Truncate_SSE4_1(
+						Dot_SSE4_1(r[0], g[0], b[0], 0.299, 0.587, 0.114),
+						Dot_SSE4_1(r[1], g[1], b[1], 0.299, 0.587, 0.114));
+
+					::_mm_storeu_si128(p, ::_mm_or_si128(::_mm_and_si128(src, alphaMask), ::_mm_mullo_epi32(gray, broadcast)));
+				}
+
+				Grayscale_Reference((pixels + i), (count - i));
+			}
+
+			void Sepia_SSE4_1(Color* pixels, const size_t count)
+			{
+				const __m128i alphaMask = ::_mm_set1_epi32(AlphaMask);
+				const __m128d c255 = ::_mm_set1_pd(255.0);
+				size_t i = 0;
+
+				for (; (i + 4) <= count; i += 4)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + i);
+					const __m128i src = ::_mm_loadu_si128(p);
+
+					__m128d r[2], g[2], b[2];
+					UnpackRGB_SSE4_1(src, r, g, b);
+
+					const __m128i tr = Truncate_SSE4_1(
+						::_mm_min_pd(Dot_SSE4_1(r[0], g[0], b[0], 0.393, 0.769, 0.189), c255),
+						::_mm_min_pd(Dot_SSE4_1(r[1], g[1], b[1], 0.393, 0.769, 0.189), c255));
+					const __m128i tg = Truncate_SSE4_1(
+						::_mm_min_pd(Dot_SSE4_1(r[0], g[0], b[0], 0.349, 0.686, 0.168), c255),
+						::_mm_min_pd(Dot_SSE4_1(r[1], g[1], b[1], 0.349, 0.686, 0.168), c255));
+					const __m128i tb = Truncate_SSE4_1(
+						::_mm_min_pd(Dot_SSE4_1(r[0], g[0], b[0], 0.272, 0.534, 0.131), c255),
+						::_mm_min_pd(Dot_SSE4_1(r[1], g[1], b[1], 0.272, 0.534, 0.131), c255));
+
+					const __m128i rgb = ::_mm_or_si128(::_mm_or_si128(tr, ::_mm_slli_epi32(tg, 8)), ::_mm_slli_epi32(tb, 16));
+					::_mm_storeu_si128(p, ::_mm_or_si128(::_mm_and_si128(src, alphaMask), rgb));
+				}
+
+				Sepia_Reference((pixels + i), (count - i));
+			}
+
+			void Brighten_SSE4_1(Color* pixels, const size_t count, const int32 level)
+			{
+				// アルファ成分には 0 を加減算するので値が変わらない
+				const __m128i offset = ::_mm_set1_epi32(BrightenOffset(level));
+				size_t i = 0;
+
+				if (level < 0)
+				{
+					for (; (i + 4) <= count; i += 4)
+					{
+						__m128i* p = reinterpret_cast<__m128i*>(pixels + i);
+						::_mm_storeu_si128(p, ::_mm_subs_epu8(::_mm_loadu_si128(p), offset));
+					}
+				}
+				else
+				{
+					for (; (i + 4) <= count; i += 4)
+					{
+						__m128i* p = reinterpret_cast<__m128i*>(pixels + i);
+						::_mm_storeu_si128(p, ::_mm_adds_epu8(::_mm_loadu_si128(p), offset));
+					}
+				}
+
+				Brighten_Reference((pixels + i), (count - i), level);
+			}
+
+			void Threshold_SSE4_1(Color* pixels, const size_t count, const double thresholdF, const bool invertColor)
+			{
+				const __m128i alphaMask = ::_mm_set1_epi32(AlphaMask);
+				const __m128i rgbMask = ::_mm_set1_epi32(RGBMask);
+				const __m128d threshold = ::_mm_set1_pd(thresholdF);
+				size_t i = 0;
+
+				for (; (i + 4) <= count; i += 4)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + i);
+					const __m128i src = ::_mm_loadu_si128(p);
+
+					__m128d r[2], g[2], b[2];
+					UnpackRGB_SSE4_1(src, r, g, b);
+
+					const __m128d lo = ::_mm_cmpgt_pd(Dot_SSE4_1(r[0], g[0], b[0], (0.299 / 255.0), (0.587 / 255.0), (0.114 / 255.0)), threshold);
+					const __m128d hi = ::_mm_cmpgt_pd(Dot_SSE4_1(r[1], g[1], b[1], (0.299 / 255.0), (0.587 / 255.0), (0.114 / 255.0)), threshold);
+
+					// 64-bit のマスク 2 + 2 個を 32-bit のマスク 4 個に詰める
+					const __m128i mask = ::_mm_castps_si128(_mm_shuffle_ps(::_mm_castpd_ps(lo), ::_mm_castpd_ps(hi), _MM_SHUFFLE(2, 0, 2, 0)));
+					const __m128i rgb = (invertColor ? ::_mm_andnot_si128(mask, rgbMask) : ::_mm_and_si128(mask, rgbMask));
+
+					::_mm_storeu_si128(p, ::_mm_or_si128(::_mm_and_si128(src, alphaMask), rgb));
+				}
+
+				Threshold_Reference((pixels + i), (count - i), thresholdF, invertColor);
+			}
+
+			void RGBAtoBGRA_SSE4_1(Color* pixels, const size_t count)
+			{
+				const __m128i shuffle = ::_mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+				size_t i = 0;
+
+				for (; (i + 4) <= count; i += 4)
+				{
+					__m128i* p = reinterpret_cast<__m128i*>(pixels + i);
+					::_mm_storeu_si128(p, ::_mm_shuffle_epi8(::_mm_loadu_si128(p), shuffle));
+				}
+
+				RGBAtoBGRA_Reference((pixels + i), (count - i));
+			}
+
+			//////////////////////////////////////////////////
+			//
+			//	AVX2
+			//
+			//////////////////////////////////////////////////
+
+		# if SIV3D_PRIVATE_IMAGE_POINT_AVX2()
+
+			SIV3D_PRIVATE_TARGET_AVX2
+			inline void UnpackRGB_AVX2(const __m256i pixels, __m256d (&r)[2], __m256d (&g)[2], __m256d (&b)[2])
+			{
+				const __m256i mask = ::_mm256_set1_epi32(0xFF);
+				const __m256i ri = ::_mm256_and_si256(pixels, mask);
+				const __m256i gi = ::_mm256_and_si256(::_mm256_srli_epi32(pixels, 8), mask);
+				const __m256i bi = ::_mm256_and_si256(::_mm256_srli_epi32(pixels, 16), mask);
+
+				r[0] = ::_mm256_cvtepi32_pd(::_mm256_castsi256_si128(ri));
+				r[1] = ::_mm256_cvtepi32_pd(_mm256_extracti128_si256(ri, 1));
+				g[0] = ::_mm256_cvtepi32_pd(::_mm256_castsi256_si128(gi));
+				g[1] = ::_mm256_cvtepi32_pd(_mm256_extracti128_si256(gi, 1));
+				b[0] = ::_mm256_cvtepi32_pd(::_mm256_castsi256_si128(bi));
+				b[1] = ::_mm256_cvtepi32_pd(_mm256_extracti128_si256(bi, 1));
+			}
+
+			[[nodiscard]]
+			SIV3D_PRIVATE_TARGET_AVX2
+			inline __m256d Dot_AVX2(const __m256d r, const __m256d g, const __m256d b, const double kr, const double kg, const double kb)
+			{
+				return ::_mm256_add_pd(::_mm256_add_pd(::_mm256_mul_pd(::_mm256_set1_pd(kr), r), ::_mm256_mul_pd(::_mm256_set1_pd(kg), g)), ::_mm256_mul_pd(::_mm256_set1_pd(kb), b));
+			}
+
+			[[nodiscard]]
+			SIV3D_PRIVATE_TARGET_AVX2
+			inline __m256i Truncate_AVX2(const __m256d lo, const __m256d hi)
+			{
+				return _mm256_inserti128_si256(::_mm256_castsi128_si256(::_mm256_cvttpd_epi32(lo)), ::_mm256_cvttpd_epi32(hi), 1);
+			}
+
+			SIV3D_PRIVATE_TARGET_AVX2
+			void Negate_AVX2(Color* pixels, const size_t count)
+			{
+				const __m256i rgbMask = ::_mm256_set1_epi32(RGBMask);
+				size_t i = 0;
+
+				for (; (i + 8) <= count; i += 8)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + i);
+					::_mm256_storeu_si256(p, ::_mm256_xor_si256(::_mm256_loadu_si256(p), rgbMask));
+				}
+
+				Negate_Reference((pixels + i), (count - i));
+			}
+
+			SIV3D_PRIVATE_TARGET_AVX2
+			void Grayscale_AVX2(Color* pixels, const size_t count)
+			{
+				const __m256i alphaMask = ::_mm256_set1_epi32(AlphaMask);
+				const __m256i broadcast = ::_mm256_set1_epi32(0x010101);
+				size_t i = 0;
+
+				for (; (i + 8) <= count; i += 8)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + i);
+					const __m256i src = ::_mm256_loadu_si256(p);
+
+					__m256d r[2], g[2], b[2];
+					UnpackRGB_AVX2(src, r, g, b);
+
+					const __m256i gray = Truncate_AVX2(
+						Dot_AVX2(r[0], g[0], b[0], 0.299, 0.587, 0.114),
+						Dot_AVX2(r[1], g[1], b[1], 0.299, 0.587, 0.114));
+
+					::_mm256_storeu_si256(p, ::_mm256_or_si256(::_mm256_and_si256(src, alphaMask), ::_mm256_mullo_epi32(gray, broadcast)));
+				}
+
+				Grayscale_Reference((pixels + i), (count - i));
+			}
+
+			SIV3D_PRIVATE_TARGET_AVX2
+			void Sepia_AVX2(Color* pixels, const size_t count)
+			{
+				const __m256i alphaMask = ::_mm256_set1_epi32(AlphaMask);
+				const __m256d c255 = ::_mm256_set1_pd(255.0);
+				size_t i = 0;
+
+				for (; (i + 8) <= count; i += 8)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + i);
+					const __m256i src = ::_mm256_loadu_si256(p);
+
+					__m256d r[2], g[2], b[2];
+					UnpackRGB_AVX2(src, r, g, b);
+
+					const __m256i tr = Truncate_AVX2(
+						::_mm256_min_pd(Dot_AVX2(r[0], g[0], b[0], 0.393, 0.769, 0.189), c255),
+						::_mm256_min_pd(Dot_AVX2(r[1], g[1], b[1], 0.393, 0.769, 0.189), c255));
+					const __m256i tg = Truncate_AVX2(
+						::_mm256_min_pd(Dot_AVX2(r[0], g[0], b[0], 0.349, 0.686, 0.168), c255),
+						::_mm256_min_pd(Dot_AVX2(r[1], g[1], b[1], 0.349, 0.686, 0.168), c255));
+					const __m256i tb = Truncate_AVX2(
+						::_mm256_min_pd(Dot_AVX2(r[0], g[0], b[0], 0.272, 0.534, 0.131), c255),
+						::_mm256_min_pd(Dot_AVX2(r[1], g[1], b[1], 0.272, 0.534, 0.131), c255));
+
+					const __m256i rgb = ::_mm256_or_si256(::_mm256_or_si256(tr, ::_mm256_slli_epi32(tg, 8)), ::_mm256_slli_epi32(tb, 16));
+					::_mm256_storeu_si256(p, ::_mm256_or_si256(::_mm256_and_si256(src, alphaMask), rgb));
+				}
+
+				Sepia_Reference((pixels + i), (count - i));
+			}
+
+			SIV3D_PRIVATE_TARGET_AVX2
+			void Brighten_AVX2(Color* pixels, const size_t count, const int32 level)
+			{
+				const __m256i offset = ::_mm256_set1_epi32(BrightenOffset(level));
+				size_t i = 0;
+
+				if (level < 0)
+				{
+					for (; (i + 8) <= count; i += 8)
+					{
+						__m256i* p = reinterpret_cast<__m256i*>(pixels + i);
+						::_mm256_storeu_si256(p, ::_mm256_subs_epu8(::_mm256_loadu_si256(p), offset));
+					}
+				}
+				else
+				{
+					for (; (i + 8) <= count; i += 8)
+					{
+						__m256i* p = reinterpret_cast<__m256i*>(pixels + i);
+						::_mm256_storeu_si256(p, ::_mm256_adds_epu8(::_mm256_loadu_si256(p), offset));
+					}
+				}
+
+				Brighten_Reference((pixels + i), (count - i), level);
+			}
+
+			SIV3D_PRIVATE_TARGET_AVX2
+			void Threshold_AVX2(Color* pixels, const size_t count, const double thresholdF, const bool invertColor)
+			{
+				const __m256i alphaMask = ::_mm256_set1_epi32(AlphaMask);
+				const __m256i rgbMask = ::_mm256_set1_epi32(RGBMask);
+				const __m256i packMask = ::_mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+				const __m256d threshold = ::_mm256_set1_pd(thresholdF);
+				size_t i = 0;
+
+				for (; (i + 8) <= count; i += 8)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + i);
+					const __m256i src = ::_mm256_loadu_si256(p);
+
+					__m256d r[2], g[2], b[2];
+					UnpackRGB_AVX2(src, r, g, b);
+
+					const __m256d lo = _mm256_cmp_pd(Dot_AVX2(r[0], g[0], b[0], (0.299 / 255.0), (0.587 / 255.0), (0.114 / 255.0)), threshold, _CMP_GT_OQ);
+					const __m256d hi = _mm256_cmp_pd(Dot_AVX2(r[1], g[1], b[1], (0.299 / 255.0), (0.587 / 255.0), (0.114 / 255.0)), threshold, _CMP_GT_OQ);
+
+					// 64-bit のマスク 4 + 4 個を 32-bit のマスク 8 個に詰める
+					const __m128i maskLo = ::_mm256_castsi256_si128(::_mm256_permutevar8x32_epi32(::_mm256_castpd_si256(lo), packMask));
+					const __m128i maskHi = ::_mm256_castsi256_si128(::_mm256_permutevar8x32_epi32(::_mm256_castpd_si256(hi), packMask));
+					const __m256i mask = _mm256_inserti128_si256(::_mm256_castsi128_si256(maskLo), maskHi, 1);
+					const __m256i rgb = (invertColor ? ::_mm256_andnot_si256(mask, rgbMask) : ::_mm256_and_si256(mask, rgbMask));
+
+					::_mm256_storeu_si256(p, ::_mm256_or_si256(::_mm256_and_si256(src, alphaMask), rgb));
+				}
+
+				Threshold_Reference((pixels + i), (count - i), thresholdF, invertColor);
+			}
+
+			SIV3D_PRIVATE_TARGET_AVX2
+			void RGBAtoBGRA_AVX2(Color* pixels, const size_t count)
+			{
+				const __m256i shuffle = ::_mm256_setr_epi8(
+					2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+					2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+				size_t i = 0;
+
+				for (; (i + 8) <= count; i += 8)
+				{
+					__m256i* p = reinterpret_cast<__m256i*>(pixels + i);
+					::_mm256_storeu_si256(p, ::_mm256_shuffle_epi8(::_mm256_loadu_si256(p), shuffle));
+				}
+
+				RGBAtoBGRA_Reference((pixels + i), (count - i));
+			}
+
+			# define SIV3D_PRIVATE_SELECT_KERNEL(NAME) SelectKernel(NAME##_Reference, NAME##_SSE4_1, NAME##_AVX2)
+
+		# else
+
+			# define SIV3D_PRIVATE_SELECT_KERNEL(NAME) SelectKernel(NAME##_Reference, NAME##_SSE4_1, NAME##_SSE4_1)
+
+		# endif
+		}
+
+		void Negate(Image& image)
+		{
+			ForEachRows(image, SIV3D_PRIVATE_SELECT_KERNEL(Negate));
+		}
+
+		void Grayscale(Image& image)
+		{
+			ForEachRows(image, SIV3D_PRIVATE_SELECT_KERNEL(Grayscale));
+		}
+
+		void Sepia(Image& image)
+		{
+			ForEachRows(image, SIV3D_PRIVATE_SELECT_KERNEL(Sepia));
+		}
+
+		void Posterize(Image& image, const int32 level)
+		{
+			// テーブル参照は SIMD 化しても速くならないので、行単位の並列化だけを行う
+			uint8 colorTable[256];
+			InitPosterizeTable(level, colorTable);
+
+			const uint8* table = colorTable;
+			ForEachRows(image, [=](Color* pixels, const size_t count) { Table_Reference(pixels, count, table); });
+		}
+
+		void Brighten(Image& image, const int32 level)
+		{
+			if (level == 0)
+			{
+				return;
+			}
+
+			const auto kernel = SIV3D_PRIVATE_SELECT_KERNEL(Brighten);
+			ForEachRows(image, [=](Color* pixels, const size_t count) { kernel(pixels, count, level); });
+		}
+
+		void GammaCorrect(Image& image, const double gamma)
+		{
+			uint8 colorTable[256];
+			InitGammmaTable(gamma, colorTable);
+
+			const uint8* table = colorTable;
+			ForEachRows(image, [=](Color* pixels, const size_t count) { Table_Reference(pixels, count, table); });
+		}
+
+		void Threshold(Image& image, const uint8 threshold, const InvertColor invertColor)
+		{
+			const double thresholdF = (threshold / 255.0);
+			const bool invert = invertColor.getBool();
+			const auto kernel = SIV3D_PRIVATE_SELECT_KERNEL(Threshold);
+			ForEachRows(image, [=](Color* pixels, const size_t count) { kernel(pixels, count, thresholdF, invert); });
+		}
+
+		void RGBAtoBGRA(Image& image)
+		{
+			ForEachRows(image, SIV3D_PRIVATE_SELECT_KERNEL(RGBAtoBGRA));
+		}
+	}
+}
+
+# undef SIV3D_PRIVATE_SELECT_KERNEL
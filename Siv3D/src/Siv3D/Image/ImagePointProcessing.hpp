@@ -0,0 +1,38 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Image.hpp>
+
+namespace s3d
+{
+	// 各ピクセルを独立に変換する画像処理（点処理）
+	// SIMD 命令で処理し、大きな画像は行単位でスレッドプールに分割する。
+	// 結果はスカラー版の実装とビット単位で一致する。
+	namespace ImagePointProcessing
+	{
+		void Negate(Image& image);
+
+		void Grayscale(Image& image);
+
+		void Sepia(Image& image);
+
+		void Posterize(Image& image, int32 level);
+
+		void Brighten(Image& image, int32 level);
+
+		void GammaCorrect(Image& image, double gamma);
+
+		void Threshold(Image& image, uint8 threshold, InvertColor invertColor);
+
+		void RGBAtoBGRA(Image& image);
+	}
+}
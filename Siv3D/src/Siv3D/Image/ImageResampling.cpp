@@ -0,0 +1,530 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cmath>
+# include <Siv3D/Mat3x3.hpp>
+# include <Siv3D/MathConstants.hpp>
+# include <Siv3D/Threading.hpp>
+# include "ImageResampling.hpp"
+
+namespace s3d
+{
+	namespace ImageResampling
+	{
+		namespace
+		{
+			// 拡大縮小のタイルの最大の幅と高さ（ピクセル）
+			constexpr int32 TileSize = 256;
+
+			// 大きく縮小するときも、タイルの高さはこれより小さくしない
+			constexpr int32 MinTileHeight = 16;
+
+			// 変形処理で 1 タスクあたりに処理する最小ピクセル数
+			constexpr int32 MinPixelsPerTask = (1 << 16);
+
+			/// @brief 書き込み先の 1 ピクセルに寄与する、元画像の連続したピクセルとその重み（1 軸分）
+			struct AxisWeights
+			{
+				Array<int32> first;
+
+				Array<int32> count;
+
+				/// @brief 書き込み先のピクセルごとに stride 個ずつ並べた重み
+				Array<float> weights;
+
+				size_t stride = 0;
+			};
+
+			[[nodiscard]]
+			double Triangle(double x) noexcept
+			{
+				x = std::abs(x);
+				return ((x < 1.0) ? (1.0 - x) : 0.0);
+			}
+
+			// OpenCV の INTER_CUBIC と同じ a = -0.75 のキュービック補間
+			[[nodiscard]]
+			double Cubic(double x) noexcept
+			{
+				constexpr double a = -0.75;
+				x = std::abs(x);
+
+				if (x < 1.0)
+				{
+					return (((a + 2.0) * x - (a + 3.0)) * x * x + 1.0);
+				}
+				else if (x < 2.0)
+				{
+					return (((a * x - 5.0 * a) * x + 8.0 * a) * x - 4.0 * a);
+				}
+
+				return 0.0;
+			}
+
+			// OpenCV の INTER_LANCZOS4 と同じ 8 タップの Lanczos 補間
+			[[nodiscard]]
+			double Lanczos4(const double x) noexcept
+			{
+				if (x == 0.0)
+				{
+					return 1.0;
+				}
+
+				if (4.0 <= std::abs(x))
+				{
+					return 0.0;
+				}
+
+				const double px = (Math::Pi * x);
+				return (4.0 * std::sin(px) * std::sin(px / 4.0) / (px * px));
+			}
+
+			[[nodiscard]]
+			double GetFilterRadius(const InterpolationAlgorithm interpolation) noexcept
+			{
+				switch (interpolation)
+				{
+				case InterpolationAlgorithm::Linear:
+					return 1.0;
+				case InterpolationAlgorithm::Cubic:
+					return 2.0;
+				case InterpolationAlgorithm::Lanczos:
+					return 4.0;
+				default:
+					return 0.5;
+				}
+			}
+
+			[[nodiscard]]
+			double GetFilterWeight(const InterpolationAlgorithm interpolation, const double x) noexcept
+			{
+				switch (interpolation)
+				{
+				case InterpolationAlgorithm::Linear:
+					return Triangle(x);
+				case InterpolationAlgorithm::Cubic:
+					return Cubic(x);
+				case InterpolationAlgorithm::Lanczos:
+					return Lanczos4(x);
+				default:
+					return 0.0;
+				}
+			}
+
+			[[nodiscard]]
+			AxisWeights MakeAxisWeights(const int32 srcSize, const int32 dstSize, const InterpolationAlgorithm interpolation)
+			{
+				const double scale = (static_cast<double>(srcSize) / dstSize);
+
+				AxisWeights result;
+				result.first.resize(dstSize);
+				result.count.resize(dstSize);
+
+				if (interpolation == InterpolationAlgorithm::Nearest)
+				{
+					result.stride = 1;
+					result.weights.assign(dstSize, 1.0f);
+
+					for (int32 i = 0; i < dstSize; ++i)
+					{
+						result.first[i] = Min(static_cast<int32>(i * scale), (srcSize - 1));
+						result.count[i] = 1;
+					}
+
+					return result;
+				}
+
+				// 縮小するときは、フィルタを広げて間引かれるピクセルも平均する
+				const double filterScale = Max(scale, 1.0);
+				const double support = (GetFilterRadius(interpolation) * filterScale);
+
+				result.stride = (static_cast<size_t>(std::ceil(support)) * 2 + 1);
+				result.weights.resize((dstSize * result.stride), 0.0f);
+
+				Array<double> weights(result.stride);
+
+				for (int32 i = 0; i < dstSize; ++i)
+				{
+					const double center = ((i + 0.5) * scale);
+					int32 begin = Max(static_cast<int32>(std::floor(center - support)), 0);
+					int32 end = Min(static_cast<int32>(std::ceil(center + support)), srcSize);
+					double sum = 0.0;
+
+					for (int32 k = begin; k < end; ++k)
+					{
+						double w;
+
+						if (interpolation == InterpolationAlgorithm::Area)
+						{
+							// 書き込み先のピクセルが覆う範囲と、元画像のピクセルが重なる長さ
+							const double lo = (center - filterScale * 0.5);
+							const double hi = (center + filterScale * 0.5);
+							w = Max((Min((k + 1.0), hi) - Max(static_cast<double>(k), lo)), 0.0);
+						}
+						else
+						{
+							w = GetFilterWeight(interpolation, ((k + 0.5 - center) / filterScale));
+						}
+
+						weights[k - begin] = w;
+						sum += w;
+					}
+
+					// 重みが 0 の両端を除く
+					size_t lead = 0;
+
+					while (((begin + 1) < end) && (weights[lead] == 0.0))
+					{
+						++lead;
+						++begin;
+					}
+
+					while (((begin + 1) < end) && (weights[lead + (end - begin) - 1] == 0.0))
+					{
+						--end;
+					}
+
+					if (sum == 0.0)
+					{
+						begin = Clamp(static_cast<int32>(center), 0, (srcSize - 1));
+						end = (begin + 1);
+						lead = 0;
+						weights[0] = sum = 1.0;
+					}
+
+					result.first[i] = begin;
+					result.count[i] = (end - begin);
+
+					float* pWeights = (result.weights.data() + i * result.stride);
+
+					for (int32 k = 0; k < (end - begin); ++k)
+					{
+						pWeights[k] = static_cast<float>(weights[lead + k] / sum);
+					}
+				}
+
+				return result;
+			}
+
+			[[nodiscard]]
+			inline uint8 ToUint8(const float value) noexcept
+			{
+				return static_cast<uint8>(Clamp((value + 0.5f), 0.0f, 255.0f));
+			}
+
+			[[nodiscard]]
+			inline Color ToColor(const Float4& value) noexcept
+			{
+				return{ ToUint8(value.x), ToUint8(value.y), ToUint8(value.z), ToUint8(value.w) };
+			}
+
+			[[nodiscard]]
+			inline Float4 ToFloat4(const Color& color) noexcept
+			{
+				return{ color.r, color.g, color.b, color.a };
+			}
+
+			struct ScaleContext
+			{
+				const Image& src;
+
+				Image& dst;
+
+				const Rect& region;
+
+				const AxisWeights& horizontal;
+
+				const AxisWeights& vertical;
+
+				int32 tileWidth;
+
+				int32 tileHeight;
+
+				int32 tilesX;
+			};
+
+			/// @brief 書き込み先の 1 タイルを、横方向と縦方向の 2 回の畳み込みで埋めます。
+			/// @param buffer 横方向に畳み込んだ結果を格納する作業領域
+			/// @param accumulator 縦方向の畳み込みの 1 行分の作業領域
+			void ScaleTile(const ScaleContext& context, const size_t tileIndex, Array<Float4>& buffer, Array<Float4>& accumulator)
+			{
+				const AxisWeights& horizontal = context.horizontal;
+				const AxisWeights& vertical = context.vertical;
+
+				const int32 x0 = (static_cast<int32>(tileIndex % context.tilesX) * context.tileWidth);
+				const int32 y0 = (static_cast<int32>(tileIndex / context.tilesX) * context.tileHeight);
+				const int32 x1 = Min((x0 + context.tileWidth), context.region.w);
+				const int32 y1 = Min((y0 + context.tileHeight), context.region.h);
+				const int32 width = (x1 - x0);
+
+				int32 rowBegin = vertical.first[y0];
+				int32 rowEnd = rowBegin;
+
+				for (int32 y = y0; y < y1; ++y)
+				{
+					rowBegin = Min(rowBegin, vertical.first[y]);
+					rowEnd = Max(rowEnd, (vertical.first[y] + vertical.count[y]));
+				}
+
+				// 1. 必要な元画像の行だけを、横方向に畳み込む
+				{
+					buffer.resize((rowEnd - rowBegin) * width);
+
+					const int32 srcWidth = context.src.width();
+
+					for (int32 sy = rowBegin; sy < rowEnd; ++sy)
+					{
+						const Color* pSrcLine = (context.src.data() + sy * srcWidth);
+						Float4* pOut = (buffer.data() + (sy - rowBegin) * width);
+
+						for (int32 x = x0; x < x1; ++x)
+						{
+							const Color* pSrc = (pSrcLine + horizontal.first[x]);
+							const float* pWeights = (horizontal.weights.data() + x * horizontal.stride);
+							const int32 count = horizontal.count[x];
+							float r = 0.0f, g = 0.0f, b = 0.0f, a = 0.0f;
+
+							for (int32 k = 0; k < count; ++k)
+							{
+								const float w = pWeights[k];
+								r += (w * pSrc[k].r);
+								g += (w * pSrc[k].g);
+								b += (w * pSrc[k].b);
+								a += (w * pSrc[k].a);
+							}
+
+							*pOut++ = Float4{ r, g, b, a };
+						}
+					}
+				}
+
+				// 2. 縦方向に畳み込んで、書き込み先に出力する
+				{
+					accumulator.resize(width);
+
+					const int32 dstWidth = context.dst.width();
+
+					for (int32 y = y0; y < y1; ++y)
+					{
+						const float* pWeights = (vertical.weights.data() + y * vertical.stride);
+						const int32 first = (vertical.first[y] - rowBegin);
+						const int32 count = vertical.count[y];
+
+						std::fill(accumulator.begin(), accumulator.end(), Float4{ 0, 0, 0, 0 });
+
+						for (int32 k = 0; k < count; ++k)
+						{
+							const float w = pWeights[k];
+							const Float4* pRow = (buffer.data() + (first + k) * width);
+
+							for (int32 x = 0; x < width; ++x)
+							{
+								accumulator[x] += (pRow[x] * w);
+							}
+						}
+
+						Color* pDst = (context.dst.data() + (context.region.y + y) * dstWidth + (context.region.x + x0));
+
+						for (int32 x = 0; x < width; ++x)
+						{
+							pDst[x] = ToColor(accumulator[x]);
+						}
+					}
+				}
+			}
+
+			/// @brief 書き込み先の座標から元画像の座標への変換（行ベクトル形式の 3x3 行列）
+			struct InverseTransform
+			{
+				double m[3][3];
+			};
+
+			[[nodiscard]]
+			InverseTransform Inverse(const double (&m)[3][3]) noexcept
+			{
+				const double c00 = (m[1][1] * m[2][2] - m[1][2] * m[2][1]);
+				const double c01 = (m[1][2] * m[2][0] - m[1][0] * m[2][2]);
+				const double c02 = (m[1][0] * m[2][1] - m[1][1] * m[2][0]);
+				const double det = (m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02);
+				const double invDet = ((det == 0.0) ? 0.0 : (1.0 / det));
+
+				InverseTransform result;
+				result.m[0][0] = (c00 * invDet);
+				result.m[0][1] = ((m[0][2] * m[2][1] - m[0][1] * m[2][2]) * invDet);
+				result.m[0][2] = ((m[0][1] * m[1][2] - m[0][2] * m[1][1]) * invDet);
+				result.m[1][0] = (c01 * invDet);
+				result.m[1][1] = ((m[0][0] * m[2][2] - m[0][2] * m[2][0]) * invDet);
+				result.m[1][2] = ((m[0][2] * m[1][0] - m[0][0] * m[1][2]) * invDet);
+				result.m[2][0] = (c02 * invDet);
+				result.m[2][1] = ((m[0][1] * m[2][0] - m[0][0] * m[2][1]) * invDet);
+				result.m[2][2] = ((m[0][0] * m[1][1] - m[0][1] * m[1][0]) * invDet);
+				return result;
+			}
+
+			/// @brief 元画像をバイリニア補間で読み取ります。範囲外のピクセルは背景色として扱います。
+			[[nodiscard]]
+			inline Color SampleBilinear(const Image& src, const double x, const double y, const Float4& background, const Color& backgroundColor) noexcept
+			{
+				const int32 width = src.width();
+				const int32 height = src.height();
+
+				// NaN の場合もここで背景色になる
+				if (not ((-1.0 < x) && (x < width) && (-1.0 < y) && (y < height)))
+				{
+					return backgroundColor;
+				}
+
+				const int32 ix = static_cast<int32>(std::floor(x));
+				const int32 iy = static_cast<int32>(std::floor(y));
+				const float fx = static_cast<float>(x - ix);
+				const float fy = static_cast<float>(y - iy);
+				const Color* pSrc = src.data();
+
+				const auto fetch = [&](const int32 px, const int32 py)
+				{
+					if ((0 <= px) && (px < width) && (0 <= py) && (py < height))
+					{
+						return ToFloat4(pSrc[py * width + px]);
+					}
+
+					return background;
+				};
+
+				const Float4 top = fetch(ix, iy).lerp(fetch((ix + 1), iy), fx);
+				const Float4 bottom = fetch(ix, (iy + 1)).lerp(fetch((ix + 1), (iy + 1)), fx);
+				return ToColor(top.lerp(bottom, fy));
+			}
+
+			template <bool Perspective>
+			void Warp(const Image& src, Image& dst, const Rect& region, const InverseTransform& transform, const Color& background)
+			{
+				if (src.isEmpty() || region.isEmpty())
+				{
+					return;
+				}
+
+				const Float4 backgroundF = ToFloat4(background);
+				const int32 dstWidth = dst.width();
+				const size_t rowsPerTask = Max((MinPixelsPerTask / region.w), 1);
+				const auto& m = transform.m;
+
+				Threading::detail::ParallelForRange(0, region.h, rowsPerTask, [&](const size_t beginRow, const size_t endRow)
+				{
+					for (size_t row = beginRow; row < endRow; ++row)
+					{
+						const double y = static_cast<double>(row);
+						Color* pDst = (dst.data() + (region.y + static_cast<int32>(row)) * dstWidth + region.x);
+
+						for (int32 x = 0; x < region.w; ++x)
+						{
+							double sx = (m[0][0] * x + m[1][0] * y + m[2][0]);
+							double sy = (m[0][1] * x + m[1][1] * y + m[2][1]);
+
+							if constexpr (Perspective)
+							{
+								const double s = (m[0][2] * x + m[1][2] * y + m[2][2]);
+
+								if (s == 0.0)
+								{
+									pDst[x] = background;
+									continue;
+								}
+
+								sx /= s;
+								sy /= s;
+							}
+
+							pDst[x] = SampleBilinear(src, sx, sy, backgroundF, background);
+						}
+					}
+				});
+			}
+		}
+
+		InterpolationAlgorithm ResolveInterpolation(const Size& srcSize, const Size& dstSize, const InterpolationAlgorithm interpolation) noexcept
+		{
+			if (interpolation != InterpolationAlgorithm::Auto)
+			{
+				return interpolation;
+			}
+
+			if ((srcSize.x <= dstSize.x) && (srcSize.y <= dstSize.y))
+			{
+				return InterpolationAlgorithm::Lanczos;
+			}
+			else if ((dstSize.x <= srcSize.x / 2) || (dstSize.y <= srcSize.y / 2))
+			{
+				return InterpolationAlgorithm::Area;
+			}
+			else
+			{
+				return InterpolationAlgorithm::Lanczos;
+			}
+		}
+
+		void Scale(const Image& src, Image& dst, const Rect& region, InterpolationAlgorithm interpolation)
+		{
+			if (src.isEmpty() || region.isEmpty())
+			{
+				return;
+			}
+
+			interpolation = ResolveInterpolation(src.size(), region.size, interpolation);
+
+			const AxisWeights horizontal = MakeAxisWeights(src.width(), region.w, interpolation);
+			const AxisWeights vertical = MakeAxisWeights(src.height(), region.h, interpolation);
+
+			// 大きく縮小するときはタイルの高さを抑えて、タイルごとの作業領域の大きさを一定に保つ
+			const double verticalScale = Max((static_cast<double>(src.height()) / region.h), 1.0);
+			const int32 tileWidth = Min(TileSize, region.w);
+			const int32 tileHeight = Min(Clamp(static_cast<int32>(TileSize / verticalScale), MinTileHeight, TileSize), region.h);
+			const int32 tilesX = ((region.w + tileWidth - 1) / tileWidth);
+			const int32 tilesY = ((region.h + tileHeight - 1) / tileHeight);
+			const size_t numTiles = (static_cast<size_t>(tilesX) * tilesY);
+			const size_t grainSize = Max<size_t>((numTiles / (Threading::GetConcurrency() * 4)), 1);
+
+			const ScaleContext context{ src, dst, region, horizontal, vertical, tileWidth, tileHeight, tilesX };
+
+			Threading::detail::ParallelForRange(0, numTiles, grainSize, [&context](const size_t begin, const size_t end)
+			{
+				Array<Float4> buffer, accumulator;
+
+				for (size_t tileIndex = begin; tileIndex < end; ++tileIndex)
+				{
+					ScaleTile(context, tileIndex, buffer, accumulator);
+				}
+			});
+		}
+
+		void WarpAffine(const Image& src, Image& dst, const Rect& region, const Mat3x2& mat, const Color& background)
+		{
+			const double m[3][3] = {
+				{ mat._11, mat._12, 0.0 },
+				{ mat._21, mat._22, 0.0 },
+				{ mat._31, mat._32, 1.0 },
+			};
+
+			Warp<false>(src, dst, region, Inverse(m), background);
+		}
+
+		void WarpPerspective(const Image& src, Image& dst, const Rect& region, const Quad& quad, const Color& background)
+		{
+			const Mat3x3 mat = Mat3x3::Homography(RectF{ 0, 0, src.width(), src.height() }, quad);
+			const double m[3][3] = {
+				{ mat._11, mat._12, mat._13 },
+				{ mat._21, mat._22, mat._23 },
+				{ mat._31, mat._32, mat._33 },
+			};
+
+			Warp<true>(src, dst, region, Inverse(m), background);
+		}
+	}
+}
@@ -0,0 +1,38 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Image.hpp>
+# include <Siv3D/2DShapes.hpp>
+# include <Siv3D/Mat3x2.hpp>
+
+namespace s3d
+{
+	// 一時的な画像を作らずに、書き込み先の画像の領域を直接タイル単位で埋める再標本化処理
+	// タイルはスレッドプールで並列に処理する。src と dst は別の画像でなければならない。
+	namespace ImageResampling
+	{
+		/// @brief InterpolationAlgorithm::Auto を、拡大縮小の倍率に応じた補間アルゴリズムに置き換えます。
+		[[nodiscard]]
+		InterpolationAlgorithm ResolveInterpolation(const Size& srcSize, const Size& dstSize, InterpolationAlgorithm interpolation) noexcept;
+
+		/// @brief src 全体を拡大縮小して、dst の region に書き込みます。
+		void Scale(const Image& src, Image& dst, const Rect& region, InterpolationAlgorithm interpolation);
+
+		/// @brief src をアフィン変換して、dst の region に書き込みます。
+		/// @param mat src の座標から region 内の座標への変換
+		void WarpAffine(const Image& src, Image& dst, const Rect& region, const Mat3x2& mat, const Color& background);
+
+		/// @brief src の四隅を quad に合わせる射影変換をして、dst の region に書き込みます。
+		/// @param quad region 内の座標で表した、src の四隅の移動先
+		void WarpPerspective(const Image& src, Image& dst, const Rect& region, const Quad& quad, const Color& background);
+	}
+}
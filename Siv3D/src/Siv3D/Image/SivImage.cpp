@@ -28,6 +28,8 @@
 # include <Siv3D/ImageFormat/WebPEncoder.hpp>
 # include <Siv3D/OpenCV_Bridge.hpp>
 # include "ImagePainting.hpp"
+# include "ImagePointProcessing.hpp"
+# include "ImageResampling.hpp"
 
 namespace s3d
 {
@@ -56,39 +58,6 @@ namespace s3d
 			return (px * py * (c1 - c2 - c3 + c4) + px * (c2 - c1) + py * (c3 - c1) + c1);
 		}
 
-		[[nodiscard]]
-		static Color MakeSepia(Color color) noexcept
-		{
-			const double tr = Min(((0.393 * color.r) + (0.769 * color.g) + (0.189 * color.b)), 255.0);
-			const double tg = Min(((0.349 * color.r) + (0.686 * color.g) + (0.168 * color.b)), 255.0);
-			const double tb = Min(((0.272 * color.r) + (0.534 * color.g) + (0.131 * color.b)), 255.0);
-
-			color.r = static_cast<uint8>(tr);
-			color.g = static_cast<uint8>(tg);
-			color.b = static_cast<uint8>(tb);
-			return color;
-		}
-
-		static void InitPosterizeTable(const int32 level, uint8 table[256]) noexcept
-		{
-			const int32 levN = Clamp(level, 2, 256) - 1;
-
-			for (size_t i = 0; i < 256; ++i)
-			{
-				table[i] = static_cast<uint8>(std::floor(i / 255.0 * levN + 0.5) / levN * 255);
-			}
-		}
-
-		static void InitGammmaTable(const double gamma, uint8 table[256])
-		{
-			const double gammaInv = (1.0 / gamma);
-
-			for (size_t i = 0; i < 256; ++i)
-			{
-				table[i] = static_cast<uint8>(std::pow(i / 255.0, gammaInv) * 255.0);
-			}
-		}
-
 		static Color GetAverage(const Image& src, const Rect& rect)
 		{
 			const int32 count = rect.area();
@@ -812,16 +781,7 @@ namespace s3d
 
 	Image& Image::RGBAtoBGRA()
 	{
-		Color* p = m_data.data();
-		const Color* pEnd = (p + num_pixels());
-
-		while (p != pEnd)
-		{
-			const uint8 t = p->r;
-			p->r = p->b;
-			p->b = t;
-			++p;
-		}
+		ImagePointProcessing::RGBAtoBGRA(*this);
 
 		return *this;
 	}
@@ -946,10 +906,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel = ~pixel;
-			}
+			ImagePointProcessing::Negate(*this);
 		}
 
 		return *this;
@@ -969,10 +926,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				pixel = ~pixel;
-			}
+			ImagePointProcessing::Negate(image);
 
 			return image;
 		}
@@ -995,13 +949,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				const uint8 gray = pixel.grayscale0_255();
-				pixel.r = gray;
-				pixel.g = gray;
-				pixel.b = gray;
-			}
+			ImagePointProcessing::Grayscale(*this);
 		}
 
 		return *this;
@@ -1021,13 +969,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				const uint8 gray = pixel.grayscale0_255();
-				pixel.r = gray;
-				pixel.g = gray;
-				pixel.b = gray;
-			}
+			ImagePointProcessing::Grayscale(image);
 
 			return image;
 		}
@@ -1050,10 +992,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			for (auto& pixel : m_data)
-			{
-				pixel = detail::MakeSepia(pixel);
-			}
+			ImagePointProcessing::Sepia(*this);
 		}
 
 		return *this;
@@ -1073,10 +1012,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			for (auto& pixel : image)
-			{
-				pixel = detail::MakeSepia(pixel);
-			}
+			ImagePointProcessing::Sepia(image);
 
 			return image;
 		}
@@ -1099,15 +1035,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			uint8 colorTable[256];
-			detail::InitPosterizeTable(level, colorTable);
-
-			for (auto& pixel : m_data)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			ImagePointProcessing::Posterize(*this, level);
 		}
 
 		return *this;
@@ -1127,15 +1055,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			uint8 colorTable[256];
-			detail::InitPosterizeTable(level, colorTable);
-
-			for (auto& pixel : image)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			ImagePointProcessing::Posterize(image, level);
 
 			return image;
 		}
@@ -1158,24 +1078,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			if (level < 0)
-			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
-					pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
-					pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
-				}
-			}
-			else if (level > 0)
-			{
-				for (auto& pixel : m_data)
-				{
-					pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
-					pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
-					pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
-				}
-			}
+			ImagePointProcessing::Brighten(*this, level);
 		}
 
 		return *this;
@@ -1195,24 +1098,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			if (level < 0)
-			{
-				for (auto& pixel : image)
-				{
-					pixel.r = static_cast<uint8>(Max(static_cast<int32>(pixel.r) + level, 0));
-					pixel.g = static_cast<uint8>(Max(static_cast<int32>(pixel.g) + level, 0));
-					pixel.b = static_cast<uint8>(Max(static_cast<int32>(pixel.b) + level, 0));
-				}
-			}
-			else if (level > 0)
-			{
-				for (auto& pixel : image)
-				{
-					pixel.r = static_cast<uint8>(Min(static_cast<int32>(pixel.r) + level, 255));
-					pixel.g = static_cast<uint8>(Min(static_cast<int32>(pixel.g) + level, 255));
-					pixel.b = static_cast<uint8>(Min(static_cast<int32>(pixel.b) + level, 255));
-				}
-			}
+			ImagePointProcessing::Brighten(image, level);
 
 			return image;
 		}
@@ -1802,15 +1688,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			uint8 colorTable[256];
-			detail::InitGammmaTable(gamma, colorTable);
-
-			for (auto& pixel : m_data)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			ImagePointProcessing::GammaCorrect(*this, gamma);
 		}
 
 		return *this;
@@ -1830,15 +1708,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			uint8 colorTable[256];
-			detail::InitGammmaTable(gamma, colorTable);
-
-			for (auto& pixel : image)
-			{
-				pixel.r = colorTable[pixel.r];
-				pixel.g = colorTable[pixel.g];
-				pixel.b = colorTable[pixel.b];
-			}
+			ImagePointProcessing::GammaCorrect(image, gamma);
 
 			return image;
 		}
@@ -1861,42 +1731,7 @@ namespace s3d
 
 		// 2. 処理
 		{
-			Color* pDst = data();
-			const Color* pDstEnd = pDst + num_pixels();
-			const double thresholdF = (threshold / 255.0);
-
-			if (invertColor)
-			{
-				while (pDst != pDstEnd)
-				{
-					if (thresholdF < pDst->grayscale())
-					{
-						pDst->setRGB(0);
-					}
-					else
-					{
-						pDst->setRGB(255);
-					}
-
-					++pDst;
-				}
-			}
-			else
-			{
-				while (pDst != pDstEnd)
-				{
-					if (thresholdF < pDst->grayscale())
-					{
-						pDst->setRGB(255);
-					}
-					else
-					{
-						pDst->setRGB(0);
-					}
-
-					++pDst;
-				}
-			}
+			ImagePointProcessing::Threshold(*this, threshold, invertColor);
 		}
 
 		return *this;
@@ -1916,42 +1751,7 @@ namespace s3d
 		{
 			Image image{ *this };
 
-			Color* pDst = image.data();
-			const Color* pDstEnd = pDst + num_pixels();
-			const double thresholdF = (threshold / 255.0);
-
-			if (invertColor)
-			{
-				while (pDst != pDstEnd)
-				{
-					if (thresholdF < pDst->grayscale())
-					{
-						pDst->setRGB(0);
-					}
-					else
-					{
-						pDst->setRGB(255);
-					}
-
-					++pDst;
-				}
-			}
-			else
-			{
-				while (pDst != pDstEnd)
-				{
-					if (thresholdF < pDst->grayscale())
-					{
-						pDst->setRGB(255);
-					}
-					else
-					{
-						pDst->setRGB(0);
-					}
-
-					++pDst;
-				}
-			}
+			ImagePointProcessing::Threshold(image, threshold, invertColor);
 
 			return image;
 		}
@@ -3093,6 +2893,69 @@ namespace s3d
 		return image;
 	}
 
+	void Image::scaleTo(Image& dst, const InterpolationAlgorithm interpolation) const
+	{
+		scaleTo(ImageROI{ dst, Rect{ dst.size() } }, interpolation);
+	}
+
+	void Image::scaleTo(const ImageROI& dst, const InterpolationAlgorithm interpolation) const
+	{
+		if (isEmpty() || dst.isEmpty())
+		{
+			return;
+		}
+
+		// 書き込み先と同じ画像の場合は、コピーを元画像にする
+		if (&dst.imageRef == this)
+		{
+			return Image{ *this }.scaleTo(dst, interpolation);
+		}
+
+		ImageResampling::Scale(*this, dst.imageRef, dst.region, interpolation);
+	}
+
+	void Image::warpAffineTo(Image& dst, const Mat3x2& mat, const Color& background) const
+	{
+		warpAffineTo(ImageROI{ dst, Rect{ dst.size() } }, mat, background);
+	}
+
+	void Image::warpAffineTo(const ImageROI& dst, const Mat3x2& mat, const Color& background) const
+	{
+		if (isEmpty() || dst.isEmpty())
+		{
+			return;
+		}
+
+		// 書き込み先と同じ画像の場合は、コピーを元画像にする
+		if (&dst.imageRef == this)
+		{
+			return Image{ *this }.warpAffineTo(dst, mat, background);
+		}
+
+		ImageResampling::WarpAffine(*this, dst.imageRef, dst.region, mat, background);
+	}
+
+	void Image::warpPerspectiveTo(Image& dst, const Quad& quad, const Color& background) const
+	{
+		warpPerspectiveTo(ImageROI{ dst, Rect{ dst.size() } }, quad, background);
+	}
+
+	void Image::warpPerspectiveTo(const ImageROI& dst, const Quad& quad, const Color& background) const
+	{
+		if (isEmpty() || dst.isEmpty())
+		{
+			return;
+		}
+
+		// 書き込み先と同じ画像の場合は、コピーを元画像にする
+		if (&dst.imageRef == this)
+		{
+			return Image{ *this }.warpPerspectiveTo(dst, quad, background);
+		}
+
+		ImageResampling::WarpPerspective(*this, dst.imageRef, dst.region, quad, background);
+	}
+
 	void Image::paint(Image& dst, const int32 x, const int32 y, const Color& color) const
 	{
 		paint(dst, Point{ x, y }, color);
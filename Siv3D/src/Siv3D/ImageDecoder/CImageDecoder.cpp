@@ -12,6 +12,7 @@
 # include <Siv3D/FileSystem.hpp>
 # include "CImageDecoder.hpp"
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ProfilerScope.hpp>
 # include <Siv3D/ImageFormat/BMPDecoder.hpp>
 # include <Siv3D/ImageFormat/PNGDecoder.hpp>
 # include <Siv3D/ImageFormat/JPEGDecoder.hpp>
@@ -71,6 +72,7 @@ namespace s3d
 	Image CImageDecoder::decode(IReader& reader, const FilePathView pathHint, const ImageFormat imageFormat)
 	{
 		LOG_SCOPED_TRACE(U"CImageDecoder::decode()");
+		SIV3D_PROFILE_SCOPE(U"ImageDecoder::Decode");
 
 		auto it = findDecoder(imageFormat);
 
@@ -14,6 +14,10 @@
 # include <Siv3D/JSONValidator.hpp>
 # include <Siv3D/TextReader.hpp>
 # include <Siv3D/TextWriter.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/MemoryViewReader.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include <Siv3D/FileSystem.hpp>
 # include <Siv3D/Unicode.hpp>
 # include <ThirdParty/nlohmann/json.hpp>
 # include <ThirdParty/nlohmann/json-schema.hpp>
@@ -142,6 +146,23 @@ namespace s3d
 
 			JSONValidatorDetail& operator=(JSONValidatorDetail&&) = default;
 		};
+
+		// UTF-8 のバイト列を String に変換せずにパースする
+		[[nodiscard]]
+		static JSON ParseBytes(const Byte* data, const size_t size, const AllowExceptions allowExceptions)
+		{
+			// BOM 付きの UTF-16 は TextReader で変換する
+			if ((2 <= size)
+				&& (((data[0] == Byte{ 0xFF }) && (data[1] == Byte{ 0xFE }))
+					|| ((data[0] == Byte{ 0xFE }) && (data[1] == Byte{ 0xFF }))))
+			{
+				TextReader reader{ std::make_unique<MemoryViewReader>(data, size) };
+
+				return JSON::Parse(reader.readAll(), allowExceptions);
+			}
+
+			return JSON::ParseUTF8(std::string_view{ reinterpret_cast<const char*>(data), size }, allowExceptions);
+		}
 	}
 
 	//////////////////////////////////////////////////
@@ -1155,9 +1176,20 @@ namespace s3d
 
 	JSON JSON::Load(const FilePathView path, const AllowExceptions allowExceptions)
 	{
-		TextReader reader{ path };
+		// 空のファイルはメモリマップできないので、サイズが 0 のファイルはマップしない
+		if ((not FileSystem::IsResourcePath(path))
+			&& (FileSystem::FileSize(path) != 0))
+		{
+			if (const MemoryMappedFileView file{ path })
+			{
+				return detail::ParseBytes(file.data(), file.mappedSize(), allowExceptions);
+			}
+		}
 
-		if (not reader)
+		// リソースと、メモリマップできなかったファイルは BinaryReader で読み込む
+		auto reader = std::make_unique<BinaryReader>(path);
+
+		if (not reader->isOpen())
 		{
 			if (allowExceptions)
 			{
@@ -1167,14 +1199,12 @@ namespace s3d
 			return JSON::Invalid();
 		}
 
-		return Parse(reader.readAll(), allowExceptions);
+		return Load(std::move(reader), allowExceptions);
 	}
 
 	JSON JSON::Load(std::unique_ptr<IReader>&& reader, const AllowExceptions allowExceptions)
 	{
-		TextReader textReader{ std::move(reader) };
-
-		if (not textReader)
+		if ((not reader) || (not reader->isOpen()))
 		{
 			if (allowExceptions)
 			{
@@ -1184,7 +1214,21 @@ namespace s3d
 			return JSON::Invalid();
 		}
 
-		return Parse(textReader.readAll(), allowExceptions);
+		// 残りのデータを一度に読み込む
+		const int64 size = Max<int64>((reader->size() - reader->getPos()), 0);
+
+		std::string buffer(static_cast<size_t>(size), '\0');
+
+		const int64 readSize = reader->read(buffer.data(), size);
+
+		buffer.resize(static_cast<size_t>(Max<int64>(readSize, 0)));
+
+		return detail::ParseBytes(reinterpret_cast<const Byte*>(buffer.data()), buffer.size(), allowExceptions);
+	}
+
+	JSON JSON::Load(const Blob& blob, const AllowExceptions allowExceptions)
+	{
+		return detail::ParseBytes(blob.data(), blob.size(), allowExceptions);
 	}
 
 	JSON JSON::Parse(const StringView str, const AllowExceptions allowExceptions)
@@ -1209,6 +1253,33 @@ namespace s3d
 		return value;
 	}
 
+	JSON JSON::ParseUTF8(std::string_view str, const AllowExceptions allowExceptions)
+	{
+		if (str.starts_with("\xEF\xBB\xBF"))
+		{
+			str.remove_prefix(3);
+		}
+
+		JSON value{ Invalid_{} };
+
+		try
+		{
+			value.m_detail = std::make_shared<detail::JSONDetail>(detail::JSONDetail::Value(), nlohmann::json::parse(str.begin(), str.end()));
+			value.m_isValid = true;
+		}
+		catch (const std::exception& e)
+		{
+			if (not allowExceptions)
+			{
+				return JSON::Invalid();
+			}
+
+			throw Error{ U"JSON::ParseUTF8(): " + Unicode::Widen(e.what()) };
+		}
+
+		return value;
+	}
+
 	JSON JSON::FromBSON(const Blob& bson, const AllowExceptions allowExceptions)
 	{
 		JSON value{ Invalid_{} };
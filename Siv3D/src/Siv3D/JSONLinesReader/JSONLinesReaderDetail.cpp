@@ -0,0 +1,237 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/Utility.hpp>
+# include "JSONLinesReaderDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 1 つのタスクでパースする行数
+		inline constexpr size_t JSONLinesGrainSize = 32;
+
+		[[nodiscard]]
+		static bool IsBlankLine(const std::string_view line) noexcept
+		{
+			for (const char ch : line)
+			{
+				if ((ch != ' ') && (ch != '\t') && (ch != '\r'))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+	}
+
+	JSONLinesReader::JSONLinesReaderDetail::JSONLinesReaderDetail()
+	{
+		// do nothing
+	}
+
+	JSONLinesReader::JSONLinesReaderDetail::~JSONLinesReaderDetail()
+	{
+		close();
+	}
+
+	bool JSONLinesReader::JSONLinesReaderDetail::open(const FilePathView path)
+	{
+		close();
+
+		std::unique_ptr<IReader> reader = std::make_unique<BinaryReader>(path);
+
+		if (not reader->isOpen())
+		{
+			return false;
+		}
+
+		m_reader = std::move(reader);
+		m_fullPath = FileSystem::FullPath(path);
+
+		return true;
+	}
+
+	bool JSONLinesReader::JSONLinesReaderDetail::open(std::unique_ptr<IReader>&& reader)
+	{
+		close();
+
+		if ((not reader)
+			|| (not reader->isOpen()))
+		{
+			return false;
+		}
+
+		m_reader = std::move(reader);
+
+		return true;
+	}
+
+	void JSONLinesReader::JSONLinesReaderDetail::close()
+	{
+		m_reader.reset();
+		m_fullPath.clear();
+		reset();
+	}
+
+	bool JSONLinesReader::JSONLinesReaderDetail::isOpen() const noexcept
+	{
+		return static_cast<bool>(m_reader);
+	}
+
+	bool JSONLinesReader::JSONLinesReaderDetail::readLine(JSON& value)
+	{
+		std::string_view line;
+
+		if (not nextLine(line))
+		{
+			return false;
+		}
+
+		value = JSON::ParseUTF8(line);
+
+		return true;
+	}
+
+	size_t JSONLinesReader::JSONLinesReaderDetail::readBatch(Array<JSON>& values, const size_t maxLines, const Parallel parallel)
+	{
+		values.clear();
+		m_batchText.clear();
+		m_batchRanges.clear();
+
+		// 行のデータを 1 つのバッファにまとめてから、パースを並列に行う
+		std::string_view line;
+
+		while ((m_batchRanges.size() < maxLines)
+			&& nextLine(line))
+		{
+			m_batchRanges.emplace_back(m_batchText.size(), line.size());
+			m_batchText.append(line);
+		}
+
+		const size_t count = m_batchRanges.size();
+
+		values.resize(count);
+
+		const auto parse = [&](const size_t i)
+		{
+			const auto [offset, size] = m_batchRanges[i];
+			values[i] = JSON::ParseUTF8(std::string_view{ (m_batchText.data() + offset), size });
+		};
+
+		if (parallel && (detail::JSONLinesGrainSize < count))
+		{
+			Threading::ParallelFor(count, parse, detail::JSONLinesGrainSize);
+		}
+		else
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				parse(i);
+			}
+		}
+
+		return count;
+	}
+
+	size_t JSONLinesReader::JSONLinesReaderDetail::lineNumber() const noexcept
+	{
+		return m_lineNumber;
+	}
+
+	const FilePath& JSONLinesReader::JSONLinesReaderDetail::path() const noexcept
+	{
+		return m_fullPath;
+	}
+
+	void JSONLinesReader::JSONLinesReaderDetail::reset()
+	{
+		m_buffer.clear();
+		m_bufferPos = 0;
+		m_endOfStream = false;
+		m_lineNumber = 0;
+	}
+
+	bool JSONLinesReader::JSONLinesReaderDetail::nextLine(std::string_view& line)
+	{
+		if (not m_reader)
+		{
+			return false;
+		}
+
+		size_t searchPos = m_bufferPos;
+
+		for (;;)
+		{
+			std::string_view current;
+
+			if (const size_t newLinePos = m_buffer.find('\n', searchPos);
+				newLinePos != std::string::npos)
+			{
+				current = std::string_view{ (m_buffer.data() + m_bufferPos), (newLinePos - m_bufferPos) };
+				m_bufferPos = (newLinePos + 1);
+			}
+			else if (m_endOfStream)
+			{
+				if (m_bufferPos == m_buffer.size())
+				{
+					return false;
+				}
+
+				current = std::string_view{ (m_buffer.data() + m_bufferPos), (m_buffer.size() - m_bufferPos) };
+				m_bufferPos = m_buffer.size();
+			}
+			else
+			{
+				// 途中までの行を先頭に詰めてから、続きを読み込む
+				m_buffer.erase(0, m_bufferPos);
+				m_bufferPos = 0;
+				searchPos = m_buffer.size();
+
+				m_buffer.resize(searchPos + ChunkSize);
+				const int64 readSize = m_reader->read((m_buffer.data() + searchPos), static_cast<int64>(ChunkSize));
+				m_buffer.resize(searchPos + static_cast<size_t>(Max<int64>(readSize, 0)));
+
+				if (readSize <= 0)
+				{
+					m_endOfStream = true;
+				}
+
+				continue;
+			}
+
+			searchPos = m_bufferPos;
+
+			if ((++m_lineNumber == 1)
+				&& current.starts_with("\xEF\xBB\xBF"))
+			{
+				current.remove_prefix(3);
+			}
+
+			if (detail::IsBlankLine(current))
+			{
+				continue;
+			}
+
+			if (current.ends_with('\r'))
+			{
+				current.remove_suffix(1);
+			}
+
+			line = current;
+			return true;
+		}
+	}
+}
@@ -0,0 +1,77 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <string>
+# include <Siv3D/JSONLinesReader.hpp>
+
+namespace s3d
+{
+	class JSONLinesReader::JSONLinesReaderDetail
+	{
+	public:
+
+		JSONLinesReaderDetail();
+
+		~JSONLinesReaderDetail();
+
+		[[nodiscard]]
+		bool open(FilePathView path);
+
+		[[nodiscard]]
+		bool open(std::unique_ptr<IReader>&& reader);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		bool readLine(JSON& value);
+
+		size_t readBatch(Array<JSON>& values, size_t maxLines, Parallel parallel);
+
+		[[nodiscard]]
+		size_t lineNumber() const noexcept;
+
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		// 1 回の IReader::read() で読み込むバイト数
+		static constexpr size_t ChunkSize = (256 * 1024);
+
+		std::unique_ptr<IReader> m_reader;
+
+		FilePath m_fullPath;
+
+		// 読み込み済みでまだ行として取り出していないデータは m_buffer[m_bufferPos] 以降
+		std::string m_buffer;
+
+		size_t m_bufferPos = 0;
+
+		bool m_endOfStream = false;
+
+		size_t m_lineNumber = 0;
+
+		// readBatch() の作業用
+		std::string m_batchText;
+
+		Array<std::pair<size_t, size_t>> m_batchRanges;
+
+		void reset();
+
+		// 次の空白でない行を取得する。返り値は次に m_buffer を変更するまで有効
+		[[nodiscard]]
+		bool nextLine(std::string_view& line);
+	};
+}
@@ -0,0 +1,91 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/JSONLinesReader.hpp>
+# include <Siv3D/JSONLinesReader/JSONLinesReaderDetail.hpp>
+
+namespace s3d
+{
+	JSONLinesReader::JSONLinesReader()
+		: pImpl{ std::make_shared<JSONLinesReaderDetail>() }
+	{
+
+	}
+
+	JSONLinesReader::JSONLinesReader(const FilePathView path)
+		: JSONLinesReader{}
+	{
+		open(path);
+	}
+
+	JSONLinesReader::JSONLinesReader(std::unique_ptr<IReader>&& reader)
+		: JSONLinesReader{}
+	{
+		open(std::move(reader));
+	}
+
+	bool JSONLinesReader::open(const FilePathView path)
+	{
+		return pImpl->open(path);
+	}
+
+	bool JSONLinesReader::open(std::unique_ptr<IReader>&& reader)
+	{
+		return pImpl->open(std::move(reader));
+	}
+
+	void JSONLinesReader::close()
+	{
+		pImpl->close();
+	}
+
+	bool JSONLinesReader::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	JSONLinesReader::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	Optional<JSON> JSONLinesReader::readLine()
+	{
+		JSON value;
+
+		if (not pImpl->readLine(value))
+		{
+			return none;
+		}
+
+		return value;
+	}
+
+	bool JSONLinesReader::readLine(JSON& value)
+	{
+		return pImpl->readLine(value);
+	}
+
+	size_t JSONLinesReader::readBatch(Array<JSON>& values, const size_t maxLines, const Parallel parallel)
+	{
+		return pImpl->readBatch(values, maxLines, parallel);
+	}
+
+	size_t JSONLinesReader::lineNumber() const noexcept
+	{
+		return pImpl->lineNumber();
+	}
+
+	const FilePath& JSONLinesReader::path() const noexcept
+	{
+		return pImpl->path();
+	}
+}
@@ -0,0 +1,259 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <streambuf>
+# include <istream>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <ThirdParty/nlohmann/json.hpp>
+# include "JSONReaderDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// IReader からブロック単位で読み込む streambuf
+		class IReaderStreamBuffer : public std::streambuf
+		{
+		public:
+
+			static constexpr size_t BufferSize = (64 * 1024);
+
+			explicit IReaderStreamBuffer(IReader& reader)
+				: m_reader{ reader }
+				, m_buffer(BufferSize) {}
+
+		protected:
+
+			int_type underflow() override
+			{
+				if (gptr() < egptr())
+				{
+					return traits_type::to_int_type(*gptr());
+				}
+
+				const int64 readSize = m_reader.read(m_buffer.data(), static_cast<int64>(m_buffer.size()));
+
+				if (readSize <= 0)
+				{
+					return traits_type::eof();
+				}
+
+				char* const pBuffer = m_buffer.data();
+				setg(pBuffer, pBuffer, (pBuffer + readSize));
+				return traits_type::to_int_type(*pBuffer);
+			}
+
+		private:
+
+			IReader& m_reader;
+
+			Array<char> m_buffer;
+		};
+
+		// nlohmann::json の SAX イベントを IJSONHandler に転送する
+		class JSONSAXAdapter
+		{
+		public:
+
+			using number_integer_t = nlohmann::json::number_integer_t;
+
+			using number_unsigned_t = nlohmann::json::number_unsigned_t;
+
+			using number_float_t = nlohmann::json::number_float_t;
+
+			using string_t = nlohmann::json::string_t;
+
+			using binary_t = nlohmann::json::binary_t;
+
+			explicit JSONSAXAdapter(IJSONHandler& handler)
+				: m_handler{ handler } {}
+
+			bool null()
+			{
+				return m_handler.onNull();
+			}
+
+			bool boolean(const bool value)
+			{
+				return m_handler.onBool(value);
+			}
+
+			bool number_integer(const number_integer_t value)
+			{
+				return m_handler.onInt(value);
+			}
+
+			bool number_unsigned(const number_unsigned_t value)
+			{
+				return m_handler.onUInt(value);
+			}
+
+			bool number_float(const number_float_t value, const string_t&)
+			{
+				return m_handler.onFloat(value);
+			}
+
+			bool string(string_t& value)
+			{
+				m_string = Unicode::FromUTF8(value);
+				return m_handler.onString(m_string);
+			}
+
+			bool binary(binary_t&)
+			{
+				// JSON テキストからは呼ばれない
+				return true;
+			}
+
+			bool start_object(size_t)
+			{
+				return m_handler.onBeginObject();
+			}
+
+			bool key(string_t& value)
+			{
+				m_string = Unicode::FromUTF8(value);
+				return m_handler.onKey(m_string);
+			}
+
+			bool end_object()
+			{
+				return m_handler.onEndObject();
+			}
+
+			bool start_array(size_t)
+			{
+				return m_handler.onBeginArray();
+			}
+
+			bool end_array()
+			{
+				return m_handler.onEndArray();
+			}
+
+			bool parse_error(size_t, const std::string&, const nlohmann::detail::exception& e)
+			{
+				m_error = Unicode::Widen(e.what());
+				return false;
+			}
+
+			[[nodiscard]]
+			String& error() noexcept
+			{
+				return m_error;
+			}
+
+		private:
+
+			IJSONHandler& m_handler;
+
+			String m_string;
+
+			String m_error;
+		};
+	}
+
+	JSONReader::JSONReaderDetail::JSONReaderDetail()
+	{
+		// do nothing
+	}
+
+	JSONReader::JSONReaderDetail::~JSONReaderDetail()
+	{
+		close();
+	}
+
+	bool JSONReader::JSONReaderDetail::open(const FilePathView path)
+	{
+		close();
+
+		std::unique_ptr<IReader> reader = std::make_unique<BinaryReader>(path);
+
+		if (not reader->isOpen())
+		{
+			return false;
+		}
+
+		m_reader = std::move(reader);
+		m_fullPath = FileSystem::FullPath(path);
+
+		return true;
+	}
+
+	bool JSONReader::JSONReaderDetail::open(std::unique_ptr<IReader>&& reader)
+	{
+		close();
+
+		if ((not reader)
+			|| (not reader->isOpen()))
+		{
+			return false;
+		}
+
+		m_reader = std::move(reader);
+
+		return true;
+	}
+
+	void JSONReader::JSONReaderDetail::close()
+	{
+		m_reader.reset();
+		m_fullPath.clear();
+	}
+
+	bool JSONReader::JSONReaderDetail::isOpen() const noexcept
+	{
+		return static_cast<bool>(m_reader);
+	}
+
+	bool JSONReader::JSONReaderDetail::read(IJSONHandler& handler)
+	{
+		m_lastError.clear();
+
+		if (not m_reader)
+		{
+			m_lastError = U"JSONReader::read(): The reader is not open";
+			return false;
+		}
+
+		bool result = false;
+
+		{
+			detail::IReaderStreamBuffer buffer{ *m_reader };
+			std::istream stream{ &buffer };
+			detail::JSONSAXAdapter adapter{ handler };
+
+			result = nlohmann::json::sax_parse(stream, &adapter);
+
+			if (not result)
+			{
+				m_lastError = std::move(adapter.error());
+			}
+		}
+
+		// データは一度しか読み込めないため、読み込み後はクローズする
+		m_reader.reset();
+
+		return result;
+	}
+
+	const String& JSONReader::JSONReaderDetail::lastError() const noexcept
+	{
+		return m_lastError;
+	}
+
+	const FilePath& JSONReader::JSONReaderDetail::path() const noexcept
+	{
+		return m_fullPath;
+	}
+}
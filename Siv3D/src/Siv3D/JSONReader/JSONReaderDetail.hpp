@@ -0,0 +1,52 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/JSONReader.hpp>
+
+namespace s3d
+{
+	class JSONReader::JSONReaderDetail
+	{
+	public:
+
+		JSONReaderDetail();
+
+		~JSONReaderDetail();
+
+		[[nodiscard]]
+		bool open(FilePathView path);
+
+		[[nodiscard]]
+		bool open(std::unique_ptr<IReader>&& reader);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		bool read(IJSONHandler& handler);
+
+		[[nodiscard]]
+		const String& lastError() const noexcept;
+
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		std::unique_ptr<IReader> m_reader;
+
+		FilePath m_fullPath;
+
+		String m_lastError;
+	};
+}
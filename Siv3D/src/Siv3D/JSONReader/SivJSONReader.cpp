@@ -0,0 +1,74 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/JSONReader.hpp>
+# include <Siv3D/JSONReader/JSONReaderDetail.hpp>
+
+namespace s3d
+{
+	JSONReader::JSONReader()
+		: pImpl{ std::make_shared<JSONReaderDetail>() }
+	{
+
+	}
+
+	JSONReader::JSONReader(const FilePathView path)
+		: JSONReader{}
+	{
+		open(path);
+	}
+
+	JSONReader::JSONReader(std::unique_ptr<IReader>&& reader)
+		: JSONReader{}
+	{
+		open(std::move(reader));
+	}
+
+	bool JSONReader::open(const FilePathView path)
+	{
+		return pImpl->open(path);
+	}
+
+	bool JSONReader::open(std::unique_ptr<IReader>&& reader)
+	{
+		return pImpl->open(std::move(reader));
+	}
+
+	void JSONReader::close()
+	{
+		pImpl->close();
+	}
+
+	bool JSONReader::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	JSONReader::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	bool JSONReader::read(IJSONHandler& handler)
+	{
+		return pImpl->read(handler);
+	}
+
+	const String& JSONReader::lastError() const noexcept
+	{
+		return pImpl->lastError();
+	}
+
+	const FilePath& JSONReader::path() const noexcept
+	{
+		return pImpl->path();
+	}
+}
@@ -0,0 +1,633 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/Threading.hpp>
+# include "NavMeshCrowdDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 1 回のタスクで更新するエージェントの数
+		static constexpr size_t NavMeshCrowdGrainSize = 64;
+
+		// 半径の何倍の距離までのエージェントを避けるか
+		static constexpr float NavMeshSeparationRangeScale = 4.0f;
+
+		// 重なりを解消する処理の反復回数
+		static constexpr int32 NavMeshCollisionIterations = 4;
+
+		// 経路から求める曲がり角の最大数
+		static constexpr int32 NavMeshMaxCorners = 3;
+
+		// 1 回の移動で通過するポリゴンの最大数
+		static constexpr int32 NavMeshMaxVisited = 16;
+
+		[[nodiscard]]
+		static Float3 ToFloat3(const Vec2& pos) noexcept
+		{
+			return{ static_cast<float>(pos.x), 0.0f, static_cast<float>(pos.y) };
+		}
+
+		// 半径に応じた、ナビメッシュ上の最も近い位置を探す範囲
+		[[nodiscard]]
+		static Float3 SearchExtent(const float radius) noexcept
+		{
+			const float extent = Max(2.0f, (radius * 2.0f));
+			return{ extent, 0.0f, extent };
+		}
+
+		// 移動の前後で通過したポリゴンの列を経路の先頭につなぐ（DetourCrowd の dtMergeCorridorStartMoved と同じ）
+		static void MergeCorridorStartMoved(Array<dtPolyRef>& corridor, const dtPolyRef* visited, const int32 nvisited)
+		{
+			int32 furthestPath = -1;
+			int32 furthestVisited = -1;
+
+			// 通過したポリゴンのうち、経路の最も先にあるものを探す
+			for (int32 i = (static_cast<int32>(corridor.size()) - 1); 0 <= i; --i)
+			{
+				for (int32 j = (nvisited - 1); 0 <= j; --j)
+				{
+					if (corridor[i] == visited[j])
+					{
+						furthestPath = i;
+						furthestVisited = j;
+					}
+				}
+
+				if (furthestPath != -1)
+				{
+					break;
+				}
+			}
+
+			if (furthestPath == -1)
+			{
+				return;
+			}
+
+			// そのポリゴンより手前の経路を、通過したポリゴンを逆順に並べたもので置き換える
+			const size_t numVisited = static_cast<size_t>(nvisited - (furthestVisited + 1));
+			corridor.erase(corridor.begin(), (corridor.begin() + furthestPath));
+			corridor.insert(corridor.begin(), numVisited, dtPolyRef{ 0 });
+
+			for (size_t i = 0; i < numVisited; ++i)
+			{
+				corridor[i] = visited[(nvisited - 1) - i];
+			}
+		}
+	}
+
+	NavMeshCrowd::NavMeshCrowdDetail::NavMeshCrowdDetail() {}
+
+	NavMeshCrowd::NavMeshCrowdDetail::NavMeshCrowdDetail(const std::shared_ptr<NavMesh::NavMeshDetail>& navMesh)
+		: m_navMesh{ navMesh } {}
+
+	size_t NavMeshCrowd::NavMeshCrowdDetail::num_agents() const noexcept
+	{
+		return m_agents.size();
+	}
+
+	Optional<NavMeshAgentID> NavMeshCrowd::NavMeshCrowdDetail::addAgent(const Vec2& pos, const NavMeshAgentConfig& config)
+	{
+		if ((not m_navMesh) || (not m_navMesh->isValid()))
+		{
+			return none;
+		}
+
+		Agent agent;
+		agent.radius			= Max(static_cast<float>(config.radius), 0.0f);
+		agent.maxSpeed			= Max(static_cast<float>(config.maxSpeed), 0.0f);
+		agent.maxAcceleration	= Max(static_cast<float>(config.maxAcceleration), 0.0f);
+		agent.separationWeight	= Max(static_cast<float>(config.separationWeight), 0.0f);
+
+		auto context = m_navMesh->acquireQueryContext();
+
+		if (not context)
+		{
+			return none;
+		}
+
+		const Float3 position = detail::ToFloat3(pos);
+		const Float3 extent = detail::SearchExtent(agent.radius);
+		dtPolyRef polygon = 0;
+		const dtStatus status = context->navmeshQuery.findNearestPoly(&position.x, &extent.x, &m_filter, &polygon, &agent.position.x);
+
+		if (dtStatusFailed(status) || (polygon == 0))
+		{
+			return none;
+		}
+
+		agent.corridor << polygon;
+
+		const NavMeshAgentID id = m_nextID++;
+		m_maxRadius = Max(m_maxRadius, agent.radius);
+		m_indices.emplace(id, m_agents.size());
+		m_ids << id;
+		m_positions.emplace_back(agent.position.x, agent.position.z);
+		m_agents << std::move(agent);
+
+		return id;
+	}
+
+	bool NavMeshCrowd::NavMeshCrowdDetail::removeAgent(const NavMeshAgentID id)
+	{
+		const auto it = m_indices.find(id);
+
+		if (it == m_indices.end())
+		{
+			return false;
+		}
+
+		// 末尾のエージェントと入れ替えてから削除する
+		const size_t index = it->second;
+		const size_t last = (m_agents.size() - 1);
+		const float removedRadius = m_agents[index].radius;
+
+		if (index != last)
+		{
+			m_agents[index] = std::move(m_agents[last]);
+			m_ids[index] = m_ids[last];
+			m_positions[index] = m_positions[last];
+			m_indices[m_ids[index]] = index;
+		}
+
+		m_agents.pop_back();
+		m_ids.pop_back();
+		m_positions.pop_back();
+		m_indices.erase(id);
+
+		// 半径が最大のエージェントを削除した場合は、グリッドのセルや近くのエージェントの検索範囲が大きくなりすぎないよう、最大の半径を求め直す
+		if (m_maxRadius <= removedRadius)
+		{
+			m_maxRadius = 0.0f;
+
+			for (const auto& agent : m_agents)
+			{
+				m_maxRadius = Max(m_maxRadius, agent.radius);
+			}
+		}
+
+		return true;
+	}
+
+	void NavMeshCrowd::NavMeshCrowdDetail::clear()
+	{
+		m_agents.clear();
+		m_ids.clear();
+		m_positions.clear();
+		m_indices.clear();
+		m_maxRadius = 0.0f;
+		m_grid.clear();
+	}
+
+	bool NavMeshCrowd::NavMeshCrowdDetail::hasAgent(const NavMeshAgentID id) const
+	{
+		return m_indices.contains(id);
+	}
+
+	bool NavMeshCrowd::NavMeshCrowdDetail::setTarget(const NavMeshAgentID id, const Vec2& target)
+	{
+		Agent* agent = getAgent(id);
+
+		if ((not agent) || (not m_navMesh->isValid()))
+		{
+			return false;
+		}
+
+		auto context = m_navMesh->acquireQueryContext();
+
+		if (not context)
+		{
+			return false;
+		}
+
+		const Float3 position = detail::ToFloat3(target);
+		const Float3 extent = detail::SearchExtent(agent->radius);
+		dtPolyRef polygon = 0;
+		Float3 nearest{ 0, 0, 0 };
+		const dtStatus status = context->navmeshQuery.findNearestPoly(&position.x, &extent.x, &m_filter, &polygon, &nearest.x);
+
+		if (dtStatusFailed(status) || (polygon == 0))
+		{
+			return false;
+		}
+
+		agent->target = nearest;
+		agent->targetPolygon = polygon;
+		agent->hasTarget = true;
+		agent->replan = true;
+
+		return true;
+	}
+
+	bool NavMeshCrowd::NavMeshCrowdDetail::resetTarget(const NavMeshAgentID id)
+	{
+		Agent* agent = getAgent(id);
+
+		if (not agent)
+		{
+			return false;
+		}
+
+		agent->hasTarget = false;
+		agent->replan = false;
+		agent->corridor.resize(1);
+
+		return true;
+	}
+
+	Vec2 NavMeshCrowd::NavMeshCrowdDetail::getPos(const NavMeshAgentID id) const
+	{
+		if (const Agent* agent = getAgent(id))
+		{
+			return{ agent->position.x, agent->position.z };
+		}
+
+		return{ 0, 0 };
+	}
+
+	Vec2 NavMeshCrowd::NavMeshCrowdDetail::getVelocity(const NavMeshAgentID id) const
+	{
+		if (const Agent* agent = getAgent(id))
+		{
+			return Vec2{ agent->velocity };
+		}
+
+		return{ 0, 0 };
+	}
+
+	bool NavMeshCrowd::NavMeshCrowdDetail::hasArrived(const NavMeshAgentID id) const
+	{
+		const Agent* agent = getAgent(id);
+
+		if ((not agent) || (not agent->hasTarget))
+		{
+			return false;
+		}
+
+		const Float2 diff{ (agent->target.x - agent->position.x), (agent->target.z - agent->position.z) };
+
+		return (diff.lengthSq() <= (agent->radius * agent->radius));
+	}
+
+	void NavMeshCrowd::NavMeshCrowdDetail::update(const double deltaTime)
+	{
+		if (m_agents.isEmpty() || (not m_navMesh) || (not m_navMesh->isValid()) || (deltaTime <= 0.0))
+		{
+			return;
+		}
+
+		const float dt = static_cast<float>(deltaTime);
+		const size_t num_agents = m_agents.size();
+
+		// 前回の更新後の位置で、近くのエージェントを検索するためのグリッドを作る
+		{
+			const double cellSize = Max((m_maxRadius * detail::NavMeshSeparationRangeScale), 0.5f);
+
+			if (m_grid.cellSize() != cellSize)
+			{
+				m_grid = SpatialHashGrid2D<uint32>{ cellSize };
+			}
+
+			m_grid.clear();
+
+			for (size_t i = 0; i < num_agents; ++i)
+			{
+				m_grid.add(static_cast<uint32>(i), m_positions[i]);
+			}
+
+			m_grid.build();
+		}
+
+		m_candidates.resize(num_agents);
+		m_resolvedCandidates.resize(num_agents);
+
+		// 各段階では、エージェントは他のエージェントの前の段階の結果だけを読むため、結果はスレッド数によらない
+		Threading::detail::ParallelForRange(0, num_agents, detail::NavMeshCrowdGrainSize, [&](const size_t begin, const size_t end)
+		{
+			auto context = m_navMesh->acquireQueryContext();
+			Array<uint32> neighbors;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (context)
+				{
+					steer(*context, i, dt, neighbors);
+				}
+				else
+				{
+					m_candidates[i] = Float2{ m_agents[i].position.x, m_agents[i].position.z };
+				}
+			}
+		});
+
+		for (int32 iteration = 0; iteration < detail::NavMeshCollisionIterations; ++iteration)
+		{
+			Threading::detail::ParallelForRange(0, num_agents, detail::NavMeshCrowdGrainSize, [&](const size_t begin, const size_t end)
+			{
+				Array<uint32> neighbors;
+
+				for (size_t i = begin; i < end; ++i)
+				{
+					resolve(i, neighbors);
+				}
+			});
+
+			m_candidates.swap(m_resolvedCandidates);
+		}
+
+		Threading::detail::ParallelForRange(0, num_agents, detail::NavMeshCrowdGrainSize, [&](const size_t begin, const size_t end)
+		{
+			auto context = m_navMesh->acquireQueryContext();
+
+			if (not context)
+			{
+				return;
+			}
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				move(*context, i);
+			}
+		});
+	}
+
+	const Array<Vec2>& NavMeshCrowd::NavMeshCrowdDetail::getPositions() const noexcept
+	{
+		return m_positions;
+	}
+
+	const Array<NavMeshAgentID>& NavMeshCrowd::NavMeshCrowdDetail::getAgentIDs() const noexcept
+	{
+		return m_ids;
+	}
+
+	NavMeshCrowd::NavMeshCrowdDetail::Agent* NavMeshCrowd::NavMeshCrowdDetail::getAgent(const NavMeshAgentID id)
+	{
+		const auto it = m_indices.find(id);
+
+		if (it == m_indices.end())
+		{
+			return nullptr;
+		}
+
+		return &m_agents[it->second];
+	}
+
+	const NavMeshCrowd::NavMeshCrowdDetail::Agent* NavMeshCrowd::NavMeshCrowdDetail::getAgent(const NavMeshAgentID id) const
+	{
+		const auto it = m_indices.find(id);
+
+		if (it == m_indices.end())
+		{
+			return nullptr;
+		}
+
+		return &m_agents[it->second];
+	}
+
+	void NavMeshCrowd::NavMeshCrowdDetail::steer(NavMesh::NavMeshDetail::QueryContext& context, const size_t index, const float deltaTime, Array<uint32>& neighbors)
+	{
+		Agent& agent = m_agents[index];
+		const dtNavMeshQuery& navmeshQuery = context.navmeshQuery;
+		// ナビメッシュが構築し直されてポリゴンが無効になった場合は、ナビメッシュ上に置き直す
+		if (not navmeshQuery.isValidPolyRef(agent.corridor.front(), &m_filter))
+		{
+			const Float3 extent = detail::SearchExtent(agent.radius);
+			dtPolyRef polygon = 0;
+			Float3 nearest{ 0, 0, 0 };
+
+			if (dtStatusFailed(navmeshQuery.findNearestPoly(&agent.position.x, &extent.x, &m_filter, &polygon, &nearest.x)) || (polygon == 0))
+			{
+				agent.velocity = Float2{ 0, 0 };
+				m_candidates[index] = Float2{ agent.position.x, agent.position.z };
+				return;
+			}
+
+			agent.position = nearest;
+			agent.corridor = { polygon };
+			agent.replan = agent.hasTarget;
+		}
+
+		if (agent.hasTarget && (not navmeshQuery.isValidPolyRef(agent.targetPolygon, &m_filter)))
+		{
+			agent.hasTarget = false;
+			agent.replan = false;
+			agent.corridor.resize(1);
+		}
+
+		if (agent.replan)
+		{
+			Array<dtPolyRef>& polygonBuffer = context.polygonBuffer;
+			int32 npolys = 0;
+
+			if (dtStatusSucceed(navmeshQuery.findPath(agent.corridor.front(), agent.targetPolygon, &agent.position.x, &agent.target.x,
+				&m_filter, polygonBuffer.data(), &npolys, static_cast<int32>(polygonBuffer.size()))) && (0 < npolys))
+			{
+				agent.corridor.assign(polygonBuffer.begin(), (polygonBuffer.begin() + npolys));
+
+				// 目的地まで到達できない場合は、到達できる最も近い位置を目指す
+				if (agent.corridor.back() != agent.targetPolygon)
+				{
+					const Float3 target = agent.target;
+					navmeshQuery.closestPointOnPoly(agent.corridor.back(), &target.x, &agent.target.x, nullptr);
+					agent.targetPolygon = agent.corridor.back();
+				}
+			}
+
+			agent.replan = false;
+		}
+
+		const Float2 position{ agent.position.x, agent.position.z };
+
+		// 経路上の次の曲がり角に向かう速度
+		Float2 desiredVelocity{ 0, 0 };
+
+		if (agent.hasTarget)
+		{
+			Float3 corners[detail::NavMeshMaxCorners];
+			unsigned char flags[detail::NavMeshMaxCorners];
+			int32 ncorners = 0;
+
+			navmeshQuery.findStraightPath(&agent.position.x, &agent.target.x, agent.corridor.data(), static_cast<int32>(agent.corridor.size()),
+				&corners[0].x, flags, nullptr, &ncorners, detail::NavMeshMaxCorners);
+
+			for (int32 i = 0; i < ncorners; ++i)
+			{
+				const Float2 diff{ (corners[i].x - position.x), (corners[i].z - position.y) };
+				const float distance = diff.length();
+
+				if (distance <= 0.01f)
+				{
+					continue;
+				}
+
+				float speed = agent.maxSpeed;
+
+				// 目的地の手前では減速する
+				if ((flags[i] & DT_STRAIGHTPATH_END) && (0.0f < agent.radius))
+				{
+					speed *= Min((distance / (agent.radius * 2.0f)), 1.0f);
+				}
+
+				desiredVelocity = (diff * (speed / distance));
+				break;
+			}
+		}
+
+		// 近くのエージェントから離れる
+		if (0.0f < agent.separationWeight)
+		{
+			const float range = (agent.radius * detail::NavMeshSeparationRangeScale);
+			m_grid.query(neighbors, Circle{ m_positions[index], range });
+
+			// 正面から向かい合ったときに止まってしまわないよう、前方のエージェントは進行方向の右側に避ける
+			const Float2 direction = desiredVelocity.normalized();
+			const Float2 side{ -direction.y, direction.x };
+
+			Float2 displacement{ 0, 0 };
+			int32 count = 0;
+
+			for (const uint32 neighbor : neighbors)
+			{
+				if (neighbor == index)
+				{
+					continue;
+				}
+
+				const Float2 diff = (position - Float2{ m_positions[neighbor] });
+				const float distanceSq = diff.lengthSq();
+
+				if ((distanceSq < 1e-6f) || ((range * range) < distanceSq))
+				{
+					continue;
+				}
+
+				const float distance = std::sqrt(distanceSq);
+				const float weight = (agent.separationWeight * (1.0f - Math::Square(distance / range)));
+				displacement += (diff * (weight / distance));
+
+				if (const float ahead = -diff.dot(direction);
+					0.0f < ahead)
+				{
+					displacement += (side * (weight * ahead / distance));
+				}
+
+				++count;
+			}
+
+			if (count)
+			{
+				desiredVelocity += (displacement / static_cast<float>(count));
+				desiredVelocity.limitLengthSelf(agent.maxSpeed);
+			}
+		}
+
+		// 加速度の上限の範囲で速度を変える
+		Float2 deltaVelocity = (desiredVelocity - agent.velocity);
+		deltaVelocity.limitLengthSelf(agent.maxAcceleration * deltaTime);
+		agent.velocity += deltaVelocity;
+
+		m_candidates[index] = (position + agent.velocity * deltaTime);
+	}
+
+	void NavMeshCrowd::NavMeshCrowdDetail::resolve(const size_t index, Array<uint32>& neighbors)
+	{
+		const Agent& agent = m_agents[index];
+		const Float2 candidate = m_candidates[index];
+
+		// 移動先の候補は前回の位置から離れているため、検索範囲を広げておく
+		const float range = ((agent.radius + m_maxRadius) * 2.0f);
+		m_grid.query(neighbors, Circle{ m_positions[index], range });
+
+		Float2 displacement{ 0, 0 };
+		int32 count = 0;
+
+		for (const uint32 neighbor : neighbors)
+		{
+			if (neighbor == index)
+			{
+				continue;
+			}
+
+			const float minDistance = (agent.radius + m_agents[neighbor].radius);
+			const Float2 diff = (candidate - m_candidates[neighbor]);
+			float distance = diff.lengthSq();
+
+			if ((minDistance * minDistance) <= distance)
+			{
+				continue;
+			}
+
+			distance = std::sqrt(distance);
+
+			// 完全に重なっている場合は、インデックスの大小で押し出す向きを決める
+			if (distance < 1e-4f)
+			{
+				displacement.x += (((index < neighbor) ? 0.5f : -0.5f) * minDistance);
+			}
+			else
+			{
+				displacement += (diff * (((minDistance - distance) * 0.5f) / distance));
+			}
+
+			++count;
+		}
+
+		if (count)
+		{
+			m_resolvedCandidates[index] = (candidate + displacement / static_cast<float>(count));
+		}
+		else
+		{
+			m_resolvedCandidates[index] = candidate;
+		}
+	}
+
+	void NavMeshCrowd::NavMeshCrowdDetail::move(NavMesh::NavMeshDetail::QueryContext& context, const size_t index)
+	{
+		Agent& agent = m_agents[index];
+		const dtNavMeshQuery& navmeshQuery = context.navmeshQuery;
+		const Float3 end{ m_candidates[index].x, agent.position.y, m_candidates[index].y };
+
+		// 壁に沿って滑るように移動する
+		dtPolyRef* visited = context.polygonBuffer.data();
+		const int32 maxVisited = Min(detail::NavMeshMaxVisited, static_cast<int32>(context.polygonBuffer.size()));
+		int32 nvisited = 0;
+		Float3 result{ 0, 0, 0 };
+
+		if (dtStatusFailed(navmeshQuery.moveAlongSurface(agent.corridor.front(), &agent.position.x, &end.x, &m_filter, &result.x, visited, &nvisited, maxVisited))
+			|| (nvisited <= 0))
+		{
+			return;
+		}
+
+		float height = result.y;
+
+		if (dtStatusSucceed(navmeshQuery.getPolyHeight(visited[nvisited - 1], &result.x, &height)))
+		{
+			result.y = height;
+		}
+
+		if (agent.hasTarget)
+		{
+			detail::MergeCorridorStartMoved(agent.corridor, visited, nvisited);
+		}
+		else
+		{
+			agent.corridor = { visited[nvisited - 1] };
+		}
+
+		agent.position = result;
+		m_positions[index].set(result.x, result.z);
+	}
+}
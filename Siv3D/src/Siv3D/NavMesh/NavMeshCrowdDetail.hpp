@@ -0,0 +1,132 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/NavMeshCrowd.hpp>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/SpatialHashGrid2D.hpp>
+# include "NavMeshDetail.hpp"
+
+namespace s3d
+{
+	class NavMeshCrowd::NavMeshCrowdDetail
+	{
+	public:
+
+		NavMeshCrowdDetail();
+
+		explicit NavMeshCrowdDetail(const std::shared_ptr<NavMesh::NavMeshDetail>& navMesh);
+
+		[[nodiscard]]
+		size_t num_agents() const noexcept;
+
+		[[nodiscard]]
+		Optional<NavMeshAgentID> addAgent(const Vec2& pos, const NavMeshAgentConfig& config);
+
+		bool removeAgent(NavMeshAgentID id);
+
+		void clear();
+
+		[[nodiscard]]
+		bool hasAgent(NavMeshAgentID id) const;
+
+		bool setTarget(NavMeshAgentID id, const Vec2& target);
+
+		bool resetTarget(NavMeshAgentID id);
+
+		[[nodiscard]]
+		Vec2 getPos(NavMeshAgentID id) const;
+
+		[[nodiscard]]
+		Vec2 getVelocity(NavMeshAgentID id) const;
+
+		[[nodiscard]]
+		bool hasArrived(NavMeshAgentID id) const;
+
+		void update(double deltaTime);
+
+		[[nodiscard]]
+		const Array<Vec2>& getPositions() const noexcept;
+
+		[[nodiscard]]
+		const Array<NavMeshAgentID>& getAgentIDs() const noexcept;
+
+	private:
+
+		struct Agent
+		{
+			float radius = 0.5f;
+
+			float maxSpeed = 3.5f;
+
+			float maxAcceleration = 8.0f;
+
+			float separationWeight = 2.0f;
+
+			Float3 position{ 0, 0, 0 };
+
+			Float2 velocity{ 0, 0 };
+
+			Float3 target{ 0, 0, 0 };
+
+			dtPolyRef targetPolygon = 0;
+
+			bool hasTarget = false;
+
+			// 次の更新で経路を計算し直す
+			bool replan = false;
+
+			// エージェントがいるポリゴンから目的地までのポリゴンの列。先頭はエージェントがいるポリゴン
+			Array<dtPolyRef> corridor;
+		};
+
+		std::shared_ptr<NavMesh::NavMeshDetail> m_navMesh;
+
+		dtQueryFilter m_filter;
+
+		// 以下の 3 つの配列は同じ順に並ぶ
+		Array<Agent> m_agents;
+
+		Array<NavMeshAgentID> m_ids;
+
+		Array<Vec2> m_positions;
+
+		// 今回の更新で各エージェントが移動しようとする位置 (x, z)。重なりの解消では 2 つの配列を交互に読み書きする
+		Array<Float2> m_candidates;
+
+		Array<Float2> m_resolvedCandidates;
+
+		HashTable<NavMeshAgentID, size_t> m_indices;
+
+		NavMeshAgentID m_nextID = 0;
+
+		// 半径が最大のエージェントの半径
+		float m_maxRadius = 0.0f;
+
+		// 近くのエージェントの検索に使う、前回の更新後の位置によるグリッド
+		SpatialHashGrid2D<uint32> m_grid;
+
+		[[nodiscard]]
+		Agent* getAgent(NavMeshAgentID id);
+
+		[[nodiscard]]
+		const Agent* getAgent(NavMeshAgentID id) const;
+
+		// 必要なら経路を計算し直し、周囲のエージェントを避ける速度を求めて、移動先の候補を決める
+		void steer(NavMesh::NavMeshDetail::QueryContext& context, size_t index, float deltaTime, Array<uint32>& neighbors);
+
+		// 周囲のエージェントと重ならないように、移動先の候補を押し戻す
+		void resolve(size_t index, Array<uint32>& neighbors);
+
+		// 移動先の候補に向かって、ナビメッシュに沿って移動させる
+		void move(NavMesh::NavMeshDetail::QueryContext& context, size_t index);
+	};
+}
@@ -9,12 +9,178 @@
 //
 //-----------------------------------------------
 
+# include <bit>
+# include <Siv3D/Threading.hpp>
 # include "NavMeshDetail.hpp"
 
 namespace s3d
 {
 	namespace detail
 	{
+		// 1 回のタスクで計算する経路の数
+		static constexpr size_t NavMeshQueryGrainSize = 16;
+
+		// dtPolyRef (32-bit) のうち、タイル番号とポリゴン番号に使えるビット数
+		static constexpr int32 NavMeshTileAndPolyBits = 22;
+
+		static constexpr int32 NavMeshMaxTileBits = 14;
+
+		// toBlob() で書き出すデータの形式
+		static constexpr uint32 NavMeshBlobMagic = 0x4D4E3353; // "S3NM"
+
+		static constexpr uint32 NavMeshBlobVersion = 1;
+
+		struct NavMeshBlobHeader
+		{
+			uint32 magic;
+
+			uint32 version;
+
+			int32 tileCount;
+
+			dtNavMeshParams params;
+		};
+
+		struct NavMeshBlobTileHeader
+		{
+			dtTileRef tileRef;
+
+			int32 dataSize;
+		};
+
+		template <class Type>
+		using RecastPtr = std::unique_ptr<Type, void(*)(Type*)>;
+
+		// dtNavMesh::init() に渡すパラメータが、buildTiles() と同じく dtPolyRef のビット数に収まっているか
+		[[nodiscard]]
+		static bool IsValidNavMeshParams(const dtNavMeshParams& params, const int32 tileCount) noexcept
+		{
+			if ((params.maxTiles <= 0)
+				|| (params.maxPolys <= 0)
+				|| (params.maxTiles < tileCount))
+			{
+				return false;
+			}
+
+			const int32 tileBits = (std::bit_width(std::bit_ceil(static_cast<uint32>(params.maxTiles))) - 1);
+			const int32 polyBits = (std::bit_width(std::bit_ceil(static_cast<uint32>(params.maxPolys))) - 1);
+
+			return ((tileBits <= NavMeshMaxTileBits)
+				&& ((tileBits + polyBits) <= NavMeshTileAndPolyBits));
+		}
+
+		[[nodiscard]]
+		inline constexpr int64 Align4(const int64 size) noexcept
+		{
+			return ((size + 3) & ~int64{ 3 });
+		}
+
+		// タイルのデータが、ヘッダに記録されている要素数どおりの大きさと内容であるか。
+		// dtNavMesh::addTile() はマジックナンバーとバージョンしか調べず、ヘッダの要素数を信用してデータを読むため、事前に確かめる
+		[[nodiscard]]
+		static bool IsValidTileData(const unsigned char* data, const int32 dataSize, const int32 maxPolys)
+		{
+			if (dataSize < static_cast<int32>(sizeof(dtMeshHeader)))
+			{
+				return false;
+			}
+
+			dtMeshHeader header;
+			std::memcpy(&header, data, sizeof(header));
+
+			if ((header.magic != DT_NAVMESH_MAGIC)
+				|| (header.version != DT_NAVMESH_VERSION)
+				|| (header.polyCount < 0) || (maxPolys < header.polyCount)
+				|| (header.vertCount < 0)
+				|| (header.maxLinkCount <= 0)
+				|| (header.detailMeshCount < 0)
+				|| (header.detailVertCount < 0)
+				|| (header.detailTriCount < 0)
+				|| (header.bvNodeCount < 0)
+				|| (header.offMeshConCount < 0)
+				|| (header.offMeshBase < 0)
+				|| (header.polyCount < (static_cast<int64>(header.offMeshBase) + header.offMeshConCount))
+				|| (header.detailMeshCount < header.offMeshBase))
+			{
+				return false;
+			}
+
+			// dtNavMesh::addTile() と同じ配置で、各領域の大きさを求める
+			const int64 headerSize			= Align4(sizeof(dtMeshHeader));
+			const int64 vertsSize			= Align4(sizeof(float) * 3 * static_cast<int64>(header.vertCount));
+			const int64 polysSize			= Align4(sizeof(dtPoly) * static_cast<int64>(header.polyCount));
+			const int64 linksSize			= Align4(sizeof(dtLink) * static_cast<int64>(header.maxLinkCount));
+			const int64 detailMeshesSize	= Align4(sizeof(dtPolyDetail) * static_cast<int64>(header.detailMeshCount));
+			const int64 detailVertsSize		= Align4(sizeof(float) * 3 * static_cast<int64>(header.detailVertCount));
+			const int64 detailTrisSize		= Align4(sizeof(unsigned char) * 4 * static_cast<int64>(header.detailTriCount));
+			const int64 bvtreeSize			= Align4(sizeof(dtBVNode) * static_cast<int64>(header.bvNodeCount));
+			const int64 offMeshLinksSize	= Align4(sizeof(dtOffMeshConnection) * static_cast<int64>(header.offMeshConCount));
+
+			if ((headerSize + vertsSize + polysSize + linksSize + detailMeshesSize + detailVertsSize + detailTrisSize + bvtreeSize + offMeshLinksSize) != dataSize)
+			{
+				return false;
+			}
+
+			// 各領域は 4 バイト境界に揃っていて、dtAlloc() で確保したデータはそれ以上に揃っている
+			const dtPoly* polys = reinterpret_cast<const dtPoly*>(data + headerSize + vertsSize);
+			const dtPolyDetail* detailMeshes = reinterpret_cast<const dtPolyDetail*>(data + headerSize + vertsSize + polysSize + linksSize);
+			const unsigned char* detailTris = (data + headerSize + vertsSize + polysSize + linksSize + detailMeshesSize + detailVertsSize);
+			const dtOffMeshConnection* offMeshCons = reinterpret_cast<const dtOffMeshConnection*>(data + (dataSize - offMeshLinksSize));
+
+			for (int32 i = 0; i < header.polyCount; ++i)
+			{
+				const dtPoly& poly = polys[i];
+
+				if ((poly.vertCount == 0) || (DT_VERTS_PER_POLYGON < poly.vertCount))
+				{
+					return false;
+				}
+
+				for (int32 k = 0; k < poly.vertCount; ++k)
+				{
+					// 隣接するポリゴンの番号は 1 始まり。DT_EXT_LINK が立っている場合は他のタイルとの境界
+					if ((header.vertCount <= poly.verts[k])
+						|| ((not (poly.neis[k] & DT_EXT_LINK)) && (header.polyCount < poly.neis[k])))
+					{
+						return false;
+					}
+				}
+			}
+
+			for (int32 i = 0; i < header.offMeshBase; ++i)
+			{
+				const dtPolyDetail& detailMesh = detailMeshes[i];
+
+				if ((header.detailVertCount < (static_cast<int64>(detailMesh.vertBase) + detailMesh.vertCount))
+					|| (header.detailTriCount < (static_cast<int64>(detailMesh.triBase) + detailMesh.triCount)))
+				{
+					return false;
+				}
+
+				const int32 numVertices = (polys[i].vertCount + detailMesh.vertCount);
+
+				for (int32 t = 0; t < detailMesh.triCount; ++t)
+				{
+					const unsigned char* tri = (detailTris + (static_cast<size_t>(detailMesh.triBase) + t) * 4);
+
+					if ((numVertices <= tri[0]) || (numVertices <= tri[1]) || (numVertices <= tri[2]))
+					{
+						return false;
+					}
+				}
+			}
+
+			for (int32 i = 0; i < header.offMeshConCount; ++i)
+			{
+				if (header.polyCount <= offMeshCons[i].poly)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
 		[[nodiscard]]
 		static NavMeshAABB CalculateAABB(const Array<Float2>& vertices) noexcept
 		{
@@ -105,6 +271,161 @@ namespace s3d
 
 			return cfg;
 		}
+
+		[[nodiscard]]
+		static dtQueryFilter MakeQueryFilter(const Array<std::pair<int32, double>>& areaCosts)
+		{
+			dtQueryFilter filter;
+
+			for (const auto& areaCost : areaCosts)
+			{
+				if (areaCost.first <= RC_WALKABLE_AREA)
+				{
+					filter.setAreaCost(areaCost.first, static_cast<float>(areaCost.second));
+				}
+			}
+
+			return filter;
+		}
+
+		static void CopyPath(const Float3* pSrc, const int32 nvertices, Array<Vec2>& dst)
+		{
+			dst.resize(nvertices);
+
+			const Float3* pSrcEnd = (pSrc + nvertices);
+			Vec2* pDst = dst.data();
+
+			while (pSrc != pSrcEnd)
+			{
+				pDst->set(pSrc->x, pSrc->z);
+				++pDst;
+				++pSrc;
+			}
+		}
+
+		static void CopyPath(const Float3* pSrc, const int32 nvertices, Array<Vec3>& dst)
+		{
+			dst.resize(nvertices);
+
+			const Float3* pSrcEnd = (pSrc + nvertices);
+			Vec3* pDst = dst.data();
+
+			while (pSrc != pSrcEnd)
+			{
+				*pDst++ = *pSrc++;
+			}
+		}
+
+		// cfg の範囲のタイル 1 枚分のナビメッシュのデータを構築する
+		// 範囲内に歩行可能な領域がなかった場合は、navData を nullptr のまま true を返す
+		[[nodiscard]]
+		static bool BuildTileData(const rcConfig& cfg, const int32 tileX, const int32 tileY,
+			const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs,
+			unsigned char*& navData, int32& navDataSize)
+		{
+			rcContext ctx;
+
+			RecastPtr<rcHeightfield> hf{ rcAllocHeightfield(), rcFreeHeightField };
+			RecastPtr<rcCompactHeightfield> chf{ rcAllocCompactHeightfield(), rcFreeCompactHeightfield };
+			RecastPtr<rcContourSet> cset{ rcAllocContourSet(), rcFreeContourSet };
+			RecastPtr<rcPolyMesh> mesh{ rcAllocPolyMesh(), rcFreePolyMesh };
+			RecastPtr<rcPolyMeshDetail> dmesh{ rcAllocPolyMeshDetail(), rcFreePolyMeshDetail };
+
+			if ((not hf) || (not chf) || (not cset) || (not mesh) || (not dmesh))
+			{
+				return false;
+			}
+
+			if (not rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch))
+			{
+				return false;
+			}
+
+			const int32 flagMergeThreshold = 0;
+
+			rcRasterizeTriangles(&ctx, &vertices[0].x, static_cast<int32>(vertices.size()),
+				&(indices.front().i0), areaIDs.data(), static_cast<int32>(areaIDs.size()), *hf, flagMergeThreshold);
+
+			rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+			rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+			rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+
+			if (not rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf))
+			{
+				return false;
+			}
+
+			hf.reset();
+
+			if (not rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf))
+			{
+				return false;
+			}
+
+			if (not rcBuildDistanceField(&ctx, *chf))
+			{
+				return false;
+			}
+
+			if (not rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea))
+			{
+				return false;
+			}
+
+			if (not rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset))
+			{
+				return false;
+			}
+
+			if (not rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *mesh))
+			{
+				return false;
+			}
+
+			if (not rcBuildPolyMeshDetail(&ctx, *mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *dmesh))
+			{
+				return false;
+			}
+
+			if (mesh->npolys == 0)
+			{
+				return true;
+			}
+
+			for (int32 i = 0; i < mesh->npolys; ++i)
+			{
+				mesh->flags[i] = 1;
+			}
+
+			dtNavMeshCreateParams params;
+			std::memset(&params, 0, sizeof(params));
+
+			params.verts		= mesh->verts;
+			params.vertCount	= mesh->nverts;
+			params.polys		= mesh->polys;
+			params.polyAreas	= mesh->areas;
+			params.polyFlags	= mesh->flags;
+			params.polyCount	= mesh->npolys;
+			params.nvp			= mesh->nvp;
+
+			params.detailMeshes		= dmesh->meshes;
+			params.detailVerts		= dmesh->verts;
+			params.detailVertsCount	= dmesh->nverts;
+			params.detailTris		= dmesh->tris;
+			params.detailTriCount	= dmesh->ntris;
+
+			params.walkableHeight	= static_cast<float>(cfg.walkableHeight);
+			params.walkableClimb	= static_cast<float>(cfg.walkableClimb);
+			params.tileX			= tileX;
+			params.tileY			= tileY;
+			rcVcopy(params.bmin, mesh->bmin);
+			rcVcopy(params.bmax, mesh->bmax);
+			params.cs = cfg.cs;
+			params.ch = cfg.ch;
+			params.buildBvTree = true;
+
+			return dtCreateNavMeshData(&params, &navData, &navDataSize);
+		}
 	}
 
 	NavMesh::NavMeshDetail::NavMeshDetail()
@@ -146,14 +467,22 @@ namespace s3d
 		try
 		{
 			const Array<Float3> vertex3 = vertices.map([](const Float2& v) { return Float3{ v.x, 0.0f, v.y }; });
-			build(config, detail::CalculateAABB(vertices), vertex3, indices, areaIDs);
+			const NavMeshAABB aabb = detail::CalculateAABB(vertices);
+
+			if (0 < config.tileSize)
+			{
+				return buildTiles(config, aabb, vertex3, indices, areaIDs);
+			}
+			else
+			{
+				return build(config, aabb, vertex3, indices, areaIDs);
+			}
 		}
 		catch (...)
 		{
+			release();
 			return false;
 		}
-
-		return true;
 	}
 
 	bool NavMesh::NavMeshDetail::build(const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs, const NavMeshConfig& config)
@@ -179,14 +508,22 @@ namespace s3d
 
 		try
 		{
-			build(config, detail::CalculateAABB(vertices), vertices, indices, areaIDs);
+			const NavMeshAABB aabb = detail::CalculateAABB(vertices);
+
+			if (0 < config.tileSize)
+			{
+				return buildTiles(config, aabb, vertices, indices, areaIDs);
+			}
+			else
+			{
+				return build(config, aabb, vertices, indices, areaIDs);
+			}
 		}
 		catch (...)
 		{
+			release();
 			return false;
 		}
-
-		return true;
 	}
 
 	void NavMesh::NavMeshDetail::query(const Float2& _start, const Float2& _end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec2>& dst) const
@@ -198,176 +535,235 @@ namespace s3d
 			return;
 		}
 
-		dtQueryFilter filter;
-		{
-			for (const auto& areaCost : areaCosts)
-			{
-				if (areaCost.first <= RC_WALKABLE_AREA)
-				{
-					filter.setAreaCost(areaCost.first, static_cast<float>(areaCost.second));
-				}
-			}
-		}
-
+		const dtQueryFilter filter = detail::MakeQueryFilter(areaCosts);
 		const Float3 start{ _start.x, 0.0f, _start.y }, end{ _end.x, 0.0f, _end.y };
 		constexpr Float3 extent{ 2.0f, 0.0f, 2.0f };
 
-		dtPolyRef startpoly;
+		if (auto context = acquireQueryContext())
 		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, 0)))
-			{
-				return;
-			}
-
-			if (startpoly == 0)
-			{
-				return;
-			}
+			const int32 nvertices = findPath(*context, start, end, extent, filter);
+			detail::CopyPath(context->buffer.data(), nvertices, dst);
 		}
+	}
 
-		dtPolyRef endpoly;
+	void NavMesh::NavMeshDetail::query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec3>& dst) const
+	{
+		dst.clear();
+
+		if (not m_built)
 		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, 0)))
-			{
-				return;
-			}
+			return;
+		}
 
-			if (endpoly == 0)
-			{
-				return;
-			}
+		const dtQueryFilter filter = detail::MakeQueryFilter(areaCosts);
+		constexpr Float3 extent{ 2.0f, 4.0f, 2.0f };
+
+		if (auto context = acquireQueryContext())
+		{
+			const int32 nvertices = findPath(*context, start, end, extent, filter);
+			detail::CopyPath(context->buffer.data(), nvertices, dst);
 		}
+	}
 
-		int32 npolys = 0;
+	void NavMesh::NavMeshDetail::query(const Array<std::pair<Vec2, Vec2>>& startEnds, const Array<std::pair<int32, double>>& areaCosts, Array<Array<Vec2>>& dst) const
+	{
+		dst.resize(startEnds.size());
+
+		if (not m_built)
 		{
-			if (dtStatusFailed(m_data.navmeshQuery.findPath(startpoly, endpoly, &start.x, &end.x, &filter, m_polygonBuffer.data(), &npolys, PolygonBufferSize)))
+			for (auto& path : dst)
 			{
-				return;
+				path.clear();
 			}
 
-			if (npolys <= 0)
-			{
-				return;
-			}
+			return;
 		}
 
-		float end2[3] = { end.x, end.y, end.z };
-
-		if (m_polygonBuffer[static_cast<size_t>(npolys) - 1] != endpoly)
-		{
-			bool posOverPoly;
-			m_data.navmeshQuery.closestPointOnPoly(m_polygonBuffer[static_cast<size_t>(npolys) - 1], &end.x, end2, &posOverPoly);
-		}
+		const dtQueryFilter filter = detail::MakeQueryFilter(areaCosts);
+		constexpr Float3 extent{ 2.0f, 0.0f, 2.0f };
 
+		// 作業領域はタスクごとに 1 つ取り出し、その範囲の経路の計算に使い回す
+		Threading::detail::ParallelForRange(0, startEnds.size(), detail::NavMeshQueryGrainSize, [&](const size_t begin, const size_t end)
 		{
-			int32 nvertices = 0;
-			m_data.navmeshQuery.findStraightPath(&start.x, end2, m_polygonBuffer.data(), npolys, &m_buffer[0].x, 0, 0, &nvertices, MaxVertices);
+			auto context = acquireQueryContext();
 
-			if (nvertices)
+			for (size_t i = begin; i < end; ++i)
 			{
-				dst.resize(nvertices);
-
-				const Float3* pSrc = m_buffer.data();
-				const Float3* pSrcEnd = (pSrc + nvertices);
-				Vec2* pDst = dst.data();
+				Array<Vec2>& path = dst[i];
+				path.clear();
 
-				while (pSrc != pSrcEnd)
+				if (not context)
 				{
-					pDst->set(pSrc->x, pSrc->z);
-					++pDst;
-					++pSrc;
+					continue;
 				}
+
+				const Float2 start = startEnds[i].first, goal = startEnds[i].second;
+				const int32 nvertices = findPath(*context, Float3{ start.x, 0.0f, start.y }, Float3{ goal.x, 0.0f, goal.y }, extent, filter);
+				detail::CopyPath(context->buffer.data(), nvertices, path);
 			}
-		}
+		});
 	}
 
-	void NavMesh::NavMeshDetail::query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec3>& dst) const
+	void NavMesh::NavMeshDetail::query(const Array<std::pair<Vec3, Vec3>>& startEnds, const Array<std::pair<int32, double>>& areaCosts, Array<Array<Vec3>>& dst) const
 	{
-		dst.clear();
+		dst.resize(startEnds.size());
 
 		if (not m_built)
 		{
+			for (auto& path : dst)
+			{
+				path.clear();
+			}
+
 			return;
 		}
 
-		dtQueryFilter filter;
+		const dtQueryFilter filter = detail::MakeQueryFilter(areaCosts);
+		constexpr Float3 extent{ 2.0f, 4.0f, 2.0f };
+
+		// 作業領域はタスクごとに 1 つ取り出し、その範囲の経路の計算に使い回す
+		Threading::detail::ParallelForRange(0, startEnds.size(), detail::NavMeshQueryGrainSize, [&](const size_t begin, const size_t end)
 		{
-			for (const auto& areaCost : areaCosts)
+			auto context = acquireQueryContext();
+
+			for (size_t i = begin; i < end; ++i)
 			{
-				if (areaCost.first <= RC_WALKABLE_AREA)
+				Array<Vec3>& path = dst[i];
+				path.clear();
+
+				if (not context)
 				{
-					filter.setAreaCost(areaCost.first, static_cast<float>(areaCost.second));
+					continue;
 				}
+
+				const int32 nvertices = findPath(*context, Float3{ startEnds[i].first }, Float3{ startEnds[i].second }, extent, filter);
+				detail::CopyPath(context->buffer.data(), nvertices, path);
 			}
+		});
+	}
+
+	Blob NavMesh::NavMeshDetail::toBlob() const
+	{
+		if (not m_built)
+		{
+			return{};
 		}
 
-		constexpr Float3 extent{ 2.0f, 4.0f, 2.0f };
+		const dtNavMesh& navmesh = *m_navmesh;
 
-		dtPolyRef startpoly;
+		detail::NavMeshBlobHeader header
 		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, 0)))
-			{
-				return;
-			}
+			.magic		= detail::NavMeshBlobMagic,
+			.version	= detail::NavMeshBlobVersion,
+			.tileCount	= 0,
+			.params		= *navmesh.getParams(),
+		};
 
-			if (startpoly == 0)
-			{
-				return;
-			}
-		}
+		size_t dataSize = sizeof(header);
 
-		dtPolyRef endpoly;
+		for (int32 i = 0; i < navmesh.getMaxTiles(); ++i)
 		{
-			if (dtStatusFailed(m_data.navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, 0)))
+			if (const dtMeshTile* tile = navmesh.getTile(i);
+				tile && tile->header && tile->dataSize)
 			{
-				return;
+				++header.tileCount;
+				dataSize += (sizeof(detail::NavMeshBlobTileHeader) + tile->dataSize);
 			}
+		}
 
-			if (endpoly == 0)
+		Blob blob{ Arg::reserve = dataSize };
+		blob.append(&header, sizeof(header));
+
+		for (int32 i = 0; i < navmesh.getMaxTiles(); ++i)
+		{
+			if (const dtMeshTile* tile = navmesh.getTile(i);
+				tile && tile->header && tile->dataSize)
 			{
-				return;
+				const detail::NavMeshBlobTileHeader tileHeader{ navmesh.getTileRef(tile), tile->dataSize };
+				blob.append(&tileHeader, sizeof(tileHeader));
+				blob.append(tile->data, tile->dataSize);
 			}
 		}
 
-		int32 npolys = 0;
+		return blob;
+	}
+
+	bool NavMesh::NavMeshDetail::load(const Blob& blob)
+	{
+		release();
+
+		const Byte* pSrc = blob.data();
+		size_t remaining = blob.size();
+
+		const auto read = [&](void* dst, const size_t size)
 		{
-			if (dtStatusFailed(m_data.navmeshQuery.findPath(startpoly, endpoly, &start.x, &end.x, &filter, m_polygonBuffer.data(), &npolys, PolygonBufferSize)))
+			if (remaining < size)
 			{
-				return;
+				return false;
 			}
 
-			if (npolys <= 0)
-			{
-				return;
-			}
+			std::memcpy(dst, pSrc, size);
+			pSrc += size;
+			remaining -= size;
+			return true;
+		};
+
+		detail::NavMeshBlobHeader header;
+
+		if ((not read(&header, sizeof(header)))
+			|| (header.magic != detail::NavMeshBlobMagic)
+			|| (header.version != detail::NavMeshBlobVersion)
+			|| (header.tileCount <= 0)
+			|| (not detail::IsValidNavMeshParams(header.params, header.tileCount)))
+		{
+			return false;
 		}
 
-		float end2[3] = { end.x, end.y, end.z };
+		std::shared_ptr<dtNavMesh> navmesh{ dtAllocNavMesh(), dtFreeNavMesh };
 
-		if (m_polygonBuffer[static_cast<size_t>(npolys) - 1] != endpoly)
+		if ((not navmesh)
+			|| dtStatusFailed(navmesh->init(&header.params)))
 		{
-			bool posOverPoly;
-			m_data.navmeshQuery.closestPointOnPoly(m_polygonBuffer[static_cast<size_t>(npolys) - 1], &end.x, end2, &posOverPoly);
+			return false;
 		}
 
+		for (int32 i = 0; i < header.tileCount; ++i)
 		{
-			int32 nvertices = 0;
-			m_data.navmeshQuery.findStraightPath(&start.x, end2, m_polygonBuffer.data(), npolys, &m_buffer[0].x, 0, 0, &nvertices, MaxVertices);
+			detail::NavMeshBlobTileHeader tileHeader;
 
-			if (nvertices)
+			if ((not read(&tileHeader, sizeof(tileHeader)))
+				|| (tileHeader.dataSize <= 0)
+				|| (remaining < static_cast<size_t>(tileHeader.dataSize)))
 			{
-				dst.resize(nvertices);
+				return false;
+			}
 
-				const Float3* pSrc = m_buffer.data();
-				const Float3* pSrcEnd = (pSrc + nvertices);
-				Vec3* pDst = dst.data();
+			unsigned char* data = static_cast<unsigned char*>(dtAlloc(tileHeader.dataSize, DT_ALLOC_PERM));
 
-				while (pSrc != pSrcEnd)
-				{
-					*pDst++ = *pSrc++;
-				}
+			if (not data)
+			{
+				return false;
+			}
+
+			read(data, tileHeader.dataSize);
+
+			if (not detail::IsValidTileData(data, tileHeader.dataSize, header.params.maxPolys))
+			{
+				dtFree(data);
+				return false;
+			}
+
+			// 成功した場合、data は navmesh が解放する
+			if (dtStatusFailed(navmesh->addTile(data, tileHeader.dataSize, DT_TILE_FREE_DATA, tileHeader.tileRef, nullptr)))
+			{
+				dtFree(data);
+				return false;
 			}
 		}
+
+		m_navmesh = std::move(navmesh);
+
+		return initQueryPool();
 	}
 
 	bool NavMesh::NavMeshDetail::build(const NavMeshConfig& config, const NavMeshAABB& aabb,
@@ -375,195 +771,321 @@ namespace s3d
 	{
 		assert(not m_built);
 
-		init();
-
 		const rcConfig cfg = detail::MakeConfig(config, aabb);
 
-		if (not rcCreateHeightfield(&m_data.ctx, *m_data.hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch))
+		unsigned char* navData = nullptr;
+		int32 navDataSize = 0;
+
+		if ((not detail::BuildTileData(cfg, 0, 0, vertices, indices, areaIDs, navData, navDataSize))
+			|| (not navData))
 		{
 			return false;
 		}
 
-		const int32 flagMergeThreshold = 0;
-
-		rcRasterizeTriangles(&m_data.ctx, &vertices[0].x, static_cast<int32>(vertices.size()),
-			&(indices.front().i0), areaIDs.data(), static_cast<int32>(areaIDs.size()), *m_data.hf, flagMergeThreshold);
+		std::shared_ptr<dtNavMesh> navmesh{ dtAllocNavMesh(), dtFreeNavMesh };
 
-		rcFilterLowHangingWalkableObstacles(&m_data.ctx, cfg.walkableClimb, *m_data.hf);
-		rcFilterLedgeSpans(&m_data.ctx, cfg.walkableHeight, cfg.walkableClimb, *m_data.hf);
-		rcFilterWalkableLowHeightSpans(&m_data.ctx, cfg.walkableHeight, *m_data.hf);
-
-		if (not rcBuildCompactHeightfield(&m_data.ctx, cfg.walkableHeight, cfg.walkableClimb, *m_data.hf, *m_data.chf))
+		// 成功した場合、navData は navmesh が解放する
+		if ((not navmesh)
+			|| dtStatusFailed(navmesh->init(navData, navDataSize, DT_TILE_FREE_DATA)))
 		{
+			dtFree(navData);
 			return false;
 		}
 
-		if (not rcErodeWalkableArea(&m_data.ctx, cfg.walkableRadius, *m_data.chf))
+		m_navmesh = std::move(navmesh);
+
+		return initQueryPool();
+	}
+
+	bool NavMesh::NavMeshDetail::buildTiles(const NavMeshConfig& config, const NavMeshAABB& aabb,
+		const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs)
+	{
+		assert(not m_built);
+
+		rcConfig cfg = detail::MakeConfig(config, aabb);
+		cfg.tileSize	= config.tileSize;
+		cfg.borderSize	= (cfg.walkableRadius + 3);
+		cfg.width		= (cfg.tileSize + cfg.borderSize * 2);
+		cfg.height		= (cfg.tileSize + cfg.borderSize * 2);
+
+		int32 gridWidth = 0, gridHeight = 0;
+		rcCalcGridSize(aabb.bmin, aabb.bmax, cfg.cs, &gridWidth, &gridHeight);
+
+		const int32 tilesX = Max(((gridWidth + cfg.tileSize - 1) / cfg.tileSize), 1);
+		const int32 tilesY = Max(((gridHeight + cfg.tileSize - 1) / cfg.tileSize), 1);
+		const int32 tileCount = (tilesX * tilesY);
+		const int32 tileBits = (std::bit_width(std::bit_ceil(static_cast<uint32>(tileCount))) - 1);
+
+		if (detail::NavMeshMaxTileBits < tileBits)
 		{
 			return false;
 		}
 
-		if (not rcBuildDistanceField(&m_data.ctx, *m_data.chf))
+		const float tileWidth = (cfg.tileSize * cfg.cs);
+		const float borderWidth = (cfg.borderSize * cfg.cs);
+
+		dtNavMeshParams params;
+		rcVcopy(params.orig, aabb.bmin);
+		params.tileWidth	= tileWidth;
+		params.tileHeight	= tileWidth;
+		params.maxTiles		= tileCount;
+		params.maxPolys		= (1 << (detail::NavMeshTileAndPolyBits - tileBits));
+
+		// 各三角形を、境界部分を含めて重なるタイルに振り分ける
+		Array<Array<TriangleIndex>> tileIndices(tileCount);
+		Array<Array<uint8>> tileAreaIDs(tileCount);
+
+		for (size_t i = 0; i < indices.size(); ++i)
 		{
-			return false;
+			const TriangleIndex& triangle = indices[i];
+			const Float3& v0 = vertices[triangle.i0];
+			const Float3& v1 = vertices[triangle.i1];
+			const Float3& v2 = vertices[triangle.i2];
+
+			const float minX = (Min({ v0.x, v1.x, v2.x }) - borderWidth - aabb.bmin[0]);
+			const float maxX = (Max({ v0.x, v1.x, v2.x }) + borderWidth - aabb.bmin[0]);
+			const float minZ = (Min({ v0.z, v1.z, v2.z }) - borderWidth - aabb.bmin[2]);
+			const float maxZ = (Max({ v0.z, v1.z, v2.z }) + borderWidth - aabb.bmin[2]);
+
+			const int32 x0 = Clamp(static_cast<int32>(std::floor(minX / tileWidth)), 0, (tilesX - 1));
+			const int32 x1 = Clamp(static_cast<int32>(std::floor(maxX / tileWidth)), 0, (tilesX - 1));
+			const int32 y0 = Clamp(static_cast<int32>(std::floor(minZ / tileWidth)), 0, (tilesY - 1));
+			const int32 y1 = Clamp(static_cast<int32>(std::floor(maxZ / tileWidth)), 0, (tilesY - 1));
+
+			for (int32 y = y0; y <= y1; ++y)
+			{
+				for (int32 x = x0; x <= x1; ++x)
+				{
+					const size_t tileIndex = (static_cast<size_t>(y) * tilesX + x);
+					tileIndices[tileIndex] << triangle;
+					tileAreaIDs[tileIndex] << areaIDs[i];
+				}
+			}
 		}
 
-		if (not rcBuildRegions(&m_data.ctx, *m_data.chf, 0 /* border size */, cfg.minRegionArea, cfg.mergeRegionArea))
+		struct TileData
 		{
-			return false;
-		}
+			unsigned char* data = nullptr;
+
+			int32 dataSize = 0;
+
+			bool succeeded = false;
+		};
 
-		if (not rcBuildContours(&m_data.ctx, *m_data.chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *m_data.cset))
+		Array<TileData> tiles(tileCount);
+
+		// タイルは互いに独立しているので、並列に構築できる
+		Threading::detail::ParallelForRange(0, tiles.size(), 1, [&](const size_t begin, const size_t end)
 		{
-			return false;
-		}
+			for (size_t i = begin; i < end; ++i)
+			{
+				TileData& tile = tiles[i];
+
+				if (not tileIndices[i])
+				{
+					tile.succeeded = true;
+					continue;
+				}
+
+				const int32 tileX = static_cast<int32>(i % tilesX);
+				const int32 tileY = static_cast<int32>(i / tilesX);
+
+				rcConfig tileConfig = cfg;
+				tileConfig.bmin[0] = (aabb.bmin[0] + tileX * tileWidth - borderWidth);
+				tileConfig.bmin[2] = (aabb.bmin[2] + tileY * tileWidth - borderWidth);
+				tileConfig.bmax[0] = (aabb.bmin[0] + (tileX + 1) * tileWidth + borderWidth);
+				tileConfig.bmax[2] = (aabb.bmin[2] + (tileY + 1) * tileWidth + borderWidth);
+
+				tile.succeeded = detail::BuildTileData(tileConfig, tileX, tileY, vertices, tileIndices[i], tileAreaIDs[i], tile.data, tile.dataSize);
+			}
+		});
+
+		// dtNavMesh へのタイルの追加はスレッドセーフではないので、まとめて行う
+		std::shared_ptr<dtNavMesh> navmesh{ dtAllocNavMesh(), dtFreeNavMesh };
+		bool succeeded = (navmesh && dtStatusSucceed(navmesh->init(&params)));
+		size_t numAddedTiles = 0;
 
-		if (not rcBuildPolyMesh(&m_data.ctx, *m_data.cset, cfg.maxVertsPerPoly, *m_data.mesh))
+		for (auto& tile : tiles)
 		{
-			return false;
+			succeeded &= tile.succeeded;
+
+			if (not tile.data)
+			{
+				continue;
+			}
+
+			// 成功した場合、data は navmesh が解放する
+			if (succeeded
+				&& (reinterpret_cast<const dtMeshHeader*>(tile.data)->polyCount <= params.maxPolys)
+				&& dtStatusSucceed(navmesh->addTile(tile.data, tile.dataSize, DT_TILE_FREE_DATA, 0, nullptr)))
+			{
+				++numAddedTiles;
+				continue;
+			}
+
+			succeeded = false;
+			dtFree(tile.data);
 		}
 
-		if (not rcBuildPolyMeshDetail(&m_data.ctx, *m_data.mesh, *m_data.chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *m_data.dmesh))
+		if ((not succeeded) || (numAddedTiles == 0))
 		{
 			return false;
 		}
 
-		const auto& mesh	= *m_data.mesh;
-		const auto& dmesh	= *m_data.dmesh;
+		m_navmesh = std::move(navmesh);
+
+		return initQueryPool();
+	}
 
-		for (int32 i = 0; i < mesh.npolys; ++i)
+	bool NavMesh::NavMeshDetail::initQueryPool()
+	{
+		if (auto context = acquireQueryContext())
 		{
-			mesh.flags[i] = 1;
+			m_built = true;
+			return true;
 		}
 
-		dtNavMeshCreateParams params;
-		std::memset(&params, 0, sizeof(params));
+		return false;
+	}
 
-		params.verts		= mesh.verts;
-		params.vertCount	= mesh.nverts;
-		params.polys		= mesh.polys;
-		params.polyAreas	= mesh.areas;
-		params.polyFlags	= mesh.flags;
-		params.polyCount	= mesh.npolys;
-		params.nvp			= mesh.nvp;
+	NavMesh::NavMeshDetail::ScopedQueryContext NavMesh::NavMeshDetail::acquireQueryContext() const
+	{
+		{
+			std::lock_guard lock{ m_queryPoolMutex };
 
-		params.detailMeshes		= dmesh.meshes;
-		params.detailVerts		= dmesh.verts;
-		params.detailVertsCount	= dmesh.nverts;
-		params.detailTris		= dmesh.tris;
-		params.detailTriCount	= dmesh.ntris;
+			if (m_queryPool)
+			{
+				std::unique_ptr<QueryContext> context = std::move(m_queryPool.back());
+				m_queryPool.pop_back();
+				return{ this, std::move(context) };
+			}
+		}
 
-		params.walkableHeight	= static_cast<float>(cfg.walkableHeight);
-		params.walkableClimb	= static_cast<float>(cfg.walkableClimb);
-		rcVcopy(params.bmin, mesh.bmin);
-		rcVcopy(params.bmax, mesh.bmax);
-		params.cs = cfg.cs;
-		params.ch = cfg.ch;
-		params.buildBvTree = true;
+		auto context = std::make_unique<QueryContext>();
 
-		if (not dtCreateNavMeshData(&params, &m_navData, &m_navDataSize))
+		if (dtStatusFailed(context->navmeshQuery.init(m_navmesh.get(), MaxSearchNodes)))
 		{
-			return false;
+			return{};
 		}
 
-		m_data.navmesh->init(m_navData, m_navDataSize, DT_TILE_FREE_DATA);
+		context->buffer.resize(MaxVertices);
+		context->polygonBuffer.resize(PolygonBufferSize);
 
-		if (dtStatusFailed(m_data.navmeshQuery.init(m_data.navmesh.get(), 2048)))
+		return{ this, std::move(context) };
+	}
+
+	void NavMesh::NavMeshDetail::releaseQueryContext(std::unique_ptr<QueryContext>&& context) const
+	{
+		std::lock_guard lock{ m_queryPoolMutex };
+
+		m_queryPool.push_back(std::move(context));
+	}
+
+	NavMesh::NavMeshDetail::ScopedQueryContext::ScopedQueryContext(const NavMeshDetail* owner, std::unique_ptr<QueryContext>&& context) noexcept
+		: m_owner{ owner }
+		, m_context{ std::move(context) } {}
+
+	NavMesh::NavMeshDetail::ScopedQueryContext::ScopedQueryContext(ScopedQueryContext&& other) noexcept
+		: m_owner{ std::exchange(other.m_owner, nullptr) }
+		, m_context{ std::move(other.m_context) } {}
+
+	NavMesh::NavMeshDetail::ScopedQueryContext::~ScopedQueryContext()
+	{
+		if ((not m_owner) || (not m_context))
 		{
-			return false;
+			return;
 		}
 
-		m_buffer.resize(MaxVertices);
+		// プールに戻せなかった作業領域は、そのまま破棄する
+		try
+		{
+			m_owner->releaseQueryContext(std::move(m_context));
+		}
+		catch (...) {}
+	}
 
-		m_polygonBuffer.resize(PolygonBufferSize);
+	NavMesh::NavMeshDetail::ScopedQueryContext::operator bool() const noexcept
+	{
+		return static_cast<bool>(m_context);
+	}
 
-		m_built = true;
+	NavMesh::NavMeshDetail::QueryContext& NavMesh::NavMeshDetail::ScopedQueryContext::operator *() const noexcept
+	{
+		return *m_context;
+	}
 
-		return true;
+	NavMesh::NavMeshDetail::QueryContext* NavMesh::NavMeshDetail::ScopedQueryContext::operator ->() const noexcept
+	{
+		return m_context.get();
 	}
 
-	void NavMesh::NavMeshDetail::init()
+	int32 NavMesh::NavMeshDetail::findPath(QueryContext& context, const Float3& start, const Float3& end, const Float3& extent, const dtQueryFilter& filter) const
 	{
-		try
+		const dtNavMeshQuery& navmeshQuery = context.navmeshQuery;
+		Array<dtPolyRef>& polygonBuffer = context.polygonBuffer;
+
+		dtPolyRef startpoly;
 		{
-			if (m_data.hf = rcAllocHeightfield(); 
-				not m_data.hf)
+			if (dtStatusFailed(navmeshQuery.findNearestPoly(&start.x, &extent.x, &filter, &startpoly, 0)))
 			{
-				throw std::bad_alloc();
+				return 0;
 			}
 
-			if (m_data.chf = rcAllocCompactHeightfield();
-				not m_data.chf)
+			if (startpoly == 0)
 			{
-				throw std::bad_alloc();
+				return 0;
 			}
+		}
 
-			if (m_data.cset = rcAllocContourSet(); 
-				not m_data.cset)
+		dtPolyRef endpoly;
+		{
+			if (dtStatusFailed(navmeshQuery.findNearestPoly(&end.x, &extent.x, &filter, &endpoly, 0)))
 			{
-				throw std::bad_alloc();
+				return 0;
 			}
 
-			if (m_data.mesh = rcAllocPolyMesh();
-				not m_data.mesh)
+			if (endpoly == 0)
 			{
-				throw std::bad_alloc();
+				return 0;
 			}
+		}
 
-			if (m_data.dmesh = rcAllocPolyMeshDetail();
-				not m_data.dmesh)
+		int32 npolys = 0;
+		{
+			if (dtStatusFailed(navmeshQuery.findPath(startpoly, endpoly, &start.x, &end.x, &filter, polygonBuffer.data(), &npolys, PolygonBufferSize)))
 			{
-				throw std::bad_alloc();
+				return 0;
 			}
 
-			m_data.navmesh = std::shared_ptr<dtNavMesh>(dtAllocNavMesh(), dtFreeNavMesh);
+			if (npolys <= 0)
+			{
+				return 0;
+			}
 		}
-		catch (...)
-		{
-			release();
 
-			throw;
-		}
-	}
+		float end2[3] = { end.x, end.y, end.z };
 
-	void NavMesh::NavMeshDetail::release()
-	{
-		if (not m_built)
+		if (polygonBuffer[static_cast<size_t>(npolys) - 1] != endpoly)
 		{
-			return;
+			bool posOverPoly;
+			navmeshQuery.closestPointOnPoly(polygonBuffer[static_cast<size_t>(npolys) - 1], &end.x, end2, &posOverPoly);
 		}
 
-		m_data.navmesh.reset();
+		int32 nvertices = 0;
+		navmeshQuery.findStraightPath(&start.x, end2, polygonBuffer.data(), npolys, &context.buffer[0].x, 0, 0, &nvertices, MaxVertices);
 
-		if (m_data.dmesh)
-		{
-			rcFreePolyMeshDetail(m_data.dmesh);
-			m_data.dmesh = nullptr;
-		}
-
-		if (m_data.mesh)
-		{
-			rcFreePolyMesh(m_data.mesh);
-			m_data.mesh = nullptr;
-		}
+		return nvertices;
+	}
 
-		if (m_data.cset)
+	void NavMesh::NavMeshDetail::release()
+	{
 		{
-			rcFreeContourSet(m_data.cset);
-			m_data.cset = nullptr;
-		}
+			std::lock_guard lock{ m_queryPoolMutex };
 
-		if (m_data.chf)
-		{
-			rcFreeCompactHeightfield(m_data.chf);
-			m_data.chf = nullptr;
+			m_queryPool.clear();
 		}
 
-		if (m_data.hf)
-		{
-			rcFreeHeightField(m_data.hf);
-			m_data.hf = nullptr;
-		}
+		m_navmesh.reset();
 
 		m_built = false;
 	}
@@ -11,6 +11,7 @@
 
 # pragma once
 # include <cfloat>
+# include <mutex>
 # include <Siv3D/NavMesh.hpp>
 # include <RecastDetour/Recast.h>
 # include <RecastDetour/DetourCommon.h>
@@ -31,6 +32,47 @@ namespace s3d
 	{
 	public:
 
+		// 経路の計算に使う作業領域。同時に計算するスレッドの数だけ作られ、使い回される（NavMeshCrowd と共有する）
+		struct QueryContext
+		{
+			dtNavMeshQuery navmeshQuery;
+
+			Array<Float3> buffer;
+
+			Array<dtPolyRef> polygonBuffer;
+		};
+
+		// acquireQueryContext() が取り出した作業領域。破棄されるときに作業領域をプールに返す
+		class ScopedQueryContext
+		{
+		public:
+
+			ScopedQueryContext() = default;
+
+			ScopedQueryContext(const NavMeshDetail* owner, std::unique_ptr<QueryContext>&& context) noexcept;
+
+			ScopedQueryContext(ScopedQueryContext&& other) noexcept;
+
+			~ScopedQueryContext();
+
+			ScopedQueryContext& operator =(ScopedQueryContext&&) = delete;
+
+			[[nodiscard]]
+			explicit operator bool() const noexcept;
+
+			[[nodiscard]]
+			QueryContext& operator *() const noexcept;
+
+			[[nodiscard]]
+			QueryContext* operator ->() const noexcept;
+
+		private:
+
+			const NavMeshDetail* m_owner = nullptr;
+
+			std::unique_ptr<QueryContext> m_context;
+		};
+
 		NavMeshDetail();
 
 		~NavMeshDetail();
@@ -45,46 +87,48 @@ namespace s3d
 
 		void query(const Float3& start, const Float3& end, const Array<std::pair<int32, double>>& areaCosts, Array<Vec3>& dst) const;
 
-	private:
-
-		static constexpr int32 MaxVertices = 8192;
-
-		static constexpr int32 PolygonBufferSize = 8192;
-
-		struct Data
-		{
-			rcContext ctx;
-
-			rcHeightfield* hf = nullptr;
+		void query(const Array<std::pair<Vec2, Vec2>>& startEnds, const Array<std::pair<int32, double>>& areaCosts, Array<Array<Vec2>>& dst) const;
 
-			rcCompactHeightfield* chf = nullptr;
+		void query(const Array<std::pair<Vec3, Vec3>>& startEnds, const Array<std::pair<int32, double>>& areaCosts, Array<Array<Vec3>>& dst) const;
 
-			rcContourSet* cset = nullptr;
+		[[nodiscard]]
+		Blob toBlob() const;
 
-			rcPolyMesh* mesh = nullptr;
+		bool load(const Blob& blob);
 
-			rcPolyMeshDetail* dmesh = nullptr;
+		// 作業領域を 1 つ取り出す。空いているものがなければ新しく作る。作れなかった場合は空の ScopedQueryContext を返す
+		[[nodiscard]]
+		ScopedQueryContext acquireQueryContext() const;
 
-			std::shared_ptr<dtNavMesh> navmesh;
+	private:
 
-			dtNavMeshQuery navmeshQuery;
+		static constexpr int32 MaxVertices = 8192;
 
-		} m_data;
+		static constexpr int32 PolygonBufferSize = 8192;
 
-		unsigned char* m_navData = nullptr;
+		static constexpr int32 MaxSearchNodes = 2048;
 
-		int32 m_navDataSize = 0;
+		std::shared_ptr<dtNavMesh> m_navmesh;
 
 		bool m_built = false;
 
-		mutable Array<Float3> m_buffer;
+		mutable std::mutex m_queryPoolMutex;
 
-		mutable Array<dtPolyRef> m_polygonBuffer;
+		mutable Array<std::unique_ptr<QueryContext>> m_queryPool;
 
 		bool build(const NavMeshConfig& config, const NavMeshAABB& aabb,
 			const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs);
 
-		void init();
+		bool buildTiles(const NavMeshConfig& config, const NavMeshAABB& aabb,
+			const Array<Float3>& vertices, const Array<TriangleIndex>& indices, const Array<uint8>& areaIDs);
+
+		bool initQueryPool();
+
+		void releaseQueryContext(std::unique_ptr<QueryContext>&& context) const;
+
+		// 経路を計算し、経路上の点の数を返す。点は context.buffer に格納される
+		[[nodiscard]]
+		int32 findPath(QueryContext& context, const Float3& start, const Float3& end, const Float3& extent, const dtQueryFilter& filter) const;
 
 		void release();
 	};
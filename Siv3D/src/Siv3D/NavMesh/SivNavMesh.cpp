@@ -128,4 +128,57 @@ namespace s3d
 	{
 		pImpl->query(start, end, areaCosts, dst);
 	}
+
+	Array<Array<Vec2>> NavMesh::query(const Array<std::pair<Vec2, Vec2>>& startEnds, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		Array<Array<Vec2>> dst;
+
+		pImpl->query(startEnds, areaCosts, dst);
+
+		return dst;
+	}
+
+	void NavMesh::query(const Array<std::pair<Vec2, Vec2>>& startEnds, Array<Array<Vec2>>& dst, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		pImpl->query(startEnds, areaCosts, dst);
+	}
+
+	Array<Array<Vec3>> NavMesh::query(const Array<std::pair<Vec3, Vec3>>& startEnds, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		Array<Array<Vec3>> dst;
+
+		pImpl->query(startEnds, areaCosts, dst);
+
+		return dst;
+	}
+
+	void NavMesh::query(const Array<std::pair<Vec3, Vec3>>& startEnds, Array<Array<Vec3>>& dst, const Array<std::pair<int32, double>>& areaCosts) const
+	{
+		pImpl->query(startEnds, areaCosts, dst);
+	}
+
+	Blob NavMesh::toBlob() const
+	{
+		return pImpl->toBlob();
+	}
+
+	bool NavMesh::save(const FilePathView path) const
+	{
+		if (not isValid())
+		{
+			return false;
+		}
+
+		return toBlob().save(path);
+	}
+
+	bool NavMesh::load(const Blob& blob)
+	{
+		return pImpl->load(blob);
+	}
+
+	bool NavMesh::load(const FilePathView path)
+	{
+		return load(Blob{ path });
+	}
 }
@@ -0,0 +1,98 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/NavMeshCrowd.hpp>
+# include "NavMeshCrowdDetail.hpp"
+
+namespace s3d
+{
+	NavMeshCrowd::NavMeshCrowd()
+		: pImpl{ std::make_shared<NavMeshCrowdDetail>() }
+	{
+
+	}
+
+	NavMeshCrowd::NavMeshCrowd(const NavMesh& navMesh)
+		: pImpl{ std::make_shared<NavMeshCrowdDetail>(navMesh.pImpl) }
+	{
+
+	}
+
+	NavMeshCrowd::~NavMeshCrowd()
+	{
+
+	}
+
+	size_t NavMeshCrowd::num_agents() const noexcept
+	{
+		return pImpl->num_agents();
+	}
+
+	Optional<NavMeshAgentID> NavMeshCrowd::addAgent(const Vec2& pos, const NavMeshAgentConfig& config)
+	{
+		return pImpl->addAgent(pos, config);
+	}
+
+	bool NavMeshCrowd::removeAgent(const NavMeshAgentID id)
+	{
+		return pImpl->removeAgent(id);
+	}
+
+	void NavMeshCrowd::clear()
+	{
+		pImpl->clear();
+	}
+
+	bool NavMeshCrowd::hasAgent(const NavMeshAgentID id) const
+	{
+		return pImpl->hasAgent(id);
+	}
+
+	bool NavMeshCrowd::setTarget(const NavMeshAgentID id, const Vec2& target)
+	{
+		return pImpl->setTarget(id, target);
+	}
+
+	bool NavMeshCrowd::resetTarget(const NavMeshAgentID id)
+	{
+		return pImpl->resetTarget(id);
+	}
+
+	Vec2 NavMeshCrowd::getPos(const NavMeshAgentID id) const
+	{
+		return pImpl->getPos(id);
+	}
+
+	Vec2 NavMeshCrowd::getVelocity(const NavMeshAgentID id) const
+	{
+		return pImpl->getVelocity(id);
+	}
+
+	bool NavMeshCrowd::hasArrived(const NavMeshAgentID id) const
+	{
+		return pImpl->hasArrived(id);
+	}
+
+	void NavMeshCrowd::update(const double deltaTime)
+	{
+		pImpl->update(deltaTime);
+	}
+
+	const Array<Vec2>& NavMeshCrowd::getPositions() const noexcept
+	{
+		return pImpl->getPositions();
+	}
+
+	const Array<NavMeshAgentID>& NavMeshCrowd::getAgentIDs() const noexcept
+	{
+		return pImpl->getAgentIDs();
+	}
+}
@@ -18,7 +18,8 @@ namespace s3d
 		: m_listner{}
 		, m_socket{ std::make_unique<UdpListeningReceiveSocket>(IpEndpointName{ ipv4.getData()[0], ipv4.getData()[1], ipv4.getData()[2], ipv4.getData()[3], port }, &m_listner) }
 	{
-		m_task = Async(Run, this);
+		// 受信ループはスレッドプールのワーカーを占有しないよう、専用のスレッドで実行する
+		m_task = std::async(std::launch::async, Run, this);
 	}
 
 	OSCReceiver::OSCReceiverDetail::~OSCReceiverDetail()
@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <future>
 # include <Siv3D/OpenAI/Image.hpp>
 # include <Siv3D/JSON.hpp>
 # include <Siv3D/System.hpp>
@@ -208,19 +209,20 @@ namespace s3d
 				return detail::CreateDALLE3ImageImpl(String{ apiKey }, request);
 			}
 
+			// 以下の非同期版は HTTP 通信の完了をポーリングし続けるため、スレッドプールではなく専用のスレッドで実行する
 			AsyncTask<s3d::Image> CreateAsync(const StringView apiKey, const RequestDALLE2& request)
 			{
-				return Async(detail::CreateDALLE2ImageImpl, String{ apiKey }, request);
+				return std::async(std::launch::async, detail::CreateDALLE2ImageImpl, String{ apiKey }, request);
 			}
 
 			AsyncTask<Array<s3d::Image>> CreateAsync(const StringView apiKey, const RequestDALLE2& request, const int32 numImages)
 			{
-				return Async(detail::CreateDALLE2ImagesImpl, String{ apiKey }, request, numImages);
+				return std::async(std::launch::async, detail::CreateDALLE2ImagesImpl, String{ apiKey }, request, numImages);
 			}
 
 			AsyncTask<s3d::Image> CreateAsync(const StringView apiKey, const RequestDALLE3& request)
 			{
-				return Async(detail::CreateDALLE3ImageImpl, String{ apiKey }, request);
+				return std::async(std::launch::async, detail::CreateDALLE3ImageImpl, String{ apiKey }, request);
 			}
 		}
 	}
@@ -9,6 +9,7 @@
 //
 //-----------------------------------------------
 
+# include <future>
 # include <Siv3D/OpenAI/Speech.hpp>
 # include <Siv3D/URLView.hpp>
 # include <Siv3D/AsyncHTTPTask.hpp>
@@ -83,7 +84,8 @@ namespace s3d
 
 			AsyncTask<bool> CreateAsync(const StringView apiKey, const Request& request, const FilePathView path)
 			{
-				return Async(detail::CreateSpeechImpl, String{ apiKey }, request, FilePath{ path });
+				// 音声ファイルのダウンロードが終わるまで待ち続けるため、専用のスレッドで実行する
+				return std::async(std::launch::async, detail::CreateSpeechImpl, String{ apiKey }, request, FilePath{ path });
 			}
 		}
 	}
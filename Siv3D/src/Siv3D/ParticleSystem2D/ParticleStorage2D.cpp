@@ -0,0 +1,292 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <atomic>
+# include <bit>
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/Threading.hpp>
+# include "ParticleStorage2D.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static constexpr size_t ParticleUpdateGrainSize = 4096;
+	}
+
+	size_t ParticleStorage2D::size() const noexcept
+	{
+		return (m_positionX.size() - m_head);
+	}
+
+	bool ParticleStorage2D::isEmpty() const noexcept
+	{
+		return (size() == 0);
+	}
+
+	void ParticleStorage2D::clear() noexcept
+	{
+		m_positionX.clear();
+		m_positionY.clear();
+		m_velocityX.clear();
+		m_velocityY.clear();
+		m_rotation.clear();
+		m_angularVelocity.clear();
+		m_startSize.clear();
+		m_startLifeTime.clear();
+		m_remainingLifeTime.clear();
+		m_startColor.clear();
+		m_head = 0;
+	}
+
+	void ParticleStorage2D::reserve(const size_t n)
+	{
+		const size_t capacity = (m_head + n);
+		m_positionX.reserve(capacity);
+		m_positionY.reserve(capacity);
+		m_velocityX.reserve(capacity);
+		m_velocityY.reserve(capacity);
+		m_rotation.reserve(capacity);
+		m_angularVelocity.reserve(capacity);
+		m_startSize.reserve(capacity);
+		m_startLifeTime.reserve(capacity);
+		m_remainingLifeTime.reserve(capacity);
+		m_startColor.reserve(capacity);
+	}
+
+	void ParticleStorage2D::push_back(const Particle2D& particle)
+	{
+		// 再確保が必要なとき、先頭側の空き領域が有効な要素数以上あれば、代わりに詰め直す
+		if ((0 < m_head)
+			&& (m_positionX.size() == m_positionX.capacity())
+			&& (size() <= m_head))
+		{
+			compact();
+		}
+
+		m_positionX.push_back(particle.position.x);
+		m_positionY.push_back(particle.position.y);
+		m_velocityX.push_back(particle.velocity.x);
+		m_velocityY.push_back(particle.velocity.y);
+		m_rotation.push_back(particle.rotation);
+		m_angularVelocity.push_back(particle.startAngularVelocity);
+		m_startSize.push_back(particle.startSize);
+		m_startLifeTime.push_back(particle.startLifeTime);
+		m_remainingLifeTime.push_back(particle.remainingLifeTime);
+		m_startColor.push_back(particle.startColor);
+	}
+
+	void ParticleStorage2D::removeFront(const size_t n) noexcept
+	{
+		m_head += Min(n, size());
+
+		if (isEmpty())
+		{
+			clear();
+		}
+	}
+
+	void ParticleStorage2D::update(const float deltaTime, const Float2& deltaVelocity)
+	{
+		const size_t first = m_head;
+		const size_t last = m_positionX.size();
+		size_t deadCount = 0;
+
+		if ((last - first) < ParallelUpdateThreshold)
+		{
+			deadCount = integrate(first, last, deltaTime, deltaVelocity);
+		}
+		else
+		{
+			std::atomic<size_t> sharedDeadCount = 0;
+
+			Threading::detail::ParallelForRange(first, last, detail::ParticleUpdateGrainSize, [&](const size_t begin, const size_t end)
+			{
+				if (const size_t n = integrate(begin, end, deltaTime, deltaVelocity))
+				{
+					sharedDeadCount.fetch_add(n, std::memory_order_relaxed);
+				}
+			});
+
+			deadCount = sharedDeadCount.load(std::memory_order_relaxed);
+		}
+
+		if (deadCount == 0)
+		{
+			return;
+		}
+
+		// 寿命が同じパーティクルは発生順に死ぬので、ほとんどの場合は先頭を進めるだけで済む
+		while ((m_head < last) && (m_remainingLifeTime[m_head] < 0.0f))
+		{
+			++m_head;
+			--deadCount;
+		}
+
+		if (deadCount != 0)
+		{
+			compact();
+		}
+		else if (isEmpty())
+		{
+			clear();
+		}
+	}
+
+	Particle2D ParticleStorage2D::operator [](const size_t index) const noexcept
+	{
+		const size_t i = (m_head + index);
+
+		Particle2D particle;
+		particle.position.set(m_positionX[i], m_positionY[i]);
+		particle.velocity.set(m_velocityX[i], m_velocityY[i]);
+		particle.startColor				= m_startColor[i];
+		particle.startSize				= m_startSize[i];
+		particle.rotation				= m_rotation[i];
+		particle.startAngularVelocity	= m_angularVelocity[i];
+		particle.startLifeTime			= m_startLifeTime[i];
+		particle.remainingLifeTime		= m_remainingLifeTime[i];
+		return particle;
+	}
+
+	const float* ParticleStorage2D::positionX() const noexcept
+	{
+		return (m_positionX.data() + m_head);
+	}
+
+	const float* ParticleStorage2D::positionY() const noexcept
+	{
+		return (m_positionY.data() + m_head);
+	}
+
+	const float* ParticleStorage2D::rotation() const noexcept
+	{
+		return (m_rotation.data() + m_head);
+	}
+
+	const float* ParticleStorage2D::startSize() const noexcept
+	{
+		return (m_startSize.data() + m_head);
+	}
+
+	const float* ParticleStorage2D::startLifeTime() const noexcept
+	{
+		return (m_startLifeTime.data() + m_head);
+	}
+
+	const float* ParticleStorage2D::remainingLifeTime() const noexcept
+	{
+		return (m_remainingLifeTime.data() + m_head);
+	}
+
+	const Float4* ParticleStorage2D::startColor() const noexcept
+	{
+		return (m_startColor.data() + m_head);
+	}
+
+	size_t ParticleStorage2D::integrate(const size_t begin, const size_t end, const float deltaTime, const Float2& deltaVelocity) noexcept
+	{
+		float* const pPositionX				= m_positionX.data();
+		float* const pPositionY				= m_positionY.data();
+		float* const pVelocityX				= m_velocityX.data();
+		float* const pVelocityY				= m_velocityY.data();
+		float* const pRotation				= m_rotation.data();
+		const float* const pAngularVelocity	= m_angularVelocity.data();
+		float* const pRemainingLifeTime		= m_remainingLifeTime.data();
+
+		size_t deadCount = 0;
+		size_t i = begin;
+
+		{
+			const __m128 dt		= _mm_set1_ps(deltaTime);
+			const __m128 dvx	= _mm_set1_ps(deltaVelocity.x);
+			const __m128 dvy	= _mm_set1_ps(deltaVelocity.y);
+			const __m128 zero	= _mm_setzero_ps();
+
+			// 4 個ずつまとめて処理する
+			for (; (i + 4) <= end; i += 4)
+			{
+				const __m128 life = _mm_sub_ps(_mm_loadu_ps(pRemainingLifeTime + i), dt);
+				_mm_storeu_ps((pRemainingLifeTime + i), life);
+
+				const __m128 vx = _mm_add_ps(_mm_loadu_ps(pVelocityX + i), dvx);
+				const __m128 vy = _mm_add_ps(_mm_loadu_ps(pVelocityY + i), dvy);
+				_mm_storeu_ps((pVelocityX + i), vx);
+				_mm_storeu_ps((pVelocityY + i), vy);
+
+				_mm_storeu_ps((pPositionX + i), _mm_add_ps(_mm_loadu_ps(pPositionX + i), _mm_mul_ps(vx, dt)));
+				_mm_storeu_ps((pPositionY + i), _mm_add_ps(_mm_loadu_ps(pPositionY + i), _mm_mul_ps(vy, dt)));
+				_mm_storeu_ps((pRotation + i), _mm_add_ps(_mm_loadu_ps(pRotation + i), _mm_mul_ps(_mm_loadu_ps(pAngularVelocity + i), dt)));
+
+				deadCount += std::popcount(static_cast<uint32>(_mm_movemask_ps(_mm_cmplt_ps(life, zero))));
+			}
+		}
+
+		for (; i < end; ++i)
+		{
+			pRemainingLifeTime[i] -= deltaTime;
+			pVelocityX[i] += deltaVelocity.x;
+			pVelocityY[i] += deltaVelocity.y;
+			pPositionX[i] += (pVelocityX[i] * deltaTime);
+			pPositionY[i] += (pVelocityY[i] * deltaTime);
+			pRotation[i] += (pAngularVelocity[i] * deltaTime);
+
+			if (pRemainingLifeTime[i] < 0.0f)
+			{
+				++deadCount;
+			}
+		}
+
+		return deadCount;
+	}
+
+	void ParticleStorage2D::compact()
+	{
+		const size_t last = m_positionX.size();
+		size_t dst = 0;
+
+		for (size_t src = m_head; src < last; ++src)
+		{
+			if (m_remainingLifeTime[src] < 0.0f)
+			{
+				continue;
+			}
+
+			if (dst != src)
+			{
+				m_positionX[dst]			= m_positionX[src];
+				m_positionY[dst]			= m_positionY[src];
+				m_velocityX[dst]			= m_velocityX[src];
+				m_velocityY[dst]			= m_velocityY[src];
+				m_rotation[dst]				= m_rotation[src];
+				m_angularVelocity[dst]		= m_angularVelocity[src];
+				m_startSize[dst]			= m_startSize[src];
+				m_startLifeTime[dst]		= m_startLifeTime[src];
+				m_remainingLifeTime[dst]	= m_remainingLifeTime[src];
+				m_startColor[dst]			= m_startColor[src];
+			}
+
+			++dst;
+		}
+
+		m_positionX.resize(dst);
+		m_positionY.resize(dst);
+		m_velocityX.resize(dst);
+		m_velocityY.resize(dst);
+		m_rotation.resize(dst);
+		m_angularVelocity.resize(dst);
+		m_startSize.resize(dst);
+		m_startLifeTime.resize(dst);
+		m_remainingLifeTime.resize(dst);
+		m_startColor.resize(dst);
+		m_head = 0;
+	}
+}
@@ -0,0 +1,104 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/PointVector.hpp>
+# include <Siv3D/Particle2D.hpp>
+
+namespace s3d
+{
+	/// @brief パーティクルを要素ごとの配列（SoA）で保持するストレージ
+	/// @remark 古いパーティクルの削除は先頭位置を進めるだけのリングバッファとして扱い、途中に寿命の尽きたパーティクルがある場合だけ詰め直します。
+	/// @remark パーティクルの並び（＝描画順）は発生順のまま保たれます。
+	class ParticleStorage2D
+	{
+	public:
+
+		/// @brief この数以上のパーティクルを更新する場合は複数のスレッドで処理します。
+		static constexpr size_t ParallelUpdateThreshold = 16384;
+
+		[[nodiscard]]
+		size_t size() const noexcept;
+
+		[[nodiscard]]
+		bool isEmpty() const noexcept;
+
+		void clear() noexcept;
+
+		void reserve(size_t n);
+
+		void push_back(const Particle2D& particle);
+
+		/// @brief 古いものから順に n 個のパーティクルを削除します。
+		void removeFront(size_t n) noexcept;
+
+		/// @brief すべてのパーティクルの時間を進め、寿命の尽きたパーティクルを削除します。
+		void update(float deltaTime, const Float2& deltaVelocity);
+
+		[[nodiscard]]
+		Particle2D operator [](size_t index) const noexcept;
+
+		[[nodiscard]]
+		const float* positionX() const noexcept;
+
+		[[nodiscard]]
+		const float* positionY() const noexcept;
+
+		[[nodiscard]]
+		const float* rotation() const noexcept;
+
+		[[nodiscard]]
+		const float* startSize() const noexcept;
+
+		[[nodiscard]]
+		const float* startLifeTime() const noexcept;
+
+		[[nodiscard]]
+		const float* remainingLifeTime() const noexcept;
+
+		[[nodiscard]]
+		const Float4* startColor() const noexcept;
+
+	private:
+
+		Array<float> m_positionX;
+
+		Array<float> m_positionY;
+
+		Array<float> m_velocityX;
+
+		Array<float> m_velocityY;
+
+		Array<float> m_rotation;
+
+		Array<float> m_angularVelocity;
+
+		Array<float> m_startSize;
+
+		Array<float> m_startLifeTime;
+
+		Array<float> m_remainingLifeTime;
+
+		Array<Float4> m_startColor;
+
+		// 有効なパーティクルの先頭位置
+		size_t m_head = 0;
+
+		// [begin, end) のパーティクルを更新し、寿命の尽きたパーティクルの数を返す
+		[[nodiscard]]
+		size_t integrate(size_t begin, size_t end, float deltaTime, const Float2& deltaVelocity) noexcept;
+
+		// 寿命の尽きたパーティクルを取り除き、残りを配列の先頭に詰める
+		void compact();
+	};
+}
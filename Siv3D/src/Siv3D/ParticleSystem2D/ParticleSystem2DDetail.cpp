@@ -144,14 +144,7 @@ namespace s3d
 
 	void ParticleSystem2D::ParticleSystem2DDetail::updateCurrentparticles(float deltaTime)
 	{
-		const Float2 deltaVelocity = (m_force * deltaTime);
-
-		for (auto& particle : m_particles)
-		{
-			particle.update(deltaTime, deltaVelocity);
-		}
-
-		m_particles.remove_if([](const Particle2D& p) { return p.isDead(); });
+		m_particles.update(deltaTime, (m_force * deltaTime));
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::addParticles(const ParticleSystem2DParameters& params)
@@ -183,41 +176,23 @@ namespace s3d
 
 			const float perParticledeltaTime = (particle.startLifeTime - particle.remainingLifeTime);
 			particle.advance(perParticledeltaTime, m_force * perParticledeltaTime);
-			m_particles << particle;
+			m_particles.push_back(particle);
 		}
 
 		if (const size_t maxParticles = static_cast<size_t>(params.maxParticles); m_particles.size() > maxParticles)
 		{
-			m_particles.erase(m_particles.begin(), m_particles.begin() + (m_particles.size() - maxParticles));
+			m_particles.removeFront(m_particles.size() - maxParticles);
 		}
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::drawParticle() const
 	{
-		const ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc =
-			m_parameters.sizeOverLifeTimeFunc ? m_parameters.sizeOverLifeTimeFunc : detail::DefaultSizeOverLifeTimeFunc;
-		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
-			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
-
-		for (const auto& particle : m_particles)
-		{
-			const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
-			const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
-
-			RectF{ Arg::center = particle.position, size }
-				.rotated(particle.rotation)
-				.draw(ColorF{ color });
-		}
+		SIV3D_ENGINE(Renderer2D)->addParticles(m_particles, m_parameters.sizeOverLifeTimeFunc, m_parameters.colorOverLifeTimeFunc);
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::drawTexturedParticle() const
 	{
-		const ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc =
-			m_parameters.sizeOverLifeTimeFunc ? m_parameters.sizeOverLifeTimeFunc : detail::DefaultSizeOverLifeTimeFunc;
-		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
-			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
-
-		SIV3D_ENGINE(Renderer2D)->addTexturedParticles(m_particleTexture, m_particles, sizeOverLifeTimeFunc, colorOverLifeTimeFunc);
+		SIV3D_ENGINE(Renderer2D)->addTexturedParticles(m_particleTexture, m_particles, m_parameters.sizeOverLifeTimeFunc, m_parameters.colorOverLifeTimeFunc);
 	}
 
 	void ParticleSystem2D::ParticleSystem2DDetail::drawDebugParticle() const
@@ -227,8 +202,9 @@ namespace s3d
 		const ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc =
 			m_parameters.colorOverLifeTimeFunc ? m_parameters.colorOverLifeTimeFunc : detail::DefaultColorOverLifeTimeFunc;
 
-		for (const auto& particle : m_particles)
+		for (size_t i = 0; i < m_particles.size(); ++i)
 		{
+			const Particle2D particle = m_particles[i];
 			const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
 			const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
 
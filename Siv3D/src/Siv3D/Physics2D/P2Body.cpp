@@ -400,6 +400,29 @@ namespace s3d
 		return{ detail::ToVec2(pImpl->getBody().GetPosition()), pImpl->getBody().GetAngle() };
 	}
 
+	Vec2 P2Body::getInterpolatedPos(const double alpha) const noexcept
+	{
+		if (isEmpty())
+		{
+			return{ 0, 0 };
+		}
+
+		b2Transform transform;
+		pImpl->getBody().GetSweep().GetTransform(&transform, static_cast<float>(alpha));
+		return detail::ToVec2(transform.p);
+	}
+
+	double P2Body::getInterpolatedAngle(const double alpha) const noexcept
+	{
+		if (isEmpty())
+		{
+			return 0.0;
+		}
+
+		const b2Sweep& sweep = pImpl->getBody().GetSweep();
+		return (sweep.a0 + (sweep.a - sweep.a0) * alpha);
+	}
+
 	P2Body& P2Body::setVelocity(const Vec2 v) noexcept
 	{
 		if (isEmpty())
@@ -26,6 +26,26 @@ namespace s3d
 		return pImpl->update(timeStep, velocityIterations, positionIterations);
 	}
 
+	int32 P2World::updateFixed(const double stepTime, const double deltaTime, const int32 maxSteps, const int32 velocityIterations, const int32 positionIterations) const
+	{
+		return pImpl->updateFixed(stepTime, deltaTime, maxSteps, velocityIterations, positionIterations);
+	}
+
+	double P2World::getInterpolationAlpha() const noexcept
+	{
+		return pImpl->getInterpolationAlpha();
+	}
+
+	P2WorldStat P2World::getStat() const
+	{
+		return pImpl->getStat();
+	}
+
+	void P2World::getTransforms(Array<P2BodyTransform>& transforms) const
+	{
+		pImpl->getTransforms(transforms);
+	}
+
 	void P2World::setSleepEnabled(const bool enabled)
 	{
 		pImpl->getData().SetAllowSleeping(enabled);
@@ -36,6 +56,16 @@ namespace s3d
 		return pImpl->getData().GetAllowSleeping();
 	}
 
+	void P2World::setParallelEnabled(const bool enabled)
+	{
+		pImpl->setParallelEnabled(enabled);
+	}
+
+	bool P2World::getParallelEnabled() const noexcept
+	{
+		return pImpl->getParallelEnabled();
+	}
+
 	void P2World::setGravity(const double gravity)
 	{
 		setGravity(Vec2{ 0.0, gravity });
@@ -106,6 +136,11 @@ namespace s3d
 		return pImpl->createCircleSensor(pImpl, bodyType, worldPos, Circle{ 0, 0, r }, filter);
 	}
 
+	Array<P2Body> P2World::createCircles(const P2BodyType bodyType, const Array<Vec2>& worldPositions, const double r, const P2Material& material, const P2Filter& filter)
+	{
+		return pImpl->createCircles(pImpl, bodyType, worldPositions, Circle{ 0, 0, r }, material, filter);
+	}
+
 	P2Body P2World::createRect(const P2BodyType bodyType, const Vec2& worldPos, const double size, const P2Material& material, const P2Filter& filter)
 	{
 		return createRect(bodyType, worldPos, RectF{ Arg::center(0, 0), size }, material, filter);
@@ -121,6 +156,11 @@ namespace s3d
 		return pImpl->createRect(pImpl, bodyType, worldPos, localPos, material, filter);
 	}
 
+	Array<P2Body> P2World::createRects(const P2BodyType bodyType, const Array<Vec2>& worldPositions, const SizeF& size, const P2Material& material, const P2Filter& filter)
+	{
+		return pImpl->createRects(pImpl, bodyType, worldPositions, RectF{ Arg::center(0, 0), size }, material, filter);
+	}
+
 	P2Body P2World::createTriangle(const P2BodyType bodyType, const Vec2& worldPos, const Triangle& localPos, const P2Material& material, const P2Filter& filter)
 	{
 		return pImpl->createTriangle(pImpl, bodyType, worldPos, localPos, material, filter);
@@ -10,22 +10,130 @@
 //-----------------------------------------------
 
 # include <Siv3D/Physics2D/P2Body.hpp>
+# include <Siv3D/Threading.hpp>
 # include "P2WorldDetail.hpp"
+# include "P2BodyDetail.hpp"
 # include "P2Common.hpp"
 
 namespace s3d
 {
+	namespace detail
+	{
+		// 接触の多いワールドのナローフェーズを、エンジンのスレッドプールで並列に処理する
+		static void P2ParallelFor(const int32 count, const int32 grainSize, b2ParallelTaskFcn* task, void* taskContext, void*)
+		{
+			Threading::detail::ParallelForRange(0, static_cast<size_t>(count), static_cast<size_t>(grainSize),
+				[task, taskContext](const size_t begin, const size_t end)
+				{
+					task(static_cast<int32>(begin), static_cast<int32>(end), taskContext);
+				});
+		}
+	}
+
 	detail::P2WorldDetail::P2WorldDetail(const Vec2 gravity)
 		: m_world{ detail::ToB2Vec2(gravity) }
 	{
 		m_world.SetContactListener(&m_contactListner);
+		m_world.SetParallelFor(&detail::P2ParallelFor, nullptr);
 	}
 
 	void detail::P2WorldDetail::update(const double timeStep, const int32 velocityIterations, const int32 positionIterations)
 	{
 		m_contactListner.clearContacts();
+		m_stat = {};
+		m_interpolationAlpha = 1.0;
 
-		m_world.Step(static_cast<float>(timeStep), velocityIterations, positionIterations);
+		step(timeStep, velocityIterations, positionIterations);
+	}
+
+	int32 detail::P2WorldDetail::updateFixed(const double stepTime, const double deltaTime, const int32 maxSteps, const int32 velocityIterations, const int32 positionIterations)
+	{
+		m_contactListner.clearContacts();
+		m_stat = {};
+
+		if (stepTime <= 0.0)
+		{
+			return 0;
+		}
+
+		m_accumulatedTime += Max(deltaTime, 0.0);
+
+		int32 stepCount = 0;
+
+		// 接触情報は、この呼び出しで進めたすべてのステップの分が集計される
+		while ((stepTime <= m_accumulatedTime) && (stepCount < maxSteps))
+		{
+			step(stepTime, velocityIterations, positionIterations);
+			m_accumulatedTime -= stepTime;
+			++stepCount;
+		}
+
+		// 処理が追いつかない場合は、遅れを取り戻そうとしてさらに重くならないよう、残りの時間を切り捨てる
+		if (stepTime <= m_accumulatedTime)
+		{
+			m_accumulatedTime = std::fmod(m_accumulatedTime, stepTime);
+		}
+
+		m_interpolationAlpha = (m_accumulatedTime / stepTime);
+
+		return stepCount;
+	}
+
+	double detail::P2WorldDetail::getInterpolationAlpha() const noexcept
+	{
+		return m_interpolationAlpha;
+	}
+
+	P2WorldStat detail::P2WorldDetail::getStat() const
+	{
+		P2WorldStat stat = m_stat;
+		stat.bodyCount = static_cast<size_t>(m_world.GetBodyCount());
+		stat.contactCount = static_cast<size_t>(m_world.GetContactCount());
+
+		for (const b2Body* body = m_world.GetBodyList(); body; body = body->GetNext())
+		{
+			if (body->IsAwake())
+			{
+				++stat.awakeBodyCount;
+			}
+		}
+
+		for (const b2Contact* contact = m_world.GetContactList(); contact; contact = contact->GetNext())
+		{
+			if (contact->IsTouching())
+			{
+				++stat.touchingContactCount;
+			}
+		}
+
+		return stat;
+	}
+
+	void detail::P2WorldDetail::getTransforms(Array<P2BodyTransform>& transforms) const
+	{
+		transforms.resize(static_cast<size_t>(m_world.GetBodyCount()));
+
+		// ボディリストは作成の新しい順に並んでいるので、後ろから詰める
+		P2BodyTransform* pDst = (transforms.data() + transforms.size());
+
+		for (const b2Body* body = m_world.GetBodyList(); body; body = body->GetNext())
+		{
+			--pDst;
+			pDst->id	= static_cast<const P2Body::P2BodyDetail*>(body->GetUserData().pBody)->id();
+			pDst->pos	= detail::ToVec2(body->GetPosition());
+			pDst->angle	= body->GetAngle();
+		}
+	}
+
+	void detail::P2WorldDetail::setParallelEnabled(const bool enabled)
+	{
+		m_world.SetParallelFor((enabled ? &detail::P2ParallelFor : nullptr), nullptr);
+		m_parallelEnabled = enabled;
+	}
+
+	bool detail::P2WorldDetail::getParallelEnabled() const noexcept
+	{
+		return m_parallelEnabled;
 	}
 
 	P2Body detail::P2WorldDetail::createPlaceholder(const std::shared_ptr<P2WorldDetail>& world, const P2BodyType bodyType, const Vec2& center)
@@ -78,6 +186,21 @@ namespace s3d
 		return body;
 	}
 
+	Array<P2Body> detail::P2WorldDetail::createCircles(const std::shared_ptr<P2WorldDetail>& world, const P2BodyType bodyType, const Array<Vec2>& worldPositions, const Circle& localPos, const P2Material& material, const P2Filter& filter)
+	{
+		// 物体 1 つにつき部品 1 つ分のブロードフェーズの領域を先に確保する
+		m_world.ReserveProxies(static_cast<int32>(worldPositions.size()));
+
+		Array<P2Body> bodies(Arg::reserve = worldPositions.size());
+
+		for (const auto& worldPos : worldPositions)
+		{
+			bodies << createCircle(world, bodyType, worldPos, localPos, material, filter);
+		}
+
+		return bodies;
+	}
+
 	P2Body detail::P2WorldDetail::createRect(const std::shared_ptr<P2WorldDetail>& world, const P2BodyType bodyType, const Vec2& worldPos, const RectF& localPos, const P2Material& material, const P2Filter& filter)
 	{
 		P2Body body{ world, generateNextID(), worldPos, bodyType };
@@ -87,6 +210,21 @@ namespace s3d
 		return body;
 	}
 
+	Array<P2Body> detail::P2WorldDetail::createRects(const std::shared_ptr<P2WorldDetail>& world, const P2BodyType bodyType, const Array<Vec2>& worldPositions, const RectF& localPos, const P2Material& material, const P2Filter& filter)
+	{
+		// 物体 1 つにつき部品 1 つ分のブロードフェーズの領域を先に確保する
+		m_world.ReserveProxies(static_cast<int32>(worldPositions.size()));
+
+		Array<P2Body> bodies(Arg::reserve = worldPositions.size());
+
+		for (const auto& worldPos : worldPositions)
+		{
+			bodies << createRect(world, bodyType, worldPos, localPos, material, filter);
+		}
+
+		return bodies;
+	}
+
 	P2Body detail::P2WorldDetail::createTriangle(const std::shared_ptr<P2WorldDetail>& world, const P2BodyType bodyType, const Vec2& worldPos, const Triangle& localPos, const P2Material& material, const P2Filter& filter)
 	{
 		P2Body body{ world, generateNextID(), worldPos, bodyType };
@@ -159,6 +297,19 @@ namespace s3d
 		return &m_world;
 	}
 
+	void detail::P2WorldDetail::step(const double timeStep, const int32 velocityIterations, const int32 positionIterations)
+	{
+		m_world.Step(static_cast<float>(timeStep), velocityIterations, positionIterations);
+
+		const b2Profile& profile = m_world.GetProfile();
+		++m_stat.stepCount;
+		m_stat.stepTime			+= profile.step;
+		m_stat.broadPhaseTime	+= profile.broadphase;
+		m_stat.narrowPhaseTime	+= profile.collide;
+		m_stat.solveTime		+= (profile.solveInit + profile.solveVelocity + profile.solvePosition);
+		m_stat.solveTOITime		+= profile.solveTOI;
+	}
+
 	P2BodyID detail::P2WorldDetail::generateNextID() noexcept
 	{
 		return ++m_currentID;
@@ -24,6 +24,21 @@ namespace s3d
 
 		void update(double timeStep, int32 velocityIterations, int32 positionIterations);
 
+		int32 updateFixed(double stepTime, double deltaTime, int32 maxSteps, int32 velocityIterations, int32 positionIterations);
+
+		[[nodiscard]]
+		double getInterpolationAlpha() const noexcept;
+
+		[[nodiscard]]
+		P2WorldStat getStat() const;
+
+		void getTransforms(Array<P2BodyTransform>& transforms) const;
+
+		void setParallelEnabled(bool enabled);
+
+		[[nodiscard]]
+		bool getParallelEnabled() const noexcept;
+
 		[[nodiscard]]
 		P2Body createPlaceholder(const std::shared_ptr<P2WorldDetail>& world, P2BodyType bodyType, const Vec2& worldPos);
 
@@ -42,9 +57,15 @@ namespace s3d
 		[[nodiscard]]
 		P2Body createCircleSensor(const std::shared_ptr<P2WorldDetail>& world, P2BodyType bodyType, const Vec2& worldPos, const Circle& localPos, const P2Filter& filter);
 
+		[[nodiscard]]
+		Array<P2Body> createCircles(const std::shared_ptr<P2WorldDetail>& world, P2BodyType bodyType, const Array<Vec2>& worldPositions, const Circle& localPos, const P2Material& material, const P2Filter& filter);
+
 		[[nodiscard]]
 		P2Body createRect(const std::shared_ptr<P2WorldDetail>& world, P2BodyType bodyType, const Vec2& worldPos, const RectF& localPos, const P2Material& material, const P2Filter& filter);
 
+		[[nodiscard]]
+		Array<P2Body> createRects(const std::shared_ptr<P2WorldDetail>& world, P2BodyType bodyType, const Array<Vec2>& worldPositions, const RectF& localPos, const P2Material& material, const P2Filter& filter);
+
 		[[nodiscard]]
 		P2Body createTriangle(const std::shared_ptr<P2WorldDetail>& world, P2BodyType bodyType, const Vec2& worldPos, const Triangle& localPos, const P2Material& material, const P2Filter& filter);
 
@@ -89,6 +110,18 @@ namespace s3d
 
 		std::atomic<P2BodyID> m_currentID = { 0 };
 
+		// updateFixed() で次の呼び出しに持ち越した時間（秒）
+		double m_accumulatedTime = 0.0;
+
+		double m_interpolationAlpha = 1.0;
+
+		// 直前の更新で進めたすべてのステップの統計
+		P2WorldStat m_stat;
+
+		bool m_parallelEnabled = true;
+
+		void step(double timeStep, int32 velocityIterations, int32 positionIterations);
+
 		[[nodiscard]]
 		P2BodyID generateNextID() noexcept;
 	};
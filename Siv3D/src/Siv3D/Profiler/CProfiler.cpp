@@ -24,6 +24,7 @@
 # include <Siv3D/Audio/IAudio.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
 # include "CProfiler.hpp"
+# include "ScopeProfiler.hpp"
 
 namespace s3d
 {
@@ -57,6 +58,8 @@ namespace s3d
 				const auto stat = SIV3D_ENGINE(Renderer2D)->getStat();
 				m_stat.drawCalls = stat.drawCalls;
 				m_stat.triangleCount = stat.triangleCount;
+				m_stat.batchCount = stat.batchCount;
+				m_stat.uploadedBytes = stat.uploadedBytes;
 			}
 
 			m_stat.textureCount	= static_cast<uint32>(SIV3D_ENGINE(Texture)->getTextureCount());
@@ -68,7 +71,11 @@ namespace s3d
 
 	void CProfiler::endFrame()
 	{
-
+		// 各スレッドのバッファが溢れないよう、毎フレーム回収する
+		if (ScopeProfiler::GetInstance().isEnabled())
+		{
+			ScopeProfiler::GetInstance().collect();
+		}
 	}
 
 	int32 CProfiler::getFPS() const noexcept
@@ -0,0 +1,257 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/TextWriter.hpp>
+# include <Siv3D/FormatLiteral.hpp>
+# include "ScopeProfiler.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static void WriteEscaped(TextWriter& writer, const StringView s)
+		{
+			for (const char32 ch : s)
+			{
+				switch (ch)
+				{
+				case U'"':
+					writer.write(U"\\\"");
+					break;
+				case U'\\':
+					writer.write(U"\\\\");
+					break;
+				default:
+					if (ch < 0x20)
+					{
+						writer.write(U"\\u{:04x}"_fmt(static_cast<uint32>(ch)));
+					}
+					else
+					{
+						writer.write(ch);
+					}
+				}
+			}
+		}
+
+		[[nodiscard]]
+		static String ToMicrosec(const uint64 nanosec)
+		{
+			return U"{}.{:03d}"_fmt((nanosec / 1000), (nanosec % 1000));
+		}
+	}
+
+	ScopeProfiler::ThreadBufferHolder::~ThreadBufferHolder()
+	{
+		if (buffer)
+		{
+			// 残っている区間は次の collect() で回収され、その後バッファは破棄される
+			buffer->retired.store(true, std::memory_order_release);
+		}
+	}
+
+	uint32 ScopeProfiler::intern(const StringView name)
+	{
+		String key{ name };
+
+		std::lock_guard lock{ m_labelMutex };
+
+		if (auto it = m_labelIDs.find(key); it != m_labelIDs.end())
+		{
+			return it->second;
+		}
+
+		const uint32 id = static_cast<uint32>(m_labels.size());
+		m_labels.push_back(key);
+		m_labelIDs.emplace(std::move(key), id);
+		return id;
+	}
+
+	void ScopeProfiler::setEnabled(const bool enabled) noexcept
+	{
+		m_enabled.store(enabled, std::memory_order_relaxed);
+	}
+
+	bool ScopeProfiler::isEnabled() const noexcept
+	{
+		return m_enabled.load(std::memory_order_relaxed);
+	}
+
+	void ScopeProfiler::record(const uint32 labelID, const uint32 depth, const uint64 beginNanosec, const uint64 endNanosec) noexcept
+	{
+		ThreadBuffer* buffer = nullptr;
+
+		try
+		{
+			buffer = &getThreadBuffer();
+		}
+		catch (...)
+		{
+			return;
+		}
+
+		const size_t head = buffer->head.load(std::memory_order_relaxed);
+		const size_t tail = buffer->tail.load(std::memory_order_acquire);
+
+		if ((head - tail) == ThreadBufferCapacity)
+		{
+			return;
+		}
+
+		buffer->events[head % ThreadBufferCapacity] = Event{ beginNanosec, endNanosec, labelID, depth, buffer->threadIndex };
+		buffer->head.store((head + 1), std::memory_order_release);
+	}
+
+	void ScopeProfiler::collect()
+	{
+		std::lock_guard lock{ m_bufferMutex };
+		collectUnlocked();
+	}
+
+	void ScopeProfiler::clear()
+	{
+		std::lock_guard lock{ m_bufferMutex };
+		collectUnlocked();
+		m_events.clear();
+		m_oldestEvent = 0;
+	}
+
+	bool ScopeProfiler::exportChromeTrace(const FilePathView path)
+	{
+		// 書き出しの間も他のスレッドが collect() できるよう、ロックを取っている間は古い区間から順にコピーするだけにする
+		Array<Event> events;
+		{
+			std::lock_guard lock{ m_bufferMutex };
+			collectUnlocked();
+
+			events.reserve(m_events.size());
+
+			for (size_t i = 0; i < m_events.size(); ++i)
+			{
+				events.push_back(m_events[(m_oldestEvent + i) % m_events.size()]);
+			}
+		}
+
+		Array<String> labels;
+		{
+			std::lock_guard lock{ m_labelMutex };
+			labels = m_labels;
+		}
+
+		TextWriter writer{ path, TextEncoding::UTF8_NO_BOM };
+
+		if (not writer)
+		{
+			return false;
+		}
+
+		uint64 originNanosec = UINT64_MAX;
+		uint32 maxThreadIndex = 0;
+
+		for (const auto& event : events)
+		{
+			originNanosec = Min(originNanosec, event.beginNanosec);
+			maxThreadIndex = Max(maxThreadIndex, event.threadIndex);
+		}
+
+		writer.writeln(U"{\"traceEvents\":[");
+
+		bool first = true;
+
+		if (events)
+		{
+			for (uint32 threadIndex = 0; threadIndex <= maxThreadIndex; ++threadIndex)
+			{
+				writer.write(first ? U"" : U",\n");
+				writer.write(U"{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{0},\"args\":{{\"name\":\"Thread {0}\"}}}}"_fmt(threadIndex));
+				first = false;
+			}
+		}
+
+		for (const auto& event : events)
+		{
+			writer.write(first ? U"" : U",\n");
+			writer.write(U"{\"name\":\"");
+			detail::WriteEscaped(writer, ((event.labelID < labels.size()) ? StringView{ labels[event.labelID] } : StringView{ U"?" }));
+			writer.write(U"\",\"cat\":\"Siv3D\",\"ph\":\"X\",\"pid\":0,\"tid\":{},\"ts\":{},\"dur\":{},\"args\":{{\"depth\":{}}}}}"_fmt(
+				event.threadIndex,
+				detail::ToMicrosec(event.beginNanosec - originNanosec),
+				detail::ToMicrosec(event.endNanosec - event.beginNanosec),
+				event.depth));
+			first = false;
+		}
+
+		writer.writeln(U"\n]}");
+
+		return true;
+	}
+
+	ScopeProfiler& ScopeProfiler::GetInstance()
+	{
+		static ScopeProfiler scopeProfiler;
+		return scopeProfiler;
+	}
+
+	ScopeProfiler::ThreadBuffer& ScopeProfiler::getThreadBuffer()
+	{
+		thread_local ThreadBufferHolder holder;
+
+		if (not holder.buffer)
+		{
+			auto buffer = std::make_shared<ThreadBuffer>();
+
+			std::lock_guard lock{ m_bufferMutex };
+			buffer->threadIndex = m_nextThreadIndex++;
+			m_buffers.push_back(buffer);
+			holder.buffer = std::move(buffer);
+		}
+
+		return *holder.buffer;
+	}
+
+	void ScopeProfiler::collectUnlocked()
+	{
+		for (auto& buffer : m_buffers)
+		{
+			// retired を先に読むことで、終了したスレッドの最後の書き込みまで確実に回収する
+			const bool retired = buffer->retired.load(std::memory_order_acquire);
+			const size_t head = buffer->head.load(std::memory_order_acquire);
+			size_t tail = buffer->tail.load(std::memory_order_relaxed);
+
+			for (; tail != head; ++tail)
+			{
+				pushEvent(buffer->events[tail % ThreadBufferCapacity]);
+			}
+
+			buffer->tail.store(tail, std::memory_order_release);
+
+			if (retired)
+			{
+				buffer.reset();
+			}
+		}
+
+		m_buffers.remove(nullptr);
+	}
+
+	void ScopeProfiler::pushEvent(const Event& event)
+	{
+		if (m_events.size() < MaxCollectedEvents)
+		{
+			m_events.push_back(event);
+			return;
+		}
+
+		// 上限に達した後は、最も古い区間を上書きする（要素を移動しないので、記録が長くなってもコストは一定）
+		m_events[m_oldestEvent] = event;
+		m_oldestEvent = ((m_oldestEvent + 1) % MaxCollectedEvents);
+	}
+}
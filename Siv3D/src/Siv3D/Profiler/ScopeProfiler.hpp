@@ -0,0 +1,128 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <memory>
+# include <mutex>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/HashTable.hpp>
+
+namespace s3d
+{
+	/// @brief SIV3D_PROFILE_SCOPE で計測した区間を集めるプロファイラ
+	/// @remark 各スレッドは自分専用のリングバッファに区間を書き込むだけで、ロックを取りません。
+	/// バッファはフレームの終わり（または書き出しの直前）に中央のバッファへ回収されます。
+	class ScopeProfiler
+	{
+	public:
+
+		struct Event
+		{
+			uint64 beginNanosec = 0;
+
+			uint64 endNanosec = 0;
+
+			uint32 labelID = 0;
+
+			uint32 depth = 0;
+
+			uint32 threadIndex = 0;
+		};
+
+		SIV3D_NODISCARD_CXX20
+		ScopeProfiler() = default;
+
+		ScopeProfiler(const ScopeProfiler&) = delete;
+
+		ScopeProfiler& operator =(const ScopeProfiler&) = delete;
+
+		/// @brief ラベルを登録して ID を返します。同じ名前には同じ ID を返します。
+		[[nodiscard]]
+		uint32 intern(StringView name);
+
+		void setEnabled(bool enabled) noexcept;
+
+		[[nodiscard]]
+		bool isEnabled() const noexcept;
+
+		/// @brief 現在のスレッドのバッファに区間を書き込みます。バッファが一杯の場合は破棄します。
+		void record(uint32 labelID, uint32 depth, uint64 beginNanosec, uint64 endNanosec) noexcept;
+
+		/// @brief 全スレッドのバッファの内容を回収します。
+		void collect();
+
+		/// @brief 回収済みの区間を消去します。
+		void clear();
+
+		bool exportChromeTrace(FilePathView path);
+
+		[[nodiscard]]
+		static ScopeProfiler& GetInstance();
+
+	private:
+
+		static constexpr size_t ThreadBufferCapacity = (1 << 14);
+
+		// 回収済みの区間の上限。超えた分は古いものから上書きする
+		static constexpr size_t MaxCollectedEvents = (1 << 21);
+
+		// 書き込みは所有スレッドだけ、読み出しは collect() だけが行う SPSC リングバッファ
+		struct ThreadBuffer
+		{
+			std::unique_ptr<Event[]> events = std::make_unique<Event[]>(ThreadBufferCapacity);
+
+			std::atomic<size_t> head = 0;
+
+			std::atomic<size_t> tail = 0;
+
+			std::atomic<bool> retired = false;
+
+			uint32 threadIndex = 0;
+		};
+
+		struct ThreadBufferHolder
+		{
+			std::shared_ptr<ThreadBuffer> buffer;
+
+			~ThreadBufferHolder();
+		};
+
+		std::atomic<bool> m_enabled = false;
+
+		std::mutex m_labelMutex;
+
+		Array<String> m_labels;
+
+		HashTable<String, uint32> m_labelIDs;
+
+		std::mutex m_bufferMutex;
+
+		Array<std::shared_ptr<ThreadBuffer>> m_buffers;
+
+		uint32 m_nextThreadIndex = 0;
+
+		// 回収済みの区間。MaxCollectedEvents 個に達した後はリングバッファとして使う
+		Array<Event> m_events;
+
+		// m_events が一杯のとき、最も古い区間の位置（次に上書きする位置）
+		size_t m_oldestEvent = 0;
+
+		[[nodiscard]]
+		ThreadBuffer& getThreadBuffer();
+
+		void collectUnlocked();
+
+		void pushEvent(const Event& event);
+	};
+}
@@ -13,6 +13,7 @@
 # include <Siv3D/Profiler/IProfiler.hpp>
 # include <Siv3D/AssetMonitor/IAssetMonitor.hpp>
 # include <Siv3D/Common/Siv3DEngine.hpp>
+# include "ScopeProfiler.hpp"
 
 namespace s3d
 {
@@ -32,5 +33,25 @@ namespace s3d
 		{
 			return SIV3D_ENGINE(Profiler)->getStat();
 		}
+
+		void EnableScopeProfiler(const bool enabled)
+		{
+			ScopeProfiler::GetInstance().setEnabled(enabled);
+		}
+
+		bool IsScopeProfilerEnabled() noexcept
+		{
+			return ScopeProfiler::GetInstance().isEnabled();
+		}
+
+		void ClearScopeProfile()
+		{
+			ScopeProfiler::GetInstance().clear();
+		}
+
+		bool ExportChromeTrace(const FilePathView path)
+		{
+			return ScopeProfiler::GetInstance().exportChromeTrace(path);
+		}
 	}
 }
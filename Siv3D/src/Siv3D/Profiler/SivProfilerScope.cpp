@@ -0,0 +1,53 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ProfilerScope.hpp>
+# include <Siv3D/Time.hpp>
+# include "ScopeProfiler.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 現在のスレッドで計測中のスコープの深さ
+		thread_local uint32 t_profilerScopeDepth = 0;
+	}
+
+	ProfilerLabel::ProfilerLabel(const StringView name)
+		: m_id{ ScopeProfiler::GetInstance().intern(name) } {}
+
+	ProfilerScope::ProfilerScope(const ProfilerLabel& label) noexcept
+	{
+		if (not ScopeProfiler::GetInstance().isEnabled())
+		{
+			return;
+		}
+
+		m_labelID		= label.id();
+		m_depth			= detail::t_profilerScopeDepth++;
+		m_active		= true;
+		m_beginNanosec	= Time::GetNanosec();
+	}
+
+	ProfilerScope::~ProfilerScope()
+	{
+		if (not m_active)
+		{
+			return;
+		}
+
+		const uint64 endNanosec = Time::GetNanosec();
+
+		--detail::t_profilerScopeDepth;
+
+		ScopeProfiler::GetInstance().record(m_labelID, m_depth, m_beginNanosec, endNanosec);
+	}
+}
@@ -63,7 +63,7 @@ namespace s3d
 
 	void CRenderer_Null::flush()
 	{
-		// do nothing
+		pRenderer2D->flush();
 	}
 
 	bool CRenderer_Null::present()
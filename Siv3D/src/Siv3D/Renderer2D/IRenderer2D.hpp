@@ -29,18 +29,20 @@
 # include <Siv3D/RenderTexture.hpp>
 # include <Siv3D/ConstantBuffer.hpp>
 # include <Siv3D/Mat3x2.hpp>
-# include <Siv3D/Particle2D.hpp>
 # include <Siv3D/ParticleSystem2DParameters.hpp>
 
 namespace s3d
 {
 	struct FloatRect;
 	struct ColorF;
+	class ParticleStorage2D;
 
 	struct Renderer2DStat
 	{
 		uint32 drawCalls = 0;
 		uint32 triangleCount = 0;
+		uint32 batchCount = 0;
+		uint64 uploadedBytes = 0;
 	};
 
 	class SIV3D_NOVTABLE ISiv3DRenderer2D
@@ -73,6 +75,8 @@ namespace s3d
 
 		virtual void addCircle(const Float2& center, float r, const Float4& innerColor, const Float4& outerColor) = 0;
 
+		virtual void addCircles(const Circle* circles, const ColorF* colors, size_t num_circles, bool uniformColor) = 0;
+
 		virtual void addCircleFrame(const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor) = 0;
 
 		virtual void addCirclePie(const Float2& center, float r, float startAngle, float angle, const Float4& innerColor, const Float4& outerColor) = 0;
@@ -129,9 +133,13 @@ namespace s3d
 
 		virtual void addRoundRectShadow(const RoundRect& roundRect, float blur, const Float4& color, bool fill) = 0;
 
-		virtual void addTexturedParticles(const Texture& texture, const Array<Particle2D>& particles,
-			ParticleSystem2DParameters::SizeOverLifeTimeFunc sizeOverLifeTimeFunc,
-			ParticleSystem2DParameters::ColorOverLifeTimeFunc colorOverLifeTimeFunc) = 0;
+		virtual void addParticles(const ParticleStorage2D& particles,
+			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc,
+			const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc) = 0;
+
+		virtual void addTexturedParticles(const Texture& texture, const ParticleStorage2D& particles,
+			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc,
+			const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc) = 0;
 
 
 		virtual Float4 getColorMul() const = 0;
@@ -12,6 +12,7 @@
 # include "CRenderer2D_Null.hpp"
 # include <Siv3D/Error.hpp>
 # include <Siv3D/EngineLog.hpp>
+# include <Siv3D/ParticleSystem2D/ParticleStorage2D.hpp>
 
 namespace s3d
 {
@@ -30,6 +31,11 @@ namespace s3d
 		LOG_SCOPED_TRACE(U"CRenderer2D_Null::init()");
 
 		m_emptyTexture = std::make_unique<Texture>();
+
+		m_bufferCreator = [this](Vertex2D::IndexType vertexSize, Vertex2D::IndexType indexSize)
+		{
+			return m_batches.requestBuffer(vertexSize, indexSize);
+		};
 	}
 
 	void CRenderer2D_Null::update()
@@ -42,134 +48,229 @@ namespace s3d
 		return m_stat;
 	}
 
-	void CRenderer2D_Null::addLine(const LineStyle&, const Float2&, const Float2&, float, const Float4(&)[2])
+	void CRenderer2D_Null::addLine(const LineStyle& style, const Float2& begin, const Float2& end, const float thickness, const Float4(&colors)[2])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildLine(style, m_bufferCreator, begin, end, thickness, colors, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addTriangle(const Float2(&)[3], const Float4&)
+	void CRenderer2D_Null::addTriangle(const Float2(&points)[3], const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTriangle(m_bufferCreator, points, color))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addTriangle(const Float2(&)[3], const Float4(&)[3])
+	void CRenderer2D_Null::addTriangle(const Float2(&points)[3], const Float4(&colors)[3])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTriangle(m_bufferCreator, points, colors))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRect(const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addRect(const FloatRect& rect, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRect(m_bufferCreator, rect, color))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRect(const FloatRect&, const Float4(&)[4])
+	void CRenderer2D_Null::addRect(const FloatRect& rect, const Float4(&colors)[4])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRect(m_bufferCreator, rect, colors))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRectFrame(const FloatRect&, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addRectFrame(const FloatRect& rect, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRectFrame(m_bufferCreator, rect, thickness, innerColor, outerColor))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRectFrameTB(const FloatRect&, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addRectFrameTB(const FloatRect& rect, const float thickness, const Float4& topColor, const Float4& bottomColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRectFrameTB(m_bufferCreator, rect, thickness, topColor, bottomColor))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addCircle(const Float2&, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addCircle(const Float2& center, const float r, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircle(m_bufferCreator, center, r, innerColor, outerColor, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addCircleFrame(const Float2&, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addCircles(const Circle* circles, const ColorF* colors, const size_t num_circles, const bool uniformColor)
 	{
-		// do nothing
+		const float scale = getMaxScaling();
+
+		for (size_t i = 0; i < num_circles;)
+		{
+			size_t num_consumed = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildCircles(m_bufferCreator, (circles + i), (uniformColor ? colors : (colors + i)), (num_circles - i), uniformColor, scale, num_consumed))
+			{
+				m_stat.triangleCount += (indexCount / 3);
+			}
+
+			i += num_consumed;
+		}
 	}
 
-	void CRenderer2D_Null::addCirclePie(const Float2&, const float, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addCircleFrame(const Float2& center, const float rInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleFrame(m_bufferCreator, center, rInner, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addCircleArc(const LineStyle&, const Float2&, const float, const float, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addCirclePie(const Float2& center, const float r, const float startAngle, const float angle, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCirclePie(m_bufferCreator, center, r, startAngle, angle, innerColor, outerColor, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addCircleSegment(const Float2&, const float, const float, const float, const Float4&)
+	void CRenderer2D_Null::addCircleArc(const LineStyle& style, const Float2& center, const float rInner, const float startAngle, const float angle, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleArc(m_bufferCreator, style, center, rInner, startAngle, angle, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addEllipse(const Float2&, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addCircleSegment(const Float2& center, const float r, const float startAngle, const float angle, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleSegment(m_bufferCreator, center, r, startAngle, angle, color, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addEllipseFrame(const Float2&, const float, const float, const float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addEllipse(const Float2& center, const float a, const float b, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipse(m_bufferCreator, center, a, b, innerColor, outerColor, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addQuad(const FloatQuad&, const Float4&)
+	void CRenderer2D_Null::addEllipseFrame(const Float2& center, const float aInner, const float bInner, const float thickness, const Float4& innerColor, const Float4& outerColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildEllipseFrame(m_bufferCreator, center, aInner, bInner, thickness, innerColor, outerColor, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addQuad(const FloatQuad&, const Float4(&)[4])
+	void CRenderer2D_Null::addQuad(const FloatQuad& quad, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildQuad(m_bufferCreator, quad, color))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRect(const FloatRect&, const float, const float, const float, const Float4&)
+	void CRenderer2D_Null::addQuad(const FloatQuad& quad, const Float4(&colors)[4])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildQuad(m_bufferCreator, quad, colors))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRect(const FloatRect&, float, float, float, const Float4&, const Float4&)
+	void CRenderer2D_Null::addRoundRect(const FloatRect& rect, const float w, const float h, const float r, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRect(m_bufferCreator, m_buffer, rect, w, h, r, color, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRectFrame(const RoundRect&, const RoundRect&, const Float4&)
+	void CRenderer2D_Null::addRoundRect(const FloatRect& rect, const float w, const float h, const float r, const Float4& topColor, const Float4& bottomColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRect(m_bufferCreator, m_buffer, rect, w, h, r, topColor, bottomColor, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRectFrame(const RoundRect&, const RoundRect&, const Float4&, const Float4&)
+	void CRenderer2D_Null::addRoundRectFrame(const RoundRect& outer, const RoundRect& inner, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectFrame(m_bufferCreator, m_buffer, outer, inner, color, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addLineString(const LineStyle&, const Vec2*, const size_t, const Optional<Float2>&, const float, const bool, const Float4&, const CloseRing)
+	void CRenderer2D_Null::addRoundRectFrame(const RoundRect& outer, const RoundRect& inner, const Float4& topColor, const Float4& bottomColor)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectFrame(m_bufferCreator, m_buffer, outer, inner, topColor, bottomColor, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addLineString(const Vec2*, const ColorF*, const size_t, const Optional<Float2>&, const float, const bool, const CloseRing)
+	void CRenderer2D_Null::addLineString(const LineStyle& style, const Vec2* points, const size_t size, const Optional<Float2>& offset, const float thickness, const bool inner, const Float4& color, const CloseRing closeRing)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildLineString(m_bufferCreator, m_buffer, style, points, size, offset, thickness, inner, color, closeRing, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addPolygon(const Array<Float2>&, const Array<TriangleIndex>&, const Optional<Float2>&, const Float4&)
+	void CRenderer2D_Null::addLineString(const Vec2* points, const ColorF* colors, size_t size, const Optional<Float2>& offset, const float thickness, const bool inner, const CloseRing closeRing)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildDefaultLineString(m_bufferCreator, points, colors, size, offset, thickness, inner, closeRing, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addPolygon(const Vertex2D*, const size_t, const TriangleIndex*, const size_t)
+	void CRenderer2D_Null::addPolygon(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, const Optional<Float2>& offset, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, indices, offset, color))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addPolygonTransformed(const Array<Float2>&, const Array<TriangleIndex>&, const float, const float, const Float2&, const Float4&)
+	void CRenderer2D_Null::addPolygon(const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygon(m_bufferCreator, vertices, vertexCount, indices, num_triangles))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addPolygonFrame(const Float2*, const size_t, const float, const Float4&)
+	void CRenderer2D_Null::addPolygonTransformed(const Array<Float2>& vertices, const Array<TriangleIndex>& indices, float s, float c, const Float2& offset, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygonTransformed(m_bufferCreator, vertices, indices, s, c, offset, color))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
+	}
+
+	void CRenderer2D_Null::addPolygonFrame(const Float2* points, const size_t size, const float thickness, const Float4& color)
+	{
+		if (const auto indexCount = Vertex2DBuilder::BuildPolygonFrame(m_bufferCreator, m_buffer, points, size, thickness, color, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
 	void CRenderer2D_Null::addNullVertices(const uint32)
@@ -177,56 +278,110 @@ namespace s3d
 		// do nothing
 	}
 
-	void CRenderer2D_Null::addTextureRegion(const Texture&, const FloatRect&, const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addTextureRegion(const Texture&, const FloatRect& rect, const FloatRect& uv, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTextureRegion(m_bufferCreator, rect, uv, color))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addTextureRegion(const Texture&, const FloatRect&, const FloatRect&, const Float4(&)[4])
+	void CRenderer2D_Null::addTextureRegion(const Texture&, const FloatRect& rect, const FloatRect& uv, const Float4(&colors)[4])
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTextureRegion(m_bufferCreator, rect, uv, colors))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedCircle(const Texture&, const Circle&, const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addTexturedCircle(const Texture&, const Circle& circle, const FloatRect& uv, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedCircle(m_bufferCreator, circle, uv, color, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedQuad(const Texture&, const FloatQuad&, const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addTexturedQuad(const Texture&, const FloatQuad& quad, const FloatRect& uv, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedQuad(m_bufferCreator, quad, uv, color))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedRoundRect(const Texture&, const FloatRect&, const float, const float, const float, const FloatRect&, const Float4&)
+	void CRenderer2D_Null::addTexturedRoundRect(const Texture&, const FloatRect& rect, const float w, const float h, const float r, const FloatRect& uvRect, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedRoundRect(m_bufferCreator, m_buffer, rect, w, h, r, uvRect, color, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedVertices(const Texture&, const Vertex2D*, const size_t, const TriangleIndex*, const size_t)
+	void CRenderer2D_Null::addTexturedVertices(const Texture&, const Vertex2D* vertices, const size_t vertexCount, const TriangleIndex* indices, const size_t num_triangles)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildTexturedVertices(m_bufferCreator, vertices, vertexCount, indices, num_triangles))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRectShadow(const FloatRect&, const float, const Float4&, bool)
+	void CRenderer2D_Null::addRectShadow(const FloatRect& rect, const float blur, const Float4& color, const bool fill)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRectShadow(m_bufferCreator, rect, blur, color, fill))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addCircleShadow(const Circle&, const float, const Float4&)
+	void CRenderer2D_Null::addCircleShadow(const Circle& circle, const float blur, const Float4& color)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildCircleShadow(m_bufferCreator, circle, blur, color, getMaxScaling()))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addRoundRectShadow(const RoundRect&, const float, const Float4&, const bool)
+	void CRenderer2D_Null::addRoundRectShadow(const RoundRect& roundRect, const float blur, const Float4& color, const bool fill)
 	{
-		// do nothing
+		if (const auto indexCount = Vertex2DBuilder::BuildRoundRectShadow(m_bufferCreator, roundRect, blur, color, getMaxScaling(), fill))
+		{
+			m_stat.triangleCount += (indexCount / 3);
+		}
 	}
 
-	void CRenderer2D_Null::addTexturedParticles(const Texture&, const Array<Particle2D>&,
-		ParticleSystem2DParameters::SizeOverLifeTimeFunc,
-		ParticleSystem2DParameters::ColorOverLifeTimeFunc)
+	void CRenderer2D_Null::addParticles(const ParticleStorage2D& particles,
+		const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc,
+		const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
 	{
-		// do nothing
+		for (size_t i = 0; i < particles.size();)
+		{
+			size_t num_consumed = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildParticles(m_bufferCreator, particles, i, sizeOverLifeTimeFunc, colorOverLifeTimeFunc, num_consumed))
+			{
+				m_stat.triangleCount += (indexCount / 3);
+			}
+
+			i += num_consumed;
+		}
+	}
+
+	void CRenderer2D_Null::addTexturedParticles(const Texture&, const ParticleStorage2D& particles,
+		const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc,
+		const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
+	{
+		for (size_t i = 0; i < particles.size();)
+		{
+			size_t num_consumed = 0;
+
+			if (const auto indexCount = Vertex2DBuilder::BuildParticles(m_bufferCreator, particles, i, sizeOverLifeTimeFunc, colorOverLifeTimeFunc, num_consumed))
+			{
+				m_stat.triangleCount += (indexCount / 3);
+			}
+
+			i += num_consumed;
+		}
 	}
 
 
@@ -389,6 +544,16 @@ namespace s3d
 
 	void CRenderer2D_Null::flush()
 	{
-		// do nothing
+		for (size_t i = 0; i < m_batches.num_batches(); ++i)
+		{
+			if (const auto& batch = m_batches.getBatch(i);
+				not batch.isEmpty())
+			{
+				++m_stat.batchCount;
+				m_stat.uploadedBytes += ((sizeof(Vertex2D) * batch.vertexCount) + (sizeof(Vertex2D::IndexType) * batch.indexCount));
+			}
+		}
+
+		m_batches.reset();
 	}
 }
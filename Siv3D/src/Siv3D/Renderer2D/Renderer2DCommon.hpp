@@ -42,5 +42,7 @@ namespace s3d
 		uint32 startIndexLocation = 0;
 
 		uint32 baseVertexLocation = 0;
+
+		uint32 vertexCount = 0;
 	};
 }
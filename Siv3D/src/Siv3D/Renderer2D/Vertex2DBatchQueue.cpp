@@ -0,0 +1,194 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/EngineLog.hpp>
+# include "Vertex2DBatchQueue.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]]
+		static size_t CalculateNewArraySize(const size_t current, const size_t target) noexcept
+		{
+			size_t newArraySize = current * 2;
+
+			while (newArraySize < target)
+			{
+				newArraySize *= 2;
+			}
+
+			return newArraySize;
+		}
+	}
+
+	Vertex2DBatchQueue::Vertex2DBatchQueue(const uint32 maxBatchVertexCount, const uint32 maxBatchIndexCount)
+		: m_maxBatchVertexCount{ maxBatchVertexCount }
+		, m_maxBatchIndexCount{ maxBatchIndexCount }
+		, m_batches(1)
+		, m_vertexArray(InitialVertexArraySize)
+		, m_indexArray(InitialIndexArraySize) {}
+
+	void Vertex2DBatchQueue::setMappedRegion(Vertex2D* pVertex, const uint32 vertexCapacity, Vertex2D::IndexType* pIndex, const uint32 indexCapacity) noexcept
+	{
+		assert((m_batches.size() == 1) && m_batches.front().isEmpty());
+
+		m_pMappedVertex				= pVertex;
+		m_pMappedIndex				= pIndex;
+		m_mappedVertexCapacity		= (pVertex ? vertexCapacity : 0);
+		m_mappedIndexCapacity		= (pIndex ? indexCapacity : 0);
+		m_mapped					= {};
+		m_mappedRegionExhausted		= false;
+	}
+
+	Vertex2DBufferPointer Vertex2DBatchQueue::requestBuffer(const uint16 vertexSize, const uint32 indexSize)
+	{
+		if ((m_maxBatchVertexCount < vertexSize) || (m_maxBatchIndexCount < indexSize)) SIV3D_UNLIKELY
+		{
+			return{ nullptr, 0, 0 };
+		}
+
+		bool mapped = false;
+
+		if (m_pMappedVertex && (not m_mappedRegionExhausted))
+		{
+			if (((m_mapped.vertexWritePos + vertexSize) <= m_mappedVertexCapacity)
+				&& ((m_mapped.indexWritePos + indexSize) <= m_mappedIndexCapacity))
+			{
+				mapped = true;
+			}
+			else
+			{
+				m_mappedRegionExhausted = true;
+			}
+		}
+
+		if ((not mapped) && (not reserveStaged(vertexSize, indexSize))) SIV3D_UNLIKELY
+		{
+			return{ nullptr, 0, 0 };
+		}
+
+		Region& region = (mapped ? m_mapped : m_staged);
+
+		if (const auto& lastBatch = m_batches.back();
+			(not lastBatch.isEmpty())
+			&& ((lastBatch.mapped != mapped)
+				|| (m_maxBatchVertexCount < (lastBatch.vertexCount + vertexSize))
+				|| (m_maxBatchIndexCount < (lastBatch.indexCount + indexSize))))
+		{
+			m_batches.emplace_back();
+		}
+
+		auto& batch = m_batches.back();
+
+		if (batch.isEmpty())
+		{
+			batch.vertexOffset	= region.vertexWritePos;
+			batch.indexOffset	= region.indexWritePos;
+			batch.mapped		= mapped;
+		}
+
+		Vertex2D* const pVertex = ((mapped ? m_pMappedVertex : m_vertexArray.data()) + region.vertexWritePos);
+		Vertex2D::IndexType* const pIndex = ((mapped ? m_pMappedIndex : m_indexArray.data()) + region.indexWritePos);
+		const auto indexOffset = static_cast<Vertex2D::IndexType>(batch.vertexCount);
+
+		region.vertexWritePos	+= vertexSize;
+		region.indexWritePos	+= indexSize;
+		batch.vertexCount		+= vertexSize;
+		batch.indexCount		+= indexSize;
+
+		return{ pVertex, pIndex, indexOffset };
+	}
+
+	size_t Vertex2DBatchQueue::num_batches() const noexcept
+	{
+		return m_batches.size();
+	}
+
+	const Vertex2DBatchQueue::Batch& Vertex2DBatchQueue::getBatch(const size_t batchIndex) const noexcept
+	{
+		assert(batchIndex < m_batches.size());
+
+		return m_batches[batchIndex];
+	}
+
+	const Vertex2D* Vertex2DBatchQueue::getStagedVertices(const Batch& batch) const noexcept
+	{
+		assert(not batch.mapped);
+
+		return (m_vertexArray.data() + batch.vertexOffset);
+	}
+
+	const Vertex2D::IndexType* Vertex2DBatchQueue::getStagedIndices(const Batch& batch) const noexcept
+	{
+		assert(not batch.mapped);
+
+		return (m_indexArray.data() + batch.indexOffset);
+	}
+
+	uint32 Vertex2DBatchQueue::getMappedVertexCount() const noexcept
+	{
+		return m_mapped.vertexWritePos;
+	}
+
+	uint32 Vertex2DBatchQueue::getMappedIndexCount() const noexcept
+	{
+		return m_mapped.indexWritePos;
+	}
+
+	void Vertex2DBatchQueue::reset() noexcept
+	{
+		m_batches.clear();
+		m_batches.emplace_back();
+
+		m_staged = {};
+
+		m_pMappedVertex				= nullptr;
+		m_pMappedIndex				= nullptr;
+		m_mappedVertexCapacity		= 0;
+		m_mappedIndexCapacity		= 0;
+		m_mapped					= {};
+		m_mappedRegionExhausted		= false;
+	}
+
+	bool Vertex2DBatchQueue::reserveStaged(const uint32 vertexSize, const uint32 indexSize)
+	{
+		// VB
+		if (const uint32 vertexArrayWritePosTarget = (m_staged.vertexWritePos + vertexSize);
+			m_vertexArray.size() < vertexArrayWritePosTarget) SIV3D_UNLIKELY
+		{
+			if (MaxVertexArraySize < vertexArrayWritePosTarget) SIV3D_UNLIKELY
+			{
+				return false;
+			}
+
+			const size_t newVertexArraySize = detail::CalculateNewArraySize(m_vertexArray.size(), vertexArrayWritePosTarget);
+			LOG_TRACE(U"ℹ️ Resized Vertex2DBatchQueue::m_vertexArray (size: {} -> {})"_fmt(m_vertexArray.size(), newVertexArraySize));
+			m_vertexArray.resize(newVertexArraySize);
+		}
+
+		// IB
+		if (const uint32 indexArrayWritePosTarget = (m_staged.indexWritePos + indexSize);
+			m_indexArray.size() < indexArrayWritePosTarget) SIV3D_UNLIKELY
+		{
+			if (MaxIndexArraySize < indexArrayWritePosTarget) SIV3D_UNLIKELY
+			{
+				return false;
+			}
+
+			const size_t newIndexArraySize = detail::CalculateNewArraySize(m_indexArray.size(), indexArrayWritePosTarget);
+			LOG_TRACE(U"ℹ️ Resized Vertex2DBatchQueue::m_indexArray (size: {} -> {})"_fmt(m_indexArray.size(), newIndexArraySize));
+			m_indexArray.resize(newIndexArraySize);
+		}
+
+		return true;
+	}
+}
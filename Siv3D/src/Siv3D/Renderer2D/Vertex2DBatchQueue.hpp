@@ -0,0 +1,132 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Vertex2D.hpp>
+# include <Siv3D/Array.hpp>
+# include "Vertex2DBufferPointer.hpp"
+
+namespace s3d
+{
+	/// @brief 2D 描画の頂点・インデックスをバッチ単位に振り分ける、グラフィックス API に依存しない部分
+	/// @remark setMappedRegion() で GPU から直接読める領域（永続マップされたバッファなど）が与えられている場合は、
+	/// そこに直接書き込ませて、アップロードのためのコピーを省きます。
+	/// 領域が足りなくなった後の要求や、領域が与えられていない場合は、CPU 側のステージング配列に書き込ませます。
+	class Vertex2DBatchQueue
+	{
+	public:
+
+		struct Batch
+		{
+			/// @brief バッチ内の頂点数
+			uint32 vertexCount = 0;
+
+			/// @brief バッチ内のインデックス数
+			uint32 indexCount = 0;
+
+			/// @brief 書き込み先の領域における、バッチの最初の頂点の位置
+			uint32 vertexOffset = 0;
+
+			/// @brief 書き込み先の領域における、バッチの最初のインデックスの位置
+			uint32 indexOffset = 0;
+
+			/// @brief 書き込み先がマップされた領域である場合 true, ステージング配列である場合 false
+			bool mapped = false;
+
+			[[nodiscard]]
+			bool isEmpty() const noexcept
+			{
+				return ((vertexCount == 0) && (indexCount == 0));
+			}
+		};
+
+		/// @param maxBatchVertexCount 1 つのバッチに含められる最大の頂点数
+		/// @param maxBatchIndexCount 1 つのバッチに含められる最大のインデックス数
+		SIV3D_NODISCARD_CXX20
+		Vertex2DBatchQueue(uint32 maxBatchVertexCount, uint32 maxBatchIndexCount);
+
+		/// @brief このフレームで直接書き込む領域を設定します。
+		/// @remark reset() を呼ぶと解除されます。バッチが空でないときに呼んではいけません。
+		void setMappedRegion(Vertex2D* pVertex, uint32 vertexCapacity, Vertex2D::IndexType* pIndex, uint32 indexCapacity) noexcept;
+
+		/// @brief 頂点とインデックスの書き込み先を確保します。
+		/// @remark 現在のバッチに収まらない場合は新しいバッチを開始します。確保に失敗した場合は pVertex が nullptr になります。
+		[[nodiscard]]
+		Vertex2DBufferPointer requestBuffer(uint16 vertexSize, uint32 indexSize);
+
+		[[nodiscard]]
+		size_t num_batches() const noexcept;
+
+		[[nodiscard]]
+		const Batch& getBatch(size_t batchIndex) const noexcept;
+
+		[[nodiscard]]
+		const Vertex2D* getStagedVertices(const Batch& batch) const noexcept;
+
+		[[nodiscard]]
+		const Vertex2D::IndexType* getStagedIndices(const Batch& batch) const noexcept;
+
+		/// @brief マップされた領域に書き込まれた頂点数を返します。
+		[[nodiscard]]
+		uint32 getMappedVertexCount() const noexcept;
+
+		/// @brief マップされた領域に書き込まれたインデックス数を返します。
+		[[nodiscard]]
+		uint32 getMappedIndexCount() const noexcept;
+
+		/// @brief すべてのバッチを破棄し、マップされた領域の設定を解除します。
+		void reset() noexcept;
+
+	private:
+
+		struct Region
+		{
+			uint32 vertexWritePos = 0;
+
+			uint32 indexWritePos = 0;
+		};
+
+		static constexpr uint32 InitialVertexArraySize	= 4096;
+		static constexpr uint32 InitialIndexArraySize	= (4096 * 8); // 32,768
+
+		static constexpr uint32 MaxVertexArraySize		= (65536 * 64); // 4,194,304
+		static constexpr uint32 MaxIndexArraySize		= (65536 * 64); // 4,194,304
+
+		uint32 m_maxBatchVertexCount = 0;
+
+		uint32 m_maxBatchIndexCount = 0;
+
+		Array<Batch> m_batches;
+
+		Array<Vertex2D> m_vertexArray;
+
+		Array<Vertex2D::IndexType> m_indexArray;
+
+		Region m_staged;
+
+		Vertex2D* m_pMappedVertex = nullptr;
+
+		Vertex2D::IndexType* m_pMappedIndex = nullptr;
+
+		uint32 m_mappedVertexCapacity = 0;
+
+		uint32 m_mappedIndexCapacity = 0;
+
+		Region m_mapped;
+
+		// マップされた領域が一度足りなくなったら、描画順を保つため、このフレームの残りはすべてステージング配列に書き込む
+		bool m_mappedRegionExhausted = false;
+
+		[[nodiscard]]
+		bool reserveStaged(uint32 vertexSize, uint32 indexSize);
+	};
+}
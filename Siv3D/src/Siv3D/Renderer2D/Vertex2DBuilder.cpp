@@ -13,6 +13,8 @@
 # include <Siv3D/FastMath.hpp>
 # include <Siv3D/Math.hpp>
 # include <Siv3D/OffsetCircular.hpp>
+# include <Siv3D/Threading.hpp>
+# include <Siv3D/ParticleSystem2D/ParticleStorage2D.hpp>
 
 namespace s3d
 {
@@ -64,6 +66,90 @@ namespace s3d
 			}
 		}
 
+		// 1 回の Build 関数でまとめて要求するインデックス数の上限
+		static constexpr uint32 MaxBatchIndexCount = 65535;
+
+		// この数以上の円をまとめて描く場合は、頂点の生成をワーカースレッドに分割する
+		static constexpr size_t ParallelCircleThreshold = 512;
+
+		static constexpr size_t ParallelCircleGrainSize = 128;
+
+		// この数以上のパーティクルをまとめて描く場合は、頂点の生成をワーカースレッドに分割する
+		static constexpr size_t ParallelParticleThreshold = 2048;
+
+		static constexpr size_t ParallelParticleGrainSize = 512;
+
+		static void WriteParticle(Vertex2D* pVertex, const float cx, const float cy, const float size, const float rotation, const Float4& color) noexcept
+		{
+			const float x = (size * 0.5f);
+			const auto [s, c] = FastMath::SinCos(rotation);
+			const float xc = (x * c);
+			const float xs = (x * s);
+
+			pVertex[0].set({ (-xc + xs + cx), (-xs - xc + cy) }, 0.0f, 0.0f, color);
+			pVertex[1].set({ (xc + xs + cx), (xs - xc + cy) }, 1.0f, 0.0f, color);
+			pVertex[2].set({ (-xc - xs + cx), (-xs + xc + cy) }, 0.0f, 1.0f, color);
+			pVertex[3].set({ (xc - xs + cx), (xs + xc + cy) }, 1.0f, 1.0f, color);
+		}
+
+		static void WriteCircle(Vertex2D* pVertex, Vertex2D::IndexType* pIndex, const Vertex2D::IndexType indexOffset,
+			const Float2& center, const float r, const Vertex2D::IndexType quality, const Float4& innerColor, const Float4& outerColor) noexcept
+		{
+			const Vertex2D::IndexType vertexSize = (quality + 1);
+
+			// 中心
+			const float centerX = center.x;
+			const float centerY = center.y;
+			pVertex[0].pos.set(centerX, centerY);
+
+			// 周
+			if (quality <= MaxSinCosTableQuality)
+			{
+				const Float2* pCS = GetSinCosTableStartPtr(quality);
+				Vertex2D* pDst = &pVertex[1];
+
+				for (Vertex2D::IndexType i = 0; i < quality; ++i)
+				{
+					(pDst++)->pos.set(r * pCS->x + centerX, r * pCS->y + centerY);
+					++pCS;
+				}
+			}
+			else
+			{
+				const float radDelta = Math::TwoPiF / quality;
+				Vertex2D* pDst = &pVertex[1];
+
+				for (Vertex2D::IndexType i = 0; i < quality; ++i)
+				{
+					const float rad = (radDelta * i);
+					const auto [s, c] = FastMath::SinCos(rad);
+					(pDst++)->pos.set(centerX + r * c, centerY - r * s);
+				}
+			}
+
+			{
+				(pVertex++)->color = innerColor;
+
+				for (size_t i = 1; i < vertexSize; ++i)
+				{
+					(pVertex++)->color = outerColor;
+				}
+			}
+
+			{
+				for (Vertex2D::IndexType i = 0; i < (quality - 1); ++i)
+				{
+					*pIndex++ = indexOffset + (i + 1);
+					*pIndex++ = indexOffset;
+					*pIndex++ = indexOffset + (i + 2);
+				}
+
+				*pIndex++ = (indexOffset + quality);
+				*pIndex++ = indexOffset;
+				*pIndex++ = (indexOffset + 1);
+			}
+		}
+
 		[[nodiscard]]
 		inline constexpr Vertex2D::IndexType CalculateCircleFrameQuality(const float size) noexcept
 		{
@@ -501,59 +587,75 @@ namespace s3d
 				return 0;
 			}
 
-			// 中心
-			const float centerX = center.x;
-			const float centerY = center.y;
-			pVertex[0].pos.set(centerX, centerY);
+			detail::WriteCircle(pVertex, pIndex, indexOffset, center, r, quality, innerColor, outerColor);
 
-			// 周
-			if (quality <= detail::MaxSinCosTableQuality)
-			{
-				const Float2* pCS = detail::GetSinCosTableStartPtr(quality);
-				Vertex2D* pDst = &pVertex[1];
+			return indexSize;
+		}
 
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
-				{
-					(pDst++)->pos.set(r * pCS->x + centerX, r * pCS->y + centerY);
-					++pCS;
-				}
+		Vertex2D::IndexType BuildCircles(const BufferCreatorFunc& bufferCreator, const Circle* circles, const ColorF* colors, const size_t num_circles, const bool uniformColor, const float scale, size_t& num_consumed)
+		{
+			num_consumed = 0;
+
+			if (num_circles == 0)
+			{
+				return 0;
 			}
-			else
+
+			// 1 回のバッファ要求（インデックスが 16-bit に収まる範囲）に入るだけの円を集める
+			Array<uint32> vertexOffsets(Arg::reserve = Min<size_t>(num_circles, (detail::MaxBatchIndexCount / 18)));
+			uint32 vertexSize = 0, indexSize = 0;
+
+			for (size_t i = 0; i < num_circles; ++i)
 			{
-				const float radDelta = Math::TwoPiF / quality;
-				Vertex2D* pDst = &pVertex[1];
+				const uint32 quality = detail::CalculateCircleQuality(static_cast<float>(Abs(circles[i].r)) * scale);
 
-				for (Vertex2D::IndexType i = 0; i < quality; ++i)
+				if ((detail::MaxBatchIndexCount < (vertexSize + quality + 1))
+					|| (detail::MaxBatchIndexCount < (indexSize + quality * 3)))
 				{
-					const float rad = (radDelta * i);
-					const auto [s, c] = FastMath::SinCos(rad);
-					(pDst++)->pos.set(centerX + r * c, centerY - r * s);
+					break;
 				}
+
+				vertexOffsets.push_back(vertexSize);
+				vertexSize += (quality + 1);
+				indexSize += (quality * 3);
 			}
 
-			{
-				(pVertex++)->color = innerColor;
+			const size_t count = vertexOffsets.size();
+			num_consumed = count;
 
-				for (size_t i = 1; i < vertexSize; ++i)
-				{
-					(pVertex++)->color = outerColor;
-				}
+			auto [pVertex, pIndex, indexOffset] = bufferCreator(static_cast<Vertex2D::IndexType>(vertexSize), static_cast<Vertex2D::IndexType>(indexSize));
+
+			if (not pVertex)
+			{
+				return 0;
 			}
 
+			// 各円の書き込み先は事前に決まっているので、どの順に処理しても結果は同じになる
+			const auto writeCircles = [&, pVertex = pVertex, pIndex = pIndex, indexOffset = indexOffset](const size_t begin, const size_t end)
 			{
-				for (Vertex2D::IndexType i = 0; i < (quality - 1); ++i)
+				for (size_t i = begin; i < end; ++i)
 				{
-					*pIndex++ = indexOffset + (i + 1);
-					*pIndex++ = indexOffset;
-					*pIndex++ = indexOffset + (i + 2);
+					const uint32 vertexOffset = vertexOffsets[i];
+					const uint32 nextVertexOffset = (((i + 1) < count) ? vertexOffsets[i + 1] : vertexSize);
+					const Vertex2D::IndexType quality = static_cast<Vertex2D::IndexType>(nextVertexOffset - vertexOffset - 1);
+					const uint32 circleIndexOffset = ((vertexOffset - static_cast<uint32>(i)) * 3);
+					const Float4 color = colors[uniformColor ? 0 : i].toFloat4();
+
+					detail::WriteCircle((pVertex + vertexOffset), (pIndex + circleIndexOffset), static_cast<Vertex2D::IndexType>(indexOffset + vertexOffset),
+						circles[i].center, static_cast<float>(circles[i].r), quality, color, color);
 				}
+			};
 
-				*pIndex++ = (indexOffset + quality);
-				*pIndex++ = indexOffset;
-				*pIndex++ = (indexOffset + 1);
+			if (count < detail::ParallelCircleThreshold)
+			{
+				writeCircles(0, count);
+			}
+			else
+			{
+				Threading::detail::ParallelForRange(0, count, detail::ParallelCircleGrainSize, writeCircles);
 			}
 
-			return indexSize;
+			return static_cast<Vertex2D::IndexType>(indexSize);
 		}
 
 		Vertex2D::IndexType BuildCircleFrame(const BufferCreatorFunc& bufferCreator, const Float2& center, const float rInner, const float thickness, const Float4& innerColor, const Float4& outerColor, const float scale)
@@ -3512,11 +3614,22 @@ namespace s3d
 			return indexCount;
 		}
 
-		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const Array<Particle2D>& particles,
-			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc)
+		Vertex2D::IndexType BuildParticles(const BufferCreatorFunc& bufferCreator, const ParticleStorage2D& particles, const size_t offset,
+			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc, size_t& num_consumed)
 		{
-			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(particles.size() * 4);
-			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(particles.size() * 6);
+			num_consumed = 0;
+
+			if (particles.size() <= offset)
+			{
+				return 0;
+			}
+
+			// 1 回のバッファ要求（インデックスが 16-bit に収まる範囲）に入るだけのパーティクルを処理する
+			const size_t count = Min<size_t>((particles.size() - offset), (detail::MaxBatchIndexCount / 6));
+			const Vertex2D::IndexType vertexSize = static_cast<Vertex2D::IndexType>(count * 4);
+			const Vertex2D::IndexType indexSize = static_cast<Vertex2D::IndexType>(count * 6);
+			num_consumed = count;
+
 			auto [pVertex, pIndex, indexOffset] = bufferCreator(vertexSize, indexSize);
 
 			if (not pVertex)
@@ -3524,31 +3637,52 @@ namespace s3d
 				return 0;
 			}
 
-			for (const auto& particle : particles)
-			{
-				const float size = sizeOverLifeTimeFunc(particle.startSize, particle.startLifeTime, particle.remainingLifeTime);
-				const Float4 color = colorOverLifeTimeFunc(particle.startColor, particle.startLifeTime, particle.remainingLifeTime);
+			const float* const pPositionX			= (particles.positionX() + offset);
+			const float* const pPositionY			= (particles.positionY() + offset);
+			const float* const pRotation			= (particles.rotation() + offset);
+			const float* const pStartSize			= (particles.startSize() + offset);
+			const float* const pStartLifeTime		= (particles.startLifeTime() + offset);
+			const float* const pRemainingLifeTime	= (particles.remainingLifeTime() + offset);
+			const Float4* const pStartColor			= (particles.startColor() + offset);
 
-				const float size_half = (size * 0.5f);
-				const float cx = particle.position.x;
-				const float cy = particle.position.y;
+			if (sizeOverLifeTimeFunc || colorOverLifeTimeFunc)
+			{
+				// ユーザ定義の関数は、呼び出し元のスレッドで発生順に呼ぶ
+				for (size_t i = 0; i < count; ++i)
+				{
+					const float size = (sizeOverLifeTimeFunc ? sizeOverLifeTimeFunc(pStartSize[i], pStartLifeTime[i], pRemainingLifeTime[i])
+						: (pStartSize[i] * (pRemainingLifeTime[i] / pStartLifeTime[i])));
+					const Float4 color = (colorOverLifeTimeFunc ? colorOverLifeTimeFunc(pStartColor[i], pStartLifeTime[i], pRemainingLifeTime[i])
+						: pStartColor[i]);
 
-				const float x = size_half;
-				const auto [s, c] = FastMath::SinCos(particle.rotation);
-				const float xc = x * c;
-				const float xs = x * s;
+					detail::WriteParticle((pVertex + i * 4), pPositionX[i], pPositionY[i], size, pRotation[i], color);
+				}
+			}
+			else
+			{
+				const auto writeParticles = [&, pVertex = pVertex](const size_t begin, const size_t end)
+				{
+					for (size_t i = begin; i < end; ++i)
+					{
+						const float size = (pStartSize[i] * (pRemainingLifeTime[i] / pStartLifeTime[i]));
+						detail::WriteParticle((pVertex + i * 4), pPositionX[i], pPositionY[i], size, pRotation[i], pStartColor[i]);
+					}
+				};
 
-				pVertex[0].set({ -xc + xs + cx, -xs - xc + cy }, 0.0f, 0.0f, color);
-				pVertex[1].set({ xc + xs + cx, xs - xc + cy }, 1.0f, 0.0f, color);
-				pVertex[2].set({ -xc - xs + cx, -xs + xc + cy }, 0.0f, 1.0f, color);
-				pVertex[3].set({ xc - xs + cx, xs + xc + cy }, 1.0f, 1.0f, color);
-				pVertex += 4;
+				if (count < detail::ParallelParticleThreshold)
+				{
+					writeParticles(0, count);
+				}
+				else
+				{
+					Threading::detail::ParallelForRange(0, count, detail::ParallelParticleGrainSize, writeParticles);
+				}
 			}
 
 			{
 				Vertex2D::IndexType indexBase = indexOffset;
 
-				for (Vertex2D::IndexType n = 0; n < particles.size(); ++n)
+				for (size_t n = 0; n < count; ++n)
 				{
 					for (Vertex2D::IndexType i = 0; i < 6; ++i)
 					{
@@ -14,18 +14,20 @@
 # include <Siv3D/Vertex2D.hpp>
 # include <Siv3D/FloatRect.hpp>
 # include <Siv3D/FloatQuad.hpp>
+# include <Siv3D/Circle.hpp>
 # include <Siv3D/TriangleIndex.hpp>
 # include <Siv3D/ColorHSV.hpp>
 # include <Siv3D/Optional.hpp>
 # include <Siv3D/LineStyle.hpp>
 # include <Siv3D/YesNo.hpp>
 # include <Siv3D/PredefinedYesNo.hpp>
-# include <Siv3D/Particle2D.hpp>
 # include <Siv3D/ParticleSystem2DParameters.hpp>
 # include "Vertex2DBufferPointer.hpp"
 
 namespace s3d
 {
+	class ParticleStorage2D;
+
 	using BufferCreatorFunc = std::function<Vertex2DBufferPointer(Vertex2D::IndexType, Vertex2D::IndexType)>;
 
 	namespace Vertex2DBuilder
@@ -69,6 +71,12 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildCircle(const BufferCreatorFunc& bufferCreator, const Float2& center, float r, const Float4& innerColor, const Float4& outerColor, float scale);
 
+		/// @brief 複数の円の頂点を、1 回のバッファ要求でまとめて生成します。
+		/// @remark インデックスが 16-bit に収まる数までの円を処理し、その数を num_consumed に格納します。
+		/// 円が多い場合は頂点の生成を並列に行いますが、結果は BuildCircle を順に呼んだ場合と同じです。
+		[[nodiscard]]
+		Vertex2D::IndexType BuildCircles(const BufferCreatorFunc& bufferCreator, const Circle* circles, const ColorF* colors, size_t num_circles, bool uniformColor, float scale, size_t& num_consumed);
+
 		[[nodiscard]]
 		Vertex2D::IndexType BuildCircleFrame(const BufferCreatorFunc& bufferCreator, const Float2& center, float rInner, float thickness, const Float4& innerColor, const Float4& outerColor, float scale);
 
@@ -165,8 +173,10 @@ namespace s3d
 		[[nodiscard]]
 		Vertex2D::IndexType BuildRoundRectShadow(const BufferCreatorFunc& bufferCreator, const RoundRect& roundRect, float blur, const Float4& color, float scale, bool fill);
 
+		/// @brief offset 番目以降のパーティクルのうち、1 回のバッファ要求に収まる数だけの頂点を生成します。
+		/// @remark sizeOverLifeTimeFunc と colorOverLifeTimeFunc が空の場合は既定の関数を使い、頂点の生成を複数のスレッドで行います。
 		[[nodiscard]]
-		Vertex2D::IndexType BuildTexturedParticles(const BufferCreatorFunc& bufferCreator, const Array<Particle2D>& particles,
-			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc);
+		Vertex2D::IndexType BuildParticles(const BufferCreatorFunc& bufferCreator, const ParticleStorage2D& particles, size_t offset,
+			const ParticleSystem2DParameters::SizeOverLifeTimeFunc& sizeOverLifeTimeFunc, const ParticleSystem2DParameters::ColorOverLifeTimeFunc& colorOverLifeTimeFunc, size_t& num_consumed);
 	}
 }
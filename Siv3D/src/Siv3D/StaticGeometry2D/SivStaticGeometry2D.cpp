@@ -0,0 +1,275 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/StaticGeometry2D.hpp>
+# include <Siv3D/2DShapes.hpp>
+# include <Siv3D/LineString.hpp>
+# include <Siv3D/Polygon.hpp>
+# include <Siv3D/Mat3x2.hpp>
+# include <Siv3D/Transformer2D.hpp>
+# include <Siv3D/ScopedColorMul2D.hpp>
+# include <Siv3D/Renderer2D/Vertex2DBuilder.hpp>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 1 つの Buffer2D に格納する頂点とインデックスの上限（Vertex2D::IndexType で表せる範囲）
+		inline constexpr size_t MaxStaticGeometryVertexCount = 65535;
+
+		inline constexpr size_t MaxStaticGeometryIndexCount = 65535;
+
+		// Vertex2DBuilder が要求した書き込み先
+		struct BufferRequest
+		{
+			size_t bufferIndex = 0;
+
+			size_t triangleOffset = 0;
+
+			size_t triangleCount = 0;
+		};
+
+		// Vertex2DBuilder の出力先を、Buffer2D の配列の末尾にする。要求ごとの書き込み先を requests に記録する
+		[[nodiscard]]
+		static BufferCreatorFunc MakeBufferCreator(Array<Buffer2D>& buffers, Array<BufferRequest>& requests)
+		{
+			return [&buffers, &requests](const Vertex2D::IndexType vertexSize, const Vertex2D::IndexType indexSize) -> Vertex2DBufferPointer
+			{
+				if (buffers.isEmpty()
+					|| (MaxStaticGeometryVertexCount < (buffers.back().vertices.size() + vertexSize))
+					|| (MaxStaticGeometryIndexCount < ((buffers.back().indices.size() * 3) + indexSize)))
+				{
+					buffers.emplace_back();
+				}
+
+				Buffer2D& buffer = buffers.back();
+				const size_t vertexOffset = buffer.vertices.size();
+				const size_t triangleOffset = buffer.indices.size();
+				const size_t triangleCount = (indexSize / 3);
+
+				buffer.vertices.resize(vertexOffset + vertexSize);
+				buffer.indices.resize(triangleOffset + triangleCount);
+
+				requests.push_back({ (buffers.size() - 1), triangleOffset, triangleCount });
+
+				return{ (buffer.vertices.data() + vertexOffset),
+					(reinterpret_cast<Vertex2D::IndexType*>(buffer.indices.data()) + (triangleOffset * 3)),
+					static_cast<Vertex2D::IndexType>(vertexOffset) };
+			};
+		}
+
+		template <class Builder>
+		static void Record(Array<Buffer2D>& buffers, Builder builder)
+		{
+			const size_t num_buffers = buffers.size();
+
+			Array<BufferRequest> requests;
+
+			// Builder は複数回の要求で書き込み先を確保し、書き込んだインデックスの合計を返す
+			size_t remainingTriangles = (builder(MakeBufferCreator(buffers, requests)) / 3);
+
+			// 確保した分より少ないインデックスしか書き込まれなかった場合は、後の要求の分から切り詰める
+			for (const auto& request : requests)
+			{
+				const size_t triangleCount = Min(request.triangleCount, remainingTriangles);
+				remainingTriangles -= triangleCount;
+
+				if (triangleCount < request.triangleCount)
+				{
+					Buffer2D& buffer = buffers[request.bufferIndex];
+					buffer.indices.resize(Min(buffer.indices.size(), (request.triangleOffset + triangleCount)));
+				}
+			}
+
+			// 新しく作った Buffer2D が空のままであれば取り除く
+			while ((num_buffers < buffers.size()) && buffers.back().indices.isEmpty())
+			{
+				buffers.pop_back();
+			}
+		}
+	}
+
+	StaticGeometry2D::StaticGeometry2D(const double qualityScale) noexcept
+		: m_qualityScale{ static_cast<float>(qualityScale) } {}
+
+	StaticGeometry2D& StaticGeometry2D::addRect(const RectF& rect, const ColorF& color)
+	{
+		detail::Record(m_buffers, [&](const BufferCreatorFunc& bufferCreator)
+		{
+			return Vertex2DBuilder::BuildRect(bufferCreator, FloatRect{ rect.x, rect.y, (rect.x + rect.w), (rect.y + rect.h) }, color.toFloat4());
+		});
+
+		return *this;
+	}
+
+	StaticGeometry2D& StaticGeometry2D::addRectFrame(const RectF& rect, const double thickness, const ColorF& color)
+	{
+		const double innerThickness = (thickness * 0.5);
+
+		if ((rect.w <= 0.0) || (rect.h <= 0.0) || (thickness <= 0.0))
+		{
+			return *this;
+		}
+
+		if (((rect.w * 0.5) <= innerThickness) || ((rect.h * 0.5) <= innerThickness))
+		{
+			return addRect(rect.stretched(innerThickness), color);
+		}
+
+		const Float4 color0 = color.toFloat4();
+
+		detail::Record(m_buffers, [&](const BufferCreatorFunc& bufferCreator)
+		{
+			return Vertex2DBuilder::BuildRectFrame(bufferCreator,
+				FloatRect{ (rect.x + innerThickness), (rect.y + innerThickness), (rect.x + rect.w - innerThickness), (rect.y + rect.h - innerThickness) },
+				static_cast<float>(thickness), color0, color0);
+		});
+
+		return *this;
+	}
+
+	StaticGeometry2D& StaticGeometry2D::addCircle(const Circle& circle, const ColorF& color)
+	{
+		const Float4 color0 = color.toFloat4();
+
+		detail::Record(m_buffers, [&](const BufferCreatorFunc& bufferCreator)
+		{
+			return Vertex2DBuilder::BuildCircle(bufferCreator, circle.center, static_cast<float>(circle.r), color0, color0, m_qualityScale);
+		});
+
+		return *this;
+	}
+
+	StaticGeometry2D& StaticGeometry2D::addCircleFrame(const Circle& circle, const double thickness, const ColorF& color)
+	{
+		const Float4 color0 = color.toFloat4();
+
+		detail::Record(m_buffers, [&](const BufferCreatorFunc& bufferCreator)
+		{
+			return Vertex2DBuilder::BuildCircleFrame(bufferCreator, circle.center,
+				static_cast<float>(circle.r - (thickness * 0.5)), static_cast<float>(thickness), color0, color0, m_qualityScale);
+		});
+
+		return *this;
+	}
+
+	StaticGeometry2D& StaticGeometry2D::addRoundRect(const RoundRect& roundRect, const ColorF& color)
+	{
+		detail::Record(m_buffers, [&](const BufferCreatorFunc& bufferCreator)
+		{
+			return Vertex2DBuilder::BuildRoundRect(bufferCreator, m_buffer,
+				FloatRect{ roundRect.x, roundRect.y, (roundRect.x + roundRect.w), (roundRect.y + roundRect.h) },
+				static_cast<float>(roundRect.w), static_cast<float>(roundRect.h), static_cast<float>(roundRect.r),
+				color.toFloat4(), m_qualityScale);
+		});
+
+		return *this;
+	}
+
+	StaticGeometry2D& StaticGeometry2D::addLine(const Line& line, const double thickness, const ColorF& color)
+	{
+		return addLine(LineStyle::Default, line, thickness, color);
+	}
+
+	StaticGeometry2D& StaticGeometry2D::addLine(const LineStyle& style, const Line& line, const double thickness, const ColorF& color)
+	{
+		const Float4 color0 = color.toFloat4();
+
+		detail::Record(m_buffers, [&](const BufferCreatorFunc& bufferCreator)
+		{
+			return Vertex2DBuilder::BuildLine(style, bufferCreator, line.begin, line.end, static_cast<float>(thickness), { color0, color0 }, m_qualityScale);
+		});
+
+		return *this;
+	}
+
+	StaticGeometry2D& StaticGeometry2D::addLineString(const LineString& lineString, const double thickness, const ColorF& color)
+	{
+		detail::Record(m_buffers, [&](const BufferCreatorFunc& bufferCreator)
+		{
+			return Vertex2DBuilder::BuildLineString(bufferCreator, m_buffer, LineStyle::Default, lineString.data(), lineString.size(),
+				none, static_cast<float>(thickness), false, color.toFloat4(), CloseRing::No, m_qualityScale);
+		});
+
+		return *this;
+	}
+
+	StaticGeometry2D& StaticGeometry2D::addPolygon(const Polygon& polygon, const ColorF& color)
+	{
+		detail::Record(m_buffers, [&](const BufferCreatorFunc& bufferCreator)
+		{
+			return Vertex2DBuilder::BuildPolygon(bufferCreator, polygon.vertices(), polygon.indices(), none, color.toFloat4());
+		});
+
+		return *this;
+	}
+
+	void StaticGeometry2D::clear()
+	{
+		m_buffers.clear();
+	}
+
+	bool StaticGeometry2D::isEmpty() const noexcept
+	{
+		return m_buffers.isEmpty();
+	}
+
+	size_t StaticGeometry2D::num_vertices() const noexcept
+	{
+		size_t count = 0;
+
+		for (const auto& buffer : m_buffers)
+		{
+			count += buffer.vertices.size();
+		}
+
+		return count;
+	}
+
+	size_t StaticGeometry2D::num_triangles() const noexcept
+	{
+		size_t count = 0;
+
+		for (const auto& buffer : m_buffers)
+		{
+			count += buffer.indices.size();
+		}
+
+		return count;
+	}
+
+	void StaticGeometry2D::draw(const ColorF& colorMul) const
+	{
+		if (colorMul != ColorF{ 1.0 })
+		{
+			const ScopedColorMul2D scopedColorMul{ colorMul };
+
+			for (const auto& buffer : m_buffers)
+			{
+				buffer.draw();
+			}
+		}
+		else
+		{
+			for (const auto& buffer : m_buffers)
+			{
+				buffer.draw();
+			}
+		}
+	}
+
+	void StaticGeometry2D::draw(const Mat3x2& transform, const ColorF& colorMul) const
+	{
+		const Transformer2D transformer{ transform };
+
+		draw(colorMul);
+	}
+}
@@ -32,7 +32,8 @@ namespace s3d
 
 			m_work = std::make_unique<asio::io_service::work>(*m_io_service);
 
-			m_io_service_thread = Async([this] { m_io_service->run(); });
+			// io_service のイベントループはスレッドプールのワーカーを占有しないよう、専用のスレッドで実行する
+			m_io_service_thread = std::async(std::launch::async, [this] { m_io_service->run(); });
 		}
 
 		if (m_isConnected)
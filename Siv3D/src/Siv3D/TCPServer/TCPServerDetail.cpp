@@ -41,7 +41,8 @@ namespace s3d
 		{
 			m_work = std::make_unique<asio::io_service::work>(*m_io_service);
 
-			m_io_service_thread = Async([this] { m_io_service->run(); });
+			// io_service のイベントループはスレッドプールのワーカーを占有しないよう、専用のスレッドで実行する
+			m_io_service_thread = std::async(std::launch::async, [this] { m_io_service->run(); });
 		}
 
 		m_acceptor = std::make_unique<asio::ip::tcp::acceptor>(*m_io_service, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), port));
@@ -69,7 +70,8 @@ namespace s3d
 		{
 			m_work = std::make_unique<asio::io_service::work>(*m_io_service);
 
-			m_io_service_thread = Async([this] { m_io_service->run(); });
+			// io_service のイベントループはスレッドプールのワーカーを占有しないよう、専用のスレッドで実行する
+			m_io_service_thread = std::async(std::launch::async, [this] { m_io_service->run(); });
 		}
 
 		m_acceptor = std::make_unique<asio::ip::tcp::acceptor>(*m_io_service, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), port));
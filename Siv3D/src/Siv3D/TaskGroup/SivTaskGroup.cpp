@@ -0,0 +1,124 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <utility>
+# include <Siv3D/TaskGroup.hpp>
+
+namespace s3d
+{
+	TaskGroup::TaskGroup()
+		: m_state{ std::make_shared<State>() } {}
+
+	TaskGroup::~TaskGroup()
+	{
+		try
+		{
+			wait();
+		}
+		catch (...) {}
+	}
+
+	void TaskGroup::wait()
+	{
+		auto& state = *m_state;
+
+		// まだ開始されていないグループのタスクは自分で実行し、他のスレッドで実行中のタスクは完了を待つ
+		for (;;)
+		{
+			if (state.runOne())
+			{
+				continue;
+			}
+
+			std::unique_lock lock{ state.mutex };
+
+			// 実行中のタスクがグループに新しいタスクを追加した場合も起きる
+			state.finished.wait(lock, [&state]()
+				{ return ((state.pendingTasks.load(std::memory_order_acquire) == 0) || (not state.tasks.empty())); });
+
+			if (state.pendingTasks.load(std::memory_order_acquire) == 0)
+			{
+				break;
+			}
+		}
+
+		std::exception_ptr exception;
+		{
+			std::lock_guard lock{ state.mutex };
+			exception = std::exchange(state.exception, nullptr);
+		}
+
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+	}
+
+	bool TaskGroup::isDone() const noexcept
+	{
+		return (m_state->pendingTasks.load(std::memory_order_acquire) == 0);
+	}
+
+	void TaskGroup::State::push(std::function<void()> task)
+	{
+		std::lock_guard lock{ mutex };
+
+		tasks.push_back(std::move(task));
+
+		finished.notify_all();
+	}
+
+	bool TaskGroup::State::runOne()
+	{
+		std::function<void()> task;
+		{
+			std::lock_guard lock{ mutex };
+
+			if (tasks.empty())
+			{
+				return false;
+			}
+
+			task = std::move(tasks.front());
+			tasks.pop_front();
+		}
+
+		std::exception_ptr exception;
+
+		try
+		{
+			task();
+		}
+		catch (...)
+		{
+			exception = std::current_exception();
+		}
+
+		onTaskFinished(std::move(exception));
+
+		return true;
+	}
+
+	void TaskGroup::State::onTaskFinished(std::exception_ptr e)
+	{
+		std::lock_guard lock{ mutex };
+
+		if (e && (not exception))
+		{
+			exception = std::move(e);
+		}
+
+		if (pendingTasks.fetch_sub(1, std::memory_order_acq_rel) == 1)
+		{
+			finished.notify_all();
+		}
+	}
+}
@@ -9,15 +9,101 @@
 //
 //-----------------------------------------------
 
+# include <bit>
 # include "TextReaderDetail.hpp"
 # include <Siv3D/BinaryReader.hpp>
 # include <Siv3D/FileSystem.hpp>
-# include <Siv3D/Endian.hpp>
 # include <Siv3D/Unicode.hpp>
-# include <Siv3D/UnicodeConverter.hpp>
+# include <Siv3D/Utility.hpp>
+# include <Siv3D/SIMD.hpp>
+# include <Siv3D/Unicode/UnicodeUtility.hpp>
 
 namespace s3d
 {
+	namespace detail
+	{
+		[[nodiscard]]
+		static bool IsUTF16(const TextEncoding encoding) noexcept
+		{
+			return ((encoding == TextEncoding::UTF16LE)
+				|| (encoding == TextEncoding::UTF16BE));
+		}
+
+		// バイト列のうち、文字の途中で区切られていない部分の長さを返す
+		[[nodiscard]]
+		static size_t GetCompleteLength(const TextEncoding encoding, const std::string_view bytes) noexcept
+		{
+			if (IsUTF16(encoding))
+			{
+				size_t length = (bytes.size() & ~size_t{ 1 });
+
+				if (2 <= length)
+				{
+					const uint8 b0 = static_cast<uint8>(bytes[length - 2]);
+					const uint8 b1 = static_cast<uint8>(bytes[length - 1]);
+					const char16 last = ((encoding == TextEncoding::UTF16LE) ? (b0 | (b1 << 8)) : ((b0 << 8) | b1));
+
+					// 上位サロゲートで終わっている場合は、次のブロックと合わせて変換する
+					if (Unicode::IsHighSurrogate(last))
+					{
+						length -= 2;
+					}
+				}
+
+				return length;
+			}
+			else
+			{
+				const size_t size = bytes.size();
+
+				for (size_t i = 1; ((i <= 4) && (i <= size)); ++i)
+				{
+					const uint8 c = static_cast<uint8>(bytes[size - i]);
+
+					if ((c & 0xC0) == 0x80)
+					{
+						continue;
+					}
+
+					const size_t sequenceLength = ((c < 0x80) ? 1 : (c < 0xE0) ? 2 : (c < 0xF0) ? 3 : (c < 0xF8) ? 4 : 1);
+
+					return ((i < sequenceLength) ? (size - i) : size);
+				}
+
+				return size;
+			}
+		}
+
+		// 最初の '\n' または '\0' の位置を返す
+		[[nodiscard]]
+		static const char32* FindLineEnd(const char32* first, const char32* const last) noexcept
+		{
+			const __m128i newLine = ::_mm_set1_epi32(U'\n');
+			const __m128i zero = ::_mm_setzero_si128();
+
+			for (; 4 <= (last - first); first += 4)
+			{
+				const __m128i v = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+				const __m128i match = ::_mm_or_si128(::_mm_cmpeq_epi32(v, newLine), ::_mm_cmpeq_epi32(v, zero));
+
+				if (const uint32 mask = static_cast<uint32>(::_mm_movemask_epi8(match)))
+				{
+					return (first + (std::countr_zero(mask) / 4));
+				}
+			}
+
+			for (; first != last; ++first)
+			{
+				if ((*first == U'\n') || (*first == U'\0'))
+				{
+					break;
+				}
+			}
+
+			return first;
+		}
+	}
+
 	TextReader::TextReaderDetail::TextReaderDetail()
 	{
 		// do nothing
@@ -103,6 +189,8 @@ namespace s3d
 		m_reader.reset();
 
 		m_info = {};
+
+		resetBuffer();
 	}
 
 	bool TextReader::TextReaderDetail::isOpen() const noexcept
@@ -112,128 +200,44 @@ namespace s3d
 
 	Optional<char32> TextReader::TextReaderDetail::readChar()
 	{
-		if (not m_info.isOpen) SIV3D_UNLIKELY
+		char32 ch;
+
+		if (not readChar(ch))
 		{
 			return none;
 		}
 
-		for (;;)
-		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
-			{
-				return none;
-			}
-
-			if (codePoint == U'\0')
-			{
-				return none;
-			}
-			else if (codePoint != U'\r')
-			{
-				return codePoint;
-			}
-		}
+		return ch;
 	}
 
 	Optional<String> TextReader::TextReaderDetail::readLine()
 	{
-		if (not m_info.isOpen) SIV3D_UNLIKELY
-		{
-			return none;
-		}
-
 		String line;
 
-		for (;;)
+		if (not readLine(line))
 		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
-			{
-				if (line)
-				{
-					return line;
-				}
-
-				return none;
-			}
-
-			if ((codePoint == U'\n') || (codePoint == U'\0'))
-			{
-				return line;
-			}
-			else if (codePoint != U'\r')
-			{
-				line.push_back(codePoint);
-			}
+			return none;
 		}
+
+		return line;
 	}
 
 	Array<String> TextReader::TextReaderDetail::readLines()
 	{
-		if (not m_info.isOpen) SIV3D_UNLIKELY
-		{
-			return{};
-		}
-
 		Array<String> lines;
-		String line;
-
-		for (;;)
-		{
-			char32 codePoint;
 
-			if (not readCodePoint(codePoint))
-			{
-				if (line)
-				{
-					lines.push_back(std::move(line));
-				}
-
-				return lines;
-			}
+		readLines(lines);
 
-			if ((codePoint == U'\n') || (codePoint == U'\0'))
-			{
-				lines.push_back(line);
-				line.clear();
-			}
-			else if (codePoint != U'\r')
-			{
-				line.push_back(codePoint);
-			}
-		}
+		return lines;
 	}
 
 	String TextReader::TextReaderDetail::readAll()
 	{
-		if (not m_info.isOpen) SIV3D_UNLIKELY
-		{
-			return{};
-		}
-
 		String s;
 
-		for (;;)
-		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
-			{
-				return s;
-			}
+		readAll(s);
 
-			if (codePoint == U'\0')
-			{
-				return s;
-			}
-			else if (codePoint != U'\r')
-			{
-				s.push_back(codePoint);
-			}
-		}
+		return s;
 	}
 
 	bool TextReader::TextReaderDetail::readChar(char32& ch)
@@ -245,25 +249,20 @@ namespace s3d
 			return false;
 		}
 
-		for (;;)
+		if (not fillBuffer())
 		{
-			char32 codePoint;
+			return false;
+		}
 
-			if (not readCodePoint(codePoint))
-			{
-				return false;
-			}
+		const char32 codePoint = m_decoded[m_decodedPos++];
 
-			if (codePoint == U'\0')
-			{
-				return false;
-			}
-			else if (codePoint != U'\r')
-			{
-				ch = codePoint;
-				return true;
-			}
+		if (codePoint == U'\0')
+		{
+			return false;
 		}
+
+		ch = codePoint;
+		return true;
 	}
 
 	bool TextReader::TextReaderDetail::readLine(String& line)
@@ -277,26 +276,25 @@ namespace s3d
 
 		for (;;)
 		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
+			if (not fillBuffer())
 			{
-				if (line)
-				{
-					return true;
-				}
-
-				return false;
+				return (not line.isEmpty());
 			}
 
-			if ((codePoint == U'\n') || (codePoint == U'\0'))
+			const char32* const pBuffer = m_decoded.data();
+			const char32* const first = (pBuffer + m_decodedPos);
+			const char32* const last = (pBuffer + m_decoded.size());
+			const char32* const lineEnd = detail::FindLineEnd(first, last);
+
+			line.append(first, (lineEnd - first));
+
+			if (lineEnd != last)
 			{
+				m_decodedPos = ((lineEnd - pBuffer) + 1);
 				return true;
 			}
-			else if (codePoint != U'\r')
-			{
-				line.push_back(codePoint);
-			}
+
+			m_decodedPos = m_decoded.size();
 		}
 	}
 
@@ -311,35 +309,12 @@ namespace s3d
 
 		String line;
 
-		for (;;)
+		while (readLine(line))
 		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
-			{
-				if (line)
-				{
-					lines.push_back(std::move(line));
-				}
-
-				if (not lines)
-				{
-					return false;
-				}
-
-				return true;
-			}
-
-			if ((codePoint == U'\n') || (codePoint == U'\0'))
-			{
-				lines.push_back(line);
-				line.clear();
-			}
-			else if (codePoint != U'\r')
-			{
-				line.push_back(codePoint);
-			}
+			lines.push_back(line);
 		}
+
+		return (not lines.isEmpty());
 	}
 
 	bool TextReader::TextReaderDetail::readAll(String& s)
@@ -353,26 +328,25 @@ namespace s3d
 
 		for (;;)
 		{
-			char32 codePoint;
-
-			if (not readCodePoint(codePoint))
+			if (not fillBuffer())
 			{
-				if (not s)
-				{
-					return false;
-				}
-
-				return true;
+				return (not s.isEmpty());
 			}
 
-			if (codePoint == U'\0')
+			const char32* const pBuffer = m_decoded.data();
+			const char32* const first = (pBuffer + m_decodedPos);
+			const char32* const last = (pBuffer + m_decoded.size());
+			const char32* const end = std::find(first, last, U'\0');
+
+			s.append(first, (end - first));
+
+			if (end != last)
 			{
+				m_decodedPos = ((end - pBuffer) + 1);
 				return true;
 			}
-			else if (codePoint != U'\r')
-			{
-				s.push_back(codePoint);
-			}
+
+			m_decodedPos = m_decoded.size();
 		}
 	}
 
@@ -386,138 +360,54 @@ namespace s3d
 		return m_info.fullPath;
 	}
 
-	bool TextReader::TextReaderDetail::readByte(uint8& c)
+	void TextReader::TextReaderDetail::resetBuffer()
 	{
-		return m_reader->read(c);
+		m_bytes.clear();
+		m_decoded.clear();
+		m_decodedPos = 0;
+		m_endOfStream = false;
 	}
 
-	bool TextReader::TextReaderDetail::readTwoBytes(uint16& c)
+	bool TextReader::TextReaderDetail::fillBuffer()
 	{
-		return m_reader->read(c);
-	}
-
-	bool TextReader::TextReaderDetail::readUTF8(char32& c)
-	{
-		uint8 cx;
-
-		if (not readByte(cx))
-		{
-			return false;
-		}
-
-		UTF8toUTF32_Converter converter;
-
-		if (converter.put(cx)) // 1
-		{
-			c = converter.get();
-			return true;
-		}
-
-		if (not readByte(cx))
+		while (m_decodedPos == m_decoded.size())
 		{
-			return false;
-		}
-
-		if (converter.put(cx)) // 2
-		{
-			c = converter.get();
-			return true;
-		}
-
-		if (not readByte(cx))
-		{
-			return false;
-		}
-
-		if (converter.put(cx)) // 3
-		{
-			c = converter.get();
-			return true;
-		}
-
-		if (not readByte(cx))
-		{
-			return false;
-		}
-
-		if (converter.put(cx)) // 4
-		{
-			c = converter.get();
-			return true;
-		}
-
-		return false;
-	}
-
-	bool TextReader::TextReaderDetail::readUTF16LE(char32& c)
-	{
-		uint16 c0 = 0, c1 = 0;
-		
-		if (not readTwoBytes(c0))
-		{
-			return false;
-		}
-
-		if (Unicode::IsHighSurrogate(c0))
-		{
-			if (not readTwoBytes(c1))
+			if (m_endOfStream)
 			{
 				return false;
 			}
 
-			c = ((((c0 - 0xD800) << 10) | (c1 - 0xDC00)) + 0x10000);
-		}
-		else
-		{
-			c = c0;
-		}
+			const size_t prevSize = m_bytes.size();
+			m_bytes.resize(prevSize + ChunkSize);
 
-		return true;
-	}
-
-	bool TextReader::TextReaderDetail::readUTF16BE(char32& c)
-	{
-		uint16 c0 = 0, c1 = 0;
+			const int64 readSize = m_reader->read((m_bytes.data() + prevSize), static_cast<int64>(ChunkSize));
+			m_bytes.resize(prevSize + static_cast<size_t>(Max<int64>(readSize, 0)));
 
-		if (not readTwoBytes(c0))
-		{
-			return false;
-		}
+			if (readSize <= 0)
+			{
+				m_endOfStream = true;
+			}
 
-		c0 = SwapEndian(c0);
+			// 最後のブロック以外では、途中で区切られた末尾の文字を次のブロックに回す
+			const size_t length = (m_endOfStream ? m_bytes.size() : detail::GetCompleteLength(m_info.encoding, m_bytes));
 
-		if (Unicode::IsHighSurrogate(c0))
-		{
-			if (not readTwoBytes(c1))
+			if (detail::IsUTF16(m_info.encoding))
 			{
-				return false;
+				m_decoded.resize(length / 2);
+				m_decoded.resize(detail::ConvertUTF16ToUTF32(m_bytes.data(), (length / 2), m_decoded.data(), (m_info.encoding == TextEncoding::UTF16BE)));
+			}
+			else
+			{
+				m_decoded.resize(length);
+				m_decoded.resize(detail::ConvertUTF8ToUTF32(std::string_view{ m_bytes.data(), length }, m_decoded.data()));
 			}
 
-			c1 = SwapEndian(c1);
+			m_decoded.erase(std::remove(m_decoded.begin(), m_decoded.end(), U'\r'), m_decoded.end());
+			m_decodedPos = 0;
 
-			c = ((((c0 - 0xD800) << 10) | (c1 - 0xDC00)) + 0x10000);
-		}
-		else
-		{
-			c = c0;
+			m_bytes.erase(0, length);
 		}
 
 		return true;
 	}
-
-	bool TextReader::TextReaderDetail::readCodePoint(char32& codePoint)
-	{
-		if (m_info.encoding == TextEncoding::UTF16LE)
-		{
-			return readUTF16LE(codePoint);
-		}
-		else if (m_info.encoding == TextEncoding::UTF16BE)
-		{
-			return readUTF16BE(codePoint);
-		}
-		else
-		{
-			return readUTF8(codePoint);
-		}
-	}
 }
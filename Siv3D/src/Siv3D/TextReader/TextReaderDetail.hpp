@@ -18,6 +18,9 @@ namespace s3d
 	{
 	private:
 
+		// 1 回の IReader::read() で読み込むバイト数
+		static constexpr size_t ChunkSize = (64 * 1024);
+
 		std::unique_ptr<IReader> m_reader;
 
 		struct Info
@@ -27,23 +30,21 @@ namespace s3d
 			bool isOpen = false;
 		} m_info;
 
-		[[nodiscard]]
-		bool readByte(uint8& c);
+		// 読み込んだが、文字の途中で区切られているためまだ変換していないバイト列
+		std::string m_bytes;
 
-		[[nodiscard]]
-		bool readTwoBytes(uint16& c);
+		// 変換済みの文字列（'\r' は取り除いてある）。未読の文字は m_decoded[m_decodedPos] 以降
+		String m_decoded;
 
-		[[nodiscard]]
-		bool readUTF8(char32& c);
+		size_t m_decodedPos = 0;
 
-		[[nodiscard]]
-		bool readUTF16LE(char32& c);
+		bool m_endOfStream = false;
 
-		[[nodiscard]]
-		bool readUTF16BE(char32& c);
+		void resetBuffer();
 
+		// 未読の文字がない場合、次のブロックを読み込んで変換する。すべて読み終えた場合は false を返す
 		[[nodiscard]]
-		bool readCodePoint(char32& codePoint);
+		bool fillBuffer();
 
 	public:
 
@@ -11,7 +11,16 @@
 
 # include <thread>
 # include <Siv3D/Threading.hpp>
+# include <Siv3D/Platform.hpp>
 # include <Siv3D/Utility.hpp>
+# include "ThreadPool.hpp"
+
+// pthreads なしでビルドした Web 版ではスレッドを作れないため、スレッドプールを使わずに呼び出し元のスレッドで処理する
+# if !SIV3D_PLATFORM(WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+	# define SIV3D_USE_THREAD_POOL 1
+# else
+	# define SIV3D_USE_THREAD_POOL 0
+# endif
 
 namespace s3d
 {
@@ -22,5 +31,74 @@ namespace s3d
 			static const size_t n = Max<size_t>(1, std::thread::hardware_concurrency());
 			return n;
 		}
+
+		size_t GetWorkerCount() noexcept
+		{
+		# if SIV3D_USE_THREAD_POOL
+			return ThreadPool::GetInstance().getWorkerCount();
+		# else
+			return 0;
+		# endif
+		}
+
+		size_t ResolveGrainSize(const size_t count, const size_t grainSize) noexcept
+		{
+			if (grainSize != AutoGrainSize)
+			{
+				return grainSize;
+			}
+
+			// 負荷の偏りを吸収するため、1 スレッドあたり 4 タスク程度に分割する
+			const size_t numTasks = (GetConcurrency() * 4);
+
+			return Max(MinAutoGrainSize, ((count + numTasks - 1) / numTasks));
+		}
+
+		namespace detail
+		{
+			void ParallelForRangeImpl(const size_t first, const size_t last, const size_t grainSize, const ParallelRangeFunction function, void* context)
+			{
+			# if SIV3D_USE_THREAD_POOL
+				ThreadPool::GetInstance().parallelFor(first, last, grainSize, function, context);
+			# else
+				if (first < last)
+				{
+					function(context, first, last);
+				}
+			# endif
+			}
+
+			void SubmitTask(std::function<void()> task)
+			{
+			# if SIV3D_USE_THREAD_POOL
+				ThreadPool::GetInstance().submit(std::move(task));
+			# else
+				task();
+			# endif
+			}
+
+			void BeginBlockingWait() noexcept
+			{
+			# if SIV3D_USE_THREAD_POOL
+				ThreadPool::GetInstance().beginBlocking();
+			# endif
+			}
+
+			void EndBlockingWait() noexcept
+			{
+			# if SIV3D_USE_THREAD_POOL
+				ThreadPool::GetInstance().endBlocking();
+			# endif
+			}
+
+			bool IsWorkerThread() noexcept
+			{
+			# if SIV3D_USE_THREAD_POOL
+				return ThreadPool::GetInstance().isWorkerThread();
+			# else
+				return false;
+			# endif
+			}
+		}
 	}
 }
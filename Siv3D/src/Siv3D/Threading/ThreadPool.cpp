@@ -0,0 +1,427 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <exception>
+# include "ThreadPool.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 現在のスレッドが所属するスレッドプールと、そのワーカー番号
+		thread_local const ThreadPool* t_currentPool = nullptr;
+
+		thread_local size_t t_workerIndex = 0;
+
+		struct ParallelForJob
+		{
+			Threading::detail::ParallelRangeFunction function = nullptr;
+
+			void* context = nullptr;
+
+			size_t last = 0;
+
+			size_t grainSize = 1;
+
+			size_t numChunks = 0;
+
+			std::atomic<size_t> next = 0;
+
+			std::atomic<bool> failed = false;
+
+			std::mutex mutex;
+
+			std::condition_variable finished;
+
+			// 処理を終えたチャンクの数（mutex で保護）
+			size_t completedChunks = 0;
+
+			std::exception_ptr exception;
+
+			// チャンクを 1 つずつ取り出して処理する。取り出すチャンクがなくなったら戻る
+			void run() noexcept
+			{
+				for (;;)
+				{
+					const size_t begin = next.fetch_add(grainSize, std::memory_order_relaxed);
+
+					if (last <= begin)
+					{
+						return;
+					}
+
+					std::exception_ptr e;
+
+					// 例外が発生した後のチャンクは、処理せずに完了として数える
+					if (not failed.load(std::memory_order_relaxed))
+					{
+						try
+						{
+							function(context, begin, Min((begin + grainSize), last));
+						}
+						catch (...)
+						{
+							e = std::current_exception();
+							failed.store(true, std::memory_order_relaxed);
+						}
+					}
+
+					std::lock_guard lock{ mutex };
+
+					if (e && (not exception))
+					{
+						exception = std::move(e);
+					}
+
+					if (++completedChunks == numChunks)
+					{
+						finished.notify_all();
+					}
+				}
+			}
+
+			// 他のスレッドが取り出したチャンクの完了を待つ
+			void wait()
+			{
+				std::unique_lock lock{ mutex };
+
+				finished.wait(lock, [this]() { return (completedChunks == numChunks); });
+			}
+		};
+	}
+
+	ThreadPool::ThreadPool(const size_t numWorkers)
+	{
+		m_queues.reserve(numWorkers);
+
+		for (size_t i = 0; i < numWorkers; ++i)
+		{
+			m_queues.push_back(std::make_unique<WorkerQueue>());
+		}
+
+		m_threads.reserve(numWorkers);
+
+		for (size_t i = 0; i < numWorkers; ++i)
+		{
+			m_threads.emplace_back(&ThreadPool::workerMain, this, i);
+		}
+	}
+
+	ThreadPool::~ThreadPool()
+	{
+		{
+			std::lock_guard lock{ m_sleepMutex };
+			m_stop = true;
+		}
+
+		m_wakeUp.notify_all();
+		m_spareWakeUp.notify_all();
+
+		for (auto& thread : m_threads)
+		{
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+		}
+
+		// ワーカーがすべて終了した後は、m_spareThreads が追加されることはない
+		for (auto& thread : m_spareThreads)
+		{
+			if (thread.joinable())
+			{
+				thread.join();
+			}
+		}
+	}
+
+	size_t ThreadPool::getWorkerCount() const noexcept
+	{
+		return m_threads.size();
+	}
+
+	void ThreadPool::submit(Task task)
+	{
+		if (m_queues.isEmpty())
+		{
+			task();
+			return;
+		}
+
+		// 代わりのスレッドは自分のキューを持たないので、ワーカー以外のスレッドと同じく順番にキューを選ぶ
+		const size_t queueIndex = (isWorkerThread() && (detail::t_workerIndex < m_queues.size())) ? detail::t_workerIndex
+			: (m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size());
+
+		{
+			auto& queue = *m_queues[queueIndex];
+			std::lock_guard lock{ queue.mutex };
+			queue.tasks.push_back(std::move(task));
+			m_pendingTasks.fetch_add(1, std::memory_order_release);
+		}
+
+		{
+			// 待機に入ろうとしているワーカーが通知を取りこぼさないよう、ロックを取ってから通知する
+			std::lock_guard lock{ m_sleepMutex };
+		}
+
+		m_wakeUp.notify_one();
+	}
+
+	void ThreadPool::beginBlocking() noexcept
+	{
+		std::lock_guard lock{ m_sleepMutex };
+
+		++m_blockedWorkers;
+
+		// 待機している代わりのスレッドが足りなければ新しく作る
+		if ((not m_stop) && (m_spareThreads.size() < m_blockedWorkers))
+		{
+			// スレッドを作れなかった場合は、代わりのスレッドなしで待つ。
+			// 待機は AsyncTask のデストラクタからも呼ばれるため、ここで例外を送出してはいけない
+			try
+			{
+				m_spareThreads.emplace_back(&ThreadPool::spareMain, this);
+			}
+			catch (...) {}
+		}
+
+		m_spareWakeUp.notify_one();
+	}
+
+	void ThreadPool::endBlocking() noexcept
+	{
+		{
+			std::lock_guard lock{ m_sleepMutex };
+
+			--m_blockedWorkers;
+		}
+
+		// 余った代わりのスレッドを待機に戻す
+		m_wakeUp.notify_all();
+	}
+
+	void ThreadPool::parallelFor(const size_t first, const size_t last, size_t grainSize, const Threading::detail::ParallelRangeFunction function, void* context)
+	{
+		if (last <= first)
+		{
+			return;
+		}
+
+		const size_t count = (last - first);
+		grainSize = Threading::ResolveGrainSize(count, grainSize);
+
+		const size_t numChunks = ((count + grainSize - 1) / grainSize);
+
+		// シングルコア環境ではワーカーに分けても速くならないので、呼び出し元のスレッドだけで処理する
+		const size_t numHelpers = Min({ (numChunks - 1), m_threads.size(), (Threading::GetConcurrency() - 1) });
+
+		if (numHelpers == 0)
+		{
+			function(context, first, last);
+			return;
+		}
+
+		// ヘルパータスクはキューの中で長く待たされることがあり、呼び出しが戻った後に開始されても安全なように、ジョブは共有して保持する
+		auto job = std::make_shared<detail::ParallelForJob>();
+		job->function	= function;
+		job->context	= context;
+		job->last		= last;
+		job->grainSize	= grainSize;
+		job->numChunks	= numChunks;
+		job->next.store(first, std::memory_order_relaxed);
+
+		for (size_t i = 0; i < numHelpers; ++i)
+		{
+			submit([job]() { job->run(); });
+		}
+
+		// 呼び出し元のスレッドは自分のジョブのチャンクだけを処理し、キューにある無関係なタスクは実行しない。
+		// チャンクがなくなった時点で未完了のものは、すべて他のスレッドで処理中なので、その完了を待つ
+		job->run();
+		job->wait();
+
+		if (job->exception)
+		{
+			std::rethrow_exception(job->exception);
+		}
+	}
+
+	bool ThreadPool::isWorkerThread() const noexcept
+	{
+		return (detail::t_currentPool == this);
+	}
+
+	ThreadPool& ThreadPool::GetInstance()
+	{
+		// 呼び出し元のスレッドも処理に参加するため、ワーカー数はハードウェアスレッド数 - 1 にする。
+		// ただし、1 つの AsyncTask が長くブロックしても他の AsyncTask や継続が止まらないよう、少なくとも 2 つは用意する。
+		// 並列ループのヘルパーは GetConcurrency() - 1 個までなので、シングルコア環境で過剰にスレッドを使うことはない
+		static ThreadPool threadPool{ Max<size_t>((Threading::GetConcurrency() - 1), MinWorkerCount) };
+		return threadPool;
+	}
+
+	void ThreadPool::workerMain(const size_t workerIndex)
+	{
+		detail::t_currentPool = this;
+		detail::t_workerIndex = workerIndex;
+
+		Task task;
+
+		for (;;)
+		{
+			if (popTask(workerIndex, task) || stealTask(workerIndex, task))
+			{
+				task();
+				task = nullptr;
+				continue;
+			}
+
+			std::unique_lock lock{ m_sleepMutex };
+
+			m_wakeUp.wait(lock, [this]() { return (m_stop || (m_pendingTasks.load(std::memory_order_acquire) != 0)); });
+
+			if (m_stop && (m_pendingTasks.load(std::memory_order_acquire) == 0))
+			{
+				return;
+			}
+		}
+	}
+
+	void ThreadPool::spareMain()
+	{
+		detail::t_currentPool = this;
+		detail::t_workerIndex = m_queues.size();
+
+		Task task;
+		std::unique_lock lock{ m_sleepMutex };
+
+		for (;;)
+		{
+			// ブロックしているワーカーの数だけ、代わりのスレッドが動く
+			m_spareWakeUp.wait(lock, [this]() { return (m_stop || (m_activeSpares < m_blockedWorkers)); });
+
+			if (m_stop)
+			{
+				return;
+			}
+
+			++m_activeSpares;
+
+			for (;;)
+			{
+				const bool surplus = (m_blockedWorkers < m_activeSpares);
+				const bool pending = (m_pendingTasks.load(std::memory_order_acquire) != 0);
+
+				if (surplus || (m_stop && (not pending)))
+				{
+					break;
+				}
+
+				if (not pending)
+				{
+					m_wakeUp.wait(lock);
+					continue;
+				}
+
+				lock.unlock();
+
+				if (stealTask(m_queues.size(), task))
+				{
+					task();
+					task = nullptr;
+				}
+
+				lock.lock();
+			}
+
+			--m_activeSpares;
+
+			// 自分が受け取った通知で起きるはずだったスレッドのために、通知し直す
+			if (m_pendingTasks.load(std::memory_order_acquire) != 0)
+			{
+				m_wakeUp.notify_one();
+			}
+		}
+	}
+
+	bool ThreadPool::popTask(const size_t queueIndex, Task& task)
+	{
+		auto& queue = *m_queues[queueIndex];
+		std::lock_guard lock{ queue.mutex };
+
+		if (queue.tasks.empty())
+		{
+			return false;
+		}
+
+		// 自分のキューからは最後に追加したタスクを取り出す（キャッシュの局所性が高い）
+		task = std::move(queue.tasks.back());
+		queue.tasks.pop_back();
+		m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+
+		return true;
+	}
+
+	bool ThreadPool::stealTask(const size_t thiefIndex, Task& task)
+	{
+		const size_t numQueues = m_queues.size();
+
+		// まずはロックを待たずに盗めるキューを探す。
+		// ロックを取れなかったキューにタスクが残っている可能性がある場合は、ロックを待って探し直す。
+		// そうしないと、m_pendingTasks != 0 のまま待機に入れず、空回りし続けることがある
+		for (const bool blocking : { false, true })
+		{
+			bool skipped = false;
+
+			for (size_t i = 1; i <= numQueues; ++i)
+			{
+				const size_t victimIndex = ((thiefIndex + i) % numQueues);
+
+				if (victimIndex == thiefIndex)
+				{
+					continue;
+				}
+
+				auto& queue = *m_queues[victimIndex];
+				std::unique_lock lock{ queue.mutex, std::defer_lock };
+
+				if (blocking)
+				{
+					lock.lock();
+				}
+				else if (not lock.try_lock())
+				{
+					skipped = true;
+					continue;
+				}
+
+				if (queue.tasks.empty())
+				{
+					continue;
+				}
+
+				// 他のワーカーのキューからは最も古いタスクを盗む
+				task = std::move(queue.tasks.front());
+				queue.tasks.pop_front();
+				m_pendingTasks.fetch_sub(1, std::memory_order_relaxed);
+
+				return true;
+			}
+
+			if ((not skipped) || (m_pendingTasks.load(std::memory_order_acquire) == 0))
+			{
+				return false;
+			}
+		}
+
+		return false;
+	}
+}
@@ -0,0 +1,114 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <functional>
+# include <mutex>
+# include <thread>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/Threading.hpp>
+
+namespace s3d
+{
+	/// @brief エンジンが所有するワークスティーリング方式のスレッドプール
+	/// @remark ワーカーごとにタスクキューを持ち、自分のキューが空になると他のワーカーのキューからタスクを盗みます。
+	class ThreadPool
+	{
+	public:
+
+		using Task = std::function<void()>;
+
+		/// @brief エンジンのスレッドプールが持つワーカースレッドの最小数
+		static constexpr size_t MinWorkerCount = 2;
+
+		SIV3D_NODISCARD_CXX20
+		explicit ThreadPool(size_t numWorkers);
+
+		~ThreadPool();
+
+		ThreadPool(const ThreadPool&) = delete;
+
+		ThreadPool& operator =(const ThreadPool&) = delete;
+
+		[[nodiscard]]
+		size_t getWorkerCount() const noexcept;
+
+		/// @brief タスクをキューに追加します。
+		/// @remark ワーカースレッドから呼ばれた場合は、そのワーカーのキューに追加されます。
+		void submit(Task task);
+
+		/// @brief ワーカースレッドが、他のタスクの完了を待ってブロックし始めることを通知します。
+		/// @remark ブロックしている間は、代わりのスレッドがキューのタスクを処理します。これにより、タスクの中で別のタスクを待ってもデッドロックしません。
+		/// @remark 代わりのスレッドを作れなかった場合も例外は送出せず、代わりのスレッドなしでブロックします。
+		void beginBlocking() noexcept;
+
+		/// @brief `beginBlocking()` で通知したブロックが終わったことを通知します。
+		void endBlocking() noexcept;
+
+		/// @brief [first, last) の範囲を grainSize ごとに分割し、呼び出し元のスレッドとワーカースレッドで並列に処理します。
+		/// @remark 範囲の要素数が粒度以下の場合は、呼び出し元のスレッドで直接処理します。
+		/// @remark 呼び出し元のスレッドはこの範囲のチャンクだけを処理し、キューにある他のタスクは実行しません。
+		void parallelFor(size_t first, size_t last, size_t grainSize, Threading::detail::ParallelRangeFunction function, void* context);
+
+		/// @brief 現在のスレッドがこのスレッドプールのワーカースレッドであるかを返します。
+		[[nodiscard]]
+		bool isWorkerThread() const noexcept;
+
+		[[nodiscard]]
+		static ThreadPool& GetInstance();
+
+	private:
+
+		struct WorkerQueue
+		{
+			std::mutex mutex;
+
+			std::deque<Task> tasks;
+		};
+
+		Array<std::unique_ptr<WorkerQueue>> m_queues;
+
+		Array<std::thread> m_threads;
+
+		std::mutex m_sleepMutex;
+
+		std::condition_variable m_wakeUp;
+
+		// ブロックしているワーカーの代わりにタスクを処理するスレッド。一度作ったものは待機させて使い回す（m_sleepMutex で保護）
+		Array<std::thread> m_spareThreads;
+
+		std::condition_variable m_spareWakeUp;
+
+		size_t m_blockedWorkers = 0;
+
+		size_t m_activeSpares = 0;
+
+		std::atomic<size_t> m_pendingTasks = 0;
+
+		std::atomic<size_t> m_nextQueue = 0;
+
+		bool m_stop = false;
+
+		void workerMain(size_t workerIndex);
+
+		void spareMain();
+
+		[[nodiscard]]
+		bool popTask(size_t queueIndex, Task& task);
+
+		[[nodiscard]]
+		bool stealTask(size_t thiefIndex, Task& task);
+	};
+}
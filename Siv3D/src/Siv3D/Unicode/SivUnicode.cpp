@@ -25,36 +25,18 @@ namespace s3d
 
 		String FromUTF8(const std::string_view s)
 		{
-			String result(detail::UTF32_Length(s), '0');
+			String result(detail::UTF32_Length(s), U'\0');
 
-			const char8* pSrc = s.data();
-			const char8* const pSrcEnd = pSrc + s.size();
-			char32* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
-				*pDst++ = detail::utf8_decode(pSrc, pSrcEnd - pSrc, offset);
-				pSrc += offset;
-			}
+			detail::ConvertUTF8ToUTF32(s, result.data());
 
 			return result;
 		}
 
 		String FromUTF16(const std::u16string_view s)
 		{
-			String result(detail::UTF32_Length(s), '0');
-
-			const char16* pSrc = s.data();
-			const char16* const pSrcEnd = pSrc + s.size();
-			char32* pDst = &result[0];
+			String result(detail::UTF32_Length(s), U'\0');
 
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
-				*pDst++ = detail::utf16_decode(pSrc, pSrcEnd - pSrc, offset);
-				pSrc += offset;
-			}
+			detail::ConvertUTF16ToUTF32(s.data(), s.size(), result.data());
 
 			return result;
 		}
@@ -82,16 +64,9 @@ namespace s3d
 
 		std::string ToUTF8(const StringView s)
 		{
-			std::string result(detail::UTF8_Length(s), '0');
+			std::string result(detail::UTF8_Length(s), '\0');
 
-			const char32* pSrc = s.data();
-			const char32* const pSrcEnd = pSrc + s.size();
-			char8* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				detail::UTF8_Encode(&pDst, *pSrc++);
-			}
+			detail::ConvertUTF32ToUTF8(s, result.data());
 
 			return result;
 		}
@@ -119,40 +94,18 @@ namespace s3d
 
 		std::u16string UTF8ToUTF16(const std::string_view s)
 		{
-			std::u16string result(detail::UTF16_Length(s), '0');
-
-			const char8* pSrc = s.data();
-			const char8* const pSrcEnd = pSrc + s.size();
-			char16* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
+			std::u16string result(detail::UTF16_Length(s), u'\0');
 
-				detail::UTF16_Encode(&pDst, detail::utf8_decode(pSrc, pSrcEnd - pSrc, offset));
-
-				pSrc += offset;
-			}
+			detail::ConvertUTF8ToUTF16(s, result.data());
 
 			return result;
 		}
 
 		std::u32string UTF8ToUTF32(const std::string_view s)
 		{
-			std::u32string result(detail::UTF32_Length(s), '0');
-
-			const char8* pSrc = s.data();
-			const char8* const pSrcEnd = pSrc + s.size();
-			char32* pDst = &result[0];
-
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
-
-				*pDst++ = detail::utf8_decode(pSrc, pSrcEnd - pSrc, offset);
+			std::u32string result(detail::UTF32_Length(s), U'\0');
 
-				pSrc += offset;
-			}
+			detail::ConvertUTF8ToUTF32(s, result.data());
 
 			return result;
 		}
@@ -179,36 +132,20 @@ namespace s3d
 
 		std::u32string UTF16ToUTF32(const std::u16string_view s)
 		{
-			std::u32string result(detail::UTF32_Length(s), '0');
-
-			const char16* pSrc = s.data();
-			const char16* const pSrcEnd = pSrc + s.size();
-			char32* pDst = &result[0];
+			std::u32string result(detail::UTF32_Length(s), U'\0');
 
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
-
-				*pDst++ = detail::utf16_decode(pSrc, pSrcEnd - pSrc, offset);
-
-				pSrc += offset;
-			}
+			detail::ConvertUTF16ToUTF32(s.data(), s.size(), result.data());
 
 			return result;
 		}
 
 		std::string UTF32ToUTF8(const std::u32string_view s)
 		{
-			std::string result(detail::UTF8_Length(s), '0');
+			const StringView view{ s.data(), s.size() };
 
-			const char32* pSrc = s.data();
-			const char32* const pSrcEnd = pSrc + s.size();
-			char8* pDst = &result[0];
+			std::string result(detail::UTF8_Length(view), '\0');
 
-			while (pSrc != pSrcEnd)
-			{
-				detail::UTF8_Encode(&pDst, *pSrc++);
-			}
+			detail::ConvertUTF32ToUTF8(view, result.data());
 
 			return result;
 		}
@@ -9,6 +9,8 @@
 //
 //-----------------------------------------------
 
+# include <bit>
+# include <Siv3D/SIMD.hpp>
 # include "UnicodeUtility.hpp"
 # include <ThirdParty/miniutf/miniutf.hpp>
 
@@ -16,6 +18,324 @@ namespace s3d
 {
 	namespace detail
 	{
+		namespace
+		{
+			// ASCII 16 文字を書き込む
+			inline void StoreASCII16(const __m128i v, char32* dst) noexcept
+			{
+				const __m128i zero = ::_mm_setzero_si128();
+				const __m128i lo = ::_mm_unpacklo_epi8(v, zero);
+				const __m128i hi = ::_mm_unpackhi_epi8(v, zero);
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), ::_mm_unpacklo_epi16(lo, zero));
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 4), ::_mm_unpackhi_epi16(lo, zero));
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), ::_mm_unpacklo_epi16(hi, zero));
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 12), ::_mm_unpackhi_epi16(hi, zero));
+			}
+
+			inline void StoreASCII16(const __m128i v, char16* dst) noexcept
+			{
+				const __m128i zero = ::_mm_setzero_si128();
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), ::_mm_unpacklo_epi8(v, zero));
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), ::_mm_unpackhi_epi8(v, zero));
+			}
+
+			// BMP の 4 文字を書き込む
+			inline void StoreBMP4(const __m128i codePoints, char32* dst) noexcept
+			{
+				::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst), codePoints);
+			}
+
+			inline void StoreBMP4(const __m128i codePoints, char16* dst) noexcept
+			{
+				::_mm_storel_epi64(reinterpret_cast<__m128i*>(dst), ::_mm_packus_epi32(codePoints, codePoints));
+			}
+
+			// src から始まる 12 バイトが 3 バイト文字 4 つである場合、そのコードポイントを返す（src からは 16 バイト読める必要がある）
+			[[nodiscard]]
+			inline bool Decode3ByteX4(const char8* src, __m128i& codePoints) noexcept
+			{
+				// 各 32 ビットレーンに 1 文字分の 3 バイトを並べる
+				const __m128i shuffle = ::_mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+				const __m128i v = ::_mm_shuffle_epi8(::_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)), shuffle);
+
+				// 1110xxxx 10xxxxxx 10xxxxxx
+				const __m128i pattern = ::_mm_cmpeq_epi32(::_mm_and_si128(v, ::_mm_set1_epi32(0x00C0C0F0)), ::_mm_set1_epi32(0x008080E0));
+
+				if (::_mm_movemask_epi8(pattern) != 0xFFFF)
+				{
+					return false;
+				}
+
+				const __m128i b0 = ::_mm_slli_epi32(::_mm_and_si128(v, ::_mm_set1_epi32(0x0000000F)), 12);
+				const __m128i b1 = ::_mm_srli_epi32(::_mm_and_si128(v, ::_mm_set1_epi32(0x00003F00)), 2);
+				const __m128i b2 = ::_mm_srli_epi32(::_mm_and_si128(v, ::_mm_set1_epi32(0x003F0000)), 16);
+				codePoints = ::_mm_or_si128(::_mm_or_si128(b0, b1), b2);
+
+				// 冗長な表現（U+0800 未満）は 1 文字ずつの処理に任せる
+				if (::_mm_movemask_epi8(::_mm_cmplt_epi32(codePoints, ::_mm_set1_epi32(0x800))) != 0)
+				{
+					return false;
+				}
+
+				return true;
+			}
+
+			// Write が false の場合は書き込まずに文字数だけを数える
+			template <class Char, bool Write>
+			size_t ConvertUTF8Impl(const std::string_view s, Char* dst) noexcept
+			{
+				const char8* pSrc = s.data();
+				const char8* const pSrcEnd = (pSrc + s.size());
+				size_t length = 0;
+
+				while (pSrc != pSrcEnd)
+				{
+					if (static_cast<uint8>(*pSrc) < 0x80)
+					{
+						// ASCII の連続
+						while (16 <= (pSrcEnd - pSrc))
+						{
+							const __m128i v = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc));
+							const uint32 mask = static_cast<uint32>(::_mm_movemask_epi8(v));
+
+							if (mask == 0)
+							{
+								if constexpr (Write)
+								{
+									StoreASCII16(v, (dst + length));
+								}
+
+								pSrc += 16;
+								length += 16;
+								continue;
+							}
+
+							const size_t numASCII = std::countr_zero(mask);
+
+							if constexpr (Write)
+							{
+								for (size_t i = 0; i < numASCII; ++i)
+								{
+									dst[length + i] = static_cast<uint8>(pSrc[i]);
+								}
+							}
+
+							pSrc += numASCII;
+							length += numASCII;
+							break;
+						}
+
+						while ((pSrc != pSrcEnd) && (static_cast<uint8>(*pSrc) < 0x80))
+						{
+							if constexpr (Write)
+							{
+								dst[length] = static_cast<uint8>(*pSrc);
+							}
+
+							++pSrc;
+							++length;
+						}
+					}
+					else
+					{
+						// 非 ASCII の連続
+						do
+						{
+							if ((16 <= (pSrcEnd - pSrc))
+								&& ((static_cast<uint8>(*pSrc) & 0xF0) == 0xE0))
+							{
+								__m128i codePoints;
+
+								if (Decode3ByteX4(pSrc, codePoints))
+								{
+									if constexpr (Write)
+									{
+										StoreBMP4(codePoints, (dst + length));
+									}
+
+									pSrc += 12;
+									length += 4;
+									continue;
+								}
+							}
+
+							int32 offset;
+							const char32 codePoint = utf8_decode(pSrc, (pSrcEnd - pSrc), offset);
+							pSrc += offset;
+
+							if constexpr (std::is_same_v<Char, char32>)
+							{
+								if constexpr (Write)
+								{
+									dst[length] = codePoint;
+								}
+
+								++length;
+							}
+							else
+							{
+								if constexpr (Write)
+								{
+									Char* p = (dst + length);
+									UTF16_Encode(&p, codePoint);
+								}
+
+								length += UTF16_Length(codePoint);
+							}
+						} while ((pSrc != pSrcEnd) && (0x80 <= static_cast<uint8>(*pSrc)));
+					}
+				}
+
+				return length;
+			}
+
+			template <bool SwapBytes>
+			[[nodiscard]]
+			inline char16 LoadUTF16(const uint8* src) noexcept
+			{
+				if constexpr (SwapBytes)
+				{
+					return static_cast<char16>((src[0] << 8) | src[1]);
+				}
+				else
+				{
+					return static_cast<char16>(src[0] | (src[1] << 8));
+				}
+			}
+
+			// Write が false の場合は書き込まずに文字数だけを数える
+			template <bool SwapBytes, bool Write>
+			size_t ConvertUTF16Impl(const uint8* src, const size_t length, char32* dst) noexcept
+			{
+				size_t i = 0;
+				size_t count = 0;
+
+				const auto decodeOne = [&]()
+				{
+					const char16 c0 = LoadUTF16<SwapBytes>(src + (i * 2));
+					char32 codePoint = c0;
+					++i;
+
+					if (is_high_surrogate(c0)
+						&& (i < length)
+						&& is_low_surrogate(LoadUTF16<SwapBytes>(src + (i * 2))))
+					{
+						const char16 c1 = LoadUTF16<SwapBytes>(src + (i * 2));
+						codePoint = ((((c0 - 0xD800) << 10) | (c1 - 0xDC00)) + 0x10000);
+						++i;
+					}
+					else if (is_high_surrogate(c0) || is_low_surrogate(c0))
+					{
+						codePoint = 0xFFFD;
+					}
+
+					if constexpr (Write)
+					{
+						dst[count] = codePoint;
+					}
+
+					++count;
+				};
+
+				while ((i + 8) <= length)
+				{
+					__m128i v = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + (i * 2)));
+
+					if constexpr (SwapBytes)
+					{
+						v = ::_mm_or_si128(::_mm_slli_epi16(v, 8), ::_mm_srli_epi16(v, 8));
+					}
+
+					const __m128i surrogates = ::_mm_cmpeq_epi16(::_mm_and_si128(v, ::_mm_set1_epi16(static_cast<int16>(0xF800))), ::_mm_set1_epi16(static_cast<int16>(0xD800)));
+
+					if (::_mm_movemask_epi8(surrogates) == 0)
+					{
+						// サロゲートを含まない 8 文字はまとめて変換する
+						if constexpr (Write)
+						{
+							const __m128i zero = ::_mm_setzero_si128();
+							::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + count), ::_mm_unpacklo_epi16(v, zero));
+							::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + count + 4), ::_mm_unpackhi_epi16(v, zero));
+						}
+
+						i += 8;
+						count += 8;
+					}
+					else
+					{
+						for (const size_t blockEnd = (i + 8); i < blockEnd;)
+						{
+							decodeOne();
+						}
+					}
+				}
+
+				while (i < length)
+				{
+					decodeOne();
+				}
+
+				return count;
+			}
+
+			// Write が false の場合は書き込まずにバイト数だけを数える
+			template <bool Write>
+			size_t ConvertUTF32Impl(const char32* src, const size_t length, char8* dst) noexcept
+			{
+				size_t i = 0;
+				size_t count = 0;
+
+				const auto encodeOne = [&]()
+				{
+					const char32 codePoint = src[i++];
+
+					if constexpr (Write)
+					{
+						char8* p = (dst + count);
+						UTF8_Encode(&p, codePoint);
+					}
+
+					count += UTF8_Length(codePoint);
+				};
+
+				while (i < length)
+				{
+					if (((i + 16) <= length) && (src[i] < 0x80))
+					{
+						const __m128i a = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+						const __m128i b = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 4));
+						const __m128i c = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+						const __m128i d = ::_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 12));
+
+						if (::_mm_testz_si128(::_mm_or_si128(::_mm_or_si128(a, b), ::_mm_or_si128(c, d)), ::_mm_set1_epi32(~0x7F)))
+						{
+							// ASCII 16 文字はまとめて変換する
+							if constexpr (Write)
+							{
+								::_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + count), ::_mm_packus_epi16(::_mm_packs_epi32(a, b), ::_mm_packs_epi32(c, d)));
+							}
+
+							i += 16;
+							count += 16;
+						}
+						else
+						{
+							for (const size_t blockEnd = (i + 16); i < blockEnd;)
+							{
+								encodeOne();
+							}
+						}
+					}
+					else
+					{
+						encodeOne();
+					}
+				}
+
+				return count;
+			}
+		}
+
 		//
 		// UTF-8
 		//
@@ -68,17 +388,7 @@ namespace s3d
 
 		size_t UTF8_Length(const StringView s) noexcept
 		{
-			size_t result = 0;
-
-			const char32* pSrc = s.data();
-			const char32* const pSrcEnd = pSrc + s.size();
-
-			while (pSrc != pSrcEnd)
-			{
-				result += UTF8_Length(*pSrc++);
-			}
-
-			return result;
+			return ConvertUTF32Impl<false>(s.data(), s.size(), nullptr);
 		}
 
 		void UTF8_Encode(char8** s, const char32 codePoint) noexcept
@@ -123,21 +433,7 @@ namespace s3d
 
 		size_t UTF16_Length(const std::string_view s) noexcept
 		{
-			size_t length = 0;
-
-			const char8* pSrc = s.data();
-			const char8* const pSrcEnd = pSrc + s.size();
-
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset = 0;
-
-				length += UTF16_Length(detail::utf8_decode(pSrc, pSrcEnd - pSrc, offset));
-
-				pSrc += offset;
-			}
-
-			return length;
+			return ConvertUTF8Impl<char16, false>(s, nullptr);
 		}
 
 		size_t UTF16_Length(const char32 codePoint) noexcept
@@ -174,44 +470,43 @@ namespace s3d
 
 		size_t UTF32_Length(const std::string_view s) noexcept
 		{
-			size_t length = 0;
-
-			const char8* pSrc = s.data();
-			const char8* const pSrcEnd = pSrc + s.size();
-
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
-
-				utf8_decode(pSrc, pSrcEnd - pSrc, offset);
-
-				pSrc += offset;
-
-				++length;
-			}
-
-			return length;
+			return ConvertUTF8Impl<char32, false>(s, nullptr);
 		}
 
 		size_t UTF32_Length(const std::u16string_view s) noexcept
 		{
-			const char16* pSrc = s.data();
-			const char16* const pSrcEnd = pSrc + s.size();
-
-			size_t length = 0;
+			return ConvertUTF16Impl<false, false>(reinterpret_cast<const uint8*>(s.data()), s.size(), nullptr);
+		}
 
-			while (pSrc != pSrcEnd)
-			{
-				int32 offset;
+		//
+		// 一括変換
+		//
 
-				utf16_decode(pSrc, pSrcEnd - pSrc, offset);
+		size_t ConvertUTF8ToUTF32(const std::string_view s, char32* dst) noexcept
+		{
+			return ConvertUTF8Impl<char32, true>(s, dst);
+		}
 
-				pSrc += offset;
+		size_t ConvertUTF8ToUTF16(const std::string_view s, char16* dst) noexcept
+		{
+			return ConvertUTF8Impl<char16, true>(s, dst);
+		}
 
-				++length;
+		size_t ConvertUTF16ToUTF32(const void* src, const size_t length, char32* dst, const bool swapBytes) noexcept
+		{
+			if (swapBytes)
+			{
+				return ConvertUTF16Impl<true, true>(static_cast<const uint8*>(src), length, dst);
+			}
+			else
+			{
+				return ConvertUTF16Impl<false, true>(static_cast<const uint8*>(src), length, dst);
 			}
+		}
 
-			return length;
+		size_t ConvertUTF32ToUTF8(const StringView s, char8* dst) noexcept
+		{
+			return ConvertUTF32Impl<true>(s.data(), s.size(), dst);
 		}
 	}
 }
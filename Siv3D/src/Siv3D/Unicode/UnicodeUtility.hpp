@@ -72,5 +72,23 @@ namespace s3d
 
 		[[nodiscard]]
 		size_t UTF32_Length(std::u16string_view s) noexcept;
+
+		//
+		// 一括変換
+		// ASCII の連続や 3 バイト文字の連続は SIMD でまとめて変換する。
+		// 不正なバイト列は U+FFFD に置き換える（utf8_decode(), utf16_decode() と同じ結果）
+		//
+
+		// dst には UTF32_Length(s) 文字分の領域が必要。書き込んだ文字数を返す
+		size_t ConvertUTF8ToUTF32(std::string_view s, char32* dst) noexcept;
+
+		// dst には UTF16_Length(s) 文字分の領域が必要。書き込んだ文字数を返す
+		size_t ConvertUTF8ToUTF16(std::string_view s, char16* dst) noexcept;
+
+		// src はアラインされていなくてよい。swapBytes が true の場合は各文字のバイト順を入れ替えて読む（UTF-16BE 用）
+		size_t ConvertUTF16ToUTF32(const void* src, size_t length, char32* dst, bool swapBytes = false) noexcept;
+
+		// dst には UTF8_Length(s) バイト分の領域が必要。書き込んだバイト数を返す
+		size_t ConvertUTF32ToUTF8(StringView s, char8* dst) noexcept;
 	}
 }
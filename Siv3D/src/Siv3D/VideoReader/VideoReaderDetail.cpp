@@ -53,7 +53,8 @@ namespace s3d
 		LOG_INFO(U"ℹ️ VideoReader: file `{0}` opened (resolution: {1}, fps: {2}, frameCount: {3})"_fmt(
 			path, m_info.resolution, m_info.fps, m_info.frameCount));
 
-		m_task = Async(&VideoReaderDetail::run, this);
+		// デコードループはスレッドプールのワーカーを占有しないよう、専用のスレッドで実行する
+		m_task = std::async(std::launch::async, &VideoReaderDetail::run, this);
 
 		return true;
 	}
@@ -0,0 +1,522 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <cstring>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/MemoryViewReader.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "CVirtualFileSystem.hpp"
+# include "VirtualFileSystemPack.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		[[nodiscard]]
+		static bool NeedsNormalization(const FilePathView path) noexcept
+		{
+			return (path.includes(U'\\') || path.starts_with(U"./"));
+		}
+
+		// `\` を `/` に置き換え、先頭の `./` を取り除く
+		[[nodiscard]]
+		static FilePath NormalizeVirtualPath(const FilePathView path)
+		{
+			FilePath result{ path };
+			result.replace(U'\\', U'/');
+
+			size_t prefix = 0;
+
+			while (FilePathView{ result }.substr(prefix).starts_with(U"./"))
+			{
+				prefix += 2;
+			}
+
+			return result.substr(prefix);
+		}
+
+		template <class Type>
+		[[nodiscard]]
+		static Type LoadPackValue(const Byte* p) noexcept
+		{
+			Type value;
+			std::memcpy(&value, p, sizeof(Type));
+			return value;
+		}
+
+		// ファイルパスから、親ディレクトリのパスをすべて列挙する
+		template <class Files>
+		[[nodiscard]]
+		static Array<FilePath> GetParentDirectories(const Files& files)
+		{
+			HashSet<FilePath> directories;
+
+			for (const auto& file : files)
+			{
+				const FilePath& path = file.first;
+
+				for (size_t i = path.indexOf(U'/'); i != String::npos; i = path.indexOf(U'/', (i + 1)))
+				{
+					directories.emplace(path.substr(0, i));
+				}
+			}
+
+			return Array<FilePath>(directories.begin(), directories.end());
+		}
+	}
+
+	bool CVirtualFileSystem::mount(const FilePathView source, const FilePathView mountPoint)
+	{
+		// FileSystem の関数がこのクラスを参照するため、ファイルの一覧はロックせずに作成する
+		std::shared_ptr<Mount> newMount = CreateMount(source, mountPoint);
+
+		if (not newMount)
+		{
+			return false;
+		}
+
+		const size_t fileCount = newMount->files.size();
+
+		{
+			std::unique_lock lock{ m_mutex };
+
+			const size_t previousCount = m_mounts.size();
+
+			// 同じものがマウントされている場合は置き換える
+			m_mounts.remove_if([&](const std::shared_ptr<Mount>& mount) { return (mount->source == newMount->source); });
+
+			m_mounts.push_back(std::move(newMount));
+
+			if (m_mounts.size() == (previousCount + 1))
+			{
+				addToIndex(*m_mounts.back());
+			}
+			else
+			{
+				rebuildIndex();
+			}
+
+			m_mountCount = m_mounts.size();
+		}
+
+		LOG_INFO(U"📦 VirtualFileSystem: Mounted `{0}` ({1} files)"_fmt(source, fileCount));
+
+		return true;
+	}
+
+	bool CVirtualFileSystem::unmount(const FilePathView source)
+	{
+		if (not source)
+		{
+			return false;
+		}
+
+		const FilePath fullPath = FileSystem::FullPath(source);
+
+		std::unique_lock lock{ m_mutex };
+
+		const size_t previousCount = m_mounts.size();
+
+		m_mounts.remove_if([&](const std::shared_ptr<Mount>& mount) { return (mount->source == fullPath); });
+
+		if (m_mounts.size() == previousCount)
+		{
+			return false;
+		}
+
+		rebuildIndex();
+
+		m_mountCount = m_mounts.size();
+
+		return true;
+	}
+
+	void CVirtualFileSystem::unmountAll()
+	{
+		std::unique_lock lock{ m_mutex };
+
+		m_mounts.clear();
+
+		rebuildIndex();
+
+		m_mountCount = 0;
+	}
+
+	bool CVirtualFileSystem::isMounted(const FilePathView source) const
+	{
+		if ((not source) || (not hasMounts()))
+		{
+			return false;
+		}
+
+		const FilePath fullPath = FileSystem::FullPath(source);
+
+		std::shared_lock lock{ m_mutex };
+
+		return m_mounts.any([&](const std::shared_ptr<Mount>& mount) { return (mount->source == fullPath); });
+	}
+
+	bool CVirtualFileSystem::hasMounts() const noexcept
+	{
+		return (m_mountCount != 0);
+	}
+
+	bool CVirtualFileSystem::isFile(const FilePathView path) const
+	{
+		std::shared_lock lock{ m_mutex };
+
+		return (findEntry(path) != nullptr);
+	}
+
+	bool CVirtualFileSystem::isDirectory(const FilePathView path) const
+	{
+		if (not path)
+		{
+			return false;
+		}
+
+		if (detail::NeedsNormalization(path) || path.ends_with(U'/'))
+		{
+			FilePath normalized = detail::NormalizeVirtualPath(path);
+
+			if (normalized.ends_with(U'/'))
+			{
+				normalized.pop_back();
+			}
+
+			std::shared_lock lock{ m_mutex };
+
+			return m_directories.contains(normalized);
+		}
+		else
+		{
+			std::shared_lock lock{ m_mutex };
+
+			return (m_directories.find(path) != m_directories.end());
+		}
+	}
+
+	int64 CVirtualFileSystem::fileSize(const FilePathView path) const
+	{
+		std::shared_lock lock{ m_mutex };
+
+		const auto* file = findEntry(path);
+
+		if (not file)
+		{
+			return -1;
+		}
+
+		const Entry& entry = file->second;
+
+		if (0 <= entry.size)
+		{
+			return entry.size;
+		}
+
+		const Mount& mount = *entry.mount;
+		const FilePathView relativePath = FilePathView{ file->first }.substr(mount.mountPoint.size());
+
+		std::lock_guard zipLock{ mount.zipMutex };
+
+		return mount.zip.openEntry(relativePath).size();
+	}
+
+	Array<FilePath> CVirtualFileSystem::enumFiles() const
+	{
+		Array<FilePath> paths;
+		{
+			std::shared_lock lock{ m_mutex };
+
+			paths.reserve(m_files.size());
+
+			for (const auto& file : m_files)
+			{
+				paths << file.first;
+			}
+		}
+
+		return paths.sort();
+	}
+
+	bool CVirtualFileSystem::open(const FilePathView path, VirtualFileSource& source) const
+	{
+		std::shared_lock lock{ m_mutex };
+
+		const auto* file = findEntry(path);
+
+		if (not file)
+		{
+			return false;
+		}
+
+		const Entry& entry = file->second;
+		const Mount& mount = *entry.mount;
+		const FilePathView relativePath = FilePathView{ file->first }.substr(mount.mountPoint.size());
+
+		switch (mount.type)
+		{
+		case MountType::Directory:
+			{
+				source.filePath = (mount.source + relativePath);
+				return true;
+			}
+		case MountType::ZIP:
+			{
+				std::lock_guard zipLock{ mount.zipMutex };
+
+				ZIPEntryReader reader = mount.zip.openEntry(relativePath);
+
+				if (not reader)
+				{
+					return false;
+				}
+
+				source.size = reader.size();
+				source.reader = std::make_unique<ZIPEntryReader>(std::move(reader));
+				return true;
+			}
+		case MountType::Pack:
+			{
+				source.holder = mount.pack;
+				source.data = (mount.pack->data() + entry.offset);
+				source.size = entry.size;
+				source.reader = std::make_unique<MemoryViewReader>(source.data, static_cast<size_t>(source.size));
+				return true;
+			}
+		default:
+			return false;
+		}
+	}
+
+	std::shared_ptr<CVirtualFileSystem::Mount> CVirtualFileSystem::CreateMount(const FilePathView source, const FilePathView mountPoint)
+	{
+		auto mount = std::make_shared<Mount>();
+
+		mount->mountPoint = detail::NormalizeVirtualPath(mountPoint);
+
+		if (mount->mountPoint && (not mount->mountPoint.ends_with(U'/')))
+		{
+			mount->mountPoint.push_back(U'/');
+		}
+
+		if (FileSystem::IsDirectory(source))
+		{
+			mount->type = MountType::Directory;
+			mount->source = FileSystem::FullPath(source);
+
+			if (not LoadDirectory(*mount))
+			{
+				return nullptr;
+			}
+		}
+		else if (FileSystem::IsFile(source))
+		{
+			mount->source = FileSystem::FullPath(source);
+
+			char magic[sizeof(detail::PackMagic)] = {};
+			{
+				BinaryReader reader{ source };
+
+				if (not reader.read(magic))
+				{
+					LOG_FAIL(U"❌ VirtualFileSystem: Failed to read `{0}`"_fmt(source));
+					return nullptr;
+				}
+			}
+
+			if (std::memcmp(magic, detail::PackMagic, sizeof(detail::PackMagic)) == 0)
+			{
+				mount->type = MountType::Pack;
+
+				if (not LoadPack(*mount))
+				{
+					return nullptr;
+				}
+			}
+			else if ((magic[0] == 'P') && (magic[1] == 'K'))
+			{
+				mount->type = MountType::ZIP;
+
+				if (not LoadZIP(*mount))
+				{
+					return nullptr;
+				}
+			}
+			else
+			{
+				LOG_FAIL(U"❌ VirtualFileSystem: `{0}` is neither a ZIP archive nor a pack file"_fmt(source));
+				return nullptr;
+			}
+		}
+		else
+		{
+			LOG_FAIL(U"❌ VirtualFileSystem: `{0}` not found"_fmt(source));
+			return nullptr;
+		}
+
+		mount->directories = detail::GetParentDirectories(mount->files);
+
+		return mount;
+	}
+
+	bool CVirtualFileSystem::LoadDirectory(Mount& mount)
+	{
+		for (const auto& path : FileSystem::DirectoryContents(mount.source, Recursive::Yes))
+		{
+			if (path.ends_with(U'/'))
+			{
+				continue;
+			}
+
+			const FilePathView relativePath = FilePathView{ path }.substr(mount.source.size());
+
+			mount.files.emplace_back((mount.mountPoint + relativePath), Entry{ &mount, 0, FileSystem::FileSize(path) });
+		}
+
+		return true;
+	}
+
+	bool CVirtualFileSystem::LoadZIP(Mount& mount)
+	{
+		if (not mount.zip.open(mount.source))
+		{
+			LOG_FAIL(U"❌ VirtualFileSystem: Failed to open the ZIP archive `{0}`"_fmt(mount.source));
+			return false;
+		}
+
+		for (const auto& path : mount.zip.enumPaths())
+		{
+			if (path.ends_with(U'/'))
+			{
+				continue;
+			}
+
+			mount.files.emplace_back((mount.mountPoint + path), Entry{ &mount, 0, -1 });
+		}
+
+		return true;
+	}
+
+	bool CVirtualFileSystem::LoadPack(Mount& mount)
+	{
+		auto pack = std::make_shared<MemoryMappedFileView>(mount.source);
+
+		if (not *pack)
+		{
+			LOG_FAIL(U"❌ VirtualFileSystem: Failed to map the pack file `{0}`"_fmt(mount.source));
+			return false;
+		}
+
+		const Byte* const data = pack->data();
+		const uint64 fileSize = pack->mappedSize();
+
+		if ((fileSize < detail::PackHeaderSize)
+			|| (detail::LoadPackValue<uint32>(data + 8) != detail::PackVersion))
+		{
+			LOG_FAIL(U"❌ VirtualFileSystem: Unsupported pack file `{0}`"_fmt(mount.source));
+			return false;
+		}
+
+		const uint32 entryCount = detail::LoadPackValue<uint32>(data + 12);
+		const uint64 indexOffset = detail::LoadPackValue<uint64>(data + 16);
+		const uint64 indexSize = detail::LoadPackValue<uint64>(data + 24);
+
+		if ((fileSize < indexOffset)
+			|| ((fileSize - indexOffset) < indexSize))
+		{
+			LOG_FAIL(U"❌ VirtualFileSystem: The pack file `{0}` is broken"_fmt(mount.source));
+			return false;
+		}
+
+		const Byte* p = (data + indexOffset);
+		const Byte* const end = (p + indexSize);
+
+		mount.files.reserve(entryCount);
+
+		for (uint32 i = 0; i < entryCount; ++i)
+		{
+			if (static_cast<size_t>(end - p) < detail::PackIndexEntryHeaderSize)
+			{
+				LOG_FAIL(U"❌ VirtualFileSystem: The pack file `{0}` is broken"_fmt(mount.source));
+				return false;
+			}
+
+			const uint64 offset = detail::LoadPackValue<uint64>(p);
+			const uint64 size = detail::LoadPackValue<uint64>(p + 8);
+			const uint32 pathLength = detail::LoadPackValue<uint32>(p + 16);
+			p += detail::PackIndexEntryHeaderSize;
+
+			if ((static_cast<size_t>(end - p) < pathLength)
+				|| (fileSize < offset)
+				|| ((fileSize - offset) < size))
+			{
+				LOG_FAIL(U"❌ VirtualFileSystem: The pack file `{0}` is broken"_fmt(mount.source));
+				return false;
+			}
+
+			const String path = Unicode::FromUTF8(std::string_view{ reinterpret_cast<const char*>(p), pathLength });
+			p += pathLength;
+
+			mount.files.emplace_back((mount.mountPoint + path), Entry{ &mount, offset, static_cast<int64>(size) });
+		}
+
+		mount.pack = std::move(pack);
+
+		return true;
+	}
+
+	void CVirtualFileSystem::addToIndex(const Mount& mount)
+	{
+		for (const auto& file : mount.files)
+		{
+			m_files.insert_or_assign(file.first, file.second);
+		}
+
+		for (const auto& directory : mount.directories)
+		{
+			m_directories.insert(directory);
+		}
+	}
+
+	void CVirtualFileSystem::rebuildIndex()
+	{
+		m_files.clear();
+		m_directories.clear();
+
+		// 後からマウントしたものが優先されるよう、マウントした順に追加する
+		for (const auto& mount : m_mounts)
+		{
+			addToIndex(*mount);
+		}
+	}
+
+	const std::pair<const FilePath, CVirtualFileSystem::Entry>* CVirtualFileSystem::findEntry(const FilePathView path) const
+	{
+		if (m_files.empty() || (not path))
+		{
+			return nullptr;
+		}
+
+		if (detail::NeedsNormalization(path))
+		{
+			const auto it = m_files.find(detail::NormalizeVirtualPath(path));
+			return ((it == m_files.end()) ? nullptr : &*it);
+		}
+		else
+		{
+			const auto it = m_files.find(path);
+			return ((it == m_files.end()) ? nullptr : &*it);
+		}
+	}
+}
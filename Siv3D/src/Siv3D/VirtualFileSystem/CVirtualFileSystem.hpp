@@ -0,0 +1,128 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <atomic>
+# include <mutex>
+# include <shared_mutex>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/HashSet.hpp>
+# include <Siv3D/ZIPReader.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include "IVirtualFileSystem.hpp"
+
+namespace s3d
+{
+	class CVirtualFileSystem final : public ISiv3DVirtualFileSystem
+	{
+	public:
+
+		bool mount(FilePathView source, FilePathView mountPoint) override;
+
+		bool unmount(FilePathView source) override;
+
+		void unmountAll() override;
+
+		bool isMounted(FilePathView source) const override;
+
+		bool hasMounts() const noexcept override;
+
+		bool isFile(FilePathView path) const override;
+
+		bool isDirectory(FilePathView path) const override;
+
+		int64 fileSize(FilePathView path) const override;
+
+		Array<FilePath> enumFiles() const override;
+
+		bool open(FilePathView path, VirtualFileSource& source) const override;
+
+	private:
+
+		enum class MountType : uint8
+		{
+			Directory,
+
+			ZIP,
+
+			Pack,
+		};
+
+		struct Mount;
+
+		struct Entry
+		{
+			const Mount* mount = nullptr;
+
+			// パックファイル内のデータの位置
+			uint64 offset = 0;
+
+			// ZIP 圧縮ファイル内のファイルでは -1（ZIPReader::openEntry() で調べる）
+			int64 size = -1;
+		};
+
+		struct Mount
+		{
+			MountType type = MountType::Directory;
+
+			// マウントしたディレクトリまたはファイルの絶対パス
+			FilePath source;
+
+			// 末尾が `/` のマウント先。空の場合もある
+			FilePath mountPoint;
+
+			ZIPReader zip;
+
+			// ZIPReader::openEntry() の展開のフォールバックはスレッドセーフでないため
+			mutable std::mutex zipMutex;
+
+			std::shared_ptr<MemoryMappedFileView> pack;
+
+			Array<std::pair<FilePath, Entry>> files;
+
+			Array<FilePath> directories;
+		};
+
+		// マウントした順
+		Array<std::shared_ptr<Mount>> m_mounts;
+
+		// 仮想パス → ファイル
+		HashTable<FilePath, Entry> m_files;
+
+		HashSet<FilePath> m_directories;
+
+		std::atomic<size_t> m_mountCount = 0;
+
+		mutable std::shared_mutex m_mutex;
+
+		[[nodiscard]]
+		static std::shared_ptr<Mount> CreateMount(FilePathView source, FilePathView mountPoint);
+
+		[[nodiscard]]
+		static bool LoadDirectory(Mount& mount);
+
+		[[nodiscard]]
+		static bool LoadZIP(Mount& mount);
+
+		[[nodiscard]]
+		static bool LoadPack(Mount& mount);
+
+		// m_mutex をロックした状態で呼ぶ
+		void addToIndex(const Mount& mount);
+
+		// m_mutex をロックした状態で呼ぶ
+		void rebuildIndex();
+
+		// m_mutex をロックした状態で呼ぶ
+		[[nodiscard]]
+		const std::pair<const FilePath, Entry>* findEntry(FilePathView path) const;
+	};
+}
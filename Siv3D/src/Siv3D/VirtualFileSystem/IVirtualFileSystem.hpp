@@ -0,0 +1,76 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <memory>
+# include <Siv3D/Common.hpp>
+# include <Siv3D/String.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/IReader.hpp>
+# include <Siv3D/Byte.hpp>
+
+namespace s3d
+{
+	struct VirtualFileSource
+	{
+		// ディレクトリをマウントしている場合の、実際のファイルパス
+		FilePath filePath;
+
+		// reader や data が参照するデータを保持する
+		std::shared_ptr<const void> holder;
+
+		// ZIP 圧縮ファイルやパックファイル内のファイルを読み込む Reader
+		std::unique_ptr<IReader> reader;
+
+		// パックファイル内のファイルの場合、メモリマップされたデータ
+		const Byte* data = nullptr;
+
+		int64 size = 0;
+	};
+
+	class SIV3D_NOVTABLE ISiv3DVirtualFileSystem
+	{
+	public:
+
+		static ISiv3DVirtualFileSystem* Create();
+
+		virtual ~ISiv3DVirtualFileSystem() = default;
+
+		virtual bool mount(FilePathView source, FilePathView mountPoint) = 0;
+
+		virtual bool unmount(FilePathView source) = 0;
+
+		virtual void unmountAll() = 0;
+
+		virtual bool isMounted(FilePathView source) const = 0;
+
+		// 1 つ以上マウントされているか
+		virtual bool hasMounts() const noexcept = 0;
+
+		virtual bool isFile(FilePathView path) const = 0;
+
+		virtual bool isDirectory(FilePathView path) const = 0;
+
+		// ファイルが無い場合は -1
+		virtual int64 fileSize(FilePathView path) const = 0;
+
+		virtual Array<FilePath> enumFiles() const = 0;
+
+		virtual bool open(FilePathView path, VirtualFileSource& source) const = 0;
+	};
+
+	namespace detail
+	{
+		// エンジンが有効で、1 つ以上マウントされている場合に仮想ファイルシステムを返す
+		[[nodiscard]]
+		ISiv3DVirtualFileSystem* GetMountedVirtualFileSystem() noexcept;
+	}
+}
@@ -0,0 +1,190 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/VirtualFileSystem.hpp>
+# include <Siv3D/FileSystem.hpp>
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/Blob.hpp>
+# include <Siv3D/Unicode.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/VirtualFileSystem/IVirtualFileSystem.hpp>
+# include <Siv3D/Common/Siv3DEngine.hpp>
+# include "VirtualFileSystemPack.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		ISiv3DVirtualFileSystem* GetMountedVirtualFileSystem() noexcept
+		{
+			if (not Siv3DEngine::isActive())
+			{
+				return nullptr;
+			}
+
+			ISiv3DVirtualFileSystem* const pVirtualFileSystem = SIV3D_ENGINE(VirtualFileSystem);
+
+			if ((not pVirtualFileSystem)
+				|| (not pVirtualFileSystem->hasMounts()))
+			{
+				return nullptr;
+			}
+
+			return pVirtualFileSystem;
+		}
+	}
+
+	namespace VirtualFileSystem
+	{
+		bool Mount(const FilePathView source, const FilePathView mountPoint)
+		{
+			return SIV3D_ENGINE(VirtualFileSystem)->mount(source, mountPoint);
+		}
+
+		bool Unmount(const FilePathView source)
+		{
+			return SIV3D_ENGINE(VirtualFileSystem)->unmount(source);
+		}
+
+		void UnmountAll()
+		{
+			SIV3D_ENGINE(VirtualFileSystem)->unmountAll();
+		}
+
+		bool IsMounted(const FilePathView source)
+		{
+			return SIV3D_ENGINE(VirtualFileSystem)->isMounted(source);
+		}
+
+		bool Exists(const FilePathView path)
+		{
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				return pVirtualFileSystem->isFile(path);
+			}
+
+			return false;
+		}
+
+		int64 FileSize(const FilePathView path)
+		{
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				return Max<int64>(pVirtualFileSystem->fileSize(path), 0);
+			}
+
+			return 0;
+		}
+
+		Array<FilePath> EnumFiles()
+		{
+			return SIV3D_ENGINE(VirtualFileSystem)->enumFiles();
+		}
+
+		MemoryViewReader OpenView(const FilePathView path)
+		{
+			if (const auto pVirtualFileSystem = detail::GetMountedVirtualFileSystem())
+			{
+				VirtualFileSource source;
+
+				if (pVirtualFileSystem->open(path, source)
+					&& source.data)
+				{
+					return MemoryViewReader{ source.data, static_cast<size_t>(source.size) };
+				}
+			}
+
+			return{};
+		}
+
+		bool CreatePack(const FilePathView directory, const FilePathView packPath)
+		{
+			if (not FileSystem::IsDirectory(directory))
+			{
+				LOG_FAIL(U"❌ VirtualFileSystem::CreatePack(): `{0}` is not a directory"_fmt(directory));
+				return false;
+			}
+
+			const FilePath root = FileSystem::FullPath(directory);
+
+			BinaryWriter writer{ packPath };
+
+			if (not writer)
+			{
+				return false;
+			}
+
+			Array<FilePath> files = FileSystem::DirectoryContents(root, Recursive::Yes)
+				.remove_if([&](const FilePath& path) { return (path.ends_with(U'/') || (path == writer.path())); });
+
+			// 同じディレクトリから常に同じパックファイルを作成するため
+			files.sort();
+
+			// ヘッダは最後に書き込む
+			const Byte header[detail::PackHeaderSize] = {};
+			writer.write(header, sizeof(header));
+
+			std::string index;
+
+			for (const auto& file : files)
+			{
+				const Blob blob{ file };
+
+				if (blob.isEmpty() && (FileSystem::FileSize(file) != 0))
+				{
+					LOG_FAIL(U"❌ VirtualFileSystem::CreatePack(): Failed to read `{0}`"_fmt(file));
+					return false;
+				}
+
+				const uint64 padding = ((detail::PackDataAlignment - (writer.getPos() % detail::PackDataAlignment)) % detail::PackDataAlignment);
+				const Byte zeros[detail::PackDataAlignment] = {};
+				writer.write(zeros, padding);
+
+				const uint64 offset = writer.getPos();
+				const uint64 size = blob.size();
+
+				if (writer.write(blob.data(), size) != static_cast<int64>(size))
+				{
+					LOG_FAIL(U"❌ VirtualFileSystem::CreatePack(): Failed to write `{0}`"_fmt(packPath));
+					return false;
+				}
+
+				const std::string path = Unicode::ToUTF8(FilePathView{ file }.substr(root.size()));
+				const uint32 pathLength = static_cast<uint32>(path.size());
+
+				index.append(reinterpret_cast<const char*>(&offset), sizeof(offset));
+				index.append(reinterpret_cast<const char*>(&size), sizeof(size));
+				index.append(reinterpret_cast<const char*>(&pathLength), sizeof(pathLength));
+				index.append(path);
+			}
+
+			const uint64 indexOffset = writer.getPos();
+			const uint64 indexSize = index.size();
+
+			if (writer.write(index.data(), index.size()) != static_cast<int64>(index.size()))
+			{
+				LOG_FAIL(U"❌ VirtualFileSystem::CreatePack(): Failed to write `{0}`"_fmt(packPath));
+				return false;
+			}
+
+			const uint32 entryCount = static_cast<uint32>(files.size());
+
+			writer.setPos(0);
+			writer.write(detail::PackMagic, sizeof(detail::PackMagic));
+			writer.write(detail::PackVersion);
+			writer.write(entryCount);
+			writer.write(indexOffset);
+			writer.write(indexSize);
+
+			return true;
+		}
+	}
+}
@@ -0,0 +1,20 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "CVirtualFileSystem.hpp"
+
+namespace s3d
+{
+	ISiv3DVirtualFileSystem* ISiv3DVirtualFileSystem::Create()
+	{
+		return new CVirtualFileSystem;
+	}
+}
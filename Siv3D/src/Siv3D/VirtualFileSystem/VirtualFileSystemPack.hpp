@@ -0,0 +1,49 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/Common.hpp>
+
+//
+// パックファイルの形式（リトルエンディアン）
+//
+// [ヘッダ]
+//	uint8[8]	magic "S3DPACK\0"
+//	uint32		version
+//	uint32		entryCount
+//	uint64		indexOffset
+//	uint64		indexSize
+//
+// [データ]
+//	各ファイルのデータを PackDataAlignment バイト境界に配置
+//
+// [インデックス] × entryCount
+//	uint64		offset（ファイル先頭からの位置）
+//	uint64		size
+//	uint32		pathLength
+//	uint8[]		path（UTF-8, `/` 区切りの相対パス）
+//
+
+namespace s3d
+{
+	namespace detail
+	{
+		inline constexpr char PackMagic[8] = { 'S', '3', 'D', 'P', 'A', 'C', 'K', '\0' };
+
+		inline constexpr uint32 PackVersion = 1;
+
+		inline constexpr size_t PackHeaderSize = 32;
+
+		inline constexpr size_t PackIndexEntryHeaderSize = 20;
+
+		inline constexpr uint64 PackDataAlignment = 16;
+	}
+}
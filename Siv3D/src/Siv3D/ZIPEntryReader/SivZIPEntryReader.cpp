@@ -0,0 +1,94 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ZIPEntryReader.hpp>
+# include <Siv3D/ZIPEntryReader/ZIPEntryReaderDetail.hpp>
+
+namespace s3d
+{
+	ZIPEntryReader::ZIPEntryReader()
+		: pImpl{ std::make_shared<ZIPEntryReaderDetail>() } {}
+
+	bool ZIPEntryReader::supportsLookahead() const noexcept
+	{
+		return pImpl->supportsLookahead();
+	}
+
+	void ZIPEntryReader::close()
+	{
+		pImpl->close();
+	}
+
+	bool ZIPEntryReader::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	ZIPEntryReader::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	bool ZIPEntryReader::isCompressed() const noexcept
+	{
+		return pImpl->isCompressed();
+	}
+
+	int64 ZIPEntryReader::size() const
+	{
+		return pImpl->size();
+	}
+
+	int64 ZIPEntryReader::getPos() const
+	{
+		return pImpl->getPos();
+	}
+
+	bool ZIPEntryReader::setPos(const int64 pos)
+	{
+		return pImpl->setPos(pos);
+	}
+
+	int64 ZIPEntryReader::skip(const int64 offset)
+	{
+		return pImpl->skip(offset);
+	}
+
+	int64 ZIPEntryReader::read(void* dst, const int64 size)
+	{
+		return pImpl->read(dst, size);
+	}
+
+	int64 ZIPEntryReader::read(void* dst, const int64 pos, const int64 size)
+	{
+		if (not pImpl->setPos(pos))
+		{
+			return 0;
+		}
+
+		return pImpl->read(dst, size);
+	}
+
+	int64 ZIPEntryReader::lookahead(void* dst, const int64 size) const
+	{
+		return pImpl->lookahead(dst, pImpl->getPos(), size);
+	}
+
+	int64 ZIPEntryReader::lookahead(void* dst, const int64 pos, const int64 size) const
+	{
+		return pImpl->lookahead(dst, pos, size);
+	}
+
+	const FilePath& ZIPEntryReader::path() const noexcept
+	{
+		return pImpl->path();
+	}
+}
@@ -0,0 +1,274 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/EngineLog.hpp>
+# include "ZIPEntryReaderDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// 1 回の inflate() で扱うサイズの上限（uInt に収まるサイズ）
+		inline constexpr size_t MaxInflateChunkSize = (1u << 30);
+
+		// 読み飛ばす際に展開先として使うバッファのサイズ
+		inline constexpr size_t InflateSkipBufferSize = (64 * 1024);
+	}
+
+	ZIPEntryReader::ZIPEntryReaderDetail::ZIPEntryReaderDetail()
+	{
+		// do nothing
+	}
+
+	ZIPEntryReader::ZIPEntryReaderDetail::~ZIPEntryReaderDetail()
+	{
+		close();
+	}
+
+	bool ZIPEntryReader::ZIPEntryReaderDetail::open(detail::ZIPEntrySource&& source, const FilePathView path)
+	{
+		close();
+
+		m_compressed = source.compressed;
+		m_path = path;
+
+		if (source.data)
+		{
+			m_holder = std::move(source.holder);
+			m_data = source.data;
+			m_compressedSize = source.compressedSize;
+			m_size = source.size;
+			m_deflated = source.deflated;
+
+			if (m_deflated
+				&& (not resetStream()))
+			{
+				close();
+				return false;
+			}
+		}
+		else
+		{
+			m_blob = std::move(source.blob);
+			m_data = m_blob.data();
+			m_compressedSize = m_blob.size();
+			m_size = static_cast<int64>(m_blob.size());
+		}
+
+		m_isOpen = true;
+
+		return true;
+	}
+
+	void ZIPEntryReader::ZIPEntryReaderDetail::close()
+	{
+		if (m_streamInitialized)
+		{
+			::inflateEnd(&m_stream);
+			m_streamInitialized = false;
+		}
+
+		m_holder.reset();
+		m_blob = Blob{};
+		m_data = nullptr;
+		m_compressedSize = 0;
+		m_size = 0;
+		m_pos = 0;
+		m_path.clear();
+		m_consumedSize = 0;
+		m_inflatedSize = 0;
+		m_isOpen = false;
+		m_compressed = false;
+		m_deflated = false;
+	}
+
+	bool ZIPEntryReader::ZIPEntryReaderDetail::isOpen() const noexcept
+	{
+		return m_isOpen;
+	}
+
+	bool ZIPEntryReader::ZIPEntryReaderDetail::isCompressed() const noexcept
+	{
+		return m_compressed;
+	}
+
+	bool ZIPEntryReader::ZIPEntryReaderDetail::supportsLookahead() const noexcept
+	{
+		return (m_isOpen && (not m_deflated));
+	}
+
+	int64 ZIPEntryReader::ZIPEntryReaderDetail::size() const noexcept
+	{
+		return m_size;
+	}
+
+	int64 ZIPEntryReader::ZIPEntryReaderDetail::getPos() const noexcept
+	{
+		return m_pos;
+	}
+
+	bool ZIPEntryReader::ZIPEntryReaderDetail::setPos(const int64 pos) noexcept
+	{
+		if ((not m_isOpen) || (not InRange<int64>(pos, 0, m_size)))
+		{
+			return false;
+		}
+
+		// 圧縮されている場合は、次に読み込むときに展開する
+		m_pos = pos;
+
+		return true;
+	}
+
+	int64 ZIPEntryReader::ZIPEntryReaderDetail::skip(const int64 offset) noexcept
+	{
+		m_pos = Clamp<int64>((m_pos + offset), 0, m_size);
+
+		return m_pos;
+	}
+
+	int64 ZIPEntryReader::ZIPEntryReaderDetail::read(void* dst, int64 size)
+	{
+		if ((not m_isOpen) || (not dst) || (size <= 0) || (m_size <= m_pos))
+		{
+			return 0;
+		}
+
+		size = Min(size, (m_size - m_pos));
+
+		if (not m_deflated)
+		{
+			std::memcpy(dst, (m_data + m_pos), static_cast<size_t>(size));
+			m_pos += size;
+			return size;
+		}
+
+		if (m_pos < m_inflatedSize)
+		{
+			if (not resetStream())
+			{
+				return 0;
+			}
+		}
+
+		if (m_inflatedSize < m_pos)
+		{
+			const auto buffer = std::make_unique<Byte[]>(detail::InflateSkipBufferSize);
+
+			while (m_inflatedSize < m_pos)
+			{
+				const int64 toSkip = Min<int64>((m_pos - m_inflatedSize), detail::InflateSkipBufferSize);
+
+				if (inflate(buffer.get(), toSkip) != toSkip)
+				{
+					m_pos = m_inflatedSize;
+					return 0;
+				}
+			}
+		}
+
+		const int64 readSize = inflate(static_cast<Byte*>(dst), size);
+
+		m_pos += readSize;
+
+		return readSize;
+	}
+
+	int64 ZIPEntryReader::ZIPEntryReaderDetail::lookahead(void* dst, const int64 pos, int64 size) const
+	{
+		if ((not supportsLookahead()) || (not dst) || (pos < 0) || (m_size <= pos) || (size <= 0))
+		{
+			return 0;
+		}
+
+		size = Min(size, (m_size - pos));
+
+		std::memcpy(dst, (m_data + pos), static_cast<size_t>(size));
+
+		return size;
+	}
+
+	const FilePath& ZIPEntryReader::ZIPEntryReaderDetail::path() const noexcept
+	{
+		return m_path;
+	}
+
+	bool ZIPEntryReader::ZIPEntryReaderDetail::resetStream()
+	{
+		if (m_streamInitialized)
+		{
+			::inflateEnd(&m_stream);
+			m_streamInitialized = false;
+		}
+
+		m_stream = z_stream{};
+
+		// ZIP のエントリーはヘッダの無い raw deflate 形式
+		if (::inflateInit2(&m_stream, -MAX_WBITS) != Z_OK)
+		{
+			LOG_FAIL(U"ZIPEntryReader: inflateInit2() failed");
+			return false;
+		}
+
+		m_streamInitialized = true;
+		m_consumedSize = 0;
+		m_inflatedSize = 0;
+
+		return true;
+	}
+
+	int64 ZIPEntryReader::ZIPEntryReaderDetail::inflate(Byte* dst, const int64 size)
+	{
+		if (not m_streamInitialized)
+		{
+			return 0;
+		}
+
+		int64 produced = 0;
+
+		while (produced < size)
+		{
+			if ((m_stream.avail_in == 0) && (m_consumedSize < m_compressedSize))
+			{
+				const size_t chunkSize = static_cast<size_t>(Min<uint64>((m_compressedSize - m_consumedSize), detail::MaxInflateChunkSize));
+
+				m_stream.next_in = const_cast<Bytef*>(reinterpret_cast<const Bytef*>(m_data + m_consumedSize));
+				m_stream.avail_in = static_cast<uInt>(chunkSize);
+				m_consumedSize += chunkSize;
+			}
+
+			const size_t outputSize = static_cast<size_t>(Min<int64>((size - produced), detail::MaxInflateChunkSize));
+
+			m_stream.next_out = reinterpret_cast<Bytef*>(dst + produced);
+			m_stream.avail_out = static_cast<uInt>(outputSize);
+
+			const int result = ::inflate(&m_stream, Z_NO_FLUSH);
+			const size_t written = (outputSize - m_stream.avail_out);
+
+			produced += written;
+
+			if (result == Z_STREAM_END)
+			{
+				break;
+			}
+
+			if (result != Z_OK)
+			{
+				LOG_FAIL(U"ZIPEntryReader: Failed to inflate `{}`"_fmt(m_path));
+				break;
+			}
+		}
+
+		m_inflatedSize += produced;
+
+		return produced;
+	}
+}
@@ -0,0 +1,120 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/ZIPEntryReader.hpp>
+# include <Siv3D/Blob.hpp>
+# include <ThirdParty/zlib/zlib.h>
+
+namespace s3d
+{
+	namespace detail
+	{
+		// ZIPReader が ZIPEntryReader に渡す、エントリーのデータ
+		struct ZIPEntrySource
+		{
+			// data の寿命を保持するオブジェクト
+			std::shared_ptr<const void> holder;
+
+			// アーカイブファイル内の、エントリーのデータ（圧縮されたデータまたは無圧縮のデータ）
+			const Byte* data = nullptr;
+
+			uint64 compressedSize = 0;
+
+			int64 size = 0;
+
+			// data が deflate 方式で圧縮されているか
+			bool deflated = false;
+
+			// data が無い場合に使う、展開済みのデータ
+			Blob blob;
+
+			// アーカイブ内でファイルが圧縮されているか
+			bool compressed = false;
+		};
+	}
+
+	class ZIPEntryReader::ZIPEntryReaderDetail
+	{
+	public:
+
+		ZIPEntryReaderDetail();
+
+		~ZIPEntryReaderDetail();
+
+		bool open(detail::ZIPEntrySource&& source, FilePathView path);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		bool isCompressed() const noexcept;
+
+		[[nodiscard]]
+		bool supportsLookahead() const noexcept;
+
+		[[nodiscard]]
+		int64 size() const noexcept;
+
+		[[nodiscard]]
+		int64 getPos() const noexcept;
+
+		bool setPos(int64 pos) noexcept;
+
+		int64 skip(int64 offset) noexcept;
+
+		int64 read(void* dst, int64 size);
+
+		int64 lookahead(void* dst, int64 pos, int64 size) const;
+
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		std::shared_ptr<const void> m_holder;
+
+		Blob m_blob;
+
+		const Byte* m_data = nullptr;
+
+		uint64 m_compressedSize = 0;
+
+		int64 m_size = 0;
+
+		int64 m_pos = 0;
+
+		FilePath m_path;
+
+		z_stream m_stream{};
+
+		// 圧縮されたデータのうち、zlib に渡したサイズ
+		uint64 m_consumedSize = 0;
+
+		// zlib が出力したデータのサイズ。setPos() で m_pos が先に進んでいる場合がある
+		int64 m_inflatedSize = 0;
+
+		bool m_isOpen = false;
+
+		bool m_compressed = false;
+
+		bool m_deflated = false;
+
+		bool m_streamInitialized = false;
+
+		[[nodiscard]]
+		bool resetStream();
+
+		int64 inflate(Byte* dst, int64 size);
+	};
+}
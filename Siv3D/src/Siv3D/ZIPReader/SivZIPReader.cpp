@@ -75,4 +75,17 @@ namespace s3d
 	{
 		return pImpl->extractToBlob(filePath);
 	}
+
+	ZIPEntryReader ZIPReader::openEntry(const FilePathView filePath) const
+	{
+		ZIPEntryReader reader;
+
+		if (detail::ZIPEntrySource source;
+			pImpl->getEntrySource(filePath, source))
+		{
+			reader.pImpl->open(std::move(source), filePath);
+		}
+
+		return reader;
+	}
 }
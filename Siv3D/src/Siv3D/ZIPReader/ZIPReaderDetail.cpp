@@ -9,10 +9,14 @@
 //
 //-----------------------------------------------
 
+# include <atomic>
+# include <numeric>
 # include "ZIPReaderDetail.hpp"
 # include <Siv3D/FileSystem.hpp>
+# include <Siv3D/Threading.hpp>
 # include <Siv3D/EngineLog.hpp>
 # include <ThirdParty/minizip/mz.h>
+# include <ThirdParty/minizip/mz_os.h>
 # include <ThirdParty/minizip/mz_strm.h>
 # include <ThirdParty/minizip/mz_strm_mem.h>
 # include <ThirdParty/minizip/mz_zip.h>
@@ -68,6 +72,23 @@ namespace s3d
 
 			return MZ_OK;
 		}
+
+		inline constexpr uint32 ZIPLocalFileHeaderSignature = 0x04034b50;
+
+		inline constexpr size_t ZIPLocalFileHeaderSize = 30;
+
+		[[nodiscard]]
+		static uint32 LoadLE(const Byte* p, const size_t size) noexcept
+		{
+			uint32 value = 0;
+
+			for (size_t i = 0; i < size; ++i)
+			{
+				value |= (static_cast<uint32>(p[i]) << (i * 8));
+			}
+
+			return value;
+		}
 	}
 
 	ZIPReader::ZIPReaderDetail::ZIPReaderDetail()
@@ -144,7 +165,10 @@ namespace s3d
 					break;
 				}
 
+				m_entryIndices.emplace(Unicode::Widen(fileInfo->filename), m_paths.size());
 				m_paths << Unicode::Widen(fileInfo->filename);
+				m_entries << Entry{ fileInfo->disk_offset, fileInfo->compressed_size, fileInfo->uncompressed_size,
+					fileInfo->compression_method, static_cast<bool>(fileInfo->flag & MZ_ZIP_FLAG_ENCRYPTED) };
 
 				err = ::mz_zip_reader_goto_next_entry(m_reader);
 
@@ -163,6 +187,26 @@ namespace s3d
 
 		m_archiveFileFullPath = FileSystem::FullPath(path);
 
+	# if SIV3D_PLATFORM(WINDOWS)
+
+		if (m_resource.data())
+		{
+			m_archiveData = static_cast<const Byte*>(m_resource.data());
+			m_archiveSize = static_cast<size_t>(m_resource.size());
+			return true;
+		}
+
+	# endif
+
+		// 無圧縮のエントリーをコピーせずに読み込めるよう、アーカイブファイル全体をマップする
+		if (auto mappedFile = std::make_shared<MemoryMappedFileView>(path);
+			mappedFile->isOpen() && mappedFile->data())
+		{
+			m_archiveData = mappedFile->data();
+			m_archiveSize = mappedFile->mappedSize();
+			m_mappedFile = std::move(mappedFile);
+		}
+
 		return true;
 	}
 
@@ -175,6 +219,16 @@ namespace s3d
 
 		m_paths.clear();
 
+		m_entries.clear();
+
+		m_entryIndices.clear();
+
+		m_mappedFile.reset();
+
+		m_archiveData = nullptr;
+
+		m_archiveSize = 0;
+
 		m_archiveFileFullPath.clear();
 
 		::mz_zip_reader_delete(&m_reader); // 内部で m_reader = nullptr;
@@ -208,6 +262,12 @@ namespace s3d
 			return false;
 		}
 
+		if (const size_t workerCount = Min(Threading::GetConcurrency(), m_entries.size());
+			1 < workerCount)
+		{
+			return extractParallel(pattern, targetDirectory, workerCount);
+		}
+
 		int32 err = MZ_OK;
 
 		if (pattern)
@@ -290,4 +350,201 @@ namespace s3d
 
 		return Blob{ std::move(data) };
 	}
+
+	bool ZIPReader::ZIPReaderDetail::getEntrySource(const FilePathView filePath, detail::ZIPEntrySource& source) const
+	{
+		if (not isOpen())
+		{
+			return false;
+		}
+
+		const auto it = m_entryIndices.find(filePath);
+
+		if (it == m_entryIndices.end())
+		{
+			LOG_FAIL(U"ZIPReader::openEntry(): `{}` not found in archive"_fmt(filePath));
+			return false;
+		}
+
+		const Entry& entry = m_entries[it->second];
+		source = detail::ZIPEntrySource{};
+		source.compressed = (entry.compressionMethod != MZ_COMPRESS_METHOD_STORE);
+
+		if (m_archiveData
+			&& (not entry.encrypted)
+			&& ((entry.compressionMethod == MZ_COMPRESS_METHOD_STORE) || (entry.compressionMethod == MZ_COMPRESS_METHOD_DEFLATE))
+			&& (0 <= entry.diskOffset)
+			&& ((static_cast<uint64>(entry.diskOffset) + detail::ZIPLocalFileHeaderSize) <= m_archiveSize))
+		{
+			// ローカルファイルヘッダのファイル名と拡張フィールドの長さは、セントラルディレクトリと異なる場合がある
+			const Byte* header = (m_archiveData + entry.diskOffset);
+			const uint64 dataOffset = (entry.diskOffset + detail::ZIPLocalFileHeaderSize + detail::LoadLE(header + 26, 2) + detail::LoadLE(header + 28, 2));
+
+			if ((detail::LoadLE(header, 4) == detail::ZIPLocalFileHeaderSignature)
+				&& ((dataOffset + entry.compressedSize) <= m_archiveSize))
+			{
+				source.holder = m_mappedFile;
+				source.data = (m_archiveData + dataOffset);
+				source.compressedSize = static_cast<uint64>(entry.compressedSize);
+				source.size = entry.uncompressedSize;
+				source.deflated = source.compressed;
+				return true;
+			}
+		}
+
+		// 暗号化されたエントリーなどは、minizip で全体を展開する
+		source.blob = extractToBlob(filePath);
+
+		if (source.blob.size() != static_cast<size_t>(entry.uncompressedSize))
+		{
+			return false;
+		}
+
+		return true;
+	}
+
+	void* ZIPReader::ZIPReaderDetail::openReader() const
+	{
+		void* reader = nullptr;
+
+		::mz_zip_reader_create(&reader);
+
+		int32 err = MZ_OK;
+
+	# if SIV3D_PLATFORM(WINDOWS)
+
+		if (m_resource.data())
+		{
+			err = ::mz_zip_reader_open_buffer(reader,
+				const_cast<uint8*>(static_cast<const std::uint8_t*>(m_resource.data())),
+				static_cast<int32>(m_resource.size()), 0);
+		}
+		else
+		{
+			const std::string archivePathC = Unicode::Narrow(m_archiveFileFullPath);
+			err = ::mz_zip_reader_open_file(reader, archivePathC.c_str());
+		}
+
+	# else
+
+		const std::string archivePathC = Unicode::Narrow(m_archiveFileFullPath);
+		err = ::mz_zip_reader_open_file(reader, archivePathC.c_str());
+
+	# endif
+
+		if (err != MZ_OK)
+		{
+			::mz_zip_reader_delete(&reader);
+			return nullptr;
+		}
+
+		return reader;
+	}
+
+	bool ZIPReader::ZIPReaderDetail::extractParallel(const StringView pattern, const FilePathView targetDirectory, const size_t workerCount) const
+	{
+		// 展開後のサイズが均等になるよう、大きいエントリーから順に、担当するサイズが最も小さいワーカーに割り当てる
+		HashTable<int64, size_t> workerIndices;
+		{
+			Array<size_t> order(m_entries.size());
+			std::iota(order.begin(), order.end(), 0);
+			std::sort(order.begin(), order.end(), [this](const size_t a, const size_t b)
+				{ return (m_entries[a].uncompressedSize > m_entries[b].uncompressedSize); });
+
+			Array<int64> workloads(workerCount, 0);
+
+			for (const size_t i : order)
+			{
+				const size_t worker = static_cast<size_t>(std::min_element(workloads.begin(), workloads.end()) - workloads.begin());
+				workloads[worker] += (m_entries[i].uncompressedSize + 1);
+				workerIndices.emplace(m_entries[i].diskOffset, worker);
+			}
+		}
+
+		const std::string patternC = (pattern ? Unicode::Narrow(pattern) : std::string{ "*" });
+		const std::string targetDirectoryC = Unicode::Narrow(targetDirectory);
+		std::atomic<size_t> extractedCount = 0;
+		std::atomic<bool> failed = false;
+
+		Threading::ParallelFor(workerCount, [&](const size_t worker)
+		{
+			void* reader = openReader();
+
+			if (not reader)
+			{
+				failed = true;
+				return;
+			}
+
+			detail::ZipOption option;
+			::mz_zip_reader_set_entry_cb(reader, &option, detail::ExtractEntryCallback);
+			::mz_zip_reader_set_overwrite_cb(reader, &option, detail::ExtractOverwriteCallback);
+			::mz_zip_reader_set_pattern(reader, patternC.c_str(), 1);
+
+			int32 err = ::mz_zip_reader_goto_first_entry(reader);
+
+			while ((err == MZ_OK) && (not failed))
+			{
+				mz_zip_file* fileInfo = nullptr;
+
+				if ((err = ::mz_zip_reader_entry_get_info(reader, &fileInfo)) != MZ_OK)
+				{
+					break;
+				}
+
+				if (const auto it = workerIndices.find(fileInfo->disk_offset);
+					(it != workerIndices.end()) && (it->second == worker))
+				{
+					// mz_zip_reader_save_all() と同じ方法で出力先のパスを作る
+					char resolvedName[256];
+					char path[512] = {};
+
+					if ((err = ::mz_path_resolve(fileInfo->filename, resolvedName, sizeof(resolvedName))) != MZ_OK)
+					{
+						break;
+					}
+
+					::mz_path_combine(path, targetDirectoryC.c_str(), sizeof(path));
+					::mz_path_combine(path, resolvedName, sizeof(path));
+
+					if ((err = ::mz_zip_reader_entry_save_file(reader, path)) != MZ_OK)
+					{
+						break;
+					}
+
+					++extractedCount;
+				}
+
+				err = ::mz_zip_reader_goto_next_entry(reader);
+			}
+
+			if ((err != MZ_END_OF_LIST) && (not failed))
+			{
+				failed = true;
+			}
+
+			::mz_zip_reader_delete(&reader);
+		}, 1);
+
+		if (failed)
+		{
+			LOG_FAIL(U"ZIPReader::extract(): Failed to save entries");
+			return false;
+		}
+
+		if (extractedCount == 0)
+		{
+			if (pattern)
+			{
+				LOG_FAIL(U"ZIPReader::extract(): Files matching `{}` not found in archive"_fmt(pattern));
+				return false;
+			}
+			else
+			{
+				LOG_TRACE(U"ZIPReader::extract(): No files in archive");
+			}
+		}
+
+		return true;
+	}
 }
@@ -12,6 +12,9 @@
 # pragma once
 # include <Siv3D/ZIPReader.hpp>
 # include <Siv3D/Unicode.hpp>
+# include <Siv3D/HashTable.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include <Siv3D/ZIPEntryReader/ZIPEntryReaderDetail.hpp>
 
 # if SIV3D_PLATFORM(WINDOWS)
 
@@ -97,14 +100,50 @@ namespace s3d
 		[[nodiscard]]
 		Blob extractToBlob(FilePathView filePath) const;
 
+		[[nodiscard]]
+		bool getEntrySource(FilePathView filePath, detail::ZIPEntrySource& source) const;
+
 	private:
 
+		struct Entry
+		{
+			// ローカルファイルヘッダの位置
+			int64 diskOffset;
+
+			int64 compressedSize;
+
+			int64 uncompressedSize;
+
+			uint16 compressionMethod;
+
+			bool encrypted;
+		};
+
 		void* m_reader = nullptr;
 
 		FilePath m_archiveFileFullPath;
 
 		Array<FilePath> m_paths;
 
+		Array<Entry> m_entries;
+
+		HashTable<FilePath, size_t> m_entryIndices;
+
+		// エントリーをコピーせずに読み込むためのメモリマップ
+		std::shared_ptr<MemoryMappedFileView> m_mappedFile;
+
+		const Byte* m_archiveData = nullptr;
+
+		size_t m_archiveSize = 0;
+
+		// 同じアーカイブを、新しい minizip のリーダーで開く
+		[[nodiscard]]
+		void* openReader() const;
+
+		// ワーカーごとに minizip のリーダーを作成して、並列に展開する
+		[[nodiscard]]
+		bool extractParallel(StringView pattern, FilePathView targetDirectory, size_t workerCount) const;
+
 	# if SIV3D_PLATFORM(WINDOWS)
 
 		ZIPResourceHolder m_resource;
@@ -0,0 +1,111 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ZstdReader.hpp>
+# include <Siv3D/ZstdReader/ZstdReaderDetail.hpp>
+
+namespace s3d
+{
+	ZstdReader::ZstdReader()
+		: pImpl{ std::make_shared<ZstdReaderDetail>() } {}
+
+	ZstdReader::ZstdReader(const FilePathView path)
+		: ZstdReader{}
+	{
+		open(path);
+	}
+
+	ZstdReader::ZstdReader(std::unique_ptr<IReader>&& reader)
+		: ZstdReader{}
+	{
+		open(std::move(reader));
+	}
+
+	bool ZstdReader::open(const FilePathView path)
+	{
+		return pImpl->open(path);
+	}
+
+	bool ZstdReader::open(std::unique_ptr<IReader>&& reader)
+	{
+		return pImpl->open(std::move(reader));
+	}
+
+	bool ZstdReader::setDictionary(const CompressionDictionary& dictionary)
+	{
+		return pImpl->setDictionary(dictionary);
+	}
+
+	void ZstdReader::close()
+	{
+		pImpl->close();
+	}
+
+	bool ZstdReader::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	ZstdReader::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	int64 ZstdReader::size() const
+	{
+		return pImpl->size();
+	}
+
+	int64 ZstdReader::getPos() const
+	{
+		return pImpl->getPos();
+	}
+
+	bool ZstdReader::setPos(const int64 pos)
+	{
+		return pImpl->setPos(pos);
+	}
+
+	int64 ZstdReader::skip(const int64 offset)
+	{
+		return pImpl->skip(offset);
+	}
+
+	int64 ZstdReader::read(void* dst, const int64 size)
+	{
+		return pImpl->read(dst, size);
+	}
+
+	int64 ZstdReader::read(void* dst, const int64 pos, const int64 size)
+	{
+		if (not pImpl->setPos(pos))
+		{
+			return 0;
+		}
+
+		return pImpl->read(dst, size);
+	}
+
+	int64 ZstdReader::lookahead(void*, int64) const
+	{
+		return 0;
+	}
+
+	int64 ZstdReader::lookahead(void*, int64, int64) const
+	{
+		return 0;
+	}
+
+	const FilePath& ZstdReader::path() const noexcept
+	{
+		return pImpl->path();
+	}
+}
@@ -0,0 +1,384 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/BinaryReader.hpp>
+# include <Siv3D/CompressionDictionary/CompressionDictionaryDetail.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "ZstdReaderDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		// skip() で読み飛ばす際に使うバッファのサイズ
+		inline constexpr size_t ZstdSkipBufferSize = (64 * 1024);
+
+		// フレームヘッダの最大サイズ（ZSTD_FRAMEHEADERSIZE_MAX）
+		inline constexpr int64 ZstdFrameHeaderSizeMax = 18;
+
+		[[nodiscard]]
+		inline constexpr uint32 LoadLE32(const uint8* p) noexcept
+		{
+			return (static_cast<uint32>(p[0]) | (static_cast<uint32>(p[1]) << 8) | (static_cast<uint32>(p[2]) << 16) | (static_cast<uint32>(p[3]) << 24));
+		}
+
+		// pos から末尾までのすべてのフレームについて、ヘッダに記録されている展開後のサイズの合計を返す。
+		// フレーム全体を読み込まずに済むよう、ヘッダとブロックヘッダだけをたどる（RFC 8878）。
+		// 展開後のサイズが記録されていないフレームがある場合や、データが壊れている場合は 0 を返す
+		[[nodiscard]]
+		static int64 FindTotalContentSize(const IReader& reader, int64 pos)
+		{
+			const int64 end = reader.size();
+
+			if (end <= pos)
+			{
+				return 0;
+			}
+
+			int64 totalContentSize = 0;
+
+			while (pos < end)
+			{
+				uint8 header[ZstdFrameHeaderSizeMax];
+				const int64 headerAvailable = reader.lookahead(header, pos, Min(ZstdFrameHeaderSizeMax, (end - pos)));
+
+				if (headerAvailable < 8)
+				{
+					return 0;
+				}
+
+				const uint32 magic = LoadLE32(header);
+
+				// スキップ可能なフレーム（ZstdSeekableWriter のシークテーブルなど）は展開後のデータを持たない
+				if ((magic & ZSTD_MAGIC_SKIPPABLE_MASK) == ZSTD_MAGIC_SKIPPABLE_START)
+				{
+					pos += (8 + static_cast<int64>(LoadLE32(header + 4)));
+					continue;
+				}
+
+				if (magic != ZSTD_MAGICNUMBER)
+				{
+					return 0;
+				}
+
+				const unsigned long long contentSize = ZSTD_getFrameContentSize(header, static_cast<size_t>(headerAvailable));
+
+				if ((contentSize == ZSTD_CONTENTSIZE_UNKNOWN) || (contentSize == ZSTD_CONTENTSIZE_ERROR))
+				{
+					return 0;
+				}
+
+				totalContentSize += static_cast<int64>(contentSize);
+
+				// Frame_Header_Descriptor からヘッダのサイズを求める
+				const uint8 descriptor = header[4];
+				const uint32 fcsFlag = (descriptor >> 6);
+				const bool singleSegment = ((descriptor >> 5) & 1);
+				const bool hasChecksum = ((descriptor >> 2) & 1);
+				constexpr int64 DictIDSizes[4] = { 0, 1, 2, 4 };
+				constexpr int64 FCSSizes[4] = { 0, 2, 4, 8 };
+				const int64 fcsSize = (((fcsFlag == 0) && singleSegment) ? 1 : FCSSizes[fcsFlag]);
+
+				pos += (5 + (singleSegment ? 0 : 1) + DictIDSizes[descriptor & 3] + fcsSize);
+
+				for (;;)
+				{
+					uint8 blockHeader[4] = {};
+
+					if (reader.lookahead(blockHeader, pos, 3) != 3)
+					{
+						return 0;
+					}
+
+					const uint32 value = LoadLE32(blockHeader);
+					const bool lastBlock = (value & 1);
+					const uint32 blockType = ((value >> 1) & 3);
+					const uint32 blockSize = (value >> 3);
+
+					// Reserved
+					if (blockType == 3)
+					{
+						return 0;
+					}
+
+					// RLE ブロックは 1 バイトだけを持つ
+					pos += (3 + ((blockType == 1) ? 1 : blockSize));
+
+					if (lastBlock)
+					{
+						break;
+					}
+				}
+
+				if (hasChecksum)
+				{
+					pos += 4;
+				}
+			}
+
+			return ((pos == end) ? totalContentSize : 0);
+		}
+	}
+
+	ZstdReader::ZstdReaderDetail::ZstdReaderDetail()
+	{
+		// do nothing
+	}
+
+	ZstdReader::ZstdReaderDetail::~ZstdReaderDetail()
+	{
+		close();
+	}
+
+	bool ZstdReader::ZstdReaderDetail::open(const FilePathView path)
+	{
+		close();
+
+		auto reader = std::make_unique<BinaryReader>(path);
+
+		if (not reader->isOpen())
+		{
+			return false;
+		}
+
+		const FilePath fullPath = reader->path();
+
+		if (not open(std::move(reader)))
+		{
+			return false;
+		}
+
+		m_fullPath = fullPath;
+
+		return true;
+	}
+
+	bool ZstdReader::ZstdReaderDetail::open(std::unique_ptr<IReader>&& reader)
+	{
+		close();
+
+		if ((not reader)
+			|| (not reader->isOpen()))
+		{
+			return false;
+		}
+
+		m_dctx = ZSTD_createDCtx();
+
+		if (not m_dctx)
+		{
+			return false;
+		}
+
+		m_inputBufferSize = ZSTD_DStreamInSize();
+		m_inputBuffer = std::make_unique<Byte[]>(m_inputBufferSize);
+		m_sourceStart = reader->getPos();
+		m_reader = std::move(reader);
+
+		// 複数のフレームが連結されている場合もあるので、すべてのフレームのヘッダを調べる
+		m_contentSize = detail::FindTotalContentSize(*m_reader, m_sourceStart);
+
+		fillInput();
+
+		return true;
+	}
+
+	bool ZstdReader::ZstdReaderDetail::setDictionary(const CompressionDictionary& dictionary)
+	{
+		if ((not m_dctx) || m_started)
+		{
+			return false;
+		}
+
+		const ZSTD_DDict* const dDict = dictionary._detail().getDDict();
+
+		if (not dDict)
+		{
+			return false;
+		}
+
+		if (ZSTD_isError(ZSTD_DCtx_refDDict(m_dctx, dDict)))
+		{
+			return false;
+		}
+
+		m_dictionary = dictionary;
+
+		return true;
+	}
+
+	void ZstdReader::ZstdReaderDetail::close()
+	{
+		release();
+	}
+
+	bool ZstdReader::ZstdReaderDetail::isOpen() const noexcept
+	{
+		return static_cast<bool>(m_reader);
+	}
+
+	int64 ZstdReader::ZstdReaderDetail::size() const noexcept
+	{
+		return m_contentSize;
+	}
+
+	int64 ZstdReader::ZstdReaderDetail::getPos() const noexcept
+	{
+		return m_pos;
+	}
+
+	bool ZstdReader::ZstdReaderDetail::setPos(const int64 pos)
+	{
+		if ((not m_reader) || (pos < 0))
+		{
+			return false;
+		}
+
+		if (pos < m_pos)
+		{
+			if (not rewind())
+			{
+				return false;
+			}
+		}
+
+		return (skip(pos - m_pos) == pos);
+	}
+
+	int64 ZstdReader::ZstdReaderDetail::skip(int64 offset)
+	{
+		if (not m_reader)
+		{
+			return 0;
+		}
+
+		const auto buffer = std::make_unique<Byte[]>(detail::ZstdSkipBufferSize);
+
+		while (0 < offset)
+		{
+			const int64 toRead = Min(offset, static_cast<int64>(detail::ZstdSkipBufferSize));
+			const int64 readSize = read(buffer.get(), toRead);
+
+			offset -= readSize;
+
+			if (readSize != toRead)
+			{
+				break;
+			}
+		}
+
+		return m_pos;
+	}
+
+	int64 ZstdReader::ZstdReaderDetail::read(void* dst, const int64 size)
+	{
+		if ((not m_reader) || (size <= 0))
+		{
+			return 0;
+		}
+
+		m_started = true;
+
+		ZSTD_outBuffer output = { dst, static_cast<size_t>(size), 0 };
+
+		while (output.pos < output.size)
+		{
+			if (m_input.pos == m_input.size)
+			{
+				fillInput();
+			}
+
+			const size_t outputPos = output.pos;
+			const size_t inputPos = m_input.pos;
+
+			// 入力が無くても、内部に残っている展開済みのデータを出力するために呼ぶ
+			const size_t result = ZSTD_decompressStream(m_dctx, &output, &m_input);
+
+			if (ZSTD_isError(result))
+			{
+				LOG_FAIL(U"ZstdReader: ZSTD_decompressStream() failed");
+				m_input = { nullptr, 0, 0 };
+				m_sourceEnded = true;
+				break;
+			}
+
+			if ((output.pos == outputPos) && (m_input.pos == inputPos) && m_sourceEnded)
+			{
+				break;
+			}
+		}
+
+		m_pos += output.pos;
+
+		return static_cast<int64>(output.pos);
+	}
+
+	const FilePath& ZstdReader::ZstdReaderDetail::path() const noexcept
+	{
+		return m_fullPath;
+	}
+
+	void ZstdReader::ZstdReaderDetail::release()
+	{
+		ZSTD_freeDCtx(m_dctx);
+		m_dctx = nullptr;
+
+		m_reader.reset();
+		m_fullPath.clear();
+		m_inputBuffer.reset();
+		m_inputBufferSize = 0;
+		m_input = { nullptr, 0, 0 };
+		m_dictionary = CompressionDictionary{};
+		m_sourceStart = 0;
+		m_contentSize = 0;
+		m_pos = 0;
+		m_sourceEnded = false;
+		m_started = false;
+	}
+
+	bool ZstdReader::ZstdReaderDetail::fillInput()
+	{
+		if (m_sourceEnded)
+		{
+			return false;
+		}
+
+		const int64 readSize = m_reader->read(m_inputBuffer.get(), static_cast<int64>(m_inputBufferSize));
+
+		if (readSize <= 0)
+		{
+			m_sourceEnded = true;
+			m_input = { nullptr, 0, 0 };
+			return false;
+		}
+
+		m_input = { m_inputBuffer.get(), static_cast<size_t>(readSize), 0 };
+
+		return true;
+	}
+
+	bool ZstdReader::ZstdReaderDetail::rewind()
+	{
+		if (not m_reader->setPos(m_sourceStart))
+		{
+			return false;
+		}
+
+		// 辞書の設定は維持する
+		ZSTD_DCtx_reset(m_dctx, ZSTD_reset_session_only);
+
+		m_input = { nullptr, 0, 0 };
+		m_pos = 0;
+		m_sourceEnded = false;
+
+		return true;
+	}
+}
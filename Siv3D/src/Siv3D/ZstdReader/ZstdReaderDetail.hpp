@@ -0,0 +1,97 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/ZstdReader.hpp>
+# include <Siv3D/CompressionDictionary.hpp>
+# include <Siv3D/String.hpp>
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class ZstdReader::ZstdReaderDetail
+	{
+	public:
+
+		ZstdReaderDetail();
+
+		~ZstdReaderDetail();
+
+		[[nodiscard]]
+		bool open(FilePathView path);
+
+		[[nodiscard]]
+		bool open(std::unique_ptr<IReader>&& reader);
+
+		[[nodiscard]]
+		bool setDictionary(const CompressionDictionary& dictionary);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		int64 size() const noexcept;
+
+		[[nodiscard]]
+		int64 getPos() const noexcept;
+
+		bool setPos(int64 pos);
+
+		int64 skip(int64 offset);
+
+		int64 read(void* dst, int64 size);
+
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		std::unique_ptr<IReader> m_reader;
+
+		FilePath m_fullPath;
+
+		ZSTD_DCtx* m_dctx = nullptr;
+
+		// 読み込み元から読み込んだ、まだ展開していないデータは m_input.src の m_input.pos 以降
+		std::unique_ptr<Byte[]> m_inputBuffer;
+
+		size_t m_inputBufferSize = 0;
+
+		ZSTD_inBuffer m_input = { nullptr, 0, 0 };
+
+		// DDict は m_dctx から参照されるため、展開が終わるまで保持する
+		CompressionDictionary m_dictionary;
+
+		// 読み込み元の、圧縮されたデータの開始位置
+		int64 m_sourceStart = 0;
+
+		// すべてのフレームのヘッダに記録されている展開後のサイズの合計。不明な場合は 0
+		int64 m_contentSize = 0;
+
+		int64 m_pos = 0;
+
+		bool m_sourceEnded = false;
+
+		// 一度でも展開を行ったか
+		bool m_started = false;
+
+		void release();
+
+		// 読み込み元からデータを読み込む。読み込めなかった場合は false
+		bool fillInput();
+
+		// 読み込み元の先頭に戻り、展開をやり直す
+		[[nodiscard]]
+		bool rewind();
+	};
+}
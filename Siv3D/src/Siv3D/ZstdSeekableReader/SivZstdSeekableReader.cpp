@@ -0,0 +1,122 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ZstdSeekableReader.hpp>
+# include <Siv3D/ZstdSeekableReader/ZstdSeekableReaderDetail.hpp>
+
+namespace s3d
+{
+	ZstdSeekableReader::ZstdSeekableReader()
+		: pImpl{ std::make_shared<ZstdSeekableReaderDetail>() } {}
+
+	ZstdSeekableReader::ZstdSeekableReader(const FilePathView path, const size_t cacheFrameCount)
+		: ZstdSeekableReader{}
+	{
+		open(path, cacheFrameCount);
+	}
+
+	ZstdSeekableReader::ZstdSeekableReader(Blob&& blob, const size_t cacheFrameCount)
+		: ZstdSeekableReader{}
+	{
+		open(std::move(blob), cacheFrameCount);
+	}
+
+	ZstdSeekableReader::ZstdSeekableReader(std::unique_ptr<IReader>&& reader, const size_t cacheFrameCount)
+		: ZstdSeekableReader{}
+	{
+		open(std::move(reader), cacheFrameCount);
+	}
+
+	bool ZstdSeekableReader::open(const FilePathView path, const size_t cacheFrameCount)
+	{
+		return pImpl->open(path, cacheFrameCount);
+	}
+
+	bool ZstdSeekableReader::open(Blob&& blob, const size_t cacheFrameCount)
+	{
+		return pImpl->open(std::move(blob), cacheFrameCount);
+	}
+
+	bool ZstdSeekableReader::open(std::unique_ptr<IReader>&& reader, const size_t cacheFrameCount)
+	{
+		return pImpl->open(std::move(reader), cacheFrameCount);
+	}
+
+	void ZstdSeekableReader::close()
+	{
+		pImpl->close();
+	}
+
+	bool ZstdSeekableReader::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	ZstdSeekableReader::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	int64 ZstdSeekableReader::size() const
+	{
+		return pImpl->size();
+	}
+
+	int64 ZstdSeekableReader::getPos() const
+	{
+		return pImpl->getPos();
+	}
+
+	bool ZstdSeekableReader::setPos(const int64 pos)
+	{
+		return pImpl->setPos(pos);
+	}
+
+	int64 ZstdSeekableReader::skip(const int64 offset)
+	{
+		return pImpl->skip(offset);
+	}
+
+	int64 ZstdSeekableReader::read(void* dst, const int64 size)
+	{
+		return pImpl->read(dst, size);
+	}
+
+	int64 ZstdSeekableReader::read(void* dst, const int64 pos, const int64 size)
+	{
+		return pImpl->read(dst, pos, size);
+	}
+
+	int64 ZstdSeekableReader::lookahead(void* dst, const int64 size) const
+	{
+		return pImpl->lookahead(dst, pImpl->getPos(), size);
+	}
+
+	int64 ZstdSeekableReader::lookahead(void* dst, const int64 pos, const int64 size) const
+	{
+		return pImpl->lookahead(dst, pos, size);
+	}
+
+	size_t ZstdSeekableReader::frameCount() const noexcept
+	{
+		return pImpl->frameCount();
+	}
+
+	void ZstdSeekableReader::setCacheFrameCount(const size_t cacheFrameCount)
+	{
+		pImpl->setCacheFrameCount(cacheFrameCount);
+	}
+
+	const FilePath& ZstdSeekableReader::path() const noexcept
+	{
+		return pImpl->path();
+	}
+}
@@ -0,0 +1,532 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/Compression/ZstdSeekableFormat.hpp>
+# include "ZstdSeekableReaderDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		inline constexpr size_t InvalidZstdFrameIndex = static_cast<size_t>(-1);
+
+		[[nodiscard]]
+		static uint32 LoadUint32(const Byte* p) noexcept
+		{
+			uint32 value;
+			std::memcpy(&value, p, sizeof(uint32));
+			return value;
+		}
+	}
+
+	ZstdSeekableReader::ZstdSeekableReaderDetail::ZstdSeekableReaderDetail()
+	{
+		// do nothing
+	}
+
+	ZstdSeekableReader::ZstdSeekableReaderDetail::~ZstdSeekableReaderDetail()
+	{
+		close();
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::open(const FilePathView path, const size_t cacheFrameCount)
+	{
+		close();
+
+		if (not m_file.open(path, MapAll::Yes))
+		{
+			return false;
+		}
+
+		if ((m_file.fileSize() == 0)
+			|| (not m_file.data()))
+		{
+			close();
+			return false;
+		}
+
+		m_data = m_file.data();
+		m_sourceSize = m_file.mappedSize();
+
+		if (not initialize(cacheFrameCount))
+		{
+			close();
+			return false;
+		}
+
+		m_fullPath = m_file.path();
+
+		return true;
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::open(Blob&& blob, const size_t cacheFrameCount)
+	{
+		close();
+
+		m_blob = std::move(blob);
+		m_data = m_blob.data();
+		m_sourceSize = m_blob.size();
+
+		if (not initialize(cacheFrameCount))
+		{
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::open(std::unique_ptr<IReader>&& reader, const size_t cacheFrameCount)
+	{
+		close();
+
+		if ((not reader)
+			|| (not reader->isOpen()))
+		{
+			return false;
+		}
+
+		m_sourceStart = reader->getPos();
+		m_sourceSize = static_cast<uint64>(Max<int64>((reader->size() - m_sourceStart), 0));
+		m_reader = std::move(reader);
+
+		if (not initialize(cacheFrameCount))
+		{
+			close();
+			return false;
+		}
+
+		return true;
+	}
+
+	void ZstdSeekableReader::ZstdSeekableReaderDetail::close()
+	{
+		ZSTD_freeDCtx(m_dctx);
+		m_dctx = nullptr;
+
+		m_file.close();
+		m_blob = Blob{};
+		m_data = nullptr;
+		m_reader.reset();
+		m_sourceStart = 0;
+		m_compressedBuffer = Array<Byte>{};
+		m_sourceSize = 0;
+		m_fullPath.clear();
+		m_frames = Array<Frame>{};
+		m_size = 0;
+		m_pos = 0;
+		m_cache = Array<CachedFrame>{};
+		m_tick = 0;
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::isOpen() const noexcept
+	{
+		return (m_dctx != nullptr);
+	}
+
+	int64 ZstdSeekableReader::ZstdSeekableReaderDetail::size() const noexcept
+	{
+		return m_size;
+	}
+
+	int64 ZstdSeekableReader::ZstdSeekableReaderDetail::getPos() const noexcept
+	{
+		return m_pos;
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::setPos(const int64 pos) noexcept
+	{
+		if ((not m_dctx) || (not InRange<int64>(pos, 0, m_size)))
+		{
+			return false;
+		}
+
+		m_pos = pos;
+
+		return true;
+	}
+
+	int64 ZstdSeekableReader::ZstdSeekableReaderDetail::skip(const int64 offset) noexcept
+	{
+		m_pos = Clamp<int64>((m_pos + offset), 0, m_size);
+
+		return m_pos;
+	}
+
+	int64 ZstdSeekableReader::ZstdSeekableReaderDetail::read(void* dst, const int64 size)
+	{
+		const int64 readSize = lookahead(dst, m_pos, size);
+
+		m_pos += readSize;
+
+		return readSize;
+	}
+
+	int64 ZstdSeekableReader::ZstdSeekableReaderDetail::read(void* dst, const int64 pos, const int64 size)
+	{
+		const int64 readSize = lookahead(dst, pos, size);
+
+		if (InRange<int64>(pos, 0, m_size))
+		{
+			m_pos = (pos + readSize);
+		}
+
+		return readSize;
+	}
+
+	int64 ZstdSeekableReader::ZstdSeekableReaderDetail::lookahead(void* dst, const int64 pos, int64 size)
+	{
+		if ((not m_dctx) || (not dst) || (pos < 0) || (m_size <= pos) || (size <= 0))
+		{
+			return 0;
+		}
+
+		size = Min(size, (m_size - pos));
+
+		Byte* pDst = static_cast<Byte*>(dst);
+		const int64 end = (pos + size);
+		int64 current = pos;
+
+		for (size_t frameIndex = findFrame(pos); ((current < end) && (frameIndex < m_frames.size())); ++frameIndex)
+		{
+			const Frame& frame = m_frames[frameIndex];
+			const size_t offsetInFrame = static_cast<size_t>(current - frame.decompressedOffset);
+			const size_t copySize = static_cast<size_t>(Min(static_cast<int64>(frame.decompressedSize - offsetInFrame), (end - current)));
+
+			if ((offsetInFrame == 0)
+				&& (copySize == frame.decompressedSize)
+				&& (not findCache(frameIndex)))
+			{
+				// フレーム全体を読み込む場合は、キャッシュを経由せずに読み込み先に直接展開する
+				if (not decompressFrame(frameIndex, pDst))
+				{
+					break;
+				}
+			}
+			else
+			{
+				const Byte* data = getFrame(frameIndex);
+
+				if (not data)
+				{
+					break;
+				}
+
+				std::memcpy(pDst, (data + offsetInFrame), copySize);
+			}
+
+			pDst += copySize;
+			current += copySize;
+		}
+
+		return (current - pos);
+	}
+
+	size_t ZstdSeekableReader::ZstdSeekableReaderDetail::frameCount() const noexcept
+	{
+		return m_frames.size();
+	}
+
+	void ZstdSeekableReader::ZstdSeekableReaderDetail::setCacheFrameCount(const size_t cacheFrameCount)
+	{
+		m_cacheFrameCount = Max<size_t>(cacheFrameCount, 1);
+
+		if (m_cacheFrameCount < m_cache.size())
+		{
+			// 最近使われたものを残す
+			std::sort(m_cache.begin(), m_cache.end(), [](const CachedFrame& a, const CachedFrame& b) { return (a.lastUsed > b.lastUsed); });
+
+			m_cache.resize(m_cacheFrameCount);
+		}
+	}
+
+	const FilePath& ZstdSeekableReader::ZstdSeekableReaderDetail::path() const noexcept
+	{
+		return m_fullPath;
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::initialize(const size_t cacheFrameCount)
+	{
+		m_dctx = ZSTD_createDCtx();
+
+		if (not m_dctx)
+		{
+			return false;
+		}
+
+		if (not loadSeekTable())
+		{
+			// IReader から読み込む場合、フレームの走査には全体の読み込みが必要になるため対応しない
+			if (m_reader)
+			{
+				LOG_FAIL(U"ZstdSeekableReader: The seek table was not found");
+				return false;
+			}
+
+			if (not scanFrames())
+			{
+				return false;
+			}
+		}
+
+		setCacheFrameCount(cacheFrameCount);
+
+		return true;
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::readSource(const uint64 offset, void* dst, const size_t size)
+	{
+		if ((m_sourceSize < size)
+			|| ((m_sourceSize - size) < offset))
+		{
+			return false;
+		}
+
+		if (size == 0)
+		{
+			return true;
+		}
+
+		if (m_data)
+		{
+			std::memcpy(dst, (m_data + offset), size);
+			return true;
+		}
+
+		return (m_reader->read(dst, (m_sourceStart + static_cast<int64>(offset)), static_cast<int64>(size)) == static_cast<int64>(size));
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::loadSeekTable()
+	{
+		if (m_sourceSize < (detail::ZstdSkippableHeaderSize + detail::ZstdSeekTableFooterSize))
+		{
+			return false;
+		}
+
+		Byte footer[detail::ZstdSeekTableFooterSize];
+
+		if ((not readSource((m_sourceSize - detail::ZstdSeekTableFooterSize), footer, sizeof(footer)))
+			|| (detail::LoadUint32(footer + 5) != detail::ZstdSeekableMagic))
+		{
+			return false;
+		}
+
+		const uint32 numFrames = detail::LoadUint32(footer);
+		const uint8 descriptor = static_cast<uint8>(footer[4]);
+
+		if (descriptor & detail::ZstdSeekTableReservedBits)
+		{
+			return false;
+		}
+
+		const size_t entrySize = ((descriptor & detail::ZstdSeekTableChecksumFlag) ? 12 : 8);
+		const uint64 tableSize = ((static_cast<uint64>(numFrames) * entrySize) + detail::ZstdSeekTableFooterSize);
+
+		if (m_sourceSize < (tableSize + detail::ZstdSkippableHeaderSize))
+		{
+			return false;
+		}
+
+		const uint64 framesSize = (m_sourceSize - tableSize - detail::ZstdSkippableHeaderSize);
+
+		Byte header[detail::ZstdSkippableHeaderSize];
+
+		if ((not readSource(framesSize, header, sizeof(header)))
+			|| (detail::LoadUint32(header) != detail::ZstdSkippableMagic)
+			|| (detail::LoadUint32(header + 4) != tableSize))
+		{
+			return false;
+		}
+
+		Array<Byte> entries(static_cast<size_t>(numFrames * entrySize));
+
+		if (not readSource((framesSize + detail::ZstdSkippableHeaderSize), entries.data(), entries.size()))
+		{
+			return false;
+		}
+
+		Array<Frame> frames(Arg::reserve = numFrames);
+		uint64 compressedOffset = 0;
+		int64 decompressedOffset = 0;
+
+		for (size_t i = 0; i < numFrames; ++i)
+		{
+			const Byte* entry = (entries.data() + (i * entrySize));
+			const uint32 compressedSize = detail::LoadUint32(entry);
+			const uint32 decompressedSize = detail::LoadUint32(entry + 4);
+
+			frames.push_back({ compressedOffset, decompressedOffset, compressedSize, decompressedSize });
+
+			compressedOffset += compressedSize;
+			decompressedOffset += decompressedSize;
+		}
+
+		// フレームはシークテーブルの直前まで隙間なく並んでいる
+		if (compressedOffset != framesSize)
+		{
+			LOG_FAIL(U"ZstdSeekableReader: The seek table does not match the data");
+			return false;
+		}
+
+		m_frames = std::move(frames);
+		m_size = decompressedOffset;
+
+		return true;
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::scanFrames()
+	{
+		Array<Frame> frames;
+		uint64 offset = 0;
+		int64 decompressedOffset = 0;
+
+		while (offset < m_sourceSize)
+		{
+			const Byte* frame = (m_data + offset);
+			const size_t remaining = static_cast<size_t>(m_sourceSize - offset);
+			const size_t compressedSize = ZSTD_findFrameCompressedSize(frame, remaining);
+
+			if (ZSTD_isError(compressedSize))
+			{
+				LOG_FAIL(U"ZstdSeekableReader: Invalid zstd frame");
+				return false;
+			}
+
+			// スキップ可能フレームは 0 を返す
+			const unsigned long long decompressedSize = ZSTD_getFrameContentSize(frame, remaining);
+
+			if (decompressedSize == ZSTD_CONTENTSIZE_ERROR)
+			{
+				LOG_FAIL(U"ZstdSeekableReader: Invalid zstd frame");
+				return false;
+			}
+			else if (decompressedSize == ZSTD_CONTENTSIZE_UNKNOWN)
+			{
+				LOG_FAIL(U"ZstdSeekableReader: The decompressed size of a frame is unknown. Use ZstdSeekableWriter to create seekable data");
+				return false;
+			}
+
+			if (decompressedSize)
+			{
+				frames.push_back({ offset, decompressedOffset, compressedSize, static_cast<size_t>(decompressedSize) });
+				decompressedOffset += static_cast<int64>(decompressedSize);
+			}
+
+			offset += compressedSize;
+		}
+
+		m_frames = std::move(frames);
+		m_size = decompressedOffset;
+
+		return true;
+	}
+
+	size_t ZstdSeekableReader::ZstdSeekableReaderDetail::findFrame(const int64 pos) const noexcept
+	{
+		// pos 以下の位置から始まる最後のフレーム
+		const auto it = std::upper_bound(m_frames.begin(), m_frames.end(), pos,
+			[](const int64 value, const Frame& frame) { return (value < frame.decompressedOffset); });
+
+		if (it == m_frames.begin())
+		{
+			return 0;
+		}
+
+		return static_cast<size_t>((it - m_frames.begin()) - 1);
+	}
+
+	ZstdSeekableReader::ZstdSeekableReaderDetail::CachedFrame* ZstdSeekableReader::ZstdSeekableReaderDetail::findCache(const size_t frameIndex) noexcept
+	{
+		for (auto& cache : m_cache)
+		{
+			if (cache.frameIndex == frameIndex)
+			{
+				return &cache;
+			}
+		}
+
+		return nullptr;
+	}
+
+	const Byte* ZstdSeekableReader::ZstdSeekableReaderDetail::getFrame(const size_t frameIndex)
+	{
+		++m_tick;
+
+		if (CachedFrame* cache = findCache(frameIndex))
+		{
+			cache->lastUsed = m_tick;
+			return cache->data.data();
+		}
+
+		CachedFrame* target = nullptr;
+
+		if (m_cache.size() < m_cacheFrameCount)
+		{
+			target = &m_cache.emplace_back();
+		}
+		else
+		{
+			// 最も長い間使われていないものを置き換える
+			target = &*std::min_element(m_cache.begin(), m_cache.end(),
+				[](const CachedFrame& a, const CachedFrame& b) { return (a.lastUsed < b.lastUsed); });
+		}
+
+		target->data.resize(m_frames[frameIndex].decompressedSize);
+
+		if (not decompressFrame(frameIndex, target->data.data()))
+		{
+			target->frameIndex = detail::InvalidZstdFrameIndex;
+			target->lastUsed = 0;
+			return nullptr;
+		}
+
+		target->frameIndex = frameIndex;
+		target->lastUsed = m_tick;
+
+		return target->data.data();
+	}
+
+	bool ZstdSeekableReader::ZstdSeekableReaderDetail::decompressFrame(const size_t frameIndex, Byte* dst)
+	{
+		const Frame& frame = m_frames[frameIndex];
+		const Byte* src = nullptr;
+
+		if (m_data)
+		{
+			// メモリ上のデータはコピーせずに展開する
+			src = (m_data + frame.compressedOffset);
+		}
+		else
+		{
+			m_compressedBuffer.resize(frame.compressedSize);
+
+			if (not readSource(frame.compressedOffset, m_compressedBuffer.data(), frame.compressedSize))
+			{
+				LOG_FAIL(U"ZstdSeekableReader: Failed to read compressed data");
+				return false;
+			}
+
+			src = m_compressedBuffer.data();
+		}
+
+		const size_t result = ZSTD_decompressDCtx(m_dctx, dst, frame.decompressedSize, src, frame.compressedSize);
+
+		if (ZSTD_isError(result)
+			|| (result != frame.decompressedSize))
+		{
+			LOG_FAIL(U"ZstdSeekableReader: ZSTD_decompressDCtx() failed");
+			return false;
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,151 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/ZstdSeekableReader.hpp>
+# include <Siv3D/MemoryMappedFileView.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/String.hpp>
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class ZstdSeekableReader::ZstdSeekableReaderDetail
+	{
+	public:
+
+		ZstdSeekableReaderDetail();
+
+		~ZstdSeekableReaderDetail();
+
+		[[nodiscard]]
+		bool open(FilePathView path, size_t cacheFrameCount);
+
+		[[nodiscard]]
+		bool open(Blob&& blob, size_t cacheFrameCount);
+
+		[[nodiscard]]
+		bool open(std::unique_ptr<IReader>&& reader, size_t cacheFrameCount);
+
+		void close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		[[nodiscard]]
+		int64 size() const noexcept;
+
+		[[nodiscard]]
+		int64 getPos() const noexcept;
+
+		bool setPos(int64 pos) noexcept;
+
+		int64 skip(int64 offset) noexcept;
+
+		int64 read(void* dst, int64 size);
+
+		int64 read(void* dst, int64 pos, int64 size);
+
+		int64 lookahead(void* dst, int64 pos, int64 size);
+
+		[[nodiscard]]
+		size_t frameCount() const noexcept;
+
+		void setCacheFrameCount(size_t cacheFrameCount);
+
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		struct Frame
+		{
+			// 圧縮されたデータにおけるフレームの開始位置
+			uint64 compressedOffset;
+
+			// 展開後のデータにおけるフレームの開始位置
+			int64 decompressedOffset;
+
+			size_t compressedSize;
+
+			size_t decompressedSize;
+		};
+
+		struct CachedFrame
+		{
+			size_t frameIndex;
+
+			uint64 lastUsed;
+
+			Array<Byte> data;
+		};
+
+		// 圧縮されたデータ（ファイルまたは Blob の場合）
+		MemoryMappedFileView m_file;
+
+		Blob m_blob;
+
+		const Byte* m_data = nullptr;
+
+		// 圧縮されたデータ（IReader の場合）
+		std::unique_ptr<IReader> m_reader;
+
+		int64 m_sourceStart = 0;
+
+		// IReader から読み込んだフレームを置くバッファ
+		Array<Byte> m_compressedBuffer;
+
+		uint64 m_sourceSize = 0;
+
+		FilePath m_fullPath;
+
+		ZSTD_DCtx* m_dctx = nullptr;
+
+		Array<Frame> m_frames;
+
+		int64 m_size = 0;
+
+		int64 m_pos = 0;
+
+		Array<CachedFrame> m_cache;
+
+		size_t m_cacheFrameCount = ZstdSeekableReader::DefaultCacheFrameCount;
+
+		uint64 m_tick = 0;
+
+		[[nodiscard]]
+		bool initialize(size_t cacheFrameCount);
+
+		[[nodiscard]]
+		bool readSource(uint64 offset, void* dst, size_t size);
+
+		// シークテーブルからフレームの一覧を作成する。シークテーブルが無い場合は false
+		[[nodiscard]]
+		bool loadSeekTable();
+
+		// フレームを先頭から走査してフレームの一覧を作成する
+		[[nodiscard]]
+		bool scanFrames();
+
+		[[nodiscard]]
+		size_t findFrame(int64 pos) const noexcept;
+
+		[[nodiscard]]
+		CachedFrame* findCache(size_t frameIndex) noexcept;
+
+		// フレームを展開したものを返す。必要に応じて展開し、キャッシュに追加する
+		[[nodiscard]]
+		const Byte* getFrame(size_t frameIndex);
+
+		[[nodiscard]]
+		bool decompressFrame(size_t frameIndex, Byte* dst);
+	};
+}
@@ -0,0 +1,96 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ZstdSeekableWriter.hpp>
+# include <Siv3D/ZstdSeekableWriter/ZstdSeekableWriterDetail.hpp>
+
+namespace s3d
+{
+	ZstdSeekableWriter::ZstdSeekableWriter()
+		: pImpl{ std::make_shared<ZstdSeekableWriterDetail>() } {}
+
+	ZstdSeekableWriter::ZstdSeekableWriter(const FilePathView path, const int32 compressionLevel, const size_t frameSize)
+		: ZstdSeekableWriter{}
+	{
+		open(path, compressionLevel, frameSize);
+	}
+
+	ZstdSeekableWriter::ZstdSeekableWriter(std::unique_ptr<IWriter>&& writer, const int32 compressionLevel, const size_t frameSize)
+		: ZstdSeekableWriter{}
+	{
+		open(std::move(writer), compressionLevel, frameSize);
+	}
+
+	bool ZstdSeekableWriter::open(const FilePathView path, const int32 compressionLevel, const size_t frameSize)
+	{
+		return pImpl->open(path, compressionLevel, frameSize);
+	}
+
+	bool ZstdSeekableWriter::open(std::unique_ptr<IWriter>&& writer, const int32 compressionLevel, const size_t frameSize)
+	{
+		return pImpl->open(std::move(writer), compressionLevel, frameSize);
+	}
+
+	bool ZstdSeekableWriter::close()
+	{
+		return pImpl->close();
+	}
+
+	bool ZstdSeekableWriter::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	ZstdSeekableWriter::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	bool ZstdSeekableWriter::endFrame()
+	{
+		return pImpl->endFrame();
+	}
+
+	int64 ZstdSeekableWriter::size() const
+	{
+		return pImpl->getPos();
+	}
+
+	int64 ZstdSeekableWriter::getPos() const
+	{
+		return pImpl->getPos();
+	}
+
+	bool ZstdSeekableWriter::setPos(const int64 pos)
+	{
+		return (pos == pImpl->getPos());
+	}
+
+	int64 ZstdSeekableWriter::write(const void* src, const int64 sizeBytes)
+	{
+		return pImpl->write(src, sizeBytes);
+	}
+
+	size_t ZstdSeekableWriter::frameCount() const noexcept
+	{
+		return pImpl->frameCount();
+	}
+
+	int64 ZstdSeekableWriter::compressedSize() const noexcept
+	{
+		return pImpl->compressedSize();
+	}
+
+	const FilePath& ZstdSeekableWriter::path() const noexcept
+	{
+		return pImpl->path();
+	}
+}
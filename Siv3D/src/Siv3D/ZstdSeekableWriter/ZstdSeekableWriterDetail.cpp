@@ -0,0 +1,287 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include <Siv3D/Compression/ZstdSeekableFormat.hpp>
+# include "ZstdSeekableWriterDetail.hpp"
+
+namespace s3d
+{
+	namespace detail
+	{
+		static void AppendUint32(Array<Byte>& dst, const uint32 value)
+		{
+			const Byte* p = static_cast<const Byte*>(static_cast<const void*>(&value));
+			dst.insert(dst.end(), p, (p + sizeof(uint32)));
+		}
+	}
+
+	ZstdSeekableWriter::ZstdSeekableWriterDetail::ZstdSeekableWriterDetail()
+	{
+		// do nothing
+	}
+
+	ZstdSeekableWriter::ZstdSeekableWriterDetail::~ZstdSeekableWriterDetail()
+	{
+		close();
+	}
+
+	bool ZstdSeekableWriter::ZstdSeekableWriterDetail::open(const FilePathView path, const int32 compressionLevel, const size_t frameSize)
+	{
+		close();
+
+		auto writer = std::make_unique<BinaryWriter>(path);
+
+		if (not writer->isOpen())
+		{
+			return false;
+		}
+
+		const FilePath fullPath = writer->path();
+
+		if (not open(std::move(writer), compressionLevel, frameSize))
+		{
+			return false;
+		}
+
+		m_fullPath = fullPath;
+
+		return true;
+	}
+
+	bool ZstdSeekableWriter::ZstdSeekableWriterDetail::open(std::unique_ptr<IWriter>&& writer, const int32 compressionLevel, const size_t frameSize)
+	{
+		close();
+
+		// サイズは close() 後も保持しているため、ここでリセットする
+		m_uncompressedSize = 0;
+		m_compressedSize = 0;
+		m_entries.clear();
+
+		if ((not writer)
+			|| (not writer->isOpen()))
+		{
+			return false;
+		}
+
+		m_cctx = ZSTD_createCCtx();
+
+		if (not m_cctx)
+		{
+			return false;
+		}
+
+		if (ZSTD_isError(ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_compressionLevel, compressionLevel)))
+		{
+			release();
+			return false;
+		}
+
+		m_frameSize = Clamp<size_t>(frameSize, 1, ZstdSeekableWriter::MaxFrameSize);
+		m_frameBuffer.reserve(m_frameSize);
+		m_outputBuffer.resize(ZSTD_compressBound(m_frameSize));
+		m_writer = std::move(writer);
+
+		return true;
+	}
+
+	bool ZstdSeekableWriter::ZstdSeekableWriterDetail::close()
+	{
+		if (not m_writer)
+		{
+			return false;
+		}
+
+		const bool result = (endFrame() && writeSeekTable() && (not m_failed));
+
+		release();
+
+		return result;
+	}
+
+	bool ZstdSeekableWriter::ZstdSeekableWriterDetail::isOpen() const noexcept
+	{
+		return static_cast<bool>(m_writer);
+	}
+
+	bool ZstdSeekableWriter::ZstdSeekableWriterDetail::endFrame()
+	{
+		if (not m_writer)
+		{
+			return false;
+		}
+
+		if (m_frameBuffer.isEmpty())
+		{
+			return (not m_failed);
+		}
+
+		const bool result = compressFrame(m_frameBuffer.data(), m_frameBuffer.size());
+
+		m_frameBuffer.clear();
+
+		return result;
+	}
+
+	int64 ZstdSeekableWriter::ZstdSeekableWriterDetail::getPos() const noexcept
+	{
+		return m_uncompressedSize;
+	}
+
+	int64 ZstdSeekableWriter::ZstdSeekableWriterDetail::write(const void* src, const int64 sizeBytes)
+	{
+		if ((not m_writer) || m_failed || (sizeBytes <= 0))
+		{
+			return 0;
+		}
+
+		const Byte* pSrc = static_cast<const Byte*>(src);
+		size_t remaining = static_cast<size_t>(sizeBytes);
+
+		while (remaining)
+		{
+			if (m_frameBuffer.isEmpty() && (m_frameSize <= remaining))
+			{
+				// フレーム全体を書き込む場合は、バッファにコピーせずに圧縮する
+				if (not compressFrame(pSrc, m_frameSize))
+				{
+					break;
+				}
+
+				pSrc += m_frameSize;
+				remaining -= m_frameSize;
+				m_uncompressedSize += m_frameSize;
+				continue;
+			}
+
+			const size_t toCopy = Min((m_frameSize - m_frameBuffer.size()), remaining);
+
+			m_frameBuffer.insert(m_frameBuffer.end(), pSrc, (pSrc + toCopy));
+			pSrc += toCopy;
+			remaining -= toCopy;
+			m_uncompressedSize += toCopy;
+
+			if ((m_frameBuffer.size() == m_frameSize)
+				&& (not endFrame()))
+			{
+				break;
+			}
+		}
+
+		return (sizeBytes - static_cast<int64>(remaining));
+	}
+
+	size_t ZstdSeekableWriter::ZstdSeekableWriterDetail::frameCount() const noexcept
+	{
+		return m_entries.size();
+	}
+
+	int64 ZstdSeekableWriter::ZstdSeekableWriterDetail::compressedSize() const noexcept
+	{
+		return m_compressedSize;
+	}
+
+	const FilePath& ZstdSeekableWriter::ZstdSeekableWriterDetail::path() const noexcept
+	{
+		return m_fullPath;
+	}
+
+	void ZstdSeekableWriter::ZstdSeekableWriterDetail::release()
+	{
+		ZSTD_freeCCtx(m_cctx);
+		m_cctx = nullptr;
+
+		m_writer.reset();
+		m_fullPath.clear();
+		m_frameSize = 0;
+		m_frameBuffer = Array<Byte>{};
+		m_outputBuffer = Array<Byte>{};
+		m_failed = false;
+	}
+
+	bool ZstdSeekableWriter::ZstdSeekableWriterDetail::compressFrame(const Byte* data, const size_t size)
+	{
+		if (m_failed)
+		{
+			return false;
+		}
+
+		if (detail::ZstdSeekTableMaxFrames <= m_entries.size())
+		{
+			LOG_FAIL(U"ZstdSeekableWriter: Too many frames");
+			m_failed = true;
+			return false;
+		}
+
+		// フレームごとに独立して展開できるよう、フレームのヘッダに展開後のサイズを記録して圧縮する
+		const size_t compressedSize = ZSTD_compress2(m_cctx, m_outputBuffer.data(), m_outputBuffer.size(), data, size);
+
+		if (ZSTD_isError(compressedSize))
+		{
+			LOG_FAIL(U"ZstdSeekableWriter: ZSTD_compress2() failed");
+			m_failed = true;
+			return false;
+		}
+
+		const int64 written = m_writer->write(m_outputBuffer.data(), static_cast<int64>(compressedSize));
+
+		m_compressedSize += written;
+
+		if (written != static_cast<int64>(compressedSize))
+		{
+			LOG_FAIL(U"ZstdSeekableWriter: Failed to write compressed data");
+			m_failed = true;
+			return false;
+		}
+
+		m_entries.push_back({ static_cast<uint32>(compressedSize), static_cast<uint32>(size) });
+
+		return true;
+	}
+
+	bool ZstdSeekableWriter::ZstdSeekableWriterDetail::writeSeekTable()
+	{
+		if (m_failed)
+		{
+			return false;
+		}
+
+		const size_t tableSize = ((m_entries.size() * sizeof(SeekTableEntry)) + detail::ZstdSeekTableFooterSize);
+
+		Array<Byte> table(Arg::reserve = (detail::ZstdSkippableHeaderSize + tableSize));
+		detail::AppendUint32(table, detail::ZstdSkippableMagic);
+		detail::AppendUint32(table, static_cast<uint32>(tableSize));
+
+		for (const auto& entry : m_entries)
+		{
+			detail::AppendUint32(table, entry.compressedSize);
+			detail::AppendUint32(table, entry.decompressedSize);
+		}
+
+		detail::AppendUint32(table, static_cast<uint32>(m_entries.size()));
+		table.push_back(Byte{ 0 }); // チェックサムなし
+		detail::AppendUint32(table, detail::ZstdSeekableMagic);
+
+		const int64 written = m_writer->write(table.data(), static_cast<int64>(table.size()));
+
+		m_compressedSize += written;
+
+		if (written != static_cast<int64>(table.size()))
+		{
+			LOG_FAIL(U"ZstdSeekableWriter: Failed to write the seek table");
+			m_failed = true;
+			return false;
+		}
+
+		return true;
+	}
+}
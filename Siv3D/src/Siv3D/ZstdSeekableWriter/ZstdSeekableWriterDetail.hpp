@@ -0,0 +1,95 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/ZstdSeekableWriter.hpp>
+# include <Siv3D/Array.hpp>
+# include <Siv3D/String.hpp>
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class ZstdSeekableWriter::ZstdSeekableWriterDetail
+	{
+	public:
+
+		ZstdSeekableWriterDetail();
+
+		~ZstdSeekableWriterDetail();
+
+		[[nodiscard]]
+		bool open(FilePathView path, int32 compressionLevel, size_t frameSize);
+
+		[[nodiscard]]
+		bool open(std::unique_ptr<IWriter>&& writer, int32 compressionLevel, size_t frameSize);
+
+		bool close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		bool endFrame();
+
+		[[nodiscard]]
+		int64 getPos() const noexcept;
+
+		int64 write(const void* src, int64 sizeBytes);
+
+		[[nodiscard]]
+		size_t frameCount() const noexcept;
+
+		[[nodiscard]]
+		int64 compressedSize() const noexcept;
+
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		struct SeekTableEntry
+		{
+			uint32 compressedSize;
+
+			uint32 decompressedSize;
+		};
+
+		std::unique_ptr<IWriter> m_writer;
+
+		FilePath m_fullPath;
+
+		ZSTD_CCtx* m_cctx = nullptr;
+
+		size_t m_frameSize = 0;
+
+		// 現在のフレームの、まだ圧縮していないデータ
+		Array<Byte> m_frameBuffer;
+
+		Array<Byte> m_outputBuffer;
+
+		Array<SeekTableEntry> m_entries;
+
+		int64 m_uncompressedSize = 0;
+
+		int64 m_compressedSize = 0;
+
+		// 圧縮または書き込みに失敗したか
+		bool m_failed = false;
+
+		void release();
+
+		// data を 1 つのフレームとして圧縮し、出力先に書き込む
+		[[nodiscard]]
+		bool compressFrame(const Byte* data, size_t size);
+
+		[[nodiscard]]
+		bool writeSeekTable();
+	};
+}
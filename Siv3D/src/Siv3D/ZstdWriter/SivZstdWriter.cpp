@@ -0,0 +1,96 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/ZstdWriter.hpp>
+# include <Siv3D/ZstdWriter/ZstdWriterDetail.hpp>
+
+namespace s3d
+{
+	ZstdWriter::ZstdWriter()
+		: pImpl{ std::make_shared<ZstdWriterDetail>() } {}
+
+	ZstdWriter::ZstdWriter(const FilePathView path, const int32 compressionLevel, const size_t workerCount)
+		: ZstdWriter{}
+	{
+		open(path, compressionLevel, workerCount);
+	}
+
+	ZstdWriter::ZstdWriter(std::unique_ptr<IWriter>&& writer, const int32 compressionLevel, const size_t workerCount)
+		: ZstdWriter{}
+	{
+		open(std::move(writer), compressionLevel, workerCount);
+	}
+
+	bool ZstdWriter::open(const FilePathView path, const int32 compressionLevel, const size_t workerCount)
+	{
+		return pImpl->open(path, compressionLevel, workerCount);
+	}
+
+	bool ZstdWriter::open(std::unique_ptr<IWriter>&& writer, const int32 compressionLevel, const size_t workerCount)
+	{
+		return pImpl->open(std::move(writer), compressionLevel, workerCount);
+	}
+
+	bool ZstdWriter::setDictionary(const CompressionDictionary& dictionary)
+	{
+		return pImpl->setDictionary(dictionary);
+	}
+
+	bool ZstdWriter::close()
+	{
+		return pImpl->close();
+	}
+
+	bool ZstdWriter::isOpen() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	ZstdWriter::operator bool() const noexcept
+	{
+		return pImpl->isOpen();
+	}
+
+	bool ZstdWriter::flush()
+	{
+		return pImpl->flush();
+	}
+
+	int64 ZstdWriter::size() const
+	{
+		return pImpl->getPos();
+	}
+
+	int64 ZstdWriter::getPos() const
+	{
+		return pImpl->getPos();
+	}
+
+	bool ZstdWriter::setPos(const int64 pos)
+	{
+		return (pos == pImpl->getPos());
+	}
+
+	int64 ZstdWriter::write(const void* src, const int64 sizeBytes)
+	{
+		return pImpl->write(src, sizeBytes);
+	}
+
+	int64 ZstdWriter::compressedSize() const noexcept
+	{
+		return pImpl->compressedSize();
+	}
+
+	const FilePath& ZstdWriter::path() const noexcept
+	{
+		return pImpl->path();
+	}
+}
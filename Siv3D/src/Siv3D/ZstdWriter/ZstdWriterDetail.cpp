@@ -0,0 +1,239 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include <Siv3D/BinaryWriter.hpp>
+# include <Siv3D/CompressionDictionary/CompressionDictionaryDetail.hpp>
+# include <Siv3D/EngineLog.hpp>
+# include "ZstdWriterDetail.hpp"
+
+namespace s3d
+{
+	ZstdWriter::ZstdWriterDetail::ZstdWriterDetail()
+	{
+		// do nothing
+	}
+
+	ZstdWriter::ZstdWriterDetail::~ZstdWriterDetail()
+	{
+		close();
+	}
+
+	bool ZstdWriter::ZstdWriterDetail::open(const FilePathView path, const int32 compressionLevel, const size_t workerCount)
+	{
+		close();
+
+		auto writer = std::make_unique<BinaryWriter>(path);
+
+		if (not writer->isOpen())
+		{
+			return false;
+		}
+
+		const FilePath fullPath = writer->path();
+
+		if (not open(std::move(writer), compressionLevel, workerCount))
+		{
+			return false;
+		}
+
+		m_fullPath = fullPath;
+
+		return true;
+	}
+
+	bool ZstdWriter::ZstdWriterDetail::open(std::unique_ptr<IWriter>&& writer, const int32 compressionLevel, const size_t workerCount)
+	{
+		close();
+
+		// サイズは close() 後も保持しているため、ここでリセットする
+		m_uncompressedSize = 0;
+		m_compressedSize = 0;
+
+		if ((not writer)
+			|| (not writer->isOpen()))
+		{
+			return false;
+		}
+
+		m_cctx = ZSTD_createCCtx();
+
+		if (not m_cctx)
+		{
+			return false;
+		}
+
+		if (ZSTD_isError(ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_compressionLevel, compressionLevel)))
+		{
+			release();
+			return false;
+		}
+
+		if (workerCount
+			&& ZSTD_isError(ZSTD_CCtx_setParameter(m_cctx, ZSTD_c_nbWorkers, static_cast<int>(workerCount))))
+		{
+			// マルチスレッドに対応していないビルドでは、呼び出し元のスレッドで圧縮する
+			LOG_INFO(U"ZstdWriter: Multithreaded compression is not supported. Falling back to single-threaded compression");
+		}
+
+		m_outputBufferSize = ZSTD_CStreamOutSize();
+		m_outputBuffer = std::make_unique<Byte[]>(m_outputBufferSize);
+		m_writer = std::move(writer);
+
+		return true;
+	}
+
+	bool ZstdWriter::ZstdWriterDetail::setDictionary(const CompressionDictionary& dictionary)
+	{
+		if ((not m_cctx) || m_started)
+		{
+			return false;
+		}
+
+		const ZSTD_CDict* const cDict = dictionary._detail().getCDict();
+
+		if (not cDict)
+		{
+			return false;
+		}
+
+		if (ZSTD_isError(ZSTD_CCtx_refCDict(m_cctx, cDict)))
+		{
+			return false;
+		}
+
+		m_dictionary = dictionary;
+
+		return true;
+	}
+
+	bool ZstdWriter::ZstdWriterDetail::close()
+	{
+		if (not m_writer)
+		{
+			return false;
+		}
+
+		ZSTD_inBuffer input = { nullptr, 0, 0 };
+
+		const bool result = (compress(input, ZSTD_e_end) && (not m_failed));
+
+		release();
+
+		return result;
+	}
+
+	bool ZstdWriter::ZstdWriterDetail::isOpen() const noexcept
+	{
+		return static_cast<bool>(m_writer);
+	}
+
+	bool ZstdWriter::ZstdWriterDetail::flush()
+	{
+		if (not m_writer)
+		{
+			return false;
+		}
+
+		ZSTD_inBuffer input = { nullptr, 0, 0 };
+
+		return compress(input, ZSTD_e_flush);
+	}
+
+	int64 ZstdWriter::ZstdWriterDetail::getPos() const noexcept
+	{
+		return m_uncompressedSize;
+	}
+
+	int64 ZstdWriter::ZstdWriterDetail::write(const void* src, const int64 sizeBytes)
+	{
+		if ((not m_writer) || (sizeBytes <= 0))
+		{
+			return 0;
+		}
+
+		m_started = true;
+
+		ZSTD_inBuffer input = { src, static_cast<size_t>(sizeBytes), 0 };
+
+		// 失敗した場合も、圧縮できた分のサイズを返す
+		[[maybe_unused]] const bool result = compress(input, ZSTD_e_continue);
+
+		m_uncompressedSize += input.pos;
+
+		return static_cast<int64>(input.pos);
+	}
+
+	int64 ZstdWriter::ZstdWriterDetail::compressedSize() const noexcept
+	{
+		return m_compressedSize;
+	}
+
+	const FilePath& ZstdWriter::ZstdWriterDetail::path() const noexcept
+	{
+		return m_fullPath;
+	}
+
+	void ZstdWriter::ZstdWriterDetail::release()
+	{
+		ZSTD_freeCCtx(m_cctx);
+		m_cctx = nullptr;
+
+		m_writer.reset();
+		m_fullPath.clear();
+		m_outputBuffer.reset();
+		m_outputBufferSize = 0;
+		m_dictionary = CompressionDictionary{};
+		m_started = false;
+		m_failed = false;
+	}
+
+	bool ZstdWriter::ZstdWriterDetail::compress(ZSTD_inBuffer& input, const ZSTD_EndDirective mode)
+	{
+		if (m_failed)
+		{
+			return false;
+		}
+
+		for (;;)
+		{
+			ZSTD_outBuffer output = { m_outputBuffer.get(), m_outputBufferSize, 0 };
+
+			const size_t remaining = ZSTD_compressStream2(m_cctx, &output, &input, mode);
+
+			if (ZSTD_isError(remaining))
+			{
+				LOG_FAIL(U"ZstdWriter: ZSTD_compressStream2() failed");
+				m_failed = true;
+				return false;
+			}
+
+			if (output.pos)
+			{
+				const int64 written = m_writer->write(output.dst, static_cast<int64>(output.pos));
+
+				m_compressedSize += written;
+
+				if (written != static_cast<int64>(output.pos))
+				{
+					LOG_FAIL(U"ZstdWriter: Failed to write compressed data");
+					m_failed = true;
+					return false;
+				}
+			}
+
+			// ZSTD_e_continue ではすべての入力を渡し終えたら、それ以外ではすべてを出力し終えたら完了
+			if ((mode == ZSTD_e_continue) ? (input.pos == input.size) : (remaining == 0))
+			{
+				return true;
+			}
+		}
+	}
+}
@@ -0,0 +1,87 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# pragma once
+# include <Siv3D/ZstdWriter.hpp>
+# include <Siv3D/CompressionDictionary.hpp>
+# include <Siv3D/String.hpp>
+# include <ThirdParty/zstd/zstd.h>
+
+namespace s3d
+{
+	class ZstdWriter::ZstdWriterDetail
+	{
+	public:
+
+		ZstdWriterDetail();
+
+		~ZstdWriterDetail();
+
+		[[nodiscard]]
+		bool open(FilePathView path, int32 compressionLevel, size_t workerCount);
+
+		[[nodiscard]]
+		bool open(std::unique_ptr<IWriter>&& writer, int32 compressionLevel, size_t workerCount);
+
+		[[nodiscard]]
+		bool setDictionary(const CompressionDictionary& dictionary);
+
+		bool close();
+
+		[[nodiscard]]
+		bool isOpen() const noexcept;
+
+		bool flush();
+
+		[[nodiscard]]
+		int64 getPos() const noexcept;
+
+		int64 write(const void* src, int64 sizeBytes);
+
+		[[nodiscard]]
+		int64 compressedSize() const noexcept;
+
+		[[nodiscard]]
+		const FilePath& path() const noexcept;
+
+	private:
+
+		std::unique_ptr<IWriter> m_writer;
+
+		FilePath m_fullPath;
+
+		ZSTD_CCtx* m_cctx = nullptr;
+
+		// 圧縮したデータを出力先に書き込む前に置くバッファ
+		std::unique_ptr<Byte[]> m_outputBuffer;
+
+		size_t m_outputBufferSize = 0;
+
+		// CDict は m_cctx から参照されるため、圧縮が終わるまで保持する
+		CompressionDictionary m_dictionary;
+
+		int64 m_uncompressedSize = 0;
+
+		int64 m_compressedSize = 0;
+
+		// 一度でも write() を呼んだか
+		bool m_started = false;
+
+		// 圧縮または書き込みに失敗したか
+		bool m_failed = false;
+
+		void release();
+
+		// input をすべて圧縮し、出力先に書き込む
+		[[nodiscard]]
+		bool compress(ZSTD_inBuffer& input, ZSTD_EndDirective mode);
+	};
+}
@@ -180,6 +180,10 @@ public:
 	/// Get the local position of the center of mass.
 	const b2Vec2& GetLocalCenter() const;
 
+	/// Siv3D: Get the swept motion of the last time step.
+	/// GetSweep().GetTransform(&xf, alpha) interpolates between the start and the end of the step.
+	const b2Sweep& GetSweep() const;
+
 	/// Set the linear velocity of the center of mass.
 	/// @param v the new linear velocity of the center of mass.
 	void SetLinearVelocity(const b2Vec2& v);
@@ -378,6 +382,9 @@ public:
 	/// Get the user data pointer that was provided in the body definition.
 	b2BodyUserData& GetUserData();
 
+	/// Siv3D: Get the user data of a const body.
+	const b2BodyUserData& GetUserData() const;
+
 	/// Set the user data. Use this to store your application specific data.
 	void SetUserData(void* data);
 
@@ -501,6 +508,11 @@ inline const b2Vec2& b2Body::GetLocalCenter() const
 	return m_sweep.localCenter;
 }
 
+inline const b2Sweep& b2Body::GetSweep() const
+{
+	return m_sweep;
+}
+
 inline void b2Body::SetLinearVelocity(const b2Vec2& v)
 {
 	if (m_type == b2_staticBody)
@@ -736,6 +748,11 @@ inline b2BodyUserData& b2Body::GetUserData()
 	return m_userData;
 }
 
+inline const b2BodyUserData& b2Body::GetUserData() const
+{
+	return m_userData;
+}
+
 inline void b2Body::ApplyForce(const b2Vec2& force, const b2Vec2& point, bool wake)
 {
 	if (m_type != b2_dynamicBody)
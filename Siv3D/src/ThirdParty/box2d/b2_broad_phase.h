@@ -53,6 +53,10 @@ public:
 	/// UpdatePairs is called.
 	int32 CreateProxy(const b2AABB& aabb, void* userData);
 
+	/// Siv3D: Reserve storage for proxyCount more proxies, so that creating them
+	/// does not reallocate the tree and the move buffer.
+	void Reserve(int32 proxyCount);
+
 	/// Destroy a proxy. It is up to the client to remove any pairs.
 	void DestroyProxy(int32 proxyId);
 
@@ -76,6 +76,13 @@
 /// Maximum number of sub-steps per contact in continuous physics simulation.
 #define b2_maxSubSteps			8
 
+/// Siv3D: The minimum number of contacts for which b2ContactManager evaluates the
+/// narrow phase in parallel (requires b2World::SetParallelFor).
+#define b2_parallelNarrowPhaseThreshold	1024
+
+/// Siv3D: The number of contacts evaluated by one parallel task.
+#define b2_parallelNarrowPhaseGrainSize	256
+
 
 // Dynamics
 
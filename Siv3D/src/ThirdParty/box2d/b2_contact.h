@@ -210,6 +210,13 @@ protected:
 
 	void Update(b2ContactListener* listener);
 
+	/// Siv3D: The first half of Update(). Computes the new manifold (with warm starting impulses)
+	/// and touching status without modifying this contact, so different contacts can be evaluated in parallel.
+	void EvaluateManifold(b2Manifold* manifold, bool* touching);
+
+	/// Siv3D: The second half of Update(). Applies the result of EvaluateManifold().
+	void Update(b2ContactListener* listener, const b2Manifold& manifold, bool touching);
+
 	static b2ContactRegister s_registers[b2Shape::e_typeCount][b2Shape::e_typeCount];
 	static bool s_initialized;
 
@@ -30,12 +30,21 @@ class b2Contact;
 class b2ContactFilter;
 class b2ContactListener;
 class b2BlockAllocator;
+struct b2Manifold;
+
+/// Siv3D: A task that processes the items in [begin, end).
+typedef void b2ParallelTaskFcn(int32 begin, int32 end, void* taskContext);
+
+/// Siv3D: Runs task over [0, count), possibly on multiple threads, and returns after all items are processed.
+/// Items are split into ranges of at least grainSize.
+typedef void b2ParallelForFcn(int32 count, int32 grainSize, b2ParallelTaskFcn* task, void* taskContext, void* userContext);
 
 // Delegate of b2World.
 class B2_API b2ContactManager
 {
 public:
 	b2ContactManager();
+	~b2ContactManager();
 
 	// Broad-phase callback.
 	void AddPair(void* proxyUserDataA, void* proxyUserDataB);
@@ -52,6 +61,21 @@ public:
 	b2ContactFilter* m_contactFilter;
 	b2ContactListener* m_contactListener;
 	b2BlockAllocator* m_allocator;
+
+	// Siv3D: parallel narrow phase
+	b2ParallelForFcn* m_parallelFor;
+	void* m_parallelForContext;
+
+private:
+
+	void CollideParallel();
+
+	static void EvaluateContacts(int32 begin, int32 end, void* taskContext);
+
+	b2Contact** m_narrowPhaseContacts;
+	b2Manifold* m_narrowPhaseManifolds;
+	int8* m_narrowPhaseStates;
+	int32 m_narrowPhaseCapacity;
 };
 
 #endif
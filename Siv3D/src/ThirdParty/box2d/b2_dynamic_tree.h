@@ -80,6 +80,10 @@ public:
 	/// Destroy a proxy. This asserts if the id is invalid.
 	void DestroyProxy(int32 proxyId);
 
+	/// Siv3D: Grow the node pool so that it holds at least nodeCapacity nodes.
+	/// Avoids repeated reallocation when many proxies are created at once.
+	void Reserve(int32 nodeCapacity);
+
 	/// Move a proxy with a swepted AABB. If the proxy has moved outside of its fattened AABB,
 	/// then the proxy is removed from the tree and re-inserted. Otherwise
 	/// the function returns immediately.
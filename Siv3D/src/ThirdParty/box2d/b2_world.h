@@ -66,6 +66,14 @@ public:
 	/// remain in scope.
 	void SetContactListener(b2ContactListener* listener);
 
+	/// Siv3D: Register a routine that runs tasks in parallel. When set, the narrow phase
+	/// of worlds with many contacts is evaluated in parallel. Pass nullptr to disable.
+	void SetParallelFor(b2ParallelForFcn* parallelFor, void* userContext);
+
+	/// Siv3D: Reserve broad-phase storage for proxyCount more fixtures (proxies),
+	/// so that creating many bodies at once does not grow the storage repeatedly.
+	void ReserveProxies(int32 proxyCount);
+
 	/// Register a routine for debug drawing. The debug draw functions are called
 	/// inside with b2World::DebugDraw method. The debug draw object is owned
 	/// by you and must remain in scope.
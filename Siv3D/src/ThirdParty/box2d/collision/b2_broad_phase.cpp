@@ -50,6 +50,22 @@ int32 b2BroadPhase::CreateProxy(const b2AABB& aabb, void* userData)
 	return proxyId;
 }
 
+void b2BroadPhase::Reserve(int32 proxyCount)
+{
+	// A tree with n leaves has 2n - 1 nodes.
+	m_tree.Reserve(2 * (m_proxyCount + proxyCount));
+
+	const int32 moveCapacity = m_moveCount + proxyCount;
+	if (m_moveCapacity < moveCapacity)
+	{
+		int32* oldBuffer = m_moveBuffer;
+		m_moveCapacity = moveCapacity;
+		m_moveBuffer = (int32*)b2Alloc(m_moveCapacity * sizeof(int32));
+		memcpy(m_moveBuffer, oldBuffer, m_moveCount * sizeof(int32));
+		b2Free(oldBuffer);
+	}
+}
+
 void b2BroadPhase::DestroyProxy(int32 proxyId)
 {
 	UnBufferMove(proxyId);
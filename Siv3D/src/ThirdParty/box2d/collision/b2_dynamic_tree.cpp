@@ -90,6 +90,31 @@ int32 b2DynamicTree::AllocateNode()
 	return nodeId;
 }
 
+// Siv3D: Grow the pool in one step. The new nodes are put in front of the free list.
+void b2DynamicTree::Reserve(int32 nodeCapacity)
+{
+	if (nodeCapacity <= m_nodeCapacity)
+	{
+		return;
+	}
+
+	b2TreeNode* oldNodes = m_nodes;
+	const int32 oldCapacity = m_nodeCapacity;
+	m_nodeCapacity = nodeCapacity;
+	m_nodes = (b2TreeNode*)b2Alloc(m_nodeCapacity * sizeof(b2TreeNode));
+	memcpy(m_nodes, oldNodes, oldCapacity * sizeof(b2TreeNode));
+	b2Free(oldNodes);
+
+	for (int32 i = oldCapacity; i < m_nodeCapacity - 1; ++i)
+	{
+		m_nodes[i].next = i + 1;
+		m_nodes[i].height = -1;
+	}
+	m_nodes[m_nodeCapacity-1].next = m_freeList;
+	m_nodes[m_nodeCapacity-1].height = -1;
+	m_freeList = oldCapacity;
+}
+
 // Return a node to the pool.
 void b2DynamicTree::FreeNode(int32 nodeId)
 {
@@ -36,6 +36,19 @@ b2ContactManager::b2ContactManager()
 	m_contactFilter = &b2_defaultFilter;
 	m_contactListener = &b2_defaultListener;
 	m_allocator = nullptr;
+	m_parallelFor = nullptr;
+	m_parallelForContext = nullptr;
+	m_narrowPhaseContacts = nullptr;
+	m_narrowPhaseManifolds = nullptr;
+	m_narrowPhaseStates = nullptr;
+	m_narrowPhaseCapacity = 0;
+}
+
+b2ContactManager::~b2ContactManager()
+{
+	b2Free(m_narrowPhaseContacts);
+	b2Free(m_narrowPhaseManifolds);
+	b2Free(m_narrowPhaseStates);
 }
 
 void b2ContactManager::Destroy(b2Contact* c)
@@ -108,6 +121,13 @@ void b2ContactManager::Destroy(b2Contact* c)
 // contact list.
 void b2ContactManager::Collide()
 {
+	// Siv3D: evaluate the manifolds of many contacts on multiple threads
+	if (m_parallelFor && (b2_parallelNarrowPhaseThreshold <= m_contactCount))
+	{
+		CollideParallel();
+		return;
+	}
+
 	// Update awake contacts.
 	b2Contact* c = m_contactList;
 	while (c)
@@ -173,6 +193,146 @@ void b2ContactManager::Collide()
 	}
 }
 
+// Siv3D: Narrow phase states stored in m_narrowPhaseStates
+enum
+{
+	e_narrowPhaseSkipped = 0,
+	e_narrowPhaseSeparated = 1,
+	e_narrowPhaseTouching = 2
+};
+
+void b2ContactManager::EvaluateContacts(int32 begin, int32 end, void* taskContext)
+{
+	b2ContactManager* self = static_cast<b2ContactManager*>(taskContext);
+
+	for (int32 i = begin; i < end; ++i)
+	{
+		b2Contact* c = self->m_narrowPhaseContacts[i];
+		int8& state = self->m_narrowPhaseStates[i];
+		state = e_narrowPhaseSkipped;
+
+		// Contacts that need filtering run user callbacks, so they are left to the serial pass.
+		if (c->m_flags & b2Contact::e_filterFlag)
+		{
+			continue;
+		}
+
+		b2Fixture* fixtureA = c->GetFixtureA();
+		b2Fixture* fixtureB = c->GetFixtureB();
+		b2Body* bodyA = fixtureA->GetBody();
+		b2Body* bodyB = fixtureB->GetBody();
+
+		bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
+		bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+
+		if (activeA == false && activeB == false)
+		{
+			continue;
+		}
+
+		int32 proxyIdA = fixtureA->m_proxies[c->GetChildIndexA()].proxyId;
+		int32 proxyIdB = fixtureB->m_proxies[c->GetChildIndexB()].proxyId;
+
+		if (self->m_broadPhase.TestOverlap(proxyIdA, proxyIdB) == false)
+		{
+			continue;
+		}
+
+		bool touching = false;
+		c->EvaluateManifold(self->m_narrowPhaseManifolds + i, &touching);
+		state = touching ? e_narrowPhaseTouching : e_narrowPhaseSeparated;
+	}
+}
+
+// Siv3D: Same as Collide(), but the manifolds are evaluated in parallel first.
+// Evaluation only reads the transforms and the contact itself, so the serial pass
+// below produces the same results and callbacks in the same order as Collide().
+void b2ContactManager::CollideParallel()
+{
+	if (m_narrowPhaseCapacity < m_contactCount)
+	{
+		b2Free(m_narrowPhaseContacts);
+		b2Free(m_narrowPhaseManifolds);
+		b2Free(m_narrowPhaseStates);
+
+		m_narrowPhaseCapacity = b2Max(m_contactCount, 2 * m_narrowPhaseCapacity);
+		m_narrowPhaseContacts = (b2Contact**)b2Alloc(m_narrowPhaseCapacity * sizeof(b2Contact*));
+		m_narrowPhaseManifolds = (b2Manifold*)b2Alloc(m_narrowPhaseCapacity * sizeof(b2Manifold));
+		m_narrowPhaseStates = (int8*)b2Alloc(m_narrowPhaseCapacity * sizeof(int8));
+	}
+
+	int32 count = 0;
+	for (b2Contact* c = m_contactList; c; c = c->GetNext())
+	{
+		m_narrowPhaseContacts[count++] = c;
+	}
+
+	m_parallelFor(count, b2_parallelNarrowPhaseGrainSize, &b2ContactManager::EvaluateContacts, this, m_parallelForContext);
+
+	for (int32 i = 0; i < count; ++i)
+	{
+		b2Contact* c = m_narrowPhaseContacts[i];
+		b2Fixture* fixtureA = c->GetFixtureA();
+		b2Fixture* fixtureB = c->GetFixtureB();
+		int32 indexA = c->GetChildIndexA();
+		int32 indexB = c->GetChildIndexB();
+		b2Body* bodyA = fixtureA->GetBody();
+		b2Body* bodyB = fixtureB->GetBody();
+
+		// Is this contact flagged for filtering?
+		if (c->m_flags & b2Contact::e_filterFlag)
+		{
+			// Should these bodies collide?
+			if (bodyB->ShouldCollide(bodyA) == false)
+			{
+				Destroy(c);
+				continue;
+			}
+
+			// Check user filtering.
+			if (m_contactFilter && m_contactFilter->ShouldCollide(fixtureA, fixtureB) == false)
+			{
+				Destroy(c);
+				continue;
+			}
+
+			// Clear the filtering flag.
+			c->m_flags &= ~b2Contact::e_filterFlag;
+		}
+
+		bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
+		bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+
+		// At least one body must be awake and it must be dynamic or kinematic.
+		if (activeA == false && activeB == false)
+		{
+			continue;
+		}
+
+		if (m_narrowPhaseStates[i] != e_narrowPhaseSkipped)
+		{
+			// The contact persists.
+			c->Update(m_contactListener, m_narrowPhaseManifolds[i], (m_narrowPhaseStates[i] == e_narrowPhaseTouching));
+			continue;
+		}
+
+		// Not evaluated in parallel: filtered, or woken up by an earlier contact in this pass.
+		int32 proxyIdA = fixtureA->m_proxies[indexA].proxyId;
+		int32 proxyIdB = fixtureB->m_proxies[indexB].proxyId;
+		bool overlap = m_broadPhase.TestOverlap(proxyIdA, proxyIdB);
+
+		// Here we destroy contacts that cease to overlap in the broad-phase.
+		if (overlap == false)
+		{
+			Destroy(c);
+			continue;
+		}
+
+		// The contact persists.
+		c->Update(m_contactListener);
+	}
+}
+
 void b2ContactManager::FindNewContacts()
 {
 	m_broadPhase.UpdatePairs(this);
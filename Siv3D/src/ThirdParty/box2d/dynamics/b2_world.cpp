@@ -107,6 +107,17 @@ void b2World::SetContactListener(b2ContactListener* listener)
 	m_contactManager.m_contactListener = listener;
 }
 
+void b2World::SetParallelFor(b2ParallelForFcn* parallelFor, void* userContext)
+{
+	m_contactManager.m_parallelFor = parallelFor;
+	m_contactManager.m_parallelForContext = userContext;
+}
+
+void b2World::ReserveProxies(int32 proxyCount)
+{
+	m_contactManager.m_broadPhase.Reserve(proxyCount);
+}
+
 void b2World::SetDebugDraw(b2Draw* debugDraw)
 {
 	m_debugDraw = debugDraw;
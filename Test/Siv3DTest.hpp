@@ -38,4 +38,18 @@ public:
     std::string describe() const override { return description.narrow(); }
 };
 
+// KDTree で Array<Vec2> を扱うためのアダプタ
+struct Vec2Adapter : KDTreeAdapter<Array<Vec2>, Vec2>
+{
+	static const element_type* GetPointer(const point_type& point)
+	{
+		return &point.x;
+	}
+
+	static element_type GetElement(const dataset_type& dataset, const size_t index, const size_t dim)
+	{
+		return dataset[index].elem(dim);
+	}
+};
+
 //# define SIV3D_RUN_BENCHMARK
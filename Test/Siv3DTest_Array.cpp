@@ -82,6 +82,37 @@ TEST_CASE("Array::parallel_map()")
 	}
 }
 
+TEST_CASE("Array::parallel_each()")
+{
+	for (const size_t grainSize : { Threading::AutoGrainSize, size_t(1), size_t(1000), size_t(1024 * 1024) })
+	{
+		Array<int32> v = Array<int32>::IndexedGenerate((64 * 1024 + 3), [](size_t i) { return static_cast<int32>(i); });
+
+		v.parallel_each([](int32& n) { n *= 2; }, grainSize);
+
+		REQUIRE(v == Array<int32>::IndexedGenerate((64 * 1024 + 3), [](size_t i) { return static_cast<int32>(i * 2); }));
+	}
+}
+
+TEST_CASE("Array::parallel_map() : grainSize")
+{
+	const Array<int32> v = Array<int32>::IndexedGenerate(10'000, [](size_t i) { return static_cast<int32>(i); });
+
+	for (const size_t grainSize : { Threading::AutoGrainSize, size_t(1), size_t(7), size_t(100'000) })
+	{
+		REQUIRE(v.map([](int32 n) { return n * 3; }) == v.parallel_map([](int32 n) { return n * 3; }, grainSize));
+
+		REQUIRE(v.count_if(IsOdd) == v.parallel_count_if(IsOdd, grainSize));
+	}
+}
+
+TEST_CASE("Array::parallel_each() : exception")
+{
+	Array<int32> v(10'000, 1);
+
+	REQUIRE_THROWS_AS(v.parallel_each([](int32& n) { if (n == 1) { throw std::runtime_error{ "error" }; } }, 16), std::runtime_error);
+}
+
 # if defined(SIV3D_RUN_BENCHMARK)
 
 TEST_CASE("Array::parallel_count_if() : benchmark")
@@ -173,4 +204,32 @@ TEST_CASE("Array::parallel_map() : benchmark")
 	}
 }
 
+
+TEST_CASE("Array::parallel_each() : benchmark")
+{
+	for (const auto& [size, label] : { std::pair<size_t, const char*>{ 1'000, "1K" }, { 100'000, "100K" }, { 10'000'000, "10M" } })
+	{
+		Array<float> v(size, 1.0f);
+
+		BENCHMARK(std::string{ "std::for_each() | " } + label)
+		{
+			std::for_each(v.begin(), v.end(), [](float& x) { x = (x * 0.5f + 1.0f); });
+			return v.front();
+		};
+
+		BENCHMARK(std::string{ "Array::parallel_each() | " } + label)
+		{
+			v.parallel_each([](float& x) { x = (x * 0.5f + 1.0f); });
+			return v.front();
+		};
+
+		// 粒度を 1 にして、範囲の分割にかかるオーバーヘッドを測る
+		BENCHMARK(std::string{ "Array::parallel_each(grainSize = 1) | " } + label)
+		{
+			v.parallel_each([](float& x) { x = (x * 0.5f + 1.0f); }, 1);
+			return v.front();
+		};
+	}
+}
+
 # endif
@@ -44,3 +44,202 @@ TEST_CASE("AsyncTask")
 # endif
 	
 }
+
+# if !SIV3D_PLATFORM(WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+
+TEST_CASE("AsyncTask::then()")
+{
+	auto task = Async([] { return 10; })
+		.then([](int32 n) { return (n + 1); })
+		.then([](int32 n) { return Format(n); });
+
+	REQUIRE(task.get() == U"11");
+
+	auto failed = Async([]() -> int32 { throw std::runtime_error{ "error" }; })
+		.then([](int32 n) { return n; });
+
+	REQUIRE_THROWS_AS(failed.get(), std::runtime_error);
+}
+
+TEST_CASE("AsyncTask : nested wait")
+{
+	// ワーカースレッドの中で別のタスクを待ってもデッドロックしない
+	Array<AsyncTask<int32>> tasks;
+
+	for (int32 i = 0; i < 64; ++i)
+	{
+		tasks << Async([i]() { return Async([i]() { return i; }).get(); });
+	}
+
+	int32 sum = 0;
+
+	for (auto& task : tasks)
+	{
+		sum += task.get();
+	}
+
+	REQUIRE(sum == (63 * 64 / 2));
+}
+
+TEST_CASE("AsyncTask : wait on destruction")
+{
+	// std::async と同様に、破棄や上書きの前にタスクの完了を待つ
+	std::atomic<int32> count = 0;
+
+	{
+		AsyncTask task{ [&count]() { std::this_thread::sleep_for(std::chrono::milliseconds{ 50 }); ++count; } };
+	}
+
+	REQUIRE(count == 1);
+
+	AsyncTask task{ [&count]() { std::this_thread::sleep_for(std::chrono::milliseconds{ 50 }); ++count; } };
+
+	task = Async([&count]() { ++count; });
+
+	REQUIRE(count >= 2);
+
+	task.wait();
+
+	REQUIRE(count == 3);
+}
+
+TEST_CASE("TaskGroup")
+{
+	std::atomic<int32> count = 0;
+
+	TaskGroup group;
+
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		group.run([&count]() { ++count; });
+	}
+
+	group.wait();
+
+	REQUIRE(group.isDone());
+	REQUIRE(count == 1000);
+
+	group.run([]() { throw std::runtime_error{ "error" }; });
+
+	REQUIRE_THROWS_AS(group.wait(), std::runtime_error);
+}
+
+TEST_CASE("TaskGroup : nested")
+{
+	// タスクの中でグループを待ってもデッドロックしない
+	std::atomic<int32> count = 0;
+	TaskGroup outer;
+
+	for (int32 i = 0; i < 16; ++i)
+	{
+		outer.run([&count]()
+		{
+			TaskGroup inner;
+
+			for (int32 k = 0; k < 50; ++k)
+			{
+				inner.run([&count]() { ++count; });
+			}
+
+			inner.wait();
+		});
+	}
+
+	outer.wait();
+	REQUIRE(count == 800);
+
+	// 実行中のタスクがグループに追加したタスクも待つ
+	TaskGroup group;
+	std::atomic<int32> depth = 0;
+	std::function<void()> step = [&]()
+	{
+		if (++depth < 100)
+		{
+			group.run(step);
+		}
+	};
+
+	group.run(step);
+	group.wait();
+	REQUIRE(depth == 100);
+}
+
+TEST_CASE("Threading::ParallelFor()")
+{
+	Array<int32> v(100'003);
+
+	Threading::ParallelFor(v.size(), [&](size_t i) { v[i] = static_cast<int32>(i); });
+
+	REQUIRE(v == Array<int32>::IndexedGenerate(v.size(), [](size_t i) { return static_cast<int32>(i); }));
+}
+
+TEST_CASE("Threading::ParallelFor() : unrelated tasks")
+{
+	// ParallelFor() を待っている呼び出し元のスレッドは、キューにある無関係なタスクを実行しない
+	const std::thread::id callerID = std::this_thread::get_id();
+	std::atomic<bool> released = false;
+	Array<AsyncTask<bool>> tasks;
+
+	for (size_t i = 0; i < (Threading::GetWorkerCount() * 2); ++i)
+	{
+		tasks << Async([&]()
+		{
+			const bool onCaller = (std::this_thread::get_id() == callerID);
+
+			while (not released)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+			}
+
+			return onCaller;
+		});
+	}
+
+	std::atomic<size_t> count = 0;
+	Threading::ParallelFor(0, 100'000, [&](size_t) { ++count; }, 100);
+	REQUIRE(count == 100'000);
+
+	released = true;
+
+	for (auto& task : tasks)
+	{
+		REQUIRE_FALSE(task.get());
+	}
+}
+
+TEST_CASE("AsyncTask : blocking task")
+{
+	// 1 つのタスクがブロックしていても、他のタスクと継続は実行される
+	REQUIRE(2 <= Threading::GetWorkerCount());
+
+	std::atomic<bool> released = false;
+
+	AsyncTask<void> blocking = Async([&]()
+	{
+		while (not released)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+		}
+	});
+
+	AsyncTask<int32> task = Async([]() { return 20; }).then([](int32 n) { return (n + 1); });
+	REQUIRE(task.wait_for(std::chrono::seconds{ 10 }) == std::future_status::ready);
+	REQUIRE(task.get() == 21);
+
+	released = true;
+	blocking.get();
+}
+
+TEST_CASE("Threading::ParallelReduce()")
+{
+	const Array<double> v = Array<double>::IndexedGenerate(100'003, [](size_t i) { return std::sin(i * 0.001); });
+
+	const double a = Threading::ParallelReduce(0, v.size(), 0.0, [&](size_t i) { return v[i]; }, std::plus<>{}, 1000);
+	const double b = Threading::ParallelReduce(0, v.size(), 0.0, [&](size_t i) { return v[i]; }, std::plus<>{}, 1000);
+
+	// 部分和の集約順序が固定なので、結果はビット単位で一致する
+	REQUIRE(a == b);
+	REQUIRE(a == Approx(v.sum()));
+}
+
+# endif
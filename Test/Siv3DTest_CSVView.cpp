@@ -0,0 +1,119 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("CSVView")
+{
+	const std::string text = "\xEF\xBB\xBFid,value,flag,name\r\n"
+		"1,0.5,true,\"Siv3D\"\r\n"
+		"2,1.5,false,\"a,b\"\r\n"
+		"3,x,TRUE,\"say \"\"hi\"\"\"\r\n"
+		"4,2.5,maybe,\"multi\nline\"\n"
+		"5\n";
+
+	const CSVView csv{ Blob{ text.data(), text.size() } };
+
+	SECTION("rows and columns")
+	{
+		REQUIRE(csv.rows() == 6);
+		REQUIRE(csv.columns(0) == 4);
+		REQUIRE(csv.columns(5) == 1);
+		REQUIRE(csv.columns(6) == 0);
+		REQUIRE(csv.getRow(0) == Array<String>{ U"id", U"value", U"flag", U"name" });
+	}
+
+	SECTION("cells")
+	{
+		std::string buffer;
+		REQUIRE(csv.getUTF8(1, 3, buffer) == "Siv3D");
+		REQUIRE(csv.getUTF8(2, 3, buffer) == "a,b");
+		REQUIRE(csv.getUTF8(3, 3, buffer) == "say \"hi\"");
+		REQUIRE(csv.getUTF8(4, 3, buffer) == "multi\nline");
+		REQUIRE(csv.getUTF8(9, 0, buffer) == "");
+		REQUIRE(csv.get<int32>(2, 0) == 2);
+		REQUIRE(csv.get<String>(3, 3) == U"say \"hi\"");
+		REQUIRE(csv.getOr<double>(3, 1, -1.0) == -1.0);
+		REQUIRE(csv.getOpt<int32>(5, 1) == none);
+	}
+
+	SECTION("column")
+	{
+		REQUIRE(csv.column<int32>(0, -1) == Array<int32>{ -1, 1, 2, 3, 4, 5 });
+		REQUIRE(csv.column<double>(1, -1.0) == Array<double>{ -1.0, 0.5, 1.5, -1.0, 2.5, -1.0 });
+		REQUIRE(csv.column<bool>(2) == Array<bool>{ false, true, false, true, false, false });
+		REQUIRE(csv.column(3, String{ U"-" }) == Array<String>{ U"name", U"Siv3D", U"a,b", U"say \"hi\"", U"multi\nline", U"-" });
+	}
+
+	SECTION("separator")
+	{
+		const std::string tsv = "a\tb\\\tc\n\"d\"\te";
+		const CSVView csv2{ Blob{ tsv.data(), tsv.size() }, U'\t' };
+		REQUIRE(csv2.rows() == 2);
+		REQUIRE(csv2.getRow(0) == Array<String>{ U"a", U"b\tc" });
+		REQUIRE(csv2.getRow(1) == Array<String>{ U"d", U"e" });
+	}
+}
+
+TEST_CASE("CSVView : mounted file")
+{
+	// パックファイル内のファイルはメモリマップできないので、BinaryReader で読み込まれる
+	FileSystem::Remove(U"test/runtime/csvview/");
+	TextWriter{ U"test/runtime/csvview/source/data.csv", TextEncoding::UTF8_NO_BOM }.write(U"a,b\n1,2\n");
+
+	REQUIRE(VirtualFileSystem::CreatePack(U"test/runtime/csvview/source/", U"test/runtime/csvview/assets.pack"));
+	REQUIRE(VirtualFileSystem::Mount(U"test/runtime/csvview/assets.pack", U"csvview"));
+
+	const CSVView csv{ U"csvview/data.csv" };
+	REQUIRE(csv);
+	REQUIRE(csv.rows() == 2);
+	REQUIRE(csv.get<int32>(1, 1) == 2);
+
+	REQUIRE(VirtualFileSystem::Unmount(U"test/runtime/csvview/assets.pack"));
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("CSVView : benchmark")
+{
+	std::string text;
+
+	for (int32 i = 0; i < 500'000; ++i)
+	{
+		text += std::to_string(i);
+		text += ",";
+		text += std::to_string(i * 0.25);
+		text += ",\"item ";
+		text += std::to_string(i % 100);
+		text += "\",true\n";
+	}
+
+	BENCHMARK("CSV::load() | 500K rows")
+	{
+		CSV csv{ MemoryViewReader{ text.data(), text.size() } };
+		return csv.rows();
+	};
+
+	BENCHMARK("CSVView::load() | 500K rows")
+	{
+		const CSVView csv{ Blob{ text.data(), text.size() } };
+		return csv.rows();
+	};
+
+	const CSVView csv{ Blob{ text.data(), text.size() } };
+
+	BENCHMARK("CSVView::column<double>() | 500K rows")
+	{
+		return csv.column<double>(1).size();
+	};
+}
+
+# endif
@@ -0,0 +1,73 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Circle::DrawBatch")
+{
+	Array<Circle> circles;
+	Array<ColorF> colors;
+
+	for (int32 i = 0; i < 50000; ++i)
+	{
+		circles.emplace_back((i % 400), (i / 400), ((i % 7 == 0) ? 120 : (1 + i % 9)));
+		colors.emplace_back(HSV{ (i % 360) });
+	}
+
+	System::Update();
+
+	for (size_t i = 0; i < circles.size(); ++i)
+	{
+		circles[i].draw(colors[i]);
+	}
+
+	System::Update();
+
+	const uint32 triangleCount = Profiler::GetStat().triangleCount;
+
+	Circle::DrawBatch(circles, colors);
+
+	System::Update();
+
+	// 個別に描いた場合と同じ三角形が生成される
+	REQUIRE(0 < triangleCount);
+	REQUIRE(Profiler::GetStat().triangleCount == triangleCount);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Circle::DrawBatch : benchmark")
+{
+	Array<Circle> circles;
+
+	for (int32 i = 0; i < 100000; ++i)
+	{
+		circles.emplace_back((i % 400), (i / 400), (1 + i % 9));
+	}
+
+	BENCHMARK("Circle::draw() x 100000")
+	{
+		for (const auto& circle : circles)
+		{
+			circle.draw();
+		}
+
+		Graphics2D::Flush();
+	};
+
+	BENCHMARK("Circle::DrawBatch() x 100000")
+	{
+		Circle::DrawBatch(circles);
+		Graphics2D::Flush();
+	};
+}
+
+# endif
@@ -0,0 +1,247 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	Blob MakeZstdTestData(const size_t size)
+	{
+		Blob blob;
+		blob.resize(size);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			blob[i] = Byte((i * 31 + (i >> 10)) & 0x7F);
+		}
+
+		return blob;
+	}
+}
+
+TEST_CASE("ZstdWriter / ZstdReader")
+{
+	const Blob data = MakeZstdTestData(3'000'000);
+
+	SECTION("round trip")
+	{
+		MemoryWriter memoryWriter;
+		ZstdWriter writer{ std::move(memoryWriter) };
+		REQUIRE(writer.isOpen());
+
+		for (size_t offset = 0; offset < data.size(); offset += 100'000)
+		{
+			REQUIRE(writer.write((data.data() + offset), Min<int64>(100'000, (data.size() - offset))) == Min<int64>(100'000, (data.size() - offset)));
+		}
+
+		REQUIRE(writer.size() == static_cast<int64>(data.size()));
+		REQUIRE(writer.close());
+		REQUIRE(writer.compressedSize() < static_cast<int64>(data.size()));
+
+		const Blob compressed = Compression::Compress(data);
+		REQUIRE(Compression::Decompress(compressed) == data);
+
+		ZstdReader reader{ MemoryReader{ Blob{ compressed } } };
+		REQUIRE(reader.size() == static_cast<int64>(data.size()));
+
+		Blob result;
+		result.resize(data.size());
+		REQUIRE(reader.read(result.data(), result.size()) == static_cast<int64>(data.size()));
+		REQUIRE(result == data);
+
+		uint8 value = 0;
+		REQUIRE(reader.setPos(12345));
+		REQUIRE(reader.read(value));
+		REQUIRE(value == static_cast<uint8>(data[12345]));
+	}
+
+	SECTION("concatenated frames")
+	{
+		// 2 つのフレームを連結したデータ（zstd コマンドで連結したファイルと同じ形式）
+		const Blob first{ data.data(), 1'000'000 };
+		const Blob second{ (data.data() + 1'000'000), (data.size() - 1'000'000) };
+
+		Blob compressed = Compression::Compress(first);
+		const Blob compressedSecond = Compression::Compress(second);
+		compressed.append(compressedSecond.data(), compressedSecond.size());
+
+		ZstdReader reader{ MemoryReader{ Blob{ compressed } } };
+		REQUIRE(reader.size() == static_cast<int64>(data.size()));
+
+		Blob result;
+		result.resize(data.size());
+		REQUIRE(reader.read(result.data(), result.size()) == static_cast<int64>(data.size()));
+		REQUIRE(result == data);
+
+		// 壊れたデータでは展開後のサイズを不明（0）とする
+		compressed.resize(compressed.size() - 100);
+		REQUIRE(ZstdReader{ MemoryReader{ std::move(compressed) } }.size() == 0);
+	}
+
+	SECTION("Serializer")
+	{
+		Serializer<ZstdWriter> writer{ MemoryWriter{} };
+		writer(Array<int32>{ 1, 2, 3 }, String{ U"Siv3D" });
+		REQUIRE(writer->close());
+	}
+
+	SECTION("dictionary")
+	{
+		Array<Blob> samples;
+
+		for (int32 i = 0; i < 2000; ++i)
+		{
+			const std::string s = (R"({"id":)" + std::to_string(i) + R"(,"name":"player)" + std::to_string(i * 7 % 101) + R"(","score":)" + std::to_string(i * 7919 % 100000) + "}");
+			samples.emplace_back(s.data(), s.size());
+		}
+
+		const CompressionDictionary dictionary{ Compression::TrainDictionary(samples, 4096) };
+		REQUIRE(dictionary);
+		REQUIRE(dictionary.id() != 0);
+
+		for (size_t i = 0; i < 100; ++i)
+		{
+			const Blob compressed = Compression::Compress(samples[i], dictionary);
+			REQUIRE(compressed.size() < Compression::Compress(samples[i]).size());
+			REQUIRE(Compression::Decompress(compressed, dictionary) == samples[i]);
+		}
+	}
+}
+
+TEST_CASE("ZstdSeekableWriter / ZstdSeekableReader")
+{
+	const Blob data = MakeZstdTestData(3'000'000);
+	const FilePath path = U"test/runtime/compression/seekable.zst";
+
+	{
+		ZstdSeekableWriter writer{ path, Compression::DefaultLevel, (256 * 1024) };
+		REQUIRE(writer.isOpen());
+		REQUIRE(writer.write(data.data(), data.size()) == static_cast<int64>(data.size()));
+		REQUIRE(writer.close());
+		REQUIRE(writer.frameCount() == 12);
+	}
+
+	SECTION("sequential")
+	{
+		// シークテーブルはスキップ可能フレームなので、先頭から展開することもできる
+		REQUIRE(Compression::DecompressFile(path) == data);
+	}
+
+	SECTION("random access")
+	{
+		ZstdSeekableReader reader{ path };
+		REQUIRE(reader.isOpen());
+		REQUIRE(reader.frameCount() == 12);
+		REQUIRE(reader.size() == static_cast<int64>(data.size()));
+
+		for (const int64 pos : { 2'999'000, 100, 1'000'000, 262'000, 0 })
+		{
+			Blob result;
+			result.resize(1000);
+
+			REQUIRE(reader.setPos(pos));
+			REQUIRE(reader.read(result.data(), 1000) == 1000);
+			REQUIRE(std::equal(result.begin(), result.end(), (data.begin() + pos)));
+			REQUIRE(reader.getPos() == (pos + 1000));
+		}
+
+		uint8 value = 0;
+		REQUIRE(reader.lookahead(value));
+		REQUIRE(value == static_cast<uint8>(data[1000]));
+		REQUIRE(reader.getPos() == 1000);
+	}
+
+	SECTION("IReader")
+	{
+		ZstdSeekableReader reader{ BinaryReader{ path } };
+		REQUIRE(reader.size() == static_cast<int64>(data.size()));
+
+		Blob result;
+		result.resize(data.size());
+		REQUIRE(reader.read(result.data(), result.size()) == static_cast<int64>(data.size()));
+		REQUIRE(result == data);
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("ZstdWriter : benchmark")
+{
+	const Blob data = MakeZstdTestData(64 * 1024 * 1024);
+
+	BENCHMARK("Compression::Compress() | 64 MB")
+	{
+		return Compression::Compress(data).size();
+	};
+
+	BENCHMARK("ZstdWriter | 64 MB")
+	{
+		ZstdWriter writer{ MemoryWriter{} };
+		writer.write(data.data(), data.size());
+		writer.close();
+		return writer.compressedSize();
+	};
+
+	BENCHMARK("ZstdWriter | 64 MB, 4 workers")
+	{
+		ZstdWriter writer{ MemoryWriter{}, Compression::DefaultLevel, 4 };
+		writer.write(data.data(), data.size());
+		writer.close();
+		return writer.compressedSize();
+	};
+}
+
+TEST_CASE("ZstdSeekableReader : benchmark")
+{
+	const Blob data = MakeZstdTestData(64 * 1024 * 1024);
+	const FilePath path = U"test/runtime/compression/seekable_benchmark.zst";
+
+	{
+		ZstdSeekableWriter writer{ path };
+		writer.write(data.data(), data.size());
+	}
+
+	ZstdSeekableReader reader{ path };
+
+	BENCHMARK("ZstdReader::setPos() + read() | 64 MB, 100 random positions")
+	{
+		ZstdReader sequentialReader{ BinaryReader{ path } };
+		uint64 sum = 0;
+
+		for (int64 i = 0; i < 100; ++i)
+		{
+			uint8 value;
+			sequentialReader.setPos((i * 7919 * 4093) % static_cast<int64>(data.size()));
+			sequentialReader.read(value);
+			sum += value;
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("ZstdSeekableReader::setPos() + read() | 64 MB, 100 random positions")
+	{
+		uint64 sum = 0;
+
+		for (int64 i = 0; i < 100; ++i)
+		{
+			uint8 value;
+			reader.setPos((i * 7919 * 4093) % static_cast<int64>(data.size()));
+			reader.read(value);
+			sum += value;
+		}
+
+		return sum;
+	};
+}
+
+# endif
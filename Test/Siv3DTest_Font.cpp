@@ -0,0 +1,158 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("Font glyph cache")
+{
+	const Font font{ 24 };
+
+	REQUIRE(font.preload(U"Siv3D"));
+	{
+		const GlyphCacheStat stat = font.getGlyphCacheStat();
+		REQUIRE(stat.pageCount == 1);
+		REQUIRE(stat.hitCount == 0);
+		REQUIRE(stat.missCount != 0);
+		REQUIRE(stat.evictedCount == 0);
+	}
+
+	// キャッシュ済みのグリフは再レンダリングされない
+	const uint64 missCount = font.getGlyphCacheStat().missCount;
+	REQUIRE(font.preload(U"Siv3D"));
+	REQUIRE(font.getGlyphCacheStat().missCount == missCount);
+	REQUIRE(font.getGlyphCacheStat().hitCount == 5);
+
+	// 2 回目以降の転送は変更された領域だけ
+	REQUIRE(font.getTexture());
+	const uint64 uploadedBytes = font.getGlyphCacheStat().uploadedBytes;
+	REQUIRE(uploadedBytes == font.getTexture().size().x * font.getTexture().size().y * sizeof(Color));
+
+	REQUIRE(font.preload(U"OpenSiv3D"));
+	REQUIRE(font.getTexture());
+	REQUIRE(font.getGlyphCacheStat().uploadedBytes < (uploadedBytes * 2));
+}
+
+TEST_CASE("Font glyph cache : getGlyphs() every frame")
+{
+	// getGlyph() の固定はフレームの間だけなので、毎フレーム別のグリフを取得しても、古いシェルフが追い出されて新しいグリフが入る
+	const Font font{ FontMethod::Bitmap, 128, Typeface::CJK_Regular_JP };
+
+	for (char32 frame = 0; frame < 30; ++frame)
+	{
+		System::Update();
+
+		for (char32 i = 0; i < 100; ++i)
+		{
+			const Glyph glyph = font.getGlyph(static_cast<char32>(0x4E00 + (frame * 100) + i));
+			REQUIRE(glyph.texture.size.x != 0);
+		}
+	}
+
+	REQUIRE(font.getGlyphCacheStat().evictedCount != 0);
+}
+
+TEST_CASE("Font shaping cache")
+{
+	const Font font{ 24 };
+	const String text = U"Siv3D 🐈 OpenSiv3D";
+
+	const Array<GlyphCluster> clusters = font.getGlyphClusters(text);
+	REQUIRE(clusters.size() == text.size());
+
+	// キャッシュから返される結果はシェーピングし直した結果と同じ
+	{
+		const Array<GlyphCluster> cached = font.getGlyphClusters(text);
+		REQUIRE(cached.size() == clusters.size());
+
+		for (size_t i = 0; i < clusters.size(); ++i)
+		{
+			REQUIRE(cached[i].glyphIndex == clusters[i].glyphIndex);
+			REQUIRE(cached[i].fontIndex == clusters[i].fontIndex);
+			REQUIRE(cached[i].pos == clusters[i].pos);
+		}
+	}
+
+	// フォールバックフォントを追加するとシェーピングし直す
+	{
+		const Font emoji{ 24, Typeface::ColorEmoji };
+		REQUIRE(font.addFallback(emoji));
+		const Array<GlyphCluster> withFallback = font.getGlyphClusters(text);
+		REQUIRE(withFallback.any([](const GlyphCluster& cluster) { return (cluster.fontIndex == 1); }));
+	}
+
+	// フォールバックフォントが解放された後は、それを参照する結果を返さない
+	REQUIRE(font.getGlyphClusters(text).none([](const GlyphCluster& cluster) { return (cluster.fontIndex == 1); }));
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Font shaping cache : benchmark")
+{
+	const Font font{ 20 };
+	Array<String> labels;
+
+	for (int32 i = 0; i < 2000; ++i)
+	{
+		labels << U"Label {} : Siv3D"_fmt(i);
+	}
+
+	Array<DrawableText> drawableTexts = labels.map([&](const String& label) { return font(label); });
+
+	BENCHMARK("Font::getGlyphClusters() x 2000 (cached)")
+	{
+		size_t count = 0;
+
+		for (const auto& label : labels)
+		{
+			count += font.getGlyphClusters(label + U'!').size();
+		}
+
+		return count;
+	};
+
+	int32 run = 0;
+
+	BENCHMARK("Font::getGlyphClusters() x 2000 (not cached)")
+	{
+		// 毎回異なる文字列にしてキャッシュを外す
+		const String suffix = Format(++run);
+		size_t count = 0;
+
+		for (const auto& label : labels)
+		{
+			count += font.getGlyphClusters(label + suffix).size();
+		}
+
+		return count;
+	};
+
+	BENCHMARK("font(label).draw() x 2000")
+	{
+		for (const auto& label : labels)
+		{
+			font(label).draw();
+		}
+
+		Graphics2D::Flush();
+	};
+
+	BENCHMARK("DrawableText::draw() x 2000")
+	{
+		for (const auto& drawableText : drawableTexts)
+		{
+			drawableText.draw();
+		}
+
+		Graphics2D::Flush();
+	};
+}
+
+# endif
@@ -201,3 +201,321 @@ TEST_CASE("Image")
 		}
 	}
 }
+
+namespace
+{
+	// 点処理の SIMD 版と比較するための、1 ピクセルずつ処理するスカラー版の実装
+	namespace ScalarPointProcessing
+	{
+		Image Grayscaled(Image image)
+		{
+			for (auto& pixel : image)
+			{
+				const uint8 gray = pixel.grayscale0_255();
+				pixel.r = gray;
+				pixel.g = gray;
+				pixel.b = gray;
+			}
+
+			return image;
+		}
+
+		Image Sepiaed(Image image)
+		{
+			for (auto& pixel : image)
+			{
+				const double tr = Min(((0.393 * pixel.r) + (0.769 * pixel.g) + (0.189 * pixel.b)), 255.0);
+				const double tg = Min(((0.349 * pixel.r) + (0.686 * pixel.g) + (0.168 * pixel.b)), 255.0);
+				const double tb = Min(((0.272 * pixel.r) + (0.534 * pixel.g) + (0.131 * pixel.b)), 255.0);
+				pixel.r = static_cast<uint8>(tr);
+				pixel.g = static_cast<uint8>(tg);
+				pixel.b = static_cast<uint8>(tb);
+			}
+
+			return image;
+		}
+
+		Image Brightened(Image image, const int32 level)
+		{
+			for (auto& pixel : image)
+			{
+				pixel.r = static_cast<uint8>(Clamp(static_cast<int32>(pixel.r) + level, 0, 255));
+				pixel.g = static_cast<uint8>(Clamp(static_cast<int32>(pixel.g) + level, 0, 255));
+				pixel.b = static_cast<uint8>(Clamp(static_cast<int32>(pixel.b) + level, 0, 255));
+			}
+
+			return image;
+		}
+
+		Image Thresholded(Image image, const uint8 threshold, const bool invertColor)
+		{
+			const double thresholdF = (threshold / 255.0);
+
+			for (auto& pixel : image)
+			{
+				pixel.setRGB(((thresholdF < pixel.grayscale()) != invertColor) ? 255 : 0);
+			}
+
+			return image;
+		}
+	}
+
+	[[nodiscard]]
+	Image MakeRandomImage(const int32 width, const int32 height)
+	{
+		Image image{ Size{ width, height } };
+
+		for (auto& pixel : image)
+		{
+			pixel = RandomColor();
+			pixel.a = static_cast<uint8>(Random(255));
+		}
+
+		return image;
+	}
+}
+
+TEST_CASE("Image point processing")
+{
+	// 幅を SIMD のレジスタ幅の倍数にせず、複数のタスクに分割される大きさにする
+	const Image image = MakeRandomImage(1027, 131);
+
+	SECTION("negate")
+	{
+		const Image result = image.negated();
+
+		for (size_t i = 0; i < image.num_pixels(); ++i)
+		{
+			REQUIRE(result.data()[i] == ~image.data()[i]);
+		}
+	}
+
+	SECTION("grayscale")
+	{
+		REQUIRE(image.grayscaled().asArray() == ScalarPointProcessing::Grayscaled(image).asArray());
+	}
+
+	SECTION("sepia")
+	{
+		REQUIRE(image.sepiaed().asArray() == ScalarPointProcessing::Sepiaed(image).asArray());
+	}
+
+	SECTION("brighten")
+	{
+		for (const int32 level : { -300, -255, -40, 0, 1, 77, 255, 1000 })
+		{
+			REQUIRE(image.brightened(level).asArray() == ScalarPointProcessing::Brightened(image, level).asArray());
+		}
+	}
+
+	SECTION("threshold")
+	{
+		for (const uint8 threshold : { 0, 1, 100, 128, 254, 255 })
+		{
+			REQUIRE(image.thresholded(threshold).asArray() == ScalarPointProcessing::Thresholded(image, threshold, false).asArray());
+			REQUIRE(image.thresholded(threshold, InvertColor::Yes).asArray() == ScalarPointProcessing::Thresholded(image, threshold, true).asArray());
+		}
+	}
+
+	SECTION("RGBAtoBGRA")
+	{
+		Image result{ image };
+		result.RGBAtoBGRA();
+
+		for (size_t i = 0; i < image.num_pixels(); ++i)
+		{
+			const Color c = image.data()[i];
+			REQUIRE(result.data()[i] == Color{ c.b, c.g, c.r, c.a });
+		}
+	}
+}
+
+TEST_CASE("Image::scaleTo / warpAffineTo")
+{
+	Image image{ Size{ 7, 5 } };
+
+	for (int32 y = 0; y < image.height(); ++y)
+	{
+		for (int32 x = 0; x < image.width(); ++x)
+		{
+			image[y][x] = Color{ static_cast<uint8>(x * 30), static_cast<uint8>(y * 50), static_cast<uint8>((x + y) * 10), 200 };
+		}
+	}
+
+	SECTION("Nearest")
+	{
+		Image dst{ Size{ 14, 10 } };
+		image.scaleTo(dst, InterpolationAlgorithm::Nearest);
+
+		for (int32 y = 0; y < dst.height(); ++y)
+		{
+			for (int32 x = 0; x < dst.width(); ++x)
+			{
+				REQUIRE(dst[y][x] == image[y / 2][x / 2]);
+			}
+		}
+	}
+
+	SECTION("Same size")
+	{
+		for (const auto interpolation : { InterpolationAlgorithm::Linear, InterpolationAlgorithm::Cubic, InterpolationAlgorithm::Area, InterpolationAlgorithm::Lanczos })
+		{
+			Image dst{ image.size() };
+			image.scaleTo(dst, interpolation);
+			REQUIRE(dst.asArray() == image.asArray());
+		}
+	}
+
+	SECTION("ImageROI")
+	{
+		Image dst{ Size{ 20, 20 }, Palette::Black };
+		image.scaleTo(dst(3, 4, 14, 10), InterpolationAlgorithm::Nearest);
+
+		REQUIRE(dst[0][0] == Palette::Black);
+		REQUIRE(dst[4][3] == image[0][0]);
+		REQUIRE(dst[13][16] == image[4][6]);
+		REQUIRE(dst[14][17] == Palette::Black);
+	}
+
+	SECTION("warpAffineTo")
+	{
+		Image dst{ Size{ 10, 8 } };
+		image.warpAffineTo(dst, Mat3x2::Translate(2, 1), Palette::White);
+
+		REQUIRE(dst[0][0] == Palette::White);
+		REQUIRE(dst[1][2] == image[0][0]);
+		REQUIRE(dst[5][8] == image[4][6]);
+	}
+}
+
+TEST_CASE("Image::warpAffineTo / warpPerspectiveTo : OpenCV")
+{
+	// OpenCV を使う warpAffine() / warpPerspective() の結果と、各チャンネル ±1 の範囲で一致する
+	constexpr int32 Tolerance = 1;
+
+	const auto maxDifference = [](const Image& a, const Image& b)
+	{
+		int32 result = 0;
+
+		for (size_t i = 0; i < a.num_pixels(); ++i)
+		{
+			const Color ca = a.data()[i], cb = b.data()[i];
+			result = Max({ result, std::abs(ca.r - cb.r), std::abs(ca.g - cb.g), std::abs(ca.b - cb.b), std::abs(ca.a - cb.a) });
+		}
+
+		return result;
+	};
+
+	const Image image = MakeRandomImage(97, 83);
+	const Color background{ 10, 20, 30, 40 };
+
+	SECTION("warpAffineTo")
+	{
+		const Mat3x2 mat = Mat3x2::Rotate(0.35).scaled(1.3).translated(40.25, 10.5);
+		const Image reference = image.warpAffine(mat, background);
+
+		// warpAffine() は変換後の画像のバウンディングボックスを書き出す
+		const Quad quad{ mat.transformPoint(Point{ 0, 0 }), mat.transformPoint(Point{ image.width(), 0 }),
+			mat.transformPoint(image.size()), mat.transformPoint(Point{ 0, image.height() }) };
+		const RectF boundingRect = Geometry2D::BoundingRect(&quad.p0, 4);
+
+		Image dst{ reference.size() };
+		image.warpAffineTo(dst, mat.translated(-boundingRect.pos), background);
+
+		REQUIRE(maxDifference(dst, reference) <= Tolerance);
+	}
+
+	SECTION("warpPerspectiveTo")
+	{
+		const Quad quad{ Vec2{ 10, 5 }, Vec2{ 130, 20 }, Vec2{ 120, 140 }, Vec2{ 3, 110 } };
+		const Image reference = image.warpPerspective(quad, background);
+
+		Image dst{ reference.size() };
+		image.warpPerspectiveTo(dst, quad.movedBy(-Geometry2D::BoundingRect(&quad.p0, 4).pos), background);
+
+		REQUIRE(maxDifference(dst, reference) <= Tolerance);
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("Image point processing : benchmark")
+{
+	for (const Size size : { Size{ 256, 256 }, Size{ 1920, 1080 }, Size{ 3840, 2160 }, Size{ 7680, 4320 } })
+	{
+		const Image image = MakeRandomImage(size.x, size.y);
+		const String label = U" | {}x{}"_fmt(size.x, size.y);
+
+		BENCHMARK(Unicode::Narrow(U"scalar grayscale" + label))
+		{
+			return ScalarPointProcessing::Grayscaled(image);
+		};
+
+		BENCHMARK(Unicode::Narrow(U"Image::grayscaled()" + label))
+		{
+			return image.grayscaled();
+		};
+
+		BENCHMARK(Unicode::Narrow(U"scalar sepia" + label))
+		{
+			return ScalarPointProcessing::Sepiaed(image);
+		};
+
+		BENCHMARK(Unicode::Narrow(U"Image::sepiaed()" + label))
+		{
+			return image.sepiaed();
+		};
+
+		BENCHMARK(Unicode::Narrow(U"scalar threshold" + label))
+		{
+			return ScalarPointProcessing::Thresholded(image, 128, false);
+		};
+
+		BENCHMARK(Unicode::Narrow(U"Image::thresholded()" + label))
+		{
+			return image.thresholded(128);
+		};
+
+		BENCHMARK(Unicode::Narrow(U"Image::brightened()" + label))
+		{
+			return image.brightened(40);
+		};
+
+		BENCHMARK(Unicode::Narrow(U"Image::negated()" + label))
+		{
+			return image.negated();
+		};
+	}
+}
+
+TEST_CASE("Image::scaleTo() : benchmark")
+{
+	const Image image = MakeRandomImage(7680, 4320);
+	Image dst{ Size{ 1920, 1080 } };
+
+	BENCHMARK("Image::scaled() | 8K -> 2K")
+	{
+		return image.scaled(dst.size(), InterpolationAlgorithm::Area);
+	};
+
+	BENCHMARK("Image::scaleTo() | 8K -> 2K")
+	{
+		image.scaleTo(dst, InterpolationAlgorithm::Area);
+		return dst[0][0];
+	};
+
+	BENCHMARK("Image::warpAffine() | 8K")
+	{
+		return image.warpAffine(Mat3x2::Rotate(0.1, image.size() * 0.5));
+	};
+
+	Image warped{ image.size() };
+
+	BENCHMARK("Image::warpAffineTo() | 8K")
+	{
+		image.warpAffineTo(warped, Mat3x2::Rotate(0.1, image.size() * 0.5));
+		return warped[0][0];
+	};
+}
+
+# endif
@@ -0,0 +1,239 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("JSON::Load()")
+{
+	const String text = U"{\"name\": \"Siv3D くん\", \"values\": [1, 2, 3]}";
+
+	SECTION("UTF-8 bytes")
+	{
+		const std::string utf8 = Unicode::ToUTF8(text);
+
+		const JSON json = JSON::ParseUTF8(utf8);
+		REQUIRE(json);
+		REQUIRE(json == JSON::Parse(text));
+		REQUIRE(json[U"name"].getString() == U"Siv3D くん");
+
+		// BOM は無視される
+		REQUIRE(JSON::ParseUTF8("\xEF\xBB\xBF" + utf8) == json);
+
+		REQUIRE(JSON::Load(Blob{ utf8.data(), utf8.size() }) == json);
+		REQUIRE(JSON::Load(MemoryReader{ Blob{ utf8.data(), utf8.size() } }) == json);
+
+		REQUIRE(not JSON::ParseUTF8("{\"name\": "));
+	}
+
+	SECTION("file")
+	{
+		for (const auto encoding : { TextEncoding::UTF8_NO_BOM, TextEncoding::UTF8_WITH_BOM, TextEncoding::UTF16LE, TextEncoding::UTF16BE })
+		{
+			const FilePath path = FileSystem::FullPath(U"test/runtime/json/load.json");
+
+			{
+				TextWriter writer{ path, encoding };
+				writer.write(text);
+			}
+
+			const JSON json = JSON::Load(path);
+			REQUIRE(json == JSON::Parse(text));
+		}
+	}
+
+	SECTION("empty file")
+	{
+		const FilePath path = FileSystem::FullPath(U"test/runtime/json/empty.json");
+
+		{
+			BinaryWriter writer{ path };
+		}
+
+		// 空のファイルは開けるが、JSON としては無効
+		REQUIRE(FileSystem::FileSize(path) == 0);
+		REQUIRE(not JSON::Load(path));
+	}
+}
+
+namespace
+{
+	struct JSONEventRecorder : IJSONHandler
+	{
+		String events;
+
+		bool onNull() override { events += U"null "; return true; }
+
+		bool onBool(const bool value) override { events += U"{} "_fmt(value); return true; }
+
+		bool onInt(const int64 value) override { events += U"{} "_fmt(value); return true; }
+
+		bool onFloat(const double value) override { events += U"{} "_fmt(value); return true; }
+
+		bool onString(const StringView value) override { events += U"\"{}\" "_fmt(value); return true; }
+
+		bool onBeginObject() override { events += U"{ "; return true; }
+
+		bool onKey(const StringView key) override { events += (key + U": "); return true; }
+
+		bool onEndObject() override { events += U"} "; return true; }
+
+		bool onBeginArray() override { events += U"[ "; return true; }
+
+		bool onEndArray() override { events += U"] "; return true; }
+	};
+}
+
+TEST_CASE("JSONReader")
+{
+	const std::string utf8 = "{\"name\": \"Siv3D くん\", \"values\": [1, -2, 0.5, true, null]}";
+
+	JSONReader reader{ MemoryViewReader{ utf8.data(), utf8.size() } };
+	REQUIRE(reader);
+
+	JSONEventRecorder recorder;
+	REQUIRE(reader.read(recorder));
+	REQUIRE(recorder.events == U"{ name: \"Siv3D くん\" values: [ 1 -2 0.5 true null ] } ");
+
+	// データは一度しか読み込めない
+	REQUIRE(not reader.isOpen());
+
+	const std::string invalid = "{\"values\": [1, }";
+	REQUIRE(not JSONReader{ MemoryViewReader{ invalid.data(), invalid.size() } }.read(recorder));
+}
+
+TEST_CASE("JSONLinesReader")
+{
+	std::string text = "\xEF\xBB\xBF{\"id\": 0}\r\n\n";
+
+	for (int32 i = 1; i < 10000; ++i)
+	{
+		text += fmt::format("{{\"id\": {}, \"name\": \"{}\"}}\n", i, std::string((i % 300), 'x'));
+	}
+
+	text += "{\"id\": ";
+
+	JSONLinesReader reader{ MemoryViewReader{ text.data(), text.size() } };
+	REQUIRE(reader);
+
+	Array<JSON> values;
+	int64 sum = 0;
+	size_t numLines = 0;
+	size_t numInvalid = 0;
+
+	while (const size_t count = reader.readBatch(values, 1000))
+	{
+		for (const auto& value : values)
+		{
+			if (value)
+			{
+				sum += value[U"id"].get<int64>();
+			}
+			else
+			{
+				++numInvalid;
+			}
+		}
+
+		numLines += count;
+	}
+
+	// 空行は読み飛ばし、パースに失敗した行は無効な JSON になる
+	REQUIRE(numLines == 10001);
+	REQUIRE(numInvalid == 1);
+	REQUIRE(sum == (9999 * 10000 / 2));
+	REQUIRE(reader.lineNumber() == 10002);
+
+	// 1 行ずつ読み込んでも同じ結果になる
+	JSONLinesReader reader2{ MemoryViewReader{ text.data(), text.size() } };
+	numLines = 0;
+
+	while (reader2.readLine())
+	{
+		++numLines;
+	}
+
+	REQUIRE(numLines == 10001);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("JSON::Load() : benchmark")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/json/benchmark.json");
+
+	{
+		JSON json;
+
+		for (int32 i = 0; i < 100000; ++i)
+		{
+			json[U"items"].push_back({ { U"id", i }, { U"name", U"アイテム {}"_fmt(i) }, { U"position", Array<double>{ (i * 0.5), (i * 0.25) } } });
+		}
+
+		json.save(path);
+	}
+
+	BENCHMARK("TextReader::readAll() + JSON::Parse()")
+	{
+		return JSON::Parse(TextReader{ path }.readAll());
+	};
+
+	BENCHMARK("JSON::Load()")
+	{
+		return JSON::Load(path);
+	};
+
+	const Blob blob{ path };
+
+	BENCHMARK("JSON::Load(Blob)")
+	{
+		return JSON::Load(blob);
+	};
+}
+
+TEST_CASE("JSONLinesReader : benchmark")
+{
+	std::string text;
+
+	for (int32 i = 0; i < 200000; ++i)
+	{
+		text += fmt::format("{{\"id\": {}, \"position\": [{}, {}], \"tags\": [\"a\", \"b\", \"c\"]}}\n", i, (i * 0.5), (i * 0.25));
+	}
+
+	BENCHMARK("JSONLinesReader::readLine() x 200000")
+	{
+		JSONLinesReader reader{ MemoryViewReader{ text.data(), text.size() } };
+		JSON value;
+		size_t count = 0;
+
+		while (reader.readLine(value))
+		{
+			++count;
+		}
+
+		return count;
+	};
+
+	BENCHMARK("JSONLinesReader::readBatch() x 200000")
+	{
+		JSONLinesReader reader{ MemoryViewReader{ text.data(), text.size() } };
+		Array<JSON> values;
+		size_t count = 0;
+
+		while (const size_t n = reader.readBatch(values))
+		{
+			count += n;
+		}
+
+		return count;
+	};
+}
+
+# endif
@@ -0,0 +1,154 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	Array<Vec2> MakeRandomPoints(const size_t count, const uint64 seed)
+	{
+		SmallRNG rng{ seed };
+
+		Array<Vec2> points(count);
+
+		for (auto& point : points)
+		{
+			point = RandomVec2(RectF{ 1000, 1000 }, rng);
+		}
+
+		return points;
+	}
+}
+
+TEST_CASE("KDTree::knnSearchBatch / radiusSearchBatch")
+{
+	const Array<Vec2> points = MakeRandomPoints(20000, 1);
+	const Array<Vec2> queries = MakeRandomPoints(2000, 2);
+	const KDTree<Vec2Adapter> tree{ points };
+
+	Array<size_t> results;
+	const size_t k = tree.knnSearchBatch(results, 8, queries);
+	REQUIRE(k == 8);
+	REQUIRE(results.size() == (queries.size() * k));
+
+	Array<size_t> offsets;
+	Array<size_t> radiusResults;
+	tree.radiusSearchBatch(radiusResults, offsets, queries, 30.0, SortByDistance::Yes);
+	REQUIRE(offsets.size() == (queries.size() + 1));
+
+	// 1 つずつ検索した場合と同じ結果になる
+	for (size_t i = 0; i < queries.size(); ++i)
+	{
+		REQUIRE(tree.knnSearch(k, queries[i]) == Array<size_t>((results.begin() + (i * k)), (results.begin() + ((i + 1) * k))));
+		REQUIRE(tree.radiusSearch(queries[i], 30.0, SortByDistance::Yes) == Array<size_t>((radiusResults.begin() + offsets[i]), (radiusResults.begin() + offsets[i + 1])));
+	}
+}
+
+TEST_CASE("DynamicKDTree")
+{
+	const Array<Vec2> allPoints = MakeRandomPoints(10000, 3);
+	const Array<Vec2> queries = MakeRandomPoints(500, 4);
+
+	Array<Vec2> points(allPoints.begin(), (allPoints.begin() + 5000));
+	DynamicKDTree<Vec2Adapter> tree{ points };
+	REQUIRE(tree.size() == 5000);
+
+	points.insert(points.end(), (allPoints.begin() + 5000), allPoints.end());
+	tree.addPoints(5000);
+
+	for (size_t i = 0; i < points.size(); i += 2)
+	{
+		tree.removePoint(i);
+	}
+
+	REQUIRE(tree.size() == 5000);
+
+	Array<size_t> results;
+	const size_t k = tree.knnSearchBatch(results, 4, queries);
+	REQUIRE(k == 4);
+
+	Array<size_t> offsets;
+	Array<size_t> radiusResults;
+	tree.radiusSearchBatch(radiusResults, offsets, queries, 40.0, SortByDistance::Yes);
+
+	// 削除されていない要素を総当たりで調べた結果と一致する
+	for (size_t i = 0; i < queries.size(); ++i)
+	{
+		Array<std::pair<double, size_t>> candidates;
+
+		for (size_t n = 1; n < points.size(); n += 2)
+		{
+			candidates.emplace_back(points[n].distanceFromSq(queries[i]), n);
+		}
+
+		candidates.sort();
+
+		Array<size_t> expectedRadius;
+
+		for (const auto& candidate : candidates)
+		{
+			if (candidate.first <= (40.0 * 40.0))
+			{
+				expectedRadius << candidate.second;
+			}
+		}
+
+		for (size_t n = 0; n < k; ++n)
+		{
+			REQUIRE(results[(i * k) + n] == candidates[n].second);
+		}
+
+		REQUIRE(Array<size_t>((radiusResults.begin() + offsets[i]), (radiusResults.begin() + offsets[i + 1])) == expectedRadius);
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("KDTree : benchmark")
+{
+	const Array<Vec2> points = MakeRandomPoints(100000, 5);
+	KDTree<Vec2Adapter> tree{ points };
+
+	BENCHMARK("KDTree::rebuildIndex() x 100000")
+	{
+		tree.rebuildIndex();
+	};
+
+	BENCHMARK("KDTree::knnSearch() x 100000")
+	{
+		Array<size_t> results;
+		size_t sum = 0;
+
+		for (const auto& point : points)
+		{
+			tree.knnSearch(results, 8, point);
+			sum += results.size();
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("KDTree::knnSearchBatch() x 100000")
+	{
+		Array<size_t> results;
+		return tree.knnSearchBatch(results, 8, points);
+	};
+
+	BENCHMARK("KDTree::radiusSearchBatch() x 100000")
+	{
+		Array<size_t> results, offsets;
+		tree.radiusSearchBatch(results, offsets, points, 5.0);
+		return results.size();
+	};
+}
+
+# endif
@@ -0,0 +1,295 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	// n x n マスの格子状の地形を作る。一定間隔で壁（歩けないマス）を置く
+	void MakeGridMap(const int32 n, const float cellSize, Array<Float2>& vertices, Array<TriangleIndex>& indices)
+	{
+		for (int32 y = 0; y <= n; ++y)
+		{
+			for (int32 x = 0; x <= n; ++x)
+			{
+				vertices.emplace_back((x * cellSize), (y * cellSize));
+			}
+		}
+
+		for (int32 y = 0; y < n; ++y)
+		{
+			for (int32 x = 0; x < n; ++x)
+			{
+				if (((x % 7) == 3) && ((y % 5) != 0))
+				{
+					continue;
+				}
+
+				const auto i0 = static_cast<TriangleIndex::value_type>(y * (n + 1) + x);
+				const auto i1 = static_cast<TriangleIndex::value_type>(i0 + 1);
+				const auto i2 = static_cast<TriangleIndex::value_type>(i0 + (n + 1));
+				const auto i3 = static_cast<TriangleIndex::value_type>(i2 + 1);
+				indices << TriangleIndex{ i0, i2, i1 } << TriangleIndex{ i1, i2, i3 };
+			}
+		}
+	}
+
+	// 壁のないマスの中心どうしを結ぶ出発地点と目的地の組を作る
+	[[nodiscard]]
+	Array<std::pair<Vec2, Vec2>> MakeStartEnds(const size_t count, const int32 n, const double cellSize)
+	{
+		const auto cellCenter = [=](int32 x, const int32 y)
+		{
+			if ((x % 7) == 3)
+			{
+				++x;
+			}
+
+			return Vec2{ ((x + 0.5) * cellSize), ((y + 0.5) * cellSize) };
+		};
+
+		Array<std::pair<Vec2, Vec2>> startEnds(Arg::reserve = count);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const int32 k = static_cast<int32>(i);
+			startEnds.emplace_back(cellCenter(((k * 13) % (n - 1)), ((k * 29) % n)), cellCenter(((k * 47) % (n - 1)), ((k * 11) % n)));
+		}
+
+		return startEnds;
+	}
+}
+
+TEST_CASE("NavMesh")
+{
+	Array<Float2> vertices;
+	Array<TriangleIndex> indices;
+	MakeGridMap(60, 8.0f, vertices, indices);
+
+	const Array<std::pair<Vec2, Vec2>> startEnds = MakeStartEnds(100, 60, 8.0);
+
+	NavMeshConfig tiledConfig;
+	tiledConfig.tileSize = 64;
+
+	const NavMesh single{ vertices, indices };
+	const NavMesh tiled{ vertices, indices, tiledConfig };
+	REQUIRE(single.isValid());
+	REQUIRE(tiled.isValid());
+
+	SECTION("tiled")
+	{
+		// タイルに分割しても、同じ地点どうしの経路が見つかる
+		for (const auto& [start, end] : startEnds)
+		{
+			REQUIRE(single.query(start, end).isEmpty() == tiled.query(start, end).isEmpty());
+		}
+	}
+
+	SECTION("batched query")
+	{
+		for (const NavMesh* navMesh : { &single, &tiled })
+		{
+			const Array<Array<Vec2>> paths = navMesh->query(startEnds);
+			REQUIRE(paths.size() == startEnds.size());
+
+			for (size_t i = 0; i < startEnds.size(); ++i)
+			{
+				REQUIRE(paths[i] == navMesh->query(startEnds[i].first, startEnds[i].second));
+			}
+		}
+	}
+
+	SECTION("save / load")
+	{
+		const FilePath path = U"test/runtime/navmesh/tiled.bin";
+		REQUIRE(tiled.save(path));
+
+		NavMesh loaded;
+		REQUIRE(loaded.load(path));
+
+		for (const auto& [start, end] : startEnds)
+		{
+			REQUIRE(loaded.query(start, end) == tiled.query(start, end));
+		}
+
+		// 壊れたデータは読み込めない
+		REQUIRE_FALSE(loaded.load(Blob{ U"abcd", 8 }));
+		REQUIRE_FALSE(loaded.isValid());
+		REQUIRE(NavMesh{}.toBlob().isEmpty());
+
+		// 途中で切れたデータは読み込めない
+		const Blob blob = single.toBlob();
+
+		for (size_t size = 0; size < blob.size(); size += 97)
+		{
+			REQUIRE_FALSE(loaded.load(Blob{ blob.data(), size }));
+		}
+
+		// タイルのデータが、タイルのヘッダに記録されている要素数より短い場合も読み込めない。
+		// toBlob() の形式は、ヘッダ（40 バイト）、タイルの dtTileRef（4 バイト）とデータサイズ（4 バイト）、タイルのデータ
+		{
+			constexpr size_t DataSizeOffset = 44;
+			constexpr int32 TrimmedSize = 64;
+
+			Blob truncated{ blob.data(), (blob.size() - TrimmedSize) };
+			int32 dataSize = 0;
+			std::memcpy(&dataSize, (truncated.data() + DataSizeOffset), sizeof(dataSize));
+			REQUIRE(dataSize == static_cast<int32>(blob.size() - DataSizeOffset - sizeof(int32)));
+
+			dataSize -= TrimmedSize;
+			std::memcpy((truncated.data() + DataSizeOffset), &dataSize, sizeof(dataSize));
+			REQUIRE_FALSE(loaded.load(truncated));
+		}
+
+		REQUIRE(loaded.load(blob));
+	}
+}
+
+TEST_CASE("NavMeshCrowd")
+{
+	Array<Float2> vertices;
+	Array<TriangleIndex> indices;
+	MakeGridMap(30, 8.0f, vertices, indices);
+
+	const NavMesh navMesh{ vertices, indices };
+	REQUIRE(navMesh.isValid());
+
+	NavMeshAgentConfig config;
+	config.radius = 1.0;
+	config.maxSpeed = 20.0;
+	config.maxAcceleration = 40.0;
+
+	NavMeshCrowd crowd{ navMesh };
+	Array<NavMeshAgentID> ids;
+
+	for (const auto& [start, end] : MakeStartEnds(50, 30, 8.0))
+	{
+		const Optional<NavMeshAgentID> id = crowd.addAgent(start, config);
+		REQUIRE(id);
+		REQUIRE(crowd.setTarget(*id, end));
+		ids << *id;
+	}
+
+	SECTION("agents")
+	{
+		// ナビメッシュから離れた位置には追加できない
+		REQUIRE_FALSE(crowd.addAgent(Vec2{ -100, -100 }, config));
+
+		REQUIRE(crowd.num_agents() == 50);
+		REQUIRE(crowd.removeAgent(ids[3]));
+		REQUIRE_FALSE(crowd.removeAgent(ids[3]));
+		REQUIRE_FALSE(crowd.hasAgent(ids[3]));
+		REQUIRE(crowd.hasAgent(ids.back()));
+		REQUIRE(crowd.num_agents() == 49);
+		REQUIRE(crowd.getPositions().size() == crowd.getAgentIDs().size());
+
+		crowd.clear();
+		REQUIRE(crowd.num_agents() == 0);
+	}
+
+	SECTION("update")
+	{
+		for (int32 i = 0; i < 1200; ++i)
+		{
+			crowd.update(1.0 / 60.0);
+		}
+
+		// すべてのエージェントが目的地に到着する
+		for (const NavMeshAgentID id : ids)
+		{
+			REQUIRE(crowd.hasArrived(id));
+		}
+
+		// エージェントどうしは大きく重ならない
+		const Array<Vec2>& positions = crowd.getPositions();
+
+		for (size_t i = 0; i < positions.size(); ++i)
+		{
+			for (size_t k = (i + 1); k < positions.size(); ++k)
+			{
+				REQUIRE(1.5 <= positions[i].distanceFrom(positions[k]));
+			}
+		}
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("NavMesh : benchmark")
+{
+	Array<Float2> vertices;
+	Array<TriangleIndex> indices;
+	MakeGridMap(240, 4.0f, vertices, indices);
+
+	BENCHMARK("NavMesh::build() | single tile")
+	{
+		return NavMesh{ vertices, indices }.isValid();
+	};
+
+	NavMeshConfig tiledConfig;
+	tiledConfig.tileSize = 64;
+
+	BENCHMARK("NavMesh::build() | tileSize = 64")
+	{
+		return NavMesh{ vertices, indices, tiledConfig }.isValid();
+	};
+
+	const NavMesh navMesh{ vertices, indices, tiledConfig };
+	const Blob blob = navMesh.toBlob();
+
+	BENCHMARK("NavMesh::load()")
+	{
+		return NavMesh{}.load(blob);
+	};
+
+	const Array<std::pair<Vec2, Vec2>> startEnds = MakeStartEnds(4096, 240, 4.0);
+
+	BENCHMARK("NavMesh::query() | 4096 paths, one by one")
+	{
+		size_t count = 0;
+
+		for (const auto& [start, end] : startEnds)
+		{
+			count += navMesh.query(start, end).size();
+		}
+
+		return count;
+	};
+
+	Array<Array<Vec2>> paths;
+
+	BENCHMARK("NavMesh::query() | 4096 paths, batched")
+	{
+		navMesh.query(startEnds, paths);
+		return paths.size();
+	};
+
+	for (const size_t num_agents : { 1'000, 10'000 })
+	{
+		NavMeshCrowd crowd{ navMesh };
+
+		for (const auto& [start, end] : MakeStartEnds(num_agents, 240, 4.0))
+		{
+			if (const auto id = crowd.addAgent(start))
+			{
+				crowd.setTarget(*id, end);
+			}
+		}
+
+		BENCHMARK(std::string{ "NavMeshCrowd::update() | " } + std::to_string(num_agents) + " agents")
+		{
+			crowd.update(1.0 / 60.0);
+			return crowd.getPositions().size();
+		};
+	}
+}
+
+# endif
@@ -0,0 +1,72 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	ParticleSystem2D MakeParticleSystem(const size_t maxParticles, const double rate)
+	{
+		ParticleSystem2DParameters parameters;
+		parameters.rate = rate;
+		parameters.maxParticles = static_cast<double>(maxParticles);
+		parameters.startLifeTime = 2.0;
+
+		return ParticleSystem2D{ Vec2{ 400, 300 }, Vec2{ 0, 100 }, CircleEmitter2D{}, parameters, Texture{} };
+	}
+}
+
+TEST_CASE("ParticleSystem2D")
+{
+	ParticleSystem2D particleSystem = MakeParticleSystem(500, 1000.0);
+	REQUIRE(particleSystem.num_particles() == 0);
+
+	// 上限を超えた分は古いものから削除される
+	particleSystem.prewarm();
+	REQUIRE(particleSystem.num_particles() == 500);
+
+	for (int32 i = 0; i < 10; ++i)
+	{
+		particleSystem.update(1.0 / 60.0);
+		REQUIRE(particleSystem.num_particles() == 500);
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("ParticleSystem2D : benchmark")
+{
+	// 1 秒あたり N / 2 個を発生させ、寿命 2 秒で N 個前後を維持する
+	for (const size_t N : { 10'000, 100'000, 1'000'000 })
+	{
+		ParticleSystem2D particleSystem = MakeParticleSystem(N, (N / 2.0));
+		particleSystem.prewarm();
+
+		const String label = U" | {} particles"_fmt(N);
+
+		BENCHMARK(Unicode::Narrow(U"ParticleSystem2D::update()" + label))
+		{
+			particleSystem.update(1.0 / 60.0);
+			return particleSystem.num_particles();
+		};
+
+		// 頂点バッファが際限なく伸びないよう、毎回描画コマンドを消化する
+		BENCHMARK(Unicode::Narrow(U"ParticleSystem2D::draw() + Graphics2D::Flush()" + label))
+		{
+			particleSystem.draw();
+			Graphics2D::Flush();
+			return particleSystem.num_particles();
+		};
+	}
+}
+
+# endif
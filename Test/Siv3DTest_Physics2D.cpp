@@ -0,0 +1,175 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	// 200 列の格子状に並べた num_bodies 個の座標を返す
+	[[nodiscard]]
+	Array<Vec2> MakeGrid(const size_t num_bodies)
+	{
+		Array<Vec2> positions(Arg::reserve = num_bodies);
+		const size_t columns = 200;
+
+		for (size_t i = 0; i < num_bodies; ++i)
+		{
+			positions.emplace_back(((static_cast<double>(i % columns) - columns / 2.0) * 12.0), (-20.0 - 12.0 * static_cast<double>(i / columns)));
+		}
+
+		return positions;
+	}
+
+	// 地面の上に num_bodies 個の物体を積み上げる
+	[[nodiscard]]
+	Array<P2Body> MakePile(P2World& world, const size_t num_bodies, Array<P2Body>& ground)
+	{
+		ground << world.createRect(P2BodyType::Static, Vec2{ 0, 0 }, SizeF{ 20000, 10 });
+
+		const Array<Vec2> positions = MakeGrid(num_bodies);
+		Array<P2Body> bodies(Arg::reserve = num_bodies);
+
+		for (size_t i = 0; i < positions.size(); ++i)
+		{
+			if (i % 2)
+			{
+				bodies << world.createRect(P2BodyType::Dynamic, positions[i], 10.0);
+			}
+			else
+			{
+				bodies << world.createCircle(P2BodyType::Dynamic, positions[i], 5.0);
+			}
+		}
+
+		return bodies;
+	}
+}
+
+TEST_CASE("P2World::updateFixed()")
+{
+	P2World world;
+	const P2Body body = world.createCircle(P2BodyType::Dynamic, Vec2{ 0, 0 }, 10);
+
+	// 余った時間は持ち越される
+	REQUIRE(world.updateFixed((1.0 / 60.0), (1.5 / 60.0)) == 1);
+	REQUIRE(world.getInterpolationAlpha() == Approx(0.5));
+	REQUIRE(world.updateFixed((1.0 / 60.0), (1.0 / 60.0)) == 1);
+	REQUIRE(world.getStat().stepCount == 1);
+
+	// maxSteps を超える分は切り捨てられる
+	REQUIRE(world.updateFixed((1.0 / 60.0), 1.0, 4) == 4);
+	REQUIRE(world.getInterpolationAlpha() < 1.0);
+
+	const Vec2 previousPos = body.getInterpolatedPos(0.0);
+	const Vec2 currentPos = body.getInterpolatedPos(1.0);
+	REQUIRE(currentPos.distanceFrom(body.getPos()) < 1e-3);
+	REQUIRE(previousPos.y < currentPos.y);
+
+	world.update();
+	REQUIRE(world.getInterpolationAlpha() == 1.0);
+	REQUIRE(world.getStat().bodyCount == 1);
+}
+
+TEST_CASE("P2World::createCircles() / P2World::getTransforms()")
+{
+	P2World world;
+	const P2Body ground = world.createRect(P2BodyType::Static, Vec2{ 0, 0 }, SizeF{ 20000, 10 });
+	const Array<Vec2> positions = MakeGrid(1000);
+	const Array<P2Body> circles = world.createCircles(P2BodyType::Dynamic, positions, 5.0);
+	const Array<P2Body> rects = world.createRects(P2BodyType::Dynamic, positions.map([](const Vec2& pos) { return pos.movedBy(0, -2400); }), SizeF{ 10, 10 });
+
+	REQUIRE(circles.size() == positions.size());
+	REQUIRE(rects.size() == positions.size());
+	REQUIRE(circles.front().getPos() == positions.front());
+	REQUIRE(rects.back().shape(0).getShapeType() == P2ShapeType::Rect);
+
+	for (int32 i = 0; i < 10; ++i)
+	{
+		world.update(1.0 / 60.0);
+	}
+
+	// 物体は作成した順に並ぶ
+	Array<P2BodyTransform> transforms;
+	world.getTransforms(transforms);
+	REQUIRE(transforms.size() == (1 + circles.size() + rects.size()));
+	REQUIRE(transforms.front().id == ground.id());
+
+	for (size_t i = 0; i < circles.size(); ++i)
+	{
+		const P2BodyTransform& transform = transforms[1 + i];
+		REQUIRE(transform.id == circles[i].id());
+		REQUIRE(transform.pos == circles[i].getPos());
+		REQUIRE(transform.angle == circles[i].getAngle());
+	}
+
+	REQUIRE(transforms.back().id == rects.back().id());
+}
+
+TEST_CASE("P2World::setParallelEnabled()")
+{
+	// 接触の数が並列処理のしきい値（1,024）を超えるワールドを、並列処理あり・なしで同じだけ進める
+	P2World serialWorld;
+	P2World parallelWorld;
+	Array<P2Body> serialGround, parallelGround;
+	const Array<P2Body> serialBodies = MakePile(serialWorld, 2000, serialGround);
+	const Array<P2Body> parallelBodies = MakePile(parallelWorld, 2000, parallelGround);
+
+	serialWorld.setParallelEnabled(false);
+	REQUIRE_FALSE(serialWorld.getParallelEnabled());
+	REQUIRE(parallelWorld.getParallelEnabled());
+
+	for (int32 i = 0; i < 120; ++i)
+	{
+		serialWorld.update(1.0 / 60.0);
+		parallelWorld.update(1.0 / 60.0);
+	}
+
+	REQUIRE(1024 <= parallelWorld.getStat().contactCount);
+	REQUIRE(parallelWorld.getStat().contactCount == serialWorld.getStat().contactCount);
+
+	// 並列に処理しても、結果はビット単位で一致する
+	Array<P2BodyTransform> serialTransforms, parallelTransforms;
+	serialWorld.getTransforms(serialTransforms);
+	parallelWorld.getTransforms(parallelTransforms);
+	REQUIRE(serialTransforms.size() == parallelTransforms.size());
+
+	for (size_t i = 0; i < serialTransforms.size(); ++i)
+	{
+		REQUIRE(serialTransforms[i].pos == parallelTransforms[i].pos);
+		REQUIRE(serialTransforms[i].angle == parallelTransforms[i].angle);
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("P2World : benchmark")
+{
+	for (const size_t N : { 2'000, 20'000 })
+	{
+		P2World world;
+		Array<P2Body> ground;
+		const Array<P2Body> bodies = MakePile(world, N, ground);
+
+		// 物体が地面に積み重なるまで進めておく
+		for (int32 i = 0; i < 120; ++i)
+		{
+			world.update(1.0 / 60.0);
+		}
+
+		BENCHMARK(Unicode::Narrow(U"P2World::update() | {} bodies"_fmt(N)))
+		{
+			world.update(1.0 / 60.0);
+			return world.getStat().stepTime;
+		};
+	}
+}
+
+# endif
@@ -0,0 +1,79 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	void ProfiledInner()
+	{
+		SIV3D_PROFILE_SCOPE(U"Test::Inner");
+		System::Sleep(1ms);
+	}
+
+	void ProfiledOuter()
+	{
+		SIV3D_PROFILE_SCOPE(U"Test::\"Outer\"");
+		ProfiledInner();
+		ProfiledInner();
+	}
+}
+
+TEST_CASE("Profiler::ExportChromeTrace")
+{
+	const FilePath path = FileSystem::FullPath(U"test/runtime/profiler/trace.json");
+
+	Profiler::ClearScopeProfile();
+	Profiler::EnableScopeProfiler(false);
+	ProfiledOuter();
+
+	Profiler::EnableScopeProfiler(true);
+	REQUIRE(Profiler::IsScopeProfilerEnabled());
+
+	ProfiledOuter();
+	Threading::ParallelFor(8, [](size_t) { ProfiledInner(); }, 1);
+
+	Profiler::EnableScopeProfiler(false);
+	REQUIRE(Profiler::ExportChromeTrace(path));
+
+	const JSON json = JSON::Load(path);
+	REQUIRE(json);
+	REQUIRE(json[U"traceEvents"].isArray());
+
+	size_t outerCount = 0, innerCount = 0;
+
+	for (const auto& event : json[U"traceEvents"].arrayView())
+	{
+		if (event[U"ph"].getString() != U"X")
+		{
+			continue;
+		}
+
+		const String name = event[U"name"].getString();
+
+		if (name == U"Test::\"Outer\"")
+		{
+			++outerCount;
+			REQUIRE(event[U"args"][U"depth"].get<int32>() == 0);
+			REQUIRE(1000.0 <= event[U"dur"].get<double>());
+		}
+		else if (name == U"Test::Inner")
+		{
+			++innerCount;
+		}
+	}
+
+	// 無効な間に実行したスコープは記録されない
+	REQUIRE(outerCount == 1);
+	REQUIRE(innerCount == 10);
+
+	Profiler::ClearScopeProfile();
+}
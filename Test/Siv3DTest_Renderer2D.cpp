@@ -0,0 +1,50 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	// N 個の長方形を描いたフレームの統計を返す
+	[[nodiscard]]
+	ProfilerStat DrawRects(const int32 n)
+	{
+		System::Update();
+
+		for (int32 i = 0; i < n; ++i)
+		{
+			RectF{ (i % 100), (i / 100), 1 }.draw();
+		}
+
+		System::Update();
+
+		return Profiler::GetStat();
+	}
+}
+
+TEST_CASE("ProfilerStat::batchCount / uploadedBytes")
+{
+	// 1 バッチあたりの頂点数の上限（65,535）を超える量を描く
+	constexpr int32 N = 20000;
+
+	// 長方形 1 個は 4 頂点と 6 インデックス
+	constexpr size_t RectBytes = ((sizeof(Vertex2D) * 4) + (sizeof(Vertex2D::IndexType) * 6));
+
+	// バッチの分け方や転送の単位はバックエンドによって異なるため、不変条件だけを確かめる
+	const ProfilerStat stat = DrawRects(N);
+	REQUIRE(0 < stat.batchCount);
+	REQUIRE((N * RectBytes) <= stat.uploadedBytes);
+
+	const ProfilerStat stat2 = DrawRects(N * 2);
+	REQUIRE(0 < stat2.batchCount);
+	REQUIRE((N * 2 * RectBytes) <= stat2.uploadedBytes);
+	REQUIRE(stat.uploadedBytes < stat2.uploadedBytes);
+}
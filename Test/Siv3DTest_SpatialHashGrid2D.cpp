@@ -0,0 +1,216 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	bool OverlapsInclusive(const RectF& a, const RectF& b) noexcept
+	{
+		return (a.x <= (b.x + b.w))
+			&& (b.x <= (a.x + a.w))
+			&& (a.y <= (b.y + b.h))
+			&& (b.y <= (a.y + a.h));
+	}
+}
+
+TEST_CASE("SpatialHashGrid2D")
+{
+	SmallRNG rng{ 12345 };
+
+	SpatialHashGrid2D<int32> grid{ 32.0 };
+	Array<RectF> rects;
+
+	for (int32 i = 0; i < 2000; ++i)
+	{
+		const Vec2 pos = RandomVec2(RectF{ -500, -500, 2000, 2000 }, rng);
+
+		if (i % 2)
+		{
+			const Circle circle{ pos, Random(1.0, 40.0, rng) };
+			grid.add(i, circle);
+			rects << circle.boundingRect();
+		}
+		else
+		{
+			// 多くのセルにまたがる大きな要素も混ぜる
+			const RectF rect{ pos, Random(1.0, ((i % 100 == 0) ? 800.0 : 40.0), rng), Random(1.0, 40.0, rng) };
+			grid.add(i, rect);
+			rects << rect;
+		}
+	}
+
+	grid.build();
+	REQUIRE(grid.size() == 2000);
+
+	SECTION("query")
+	{
+		for (int32 n = 0; n < 200; ++n)
+		{
+			const RectF queryRect{ RandomVec2(RectF{ -500, -500, 2000, 2000 }, rng), Random(1.0, 300.0, rng), Random(1.0, 300.0, rng) };
+
+			Array<int32> expected;
+
+			for (int32 i = 0; i < 2000; ++i)
+			{
+				if (OverlapsInclusive(rects[i], queryRect))
+				{
+					expected << i;
+				}
+			}
+
+			// 重複なく、すべての要素が見つかる
+			REQUIRE(grid.query(queryRect).sorted() == expected);
+		}
+	}
+
+	SECTION("query (Circle)")
+	{
+		for (int32 n = 0; n < 200; ++n)
+		{
+			const Circle queryCircle{ RandomVec2(RectF{ -500, -500, 2000, 2000 }, rng), Random(1.0, 200.0, rng) };
+
+			Array<int32> expected;
+
+			for (int32 i = 0; i < 2000; ++i)
+			{
+				if (rects[i].intersects(queryCircle))
+				{
+					expected << i;
+				}
+			}
+
+			REQUIRE(grid.query(queryCircle).sorted() == expected);
+		}
+	}
+
+	SECTION("query (Polygon)")
+	{
+		for (int32 n = 0; n < 200; ++n)
+		{
+			// 凹多角形。バウンディングボックスには入るが、多角形とは交差しない要素がある
+			const Polygon queryPolygon = Shape2D::Star(Random(10.0, 300.0, rng), RandomVec2(RectF{ -500, -500, 2000, 2000 }, rng), Random(Math::TwoPi, rng)).asPolygon();
+
+			Array<int32> expected;
+
+			for (int32 i = 0; i < 2000; ++i)
+			{
+				if (rects[i].intersects(queryPolygon))
+				{
+					expected << i;
+				}
+			}
+
+			REQUIRE(grid.query(queryPolygon).sorted() == expected);
+		}
+	}
+
+	SECTION("findPairs")
+	{
+		Array<std::pair<int32, int32>> expected;
+
+		for (int32 i = 0; i < 2000; ++i)
+		{
+			for (int32 k = (i + 1); k < 2000; ++k)
+			{
+				if (OverlapsInclusive(rects[i], rects[k]))
+				{
+					expected.emplace_back(i, k);
+				}
+			}
+		}
+
+		const auto pairs = grid.findPairs();
+		REQUIRE(pairs.sorted() == expected);
+
+		// 並列に処理しても結果の順序は変わらない
+		REQUIRE(grid.findPairs() == pairs);
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("SpatialHashGrid2D : benchmark")
+{
+	// 毎回すべての点が移動する想定で、再構築と 10,000 回の半径検索を計測する
+	constexpr size_t NumQueries = 10000;
+	constexpr double Radius = 20.0;
+
+	for (const size_t N : { 10'000, 100'000, 1'000'000 })
+	{
+		const double side = (std::sqrt(static_cast<double>(N)) * 10.0);
+		SmallRNG rng{ N };
+
+		Array<Vec2> points(N);
+
+		for (auto& point : points)
+		{
+			point = RandomVec2(RectF{ side, side }, rng);
+		}
+
+		const String label = U" | {} points"_fmt(N);
+
+		BENCHMARK(Unicode::Narrow(U"KDTree rebuild + radiusSearch()" + label))
+		{
+			KDTree<Vec2Adapter> tree{ points };
+			Array<size_t> results;
+			size_t count = 0;
+
+			for (size_t i = 0; i < NumQueries; ++i)
+			{
+				tree.radiusSearch(results, points[i], Radius);
+				count += results.size();
+			}
+
+			return count;
+		};
+
+		BENCHMARK(Unicode::Narrow(U"SpatialHashGrid2D rebuild + query()" + label))
+		{
+			SpatialHashGrid2D<uint32> grid{ Radius };
+
+			for (size_t i = 0; i < N; ++i)
+			{
+				grid.add(static_cast<uint32>(i), points[i]);
+			}
+
+			grid.build();
+
+			Array<uint32> results;
+			size_t count = 0;
+
+			for (size_t i = 0; i < NumQueries; ++i)
+			{
+				grid.query(results, Circle{ points[i], Radius });
+				count += results.size();
+			}
+
+			return count;
+		};
+
+		BENCHMARK(Unicode::Narrow(U"SpatialHashGrid2D rebuild + findPairs()" + label))
+		{
+			SpatialHashGrid2D<uint32> grid{ Radius };
+
+			for (size_t i = 0; i < N; ++i)
+			{
+				grid.add(static_cast<uint32>(i), Circle{ points[i], (Radius * 0.5) });
+			}
+
+			grid.build();
+
+			return grid.findPairs().size();
+		};
+	}
+}
+
+# endif
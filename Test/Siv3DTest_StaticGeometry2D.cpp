@@ -0,0 +1,158 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	// 円・角丸長方形・線分を合わせて count 個並べた静的なシーン
+	template <class CircleFunc, class RoundRectFunc, class LineFunc>
+	void ForEachStaticShape(const int32 count, CircleFunc onCircle, RoundRectFunc onRoundRect, LineFunc onLine)
+	{
+		for (int32 i = 0; i < count; ++i)
+		{
+			const Vec2 pos{ ((i % 100) * 8), ((i / 100) * 6) };
+			const ColorF color = HSV{ (i % 360) };
+
+			switch (i % 3)
+			{
+			case 0:
+				onCircle(Circle{ pos, 3 }, color);
+				break;
+			case 1:
+				onRoundRect(RoundRect{ pos, 6, 4, 1.5 }, color);
+				break;
+			default:
+				onLine(Line{ pos, (pos + Vec2{ 6, 4 }) }, color);
+				break;
+			}
+		}
+	}
+}
+
+TEST_CASE("StaticGeometry2D")
+{
+	constexpr int32 N = 10000;
+
+	System::Update();
+
+	ForEachStaticShape(N,
+		[](const Circle& c, const ColorF& color) { c.draw(color); },
+		[](const RoundRect& rr, const ColorF& color) { rr.draw(color); },
+		[](const Line& line, const ColorF& color) { line.draw(2, color); });
+
+	System::Update();
+
+	const uint32 triangleCount = Profiler::GetStat().triangleCount;
+
+	StaticGeometry2D geometry;
+
+	ForEachStaticShape(N,
+		[&](const Circle& c, const ColorF& color) { geometry.addCircle(c, color); },
+		[&](const RoundRect& rr, const ColorF& color) { geometry.addRoundRect(rr, color); },
+		[&](const Line& line, const ColorF& color) { geometry.addLine(line, 2, color); });
+
+	REQUIRE(geometry.num_triangles() == triangleCount);
+
+	geometry.draw();
+
+	System::Update();
+
+	// 個別に描いた場合と同じ三角形が描かれる
+	REQUIRE(Profiler::GetStat().triangleCount == triangleCount);
+
+	geometry.clear();
+	REQUIRE(geometry.isEmpty());
+}
+
+TEST_CASE("StaticGeometry2D : spill")
+{
+	// 長方形 10,920 個で 1 つ目の Buffer2D のインデックス（上限 65,535）を 65,520 まで埋める
+	constexpr int32 N = 10920;
+
+	const Line line{ 100, 100, 300, 200 };
+
+	StaticGeometry2D single;
+	single.addLine(LineStyle::RoundCap, line, 40, Palette::Orange);
+
+	StaticGeometry2D geometry;
+
+	for (int32 i = 0; i < N; ++i)
+	{
+		geometry.addRect(RectF{ (i % 100), (i / 100), 1 }, Palette::White);
+	}
+
+	REQUIRE(geometry.num_triangles() == (N * 2));
+
+	// 丸い端の線分は、線分本体・始点の半円・終点の半円の 3 回に分けて書き込み先を要求する。
+	// 線分本体は 1 つ目の Buffer2D に収まり、半円は新しい Buffer2D に書き込まれる
+	geometry.addLine(LineStyle::RoundCap, line, 40, Palette::Orange);
+
+	REQUIRE(geometry.num_triangles() == ((N * 2) + single.num_triangles()));
+
+	System::Update();
+
+	for (int32 i = 0; i < N; ++i)
+	{
+		RectF{ (i % 100), (i / 100), 1 }.draw();
+	}
+
+	line.draw(LineStyle::RoundCap, 40, Palette::Orange);
+
+	System::Update();
+
+	const uint32 triangleCount = Profiler::GetStat().triangleCount;
+	REQUIRE(geometry.num_triangles() == triangleCount);
+
+	geometry.draw();
+
+	System::Update();
+
+	REQUIRE(Profiler::GetStat().triangleCount == triangleCount);
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("StaticGeometry2D : benchmark")
+{
+	constexpr int32 N = 10000;
+
+	StaticGeometry2D geometry;
+
+	ForEachStaticShape(N,
+		[&](const Circle& c, const ColorF& color) { geometry.addCircle(c, color); },
+		[&](const RoundRect& rr, const ColorF& color) { geometry.addRoundRect(rr, color); },
+		[&](const Line& line, const ColorF& color) { geometry.addLine(line, 2, color); });
+
+	BENCHMARK("Static scene x 10000 : draw()")
+	{
+		ForEachStaticShape(N,
+			[](const Circle& c, const ColorF& color) { c.draw(color); },
+			[](const RoundRect& rr, const ColorF& color) { rr.draw(color); },
+			[](const Line& line, const ColorF& color) { line.draw(2, color); });
+
+		Graphics2D::Flush();
+	};
+
+	BENCHMARK("Static scene x 10000 : StaticGeometry2D::draw()")
+	{
+		geometry.draw();
+		Graphics2D::Flush();
+	};
+
+	BENCHMARK("Static scene x 10000 : StaticGeometry2D::draw(transform, colorMul)")
+	{
+		geometry.draw(Mat3x2::Translate(10, 10), ColorF{ 0.5 });
+		Graphics2D::Flush();
+	};
+}
+
+# endif
@@ -1416,4 +1416,87 @@ TEST_CASE("TextReader::readAll(String&) | LONG")
 	}
 }
 
+TEST_CASE("TextReader : large input")
+{
+	// 内部のバッファサイズをまたぐ長さのテキスト
+	std::string text;
+	Array<String> expected;
+
+	for (int32 i = 0; i < 20000; ++i)
+	{
+		const String line = U"{} OpenSiv3D あいうえお 😀"_fmt(i);
+		text += Unicode::ToUTF8(line);
+		text += ((i % 2) ? "\r\n" : "\n");
+		expected << line;
+	}
+
+	SECTION("readLine")
+	{
+		TextReader reader{ MemoryViewReader{ text.data(), text.size() }, TextEncoding::UTF8_NO_BOM };
+		String line;
+		size_t count = 0;
+		while (reader.readLine(line))
+		{
+			REQUIRE(line == expected[count]);
+			++count;
+		}
+		REQUIRE(count == expected.size());
+	}
+
+	SECTION("readLines")
+	{
+		TextReader reader{ MemoryViewReader{ text.data(), text.size() }, TextEncoding::UTF8_NO_BOM };
+		REQUIRE(reader.readLines() == expected);
+	}
+
+	SECTION("readAll")
+	{
+		TextReader reader{ MemoryViewReader{ text.data(), text.size() }, TextEncoding::UTF8_NO_BOM };
+		REQUIRE(reader.readAll() == (expected.join(U"\n", U"", U"") + U"\n"));
+	}
+}
+
+# if defined(SIV3D_RUN_BENCHMARK)
+
+TEST_CASE("TextReader : benchmark")
+{
+	const auto makeText = [](const StringView line)
+	{
+		std::string text;
+		const std::string utf8 = Unicode::ToUTF8(line);
+		while (text.size() < (16 * 1024 * 1024))
+		{
+			text += utf8;
+			text += '\n';
+		}
+		return text;
+	};
+
+	const std::string ascii = makeText(U"The quick brown fox jumps over the lazy dog. 0123456789");
+	const std::string japanese = makeText(U"いろはにほへと ちりぬるを わかよたれそ つねならむ");
+	const std::string mixed = makeText(U"Siv3D は C++20 で 2D/3D ゲーム 😀 を作れる framework です");
+
+	for (const auto& [label, text] : { std::pair{ "ASCII", &ascii }, std::pair{ "Japanese", &japanese }, std::pair{ "Mixed", &mixed } })
+	{
+		BENCHMARK(std::string{ "Unicode::FromUTF8() | 16MB " } + label)
+		{
+			return Unicode::FromUTF8(*text).size();
+		};
+
+		BENCHMARK(std::string{ "TextReader::readAll() | 16MB " } + label)
+		{
+			TextReader reader{ MemoryViewReader{ text->data(), text->size() }, TextEncoding::UTF8_NO_BOM };
+			return reader.readAll().size();
+		};
+
+		BENCHMARK(std::string{ "TextReader::readLines() | 16MB " } + label)
+		{
+			TextReader reader{ MemoryViewReader{ text->data(), text->size() }, TextEncoding::UTF8_NO_BOM };
+			return reader.readLines().size();
+		};
+	}
+}
+
+# endif
+
 SIV3D_DISABLE_MSVC_WARNINGS_POP()
@@ -51,4 +51,26 @@ TEST_CASE("Unicode")
 		REQUIRE(Unicode::ToUTF32(U"OpenSiv3D") == U"OpenSiv3D");
 		REQUIRE(Unicode::ToUTF32(U"あいうえお") == U"あいうえお");
 	}
+
+	SECTION("Long mixed text")
+	{
+		// SIMD で処理されるブロック境界をまたぐ長さのテキスト
+		String s;
+		for (int32 i = 0; i < 100; ++i)
+		{
+			s += U"OpenSiv3D あいうえお 漢字テスト 😀 é ";
+		}
+
+		const std::string utf8 = Unicode::ToUTF8(s);
+		REQUIRE(Unicode::FromUTF8(utf8) == s);
+		REQUIRE(Unicode::FromUTF16(Unicode::ToUTF16(s)) == s);
+		REQUIRE(Unicode::UTF8ToUTF16(utf8) == Unicode::ToUTF16(s));
+		REQUIRE(Unicode::UTF16ToUTF32(Unicode::ToUTF16(s)) == s.toUTF32());
+	}
+
+	SECTION("Invalid UTF-8")
+	{
+		const std::string invalid = "abcdefghijklmnop\xE3\x81qrstuvwxyz\xFF\xE3\x81\x82";
+		REQUIRE(Unicode::FromUTF8(invalid) == U"abcdefghijklmnop\uFFFD\uFFFDqrstuvwxyz\uFFFDあ");
+	}
 }
@@ -0,0 +1,58 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+TEST_CASE("VirtualFileSystem")
+{
+	const FilePath directory = U"test/runtime/vfs/source/";
+	const FilePath packPath = U"test/runtime/vfs/assets.pack";
+
+	FileSystem::Remove(U"test/runtime/vfs/");
+	TextWriter{ directory + U"a.txt" }.write(U"Siv3D");
+	TextWriter{ directory + U"data/b.txt" }.write(U"VirtualFileSystem");
+
+	REQUIRE(VirtualFileSystem::CreatePack(directory, packPath));
+	REQUIRE(VirtualFileSystem::Mount(packPath, U"assets"));
+	REQUIRE(VirtualFileSystem::IsMounted(packPath));
+
+	SECTION("FileSystem queries")
+	{
+		REQUIRE(VirtualFileSystem::Exists(U"assets/data/b.txt"));
+		REQUIRE(FileSystem::IsFile(U"assets/data/b.txt"));
+		REQUIRE(FileSystem::IsDirectory(U"assets/data"));
+		REQUIRE(FileSystem::FileSize(U"assets/a.txt") == FileSystem::FileSize(directory + U"a.txt"));
+		REQUIRE_FALSE(FileSystem::Exists(U"assets/c.txt"));
+	}
+
+	SECTION("loading")
+	{
+		REQUIRE(TextReader{ U"assets/a.txt" }.readAll() == U"Siv3D");
+		REQUIRE(TextReader{ U"./assets/data/b.txt" }.readAll() == U"VirtualFileSystem");
+
+		const MemoryViewReader view = VirtualFileSystem::OpenView(U"assets/a.txt");
+		REQUIRE(view.isOpen());
+		REQUIRE(view.size() == FileSystem::FileSize(directory + U"a.txt"));
+	}
+
+	SECTION("later mounts take priority")
+	{
+		TextWriter{ U"test/runtime/vfs/override/a.txt" }.write(U"override");
+		REQUIRE(VirtualFileSystem::Mount(U"test/runtime/vfs/override/", U"assets"));
+		REQUIRE(TextReader{ U"assets/a.txt" }.readAll() == U"override");
+		REQUIRE(TextReader{ U"assets/data/b.txt" }.readAll() == U"VirtualFileSystem");
+		REQUIRE(VirtualFileSystem::Unmount(U"test/runtime/vfs/override/"));
+		REQUIRE(TextReader{ U"assets/a.txt" }.readAll() == U"Siv3D");
+	}
+
+	VirtualFileSystem::UnmountAll();
+	REQUIRE_FALSE(FileSystem::Exists(U"assets/a.txt"));
+}
@@ -0,0 +1,80 @@
+﻿//-----------------------------------------------
+//
+//	This file is part of the Siv3D Engine.
+//
+//	Copyright (c) 2008-2023 Ryo Suzuki
+//	Copyright (c) 2016-2023 OpenSiv3D Project
+//
+//	Licensed under the MIT License.
+//
+//-----------------------------------------------
+
+# include "Siv3DTest.hpp"
+
+namespace
+{
+	[[nodiscard]]
+	std::string MakeZIPTestText()
+	{
+		std::string text;
+
+		for (int32 i = 0; i < 1000; ++i)
+		{
+			text += fmt::format("Siv3D {:05d}\n", i);
+		}
+
+		return text;
+	}
+}
+
+TEST_CASE("ZIPReader::openEntry")
+{
+	const std::string text = MakeZIPTestText();
+
+	ZIPReader zip{ U"test/zip/entries.zip" };
+	REQUIRE(zip.isOpen());
+
+	SECTION("stored and deflated entries")
+	{
+		for (const auto& name : { U"stored.txt"_sv, U"deflated.txt"_sv })
+		{
+			ZIPEntryReader reader = zip.openEntry(name);
+			REQUIRE(reader.isOpen());
+			REQUIRE(reader.size() == static_cast<int64>(text.size()));
+			REQUIRE(reader.isCompressed() == (name == U"deflated.txt"));
+
+			std::string buffer(text.size(), '\0');
+			REQUIRE(reader.read(buffer.data(), 7000) == 7000);
+			REQUIRE(reader.read(buffer.data() + 7000, 100000) == static_cast<int64>(text.size() - 7000));
+			REQUIRE(buffer == text);
+
+			// 後方へのシーク
+			char line[12] = {};
+			REQUIRE(reader.read(line, 120, 11) == 11);
+			REQUIRE(std::string(line, 11) == "Siv3D 00010");
+			REQUIRE(reader.getPos() == 131);
+		}
+	}
+
+	SECTION("empty entry")
+	{
+		ZIPEntryReader reader = zip.openEntry(U"dir/empty.txt");
+		REQUIRE(reader.isOpen());
+		REQUIRE(reader.size() == 0);
+	}
+
+	SECTION("missing entry")
+	{
+		REQUIRE_FALSE(zip.openEntry(U"missing.txt").isOpen());
+	}
+
+	SECTION("entry outlives ZIPReader")
+	{
+		ZIPEntryReader reader = zip.openEntry(U"deflated.txt");
+		zip.close();
+
+		std::string buffer(text.size(), '\0');
+		REQUIRE(reader.read(buffer.data(), buffer.size()) == static_cast<int64>(text.size()));
+		REQUIRE(buffer == text);
+	}
+}